@@ -0,0 +1,51 @@
+#include <cstdint>
+#include <vector>
+
+#include "../veil/dispatcher.hpp"
+#include "test.hpp"
+
+using namespace interpreter;
+using namespace std;
+
+// Fused ops run the ops they stand for, so fusing changes no result; every fixed sequence is in
+// the count down below, the random loops add the generated ones they happen to hold
+
+static vector<uint8_t> make_count_down()
+{
+	test::builder b;
+	const op_asm::label head = b.make_label();
+	const op_asm::label done = b.make_label();
+	const op_asm::label even = b.make_label();
+
+	b.put(test::push(0ui64)).put(test::push(5ui64));
+	b.bind(head).put(test::load(0ui8)).put(test::push(0ui64)).put(op_asm::__ucmp<val64<>>()).jmp_e(done);
+	b.put(test::load(0ui8)).put(test::push(2ui64)).put(op_asm::__scmp<val64<>>()).jmp_b(even);
+	b.put(test::load(~0ui8)).put(test::load(~8ui8)).put(op_asm::__uadd<val64<>>()).put(test::store(~0ui8));
+	b.put(test::load(~8ui8)).put(op_asm::__uinc<val64<>>()).put(test::store(~8ui8));
+	b.bind(even).put(test::load(~0ui8)).put(test::store(~8ui8));
+	b.put(test::load(0ui8)).put(op_asm::__udec<val64<>>()).put(test::store(0ui8));
+	b.jmp(head);
+	b.bind(done).put(test::load(~0ui8)).put(test::store(8ui8)).put(op_asm::__exit<endian::native>());
+
+	return b.assemble();
+}
+
+bool test::test_fused_ops()
+{
+	auto fuse = [](const vector<uint8_t>& code, check_type)
+	{
+		vector<uint8_t> fused(code);
+
+		dispatcher::fuse_ops(fused.data(), (uint64_t)fused.size());
+		return fused;
+	};
+
+	const vector<uint64_t> args = { 0ui64, 1ui64, 3ui64, 17ui64 };
+	const vector<uint8_t> count_down = make_count_down();
+	bool ok = fuse(count_down, check_type::unchecked) != count_down && same_results(count_down, args, fuse);
+
+	for (uint64_t seed = 0ui64; seed < 64ui64; ++seed)
+		ok = ok && same_results(make_random(seed, seed % 2ui64 == 0ui64), args, fuse);
+
+	return report("fused ops", ok);
+}
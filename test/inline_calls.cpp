@@ -0,0 +1,32 @@
+#include <cstdint>
+#include <vector>
+
+#include "../veil/compiler.hpp"
+#include "test.hpp"
+
+using namespace interpreter;
+using namespace std;
+
+// Inlined calls give the results of the calls they replace
+
+bool test::test_inline_calls()
+{
+	auto inline_calls = [](const vector<uint8_t>& code, check_type)
+	{
+		return compiler::inliner(code.data(), (uint64_t)code.size()).get_code();
+	};
+
+	const vector<uint64_t> args = { 0ui64, 1ui64, 3ui64, 17ui64 };
+	bool changed = false;
+	bool ok = true;
+
+	for (uint64_t seed = 0ui64; seed < 64ui64; ++seed)
+	{
+		const vector<uint8_t> code = make_random(seed, true);
+
+		changed = changed || compiler::inliner(code.data(), (uint64_t)code.size()).get_inlined() != 0ui64;
+		ok = ok && same_results(code, args, inline_calls);
+	}
+
+	return report("inline calls", ok && changed);
+}
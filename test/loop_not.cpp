@@ -0,0 +1,88 @@
+#include <cstdint>
+#include <vector>
+
+#include "../veil/compiler.hpp"
+#include "../veil/interpreter.hpp"
+#include "test.hpp"
+
+using namespace interpreter;
+using namespace std;
+using namespace test;
+
+// A not of a slot stored in the loop is neither invariant nor linear, the loop optimizer hoists
+// none of the values computed from it
+
+// acc ~0, c ~8, x ~16, i ~24, for i in [0, n) x = x * 3 + 1, acc += c * 2 + ~x + step * i
+
+static vector<uint8_t> make(uint64_t step)
+{
+	builder b;
+	const op_asm::label head = b.make_label();
+	const op_asm::label done = b.make_label();
+
+	b.put(push(0ui64)).put(push(21ui64)).put(push(5ui64)).put(push(0ui64));
+	b.bind(head).put(load(~24ui8)).put(load(0ui8)).put(op_asm::__ucmp<val64<>>()).jmp_e(done);
+	b.put(load(~16ui8)).put(push(3ui64)).put(op_asm::__umul<val64<>>()).put(push(1ui64)).put(op_asm::__uadd<val64<>>()).put(store(~16ui8));
+	b.put(load(~0ui8)).put(load(~8ui8)).put(push(2ui64)).put(op_asm::__umul<val64<>>()).put(load(~16ui8)).put(op_asm::__not<val64<>>())
+		.put(op_asm::__uadd<val64<>>());
+
+	if (step != 0ui64)
+		b.put(load(~24ui8)).put(push(step)).put(op_asm::__umul<val64<>>()).put(op_asm::__uadd<val64<>>());
+
+	b.put(op_asm::__uadd<val64<>>()).put(store(~0ui8));
+	b.put(load(~24ui8)).put(push(1ui64)).put(op_asm::__uadd<val64<>>()).put(store(~24ui8));
+	b.jmp(head);
+	b.bind(done).put(load(~0ui8)).put(store(8ui8)).put(op_asm::__exit<endian::native>());
+
+	return b.assemble();
+}
+
+static uint64_t expect(uint64_t step, uint64_t n)
+{
+	uint64_t acc = 0ui64;
+	uint64_t x = 5ui64;
+
+	for (uint64_t i = 0ui64; i != n; ++i)
+	{
+		x = x * 3ui64 + 1ui64;
+		acc += 21ui64 * 2ui64 + ~x + step * i;
+	}
+
+	return acc;
+}
+
+static bool check(const char* name, uint64_t step)
+{
+	const vector<uint8_t> code = make(step);
+	const compiler::loop_optimizer optimized(code.data(), (uint64_t)code.size(), check_type::unchecked);
+	const vector<uint8_t>& loop = optimized.get_code();
+	bool ok = true;
+
+	for (check_type chk_type : check_types)
+	{
+		::interpreter::interpreter plain(code.data(), (uint64_t)code.size(), 16ui64, 1ui64 << 16ui64, endian::native,
+			dispatch_type::switched, chk_type);
+		::interpreter::interpreter hoisted(loop.data(), (uint64_t)loop.size(), 16ui64, 1ui64 << 16ui64, endian::native,
+			dispatch_type::switched, chk_type);
+
+		for (uint64_t n : { 0ui64, 1ui64, 2ui64, 10ui64, 1000ui64 })
+		{
+			const uint64_t want = expect(step, n);
+
+			ok = ok && plain.execute<val64<>>(val64<>(n)).ui == want;
+			ok = ok && hoisted.execute<val64<>>(val64<>(n)).ui == want;
+		}
+	}
+
+	return report(name, ok);
+}
+
+bool test::test_loop_not()
+{
+	bool ok = true;
+
+	ok = check("not of a stored slot", 0ui64) && ok;
+	ok = check("not of a stored slot plus the induction variable", 4ui64) && ok;
+
+	return ok;
+}
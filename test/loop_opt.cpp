@@ -0,0 +1,32 @@
+#include <cstdint>
+#include <vector>
+
+#include "../veil/compiler.hpp"
+#include "test.hpp"
+
+using namespace interpreter;
+using namespace std;
+
+// Hoisted and strength reduced slots give the results of the ops they replace
+
+bool test::test_loop_opt()
+{
+	auto optimize = [](const vector<uint8_t>& code, check_type chk_type)
+	{
+		return compiler::loop_optimizer(code.data(), (uint64_t)code.size(), chk_type).get_code();
+	};
+
+	const vector<uint64_t> args = { 0ui64, 1ui64, 3ui64, 17ui64 };
+	bool changed = false;
+	bool ok = true;
+
+	for (uint64_t seed = 0ui64; seed < 1024ui64; ++seed)
+	{
+		const vector<uint8_t> code = make_random(seed, false);
+
+		changed = changed || !compiler::loop_optimizer(code.data(), (uint64_t)code.size(), check_type::unchecked).get_loops().empty();
+		ok = ok && same_results(code, args, optimize);
+	}
+
+	return report("loop optimizer", ok && changed);
+}
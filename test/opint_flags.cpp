@@ -0,0 +1,93 @@
+#include <cstdint>
+#include <vector>
+
+#include "../veil/interpreter.hpp"
+#include "test.hpp"
+
+using namespace interpreter;
+using namespace std;
+using namespace test;
+
+// Overflow flags stay observable through jmp_msk wherever the dispatch loop runs opint checks, so
+// no pass folds, drops or hoists an op setting them for such code
+
+static constexpr uint64_t iovf_mask = 0x0202020202020202ui64;
+
+// Returns 1 when the overflow flag is set at the end, 0 otherwise
+
+static void flag_exit(builder& b)
+{
+	const op_asm::label set = b.make_label();
+
+	b.jmp_msk(set, iovf_mask, type::v1);
+	b.put(push(0ui64)).put(store(8ui8)).put(op_asm::__exit<endian::native>());
+	b.bind(set).put(push(1ui64)).put(store(8ui8)).put(op_asm::__exit<endian::native>());
+}
+
+// ~0 + 1 folds to 0 and ~0 * 2 to a shift without opint checks only
+
+static vector<uint8_t> make_fold(bool mul)
+{
+	builder b;
+
+	b.put(push(~0ui64)).put(push(mul ? 2ui64 : 1ui64));
+
+	if (mul)
+		b.put(op_asm::__umul<val64<>>());
+	else
+		b.put(op_asm::__uadd<val64<>>());
+
+	b.put(op_asm::__pop<val64<>>());
+	flag_exit(b);
+
+	return b.assemble();
+}
+
+// c ~0, d ~8, i ~16, for i in [0, n) i += 1 and (c + d) ^ c is dropped; the invariant c + d
+// overflows and is hoisted without opint checks only
+
+static vector<uint8_t> make_loop()
+{
+	builder b;
+	const op_asm::label head = b.make_label();
+	const op_asm::label done = b.make_label();
+
+	b.put(push(~0ui64)).put(push(1ui64)).put(push(0ui64));
+	b.bind(head).put(load(~16ui8)).put(load(0ui8)).put(op_asm::__ucmp<val64<>>()).jmp_e(done);
+	b.put(load(~16ui8)).put(push(1ui64)).put(op_asm::__uadd<val64<>>()).put(store(~16ui8));
+	b.put(load(~0ui8)).put(load(~8ui8)).put(op_asm::__uadd<val64<>>()).put(load(~0ui8)).put(op_asm::__xor<val64<>>())
+		.put(op_asm::__pop<val64<>>());
+	b.jmp(head);
+	b.bind(done);
+	flag_exit(b);
+
+	return b.assemble();
+}
+
+static bool check(const char* name, const vector<uint8_t>& code, uint64_t n)
+{
+	bool ok = true;
+
+	for (check_type chk_type : check_types)
+	{
+		const uint64_t want = has_opint_check(chk_type) ? 1ui64 : run(code, n, dispatch_type::switched, chk_type);
+		::interpreter::interpreter optimized(code.data(), (uint64_t)code.size(), 16ui64, 1ui64 << 16ui64, endian::native,
+			dispatch_type::switched, chk_type);
+
+		ok = ok && run(code, n, dispatch_type::switched, chk_type) == want;
+		ok = ok && optimized.execute<val64<>>(val64<>(n)).ui == want;
+	}
+
+	return report(name, ok);
+}
+
+bool test::test_opint_flags()
+{
+	bool ok = true;
+
+	ok = check("uadd folded", make_fold(false), 0ui64) && ok;
+	ok = check("umul by 2 turned into a shift", make_fold(true), 0ui64) && ok;
+	ok = check("uadd hoisted from a loop", make_loop(), 4ui64) && ok;
+
+	return ok;
+}
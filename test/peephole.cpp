@@ -0,0 +1,32 @@
+#include <cstdint>
+#include <vector>
+
+#include "../veil/compiler.hpp"
+#include "test.hpp"
+
+using namespace interpreter;
+using namespace std;
+
+// The peephole optimizer leaves results as they are for either check type
+
+bool test::test_peephole()
+{
+	auto optimize = [](const vector<uint8_t>& code, check_type chk_type)
+	{
+		return compiler::optimizer(code.data(), (uint64_t)code.size(), chk_type).get_code();
+	};
+
+	const vector<uint64_t> args = { 0ui64, 1ui64, 3ui64, 17ui64 };
+	bool changed = false;
+	bool ok = true;
+
+	for (uint64_t seed = 0ui64; seed < 64ui64; ++seed)
+	{
+		const vector<uint8_t> code = make_random(seed, seed % 2ui64 == 0ui64);
+
+		changed = changed || optimize(code, check_type::unchecked) != code;
+		ok = ok && same_results(code, args, optimize);
+	}
+
+	return report("peephole", ok && changed);
+}
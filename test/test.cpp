@@ -0,0 +1,162 @@
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "../veil/dispatcher.hpp"
+#include "test.hpp"
+
+using namespace interpreter;
+using namespace std;
+
+uint64_t test::run(const vector<uint8_t>& code, uint64_t arg, dispatch_type disp_type, check_type chk_type)
+{
+	dispatcher disp(code.data(), (uint64_t)code.size(), 16ui64, 1ui64 << 16ui64, disp_type, chk_type);
+
+	disp.push_val(val64<>());
+	disp.push_val(val64<>(arg));
+	disp.init();
+	disp.loop();
+	disp.exit();
+	disp.pop_val<val64<>>();
+
+	return disp.pop_val<val64<>>().ui;
+}
+
+// Slots s0 to s3 are at ~0 to ~24 and the induction variable at ~32, the round count is the
+// argument at 0 and the result at 8
+
+vector<uint8_t> test::make_random(uint64_t seed, bool calls)
+{
+	static constexpr uint64_t constants[] = { 0ui64, 1ui64, 2ui64, 3ui64, 8ui64, 0x55ui64, ~0ui64 };
+
+	mt19937_64 gen(seed);
+	builder b;
+	const op_asm::label head = b.make_label();
+	const op_asm::label done = b.make_label();
+	const op_asm::label f = b.make_label();
+	const op_asm::label g = b.make_label();
+
+	auto pick = [&](uint64_t count) -> uint64_t
+	{
+		return gen() % count;
+	};
+
+	auto expr = [&](auto& self, uint64_t depth) -> void
+	{
+		const uint64_t kind = depth == 0ui64 ? pick(3ui64) : pick(8ui64);
+
+		switch (kind)
+		{
+		case 0ui64:
+			b.put(load((uint8_t)~(pick(5ui64) * 8ui64)));
+			break;
+
+		case 1ui64:
+			b.put(load(0ui8));
+			break;
+
+		case 2ui64:
+			b.put(push(pick(4ui64) == 0ui64 ? gen() : constants[pick(sizeof(constants) / sizeof(constants[0]))]));
+			break;
+
+		case 3ui64:
+		{
+			static constexpr op unary[] = { op::not_64, op::neg_64, op::uinc_64, op::udec_64 };
+
+			self(self, depth - 1ui64);
+			b.put(array<uint8_t, 1ui64>{ (uint8_t)unary[pick(4ui64)] });
+			break;
+		}
+
+		case 4ui64:
+		{
+			self(self, depth - 1ui64);
+			b.put(op_asm::__push<val8<>>(val8<>((uint8_t)pick(64ui64))));
+			b.put(array<uint8_t, 1ui64>{ (uint8_t)(pick(2ui64) == 0ui64 ? op::ushl_64 : op::ushr_64) });
+			break;
+		}
+
+		case 5ui64:
+			if (calls)
+			{
+				self(self, depth - 1ui64);
+				b.call(pick(2ui64) == 0ui64 ? f : g);
+				break;
+			}
+
+			[[fallthrough]];
+
+		default:
+		{
+			static constexpr op binary[] = { op::uadd_64, op::usub_64, op::umul_64, op::and_64, op::or_64, op::xor_64 };
+
+			self(self, depth - 1ui64);
+			self(self, depth - 1ui64);
+			b.put(array<uint8_t, 1ui64>{ (uint8_t)binary[pick(6ui64)] });
+			break;
+		}
+		}
+	};
+
+	for (uint64_t i = 0ui64; i < 4ui64; ++i)
+		b.put(push(gen()));
+
+	b.put(push(0ui64));
+	b.bind(head).put(load(~32ui8)).put(load(0ui8)).put(op_asm::__ucmp<val64<>>()).jmp_e(done);
+
+	for (uint64_t count = 1ui64 + pick(4ui64), i = 0ui64; i < count; ++i)
+	{
+		const uint8_t slot = (uint8_t)~(pick(4ui64) * 8ui64);
+
+		if (pick(8ui64) == 0ui64)
+			b.put(load(slot)).put(store(slot));
+		else if (pick(4ui64) == 0ui64)
+		{
+			const op_asm::label skip = b.make_label();
+
+			b.put(load(slot)).put(push(1ui64)).put(op_asm::__and<val64<>>()).put(push(0ui64)).put(op_asm::__ucmp<val64<>>()).jmp_e(skip);
+			expr(expr, 1ui64 + pick(3ui64));
+			b.put(store(slot));
+			b.bind(skip);
+		}
+		else
+		{
+			expr(expr, 1ui64 + pick(3ui64));
+			b.put(store(slot));
+		}
+	}
+
+	if (pick(2ui64) == 0ui64)
+		b.put(load(~32ui8)).put(push(1ui64)).put(op_asm::__uadd<val64<>>()).put(store(~32ui8));
+	else
+		b.put(load(~32ui8)).put(op_asm::__uinc<val64<>>()).put(store(~32ui8));
+
+	b.jmp(head);
+	b.bind(done).put(load(~0ui8)).put(load(~8ui8)).put(op_asm::__xor<val64<>>()).put(load(~16ui8)).put(op_asm::__xor<val64<>>())
+		.put(load(~24ui8)).put(op_asm::__xor<val64<>>()).put(store(8ui8)).put(op_asm::__exit<endian::native>());
+
+	// f(x) = x * 3 + 1, g(x) keeps x + 7 in a local and returns it xored with x << 1
+
+	b.bind(f).put(load(0ui8)).put(push(3ui64)).put(op_asm::__umul<val64<>>()).put(push(1ui64)).put(op_asm::__uadd<val64<>>())
+		.put(store(0ui8)).put(op_asm::__ret());
+	b.bind(g).put(load(0ui8)).put(push(7ui64)).put(op_asm::__uadd<val64<>>()).put(load(~0ui8))
+		.put(load(0ui8)).put(op_asm::__push<val8<>>(val8<>(1ui8))).put(op_asm::__ushl<val64<>>()).put(op_asm::__xor<val64<>>())
+		.put(store(0ui8)).put(op_asm::__ret());
+
+	return b.assemble();
+}
+
+int main()
+{
+	bool ok = true;
+
+	ok = test::test_verify_truncated() && ok;
+	ok = test::test_fused_ops() && ok;
+	ok = test::test_peephole() && ok;
+	ok = test::test_inline_calls() && ok;
+	ok = test::test_loop_opt() && ok;
+	ok = test::test_loop_not() && ok;
+	ok = test::test_opint_flags() && ok;
+
+	return ok ? 0 : 1;
+}
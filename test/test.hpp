@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "../veil/interpreter_type.hpp"
+#include "../veil/op_asm.hpp"
+
+namespace test
+{
+	typedef op_asm::builder<> builder;
+
+	static constexpr interpreter::dispatch_type dispatch_types[] =
+	{
+		interpreter::dispatch_type::switched,
+		interpreter::dispatch_type::threaded,
+		interpreter::dispatch_type::decoded,
+		interpreter::dispatch_type::cached,
+		interpreter::dispatch_type::registered,
+		interpreter::dispatch_type::jitted,
+		interpreter::dispatch_type::patched,
+		interpreter::dispatch_type::traced
+	};
+
+	static constexpr interpreter::check_type check_types[] =
+	{
+		interpreter::check_type::unchecked,
+		interpreter::check_type::checked
+	};
+
+	inline auto push(uint64_t value)
+	{
+		return op_asm::__push<interpreter::val64<>>(interpreter::val64<>(value));
+	}
+
+	inline auto load(uint8_t address)
+	{
+		return op_asm::__s_load<interpreter::val64<>>(interpreter::val8<>(address));
+	}
+
+	inline auto store(uint8_t address)
+	{
+		return op_asm::__s_store<interpreter::val64<>>(interpreter::val8<>(address));
+	}
+
+	// run - result of code taking and returning a val64, run as it is by the dispatcher so none
+	//       of the passes of the interpreter touch it
+
+	uint64_t run(const std::vector<uint8_t>& code, uint64_t arg, interpreter::dispatch_type disp_type,
+		interpreter::check_type chk_type);
+
+	// make_random - counted loop over four slots, each round stores random expressions of the
+	//               slots, the induction variable and constants to them, with calls when asked;
+	//               the code takes the round count and returns the slots xored
+
+	std::vector<uint8_t> make_random(uint64_t seed, bool calls);
+
+	// same_results - code and code taken through pass, which gets the code and the check type,
+	//                give the same result on every dispatch type, check type and argument
+
+	template <typename PASS>
+	bool same_results(const std::vector<uint8_t>& code, const std::vector<uint64_t>& args, PASS pass)
+	{
+		for (interpreter::check_type chk_type : check_types)
+		{
+			const std::vector<uint8_t> passed = pass(code, chk_type);
+
+			for (interpreter::dispatch_type disp_type : dispatch_types)
+				for (uint64_t arg : args)
+					if (run(code, arg, disp_type, chk_type) != run(passed, arg, disp_type, chk_type))
+						return false;
+		}
+
+		return true;
+	}
+
+	inline bool report(const char* name, bool ok)
+	{
+		std::cout << name << (ok ? ": ok" : ": FAIL") << std::endl;
+
+		return ok;
+	}
+
+	bool test_fused_ops();
+	bool test_inline_calls();
+	bool test_loop_not();
+	bool test_loop_opt();
+	bool test_opint_flags();
+	bool test_peephole();
+	bool test_verify_truncated();
+}
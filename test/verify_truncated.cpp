@@ -0,0 +1,51 @@
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "../veil/interpreter.hpp"
+#include "../veil/verify.hpp"
+#include "test.hpp"
+
+using namespace interpreter;
+using namespace std;
+
+// Ops cut off by the code end are never proven, the verifier reads none of their operands and
+// checked code running into them throws instead of running them unchecked
+
+static bool check(const char* name, const vector<uint8_t>& code)
+{
+	const verified_code verified(code.data(), code.data() + (ptrdiff_t)code.size());
+	bool ok = !verified.is_whole();
+
+	for (uint64_t i = 0ui64; i < (uint64_t)code.size(); ++i)
+		ok = ok && !verified.is_safe(code.data() + (ptrdiff_t)i);
+
+	bool thrown = false;
+
+	try
+	{
+		::interpreter::interpreter checked(code.data(), (uint64_t)code.size(), 16ui64, 1ui64 << 16ui64, endian::native,
+			dispatch_type::switched, check_type::checked);
+
+		checked.execute<VOID>();
+	}
+	catch (const exception&)
+	{
+		thrown = true;
+	}
+
+	return test::report(name, ok && thrown);
+}
+
+bool test::test_verify_truncated()
+{
+	bool ok = true;
+
+	ok = check("nop, s_alloc", { (uint8_t)op::nop, (uint8_t)op::s_alloc }) && ok;
+	ok = check("s_alloc", { (uint8_t)op::s_alloc }) && ok;
+	ok = check("nop, push_64", { (uint8_t)op::nop, (uint8_t)op::push_64, 0ui8, 0ui8 }) && ok;
+	ok = check("nop, jmp_32", { (uint8_t)op::nop, (uint8_t)op::jmp_32, 0ui8 }) && ok;
+	ok = check("nop, s_load_64", { (uint8_t)op::nop, (uint8_t)op::s_load_64 }) && ok;
+
+	return ok;
+}
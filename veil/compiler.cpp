@@ -1,4 +1,2146 @@
 #include "compiler.hpp"
 
+#ifdef X64JIT
+#include <elf.h>
+#endif
+
 using namespace compiler;
-using namespace std;
\ No newline at end of file
+using namespace interpreter;
+using namespace std;
+
+struct op_call
+{
+	const char* name;
+	const char* call;
+	const char* args;
+};
+
+// Families from jmp_64 on come in 64, 32, 16, 8 variants, float ones from fneg_64 on in 64, 32
+
+static constexpr op_call _calls_4[] =
+{
+	{ "jmp", "__dil_jmp", "(opptr)" },
+	{ "jmp_a", "__dil_jmp_a", "(opptr, state)" },
+	{ "jmp_ae", "__dil_jmp_ae", "(opptr, state)" },
+	{ "jmp_b", "__dil_jmp_b", "(opptr, state)" },
+	{ "jmp_be", "__dil_jmp_be", "(opptr, state)" },
+	{ "jmp_e", "__dil_jmp_e", "(opptr, state)" },
+	{ "jmp_ne", "__dil_jmp_ne", "(opptr, state)" },
+	{ "jmp_un", "__dil_jmp_un", "(opptr, state)" },
+	{ "jmp_msk", "__dil_jmp_msk", "(opptr, state)" },
+	{ "l_load", "__dil_l_load", "(opptr, ftop, stop)" },
+	{ "l_store", "__dil_l_store", "(opptr, ftop, stop)" },
+	{ "s_load", "__dil_s_load", "(opptr, ftop, stop)" },
+	{ "s_store", "__dil_s_store", "(opptr, ftop, stop)" },
+	{ "push", "__dil_push", "(opptr, stop)" },
+	{ "pop", "stack_type::dil_rem", "(stop)" },
+	{ "dup", "stack_type::dil_dup", "(stop)" },
+	{ "ptrcpy", "__dil_ptrcpy", "(stop)" },
+	{ "ptrget", "__dil_ptrget", "(stop)" },
+	{ "ptrset", "__dil_ptrset", "(stop)" },
+	{ "neg", "__dil_neg", "(state, stop)" },
+	{ "not", "__dil_not", "(stop)" },
+	{ "sinc", "__dil_sinc", "(state, stop)" },
+	{ "uinc", "__dil_uinc", "(state, stop)" },
+	{ "sdec", "__dil_sdec", "(state, stop)" },
+	{ "udec", "__dil_udec", "(state, stop)" },
+	{ "and", "__dil_and", "(stop)" },
+	{ "or", "__dil_or", "(stop)" },
+	{ "xor", "__dil_xor", "(stop)" },
+	{ "sadd", "__dil_sadd", "(state, stop)" },
+	{ "uadd", "__dil_uadd", "(state, stop)" },
+	{ "ssub", "__dil_ssub", "(state, stop)" },
+	{ "usub", "__dil_usub", "(state, stop)" },
+	{ "smul", "__dil_smul", "(state, stop)" },
+	{ "umul", "__dil_umul", "(state, stop)" },
+	{ "smod", "__dil_smod", "(state, stop)" },
+	{ "umod", "__dil_umod", "(state, stop)" },
+	{ "sdiv", "__dil_sdiv", "(state, stop)" },
+	{ "udiv", "__dil_udiv", "(state, stop)" },
+	{ "scmp", "__dil_scmp", "(state, stop)" },
+	{ "ucmp", "__dil_ucmp", "(state, stop)" },
+	{ "rotl", "__dil_rotl", "(stop)" },
+	{ "rotr", "__dil_rotr", "(stop)" },
+	{ "sshl", "__dil_sshl", "(stop)" },
+	{ "ushl", "__dil_ushl", "(stop)" },
+	{ "sshr", "__dil_sshr", "(stop)" },
+	{ "ushr", "__dil_ushr", "(stop)" },
+};
+
+static constexpr op_call _calls_2[] =
+{
+	{ "fneg", "__dil_fneg", "(stop)" },
+	{ "fevl", "__dil_fevl", "(state, stop)" },
+	{ "fadd", "__dil_fadd", "(stop)" },
+	{ "fsub", "__dil_fsub", "(stop)" },
+	{ "fmul", "__dil_fmul", "(stop)" },
+	{ "fmod", "__dil_fmod", "(stop)" },
+	{ "fdiv", "__dil_fdiv", "(stop)" },
+	{ "fcmp", "__dil_fcmp", "(state, stop)" },
+};
+
+static constexpr const char* _widths[] = { "64", "32", "16", "8" };
+static constexpr const char* _values[] = { "val64<>", "val32<>", "val16<>", "val8<>" };
+
+static_assert((uint64_t)op::jmp_64 + (uint64_t)size(_calls_4) * 4ui64 == (uint64_t)op::fneg_64);
+static_assert((uint64_t)op::fneg_64 + (uint64_t)size(_calls_2) * 2ui64 == (uint64_t)op::si64_2_f64);
+
+static inline const op_call& get_call(op op_code, uint64_t& width)
+{
+	const uint64_t code = (uint64_t)op_code;
+
+	if (code < (uint64_t)op::fneg_64)
+	{
+		width = (code - (uint64_t)op::jmp_64) & 3ui64;
+		return _calls_4[(code - (uint64_t)op::jmp_64) >> 2ui64];
+	}
+	else
+	{
+		width = (code - (uint64_t)op::fneg_64) & 1ui64;
+		return _calls_2[(code - (uint64_t)op::fneg_64) >> 1ui64];
+	}
+}
+
+static inline string get_name(op op_code)
+{
+	if (op_code == op::nop)
+		return "nop";
+	else
+	{
+		uint64_t width;
+		const op_call& call = get_call(op_code, width);
+
+		return string(call.name) + "_" + _widths[width];
+	}
+}
+
+string opgen::__call(op op_code)
+{
+	uint64_t width;
+	const op_call& call = get_call(op_code, width);
+
+	return string(call.call) + "<" + _values[width] + ">" + call.args + ";";
+}
+
+bool opgen::is_straight(op op_code) noexcept
+{
+	return (uint8_t)op_code >= (uint8_t)op::l_load_64 && (uint8_t)op_code <= (uint8_t)op::fcmp_32;
+}
+
+bool opgen::is_jump(op op_code) noexcept
+{
+	return (uint8_t)op_code >= (uint8_t)op::jmp_64 && (uint8_t)op_code <= (uint8_t)op::jmp_msk_8;
+}
+
+vector<op_site> opgen::__sites(const op_profile& profile)
+{
+	const uint8_t* bcode = profile.get_code_beg();
+	const uint8_t* ecode = profile.get_code_end();
+
+	vector<op_site> sites;
+	map<const uint8_t*, uint64_t> index;
+
+	for (const uint8_t* opptr = bcode; opptr < ecode; ++opptr)
+		if (profile.get_count(opptr) != 0ui64)
+		{
+			index[opptr] = (uint64_t)sites.size();
+			sites.push_back(op_site{ {}, {}, 0ui64, profile.get_count(opptr) });
+		}
+
+	for (const auto& [opptr, i] : index)
+	{
+		op_site& site = sites[i];
+		const uint8_t* next = opptr;
+
+		while (site.length < max_length)
+		{
+			const uint64_t size = decoded_code::get_size(next, ecode);
+			const op op_code = (op)*next;
+
+			if (size == 0ui64 || !(is_straight(op_code) || is_jump(op_code)))
+				break;
+
+			const auto it = index.find(next);
+
+			site.ops[site.length] = op_code;
+			site.next[site.length++] = it == index.end() ? ~0ui64 : it->second;
+
+			if (is_jump(op_code))
+				break;
+
+			next += (ptrdiff_t)size;
+		}
+	}
+
+	return sites;
+}
+
+vector<op_sequence> opgen::count_seqs(const op_profile& profile, uint64_t length)
+{
+	if (length < 2ui64 || length > max_length)
+		throw runtime_error(_err_msg_wrong_size);
+
+	map<vector<op>, uint64_t> counts;
+
+	for (const op_site& site : __sites(profile))
+		if (site.length >= length)
+			counts[vector<op>(site.ops, site.ops + (ptrdiff_t)length)] += site.count;
+
+	vector<op_sequence> seqs;
+
+	for (const auto& [ops, count] : counts)
+		seqs.push_back(op_sequence{ ops, count });
+
+	stable_sort(seqs.begin(), seqs.end(), [](const op_sequence& a, const op_sequence& b) { return a.count > b.count; });
+
+	return seqs;
+}
+
+opgen::opgen(const op_profile& profile, uint64_t count)
+{
+	if (count > max_count)
+		throw runtime_error(_err_msg_wrong_count);
+
+	// Greedy pick by dispatches saved: a site runs the longest picked sequence it starts, and
+	// ops that sequence covers are no longer dispatched for the flow entering at the site
+
+	vector<op_site> sites = __sites(profile);
+	vector<uint64_t> length(sites.size(), 1ui64);
+
+	vector<op_sequence> cands = count_seqs(profile, 2ui64);
+	vector<op_sequence> cands_3 = count_seqs(profile, 3ui64);
+
+	cands.insert(cands.end(), cands_3.begin(), cands_3.end());
+
+	while (_seqs.size() < count)
+	{
+		const op_sequence* best = (const op_sequence*)nullptr;
+		uint64_t best_saved = 0ui64;
+
+		for (const op_sequence& cand : cands)
+		{
+			uint64_t saved = 0ui64;
+
+			for (uint64_t i = 0ui64; i < sites.size(); ++i)
+				if (sites[i].length >= cand.ops.size() && length[i] < cand.ops.size()
+					&& equal(cand.ops.begin(), cand.ops.end(), sites[i].ops))
+					saved += sites[i].count * (cand.ops.size() - length[i]);
+
+			if (saved > best_saved)
+			{
+				best = &cand;
+				best_saved = saved;
+			}
+		}
+
+		if (best == (const op_sequence*)nullptr)
+			break;
+
+		for (uint64_t i = 0ui64; i < sites.size(); ++i)
+			if (sites[i].length >= best->ops.size() && length[i] < best->ops.size()
+				&& equal(best->ops.begin(), best->ops.end(), sites[i].ops))
+			{
+				for (uint64_t j = length[i]; j < best->ops.size(); ++j)
+					if (sites[i].next[j] != ~0ui64)
+						sites[sites[i].next[j]].count -= min(sites[i].count, sites[sites[i].next[j]].count);
+
+				length[i] = best->ops.size();
+			}
+
+		_seqs.push_back(op_sequence{ best->ops, best_saved });
+	}
+
+	// fuse_ops takes the first sequence that matches, longer ones go first
+
+	stable_sort(_seqs.begin(), _seqs.end(), [](const op_sequence& a, const op_sequence& b) { return a.ops.size() > b.ops.size(); });
+}
+
+string opgen::emit_ops() const
+{
+	string out;
+
+	out += "#pragma once\n\n";
+	out += "#include <cstdint>\n\n";
+	out += "#include \"op.hpp\"\n\n";
+	out += "// Generated by compiler::opgen, do not edit\n\n";
+	out += "namespace interpreter\n{\n";
+	out += "\t// gen_ops - sequences behind gen_0 .. gen_3 in the order fuse_ops tries them, a sequence\n";
+	out += "\t//           ends at its first nop and an empty one is never fused\n\n";
+	out += "\tinline constexpr uint64_t gen_count = " + to_string(max_count) + "ui64;\n";
+	out += "\tinline constexpr uint64_t gen_length = " + to_string(max_length) + "ui64;\n\n";
+	out += "\tinline constexpr op gen_ops[gen_count][gen_length] =\n\t{\n";
+
+	for (uint64_t i = 0ui64; i < max_count; ++i)
+	{
+		out += "\t\t{ ";
+
+		for (uint64_t j = 0ui64; j < max_length; ++j)
+		{
+			const op op_code = i < _seqs.size() && j < _seqs[i].ops.size() ? _seqs[i].ops[j] : op::nop;
+			out += "op::" + get_name(op_code) + (j + 1ui64 < max_length ? ", " : " ");
+		}
+
+		out += i + 1ui64 < max_count ? "}," : "}";
+		out += i < _seqs.size() ? "\t// " + to_string(_seqs[i].count) + " dispatches saved\n" : "\n";
+	}
+
+	out += "\t};\n}";
+
+	return out;
+}
+
+string opgen::emit_handlers() const
+{
+	string out;
+
+	out += "#pragma once\n\n";
+	out += "#include \"dispatcher.hpp\"\n\n";
+	out += "// Generated by compiler::opgen, do not edit\n\n";
+	out += "namespace interpreter\n{";
+
+	for (uint64_t i = 0ui64; i < max_count; ++i)
+	{
+		out += "\n\t// gen_" + to_string(i) + " - ";
+
+		if (i < _seqs.size())
+			for (uint64_t j = 0ui64; j < _seqs[i].ops.size(); ++j)
+				out += get_name(_seqs[i].ops[j]) + (j + 1ui64 < _seqs[i].ops.size() ? ", " : "\n\n");
+		else
+			out += "reserved, fuse_ops never emits an op without a sequence and the handler only fills its\n\t//         case of the dispatch loops\n\n";
+
+		// Handlers keep the signature of the primary template whatever their sequence reads
+
+		out += "\ttemplate <>\n";
+		out += "\tinline void dispatcher::__dil_gen<" + to_string(i) + "ui64>([[maybe_unused]] const uint8_t*& opptr, [[maybe_unused]] uintptr_t& ftop,\n";
+		out += "\t\t[[maybe_unused]] uintptr_t& stop, [[maybe_unused]] state& state)\n";
+		out += "\t{\n";
+
+		if (i < _seqs.size())
+			for (uint64_t j = 0ui64; j < _seqs[i].ops.size(); ++j)
+			{
+				if (j != 0ui64)
+					out += "\t\topptr += (ptrdiff_t)sizeof(op);\n";
+
+				out += "\t\t" + __call(_seqs[i].ops[j]) + "\n";
+			}
+
+		out += "\t}\n";
+	}
+
+	out += "}";
+
+	return out;
+}
+
+// peephole_op - op the optimizer holds, ids are the original ops control flow entering here
+//               stands for, target is the original op a branch goes to or ~0
+
+struct peephole_op
+{
+	vector<uint8_t> bytes;
+	vector<uint64_t> ids;
+	uint64_t target;
+	bool entry;
+};
+
+static inline uint64_t fetch_value(const uint8_t* opptr, uint64_t width)
+{
+	switch (width)
+	{
+	case 8ui64:
+		return ((const val64<>*)opptr)->ui;
+
+	case 4ui64:
+		return (uint64_t)((const val32<>*)opptr)->ui;
+
+	case 2ui64:
+		return (uint64_t)((const val16<>*)opptr)->ui;
+
+	case 1ui64:
+		return (uint64_t)((const val8<>*)opptr)->ui;
+
+	default:
+		__assume(false);
+		break;
+	}
+}
+
+static inline void store_value(uint8_t* opptr, uint64_t width, uint64_t value)
+{
+	switch (width)
+	{
+	case 8ui64:
+		((val64<>*)opptr)->ui = value;
+		break;
+
+	case 4ui64:
+		((val32<>*)opptr)->ui = (uint32_t)value;
+		break;
+
+	case 2ui64:
+		((val16<>*)opptr)->ui = (uint16_t)value;
+		break;
+
+	case 1ui64:
+		((val8<>*)opptr)->ui = (uint8_t)value;
+		break;
+
+	default:
+		__assume(false);
+		break;
+	}
+}
+
+// Ops from jmp_64 to ushr_8 come in 64, 32, 16, 8 variants, family is the 64-bit one and width
+// the byte count of the variant, every other op is its own family of width 0
+
+static inline op get_family(op op_code, uint64_t& width) noexcept
+{
+	const uint64_t code = (uint64_t)op_code;
+
+	if (code >= (uint64_t)op::jmp_64 && code < (uint64_t)op::fneg_64)
+	{
+		width = 8ui64 >> ((code - (uint64_t)op::jmp_64) & 3ui64);
+		return (op)(code - ((code - (uint64_t)op::jmp_64) & 3ui64));
+	}
+	else
+	{
+		width = 0ui64;
+		return op_code;
+	}
+}
+
+static inline op get_variant(op family, uint64_t width) noexcept
+{
+	return (op)((uint64_t)family + 3ui64 - (uint64_t)countr_zero(width));
+}
+
+static inline bool is_push(const peephole_op& o, uint64_t& width, uint64_t& value) noexcept
+{
+	if (get_family((op)o.bytes[0ui64], width) == op::push_64)
+	{
+		value = fetch_value(o.bytes.data() + (ptrdiff_t)1, width);
+		return true;
+	}
+	else
+		return false;
+}
+
+static inline peephole_op make_op(op op_code, uint64_t width = 0ui64, uint64_t value = 0ui64)
+{
+	peephole_op o{ vector<uint8_t>(1ui64 + width, 0ui8), vector<uint64_t>(), ~0ui64, false };
+
+	o.bytes[0ui64] = (uint8_t)op_code;
+
+	if (width != 0ui64)
+		store_value(o.bytes.data() + (ptrdiff_t)1, width, value);
+
+	return o;
+}
+
+static inline uint64_t get_mask(uint64_t width) noexcept
+{
+	return width == 8ui64 ? ~0ui64 : (1ui64 << (width * 8ui64)) - 1ui64;
+}
+
+static inline int64_t get_signed(uint64_t value, uint64_t width) noexcept
+{
+	const uint64_t shift = 64ui64 - width * 8ui64;
+
+	return (int64_t)(value << shift) >> (int64_t)shift;
+}
+
+static inline bool is_shift(op family) noexcept
+{
+	return family == op::sshl_64 || family == op::ushl_64 || family == op::sshr_64 || family == op::ushr_64;
+}
+
+// Ops setting evaluation flags are folded for code without opint checks only, compares, division
+// and rotates are never folded
+
+static bool fold_binary(op family, uint64_t width, uint64_t a, uint64_t b, bool unflagged, uint64_t& value) noexcept
+{
+	switch (family)
+	{
+	case op::and_64:
+		value = a & b;
+		break;
+
+	case op::or_64:
+		value = a | b;
+		break;
+
+	case op::xor_64:
+		value = a ^ b;
+		break;
+
+	case op::sadd_64:
+	case op::uadd_64:
+		value = a + b;
+		break;
+
+	case op::ssub_64:
+	case op::usub_64:
+		value = a - b;
+		break;
+
+	case op::smul_64:
+	case op::umul_64:
+		value = a * b;
+		break;
+
+	case op::sshl_64:
+	case op::ushl_64:
+		value = a << b;
+		break;
+
+	case op::sshr_64:
+		value = (uint64_t)(get_signed(a, width) >> (int64_t)b);
+		break;
+
+	case op::ushr_64:
+		value = (a & get_mask(width)) >> b;
+		break;
+
+	default:
+		return false;
+	}
+
+	if (is_shift(family))
+	{
+		if (b >= width * 8ui64)
+			return false;
+	}
+	else if (family != op::and_64 && family != op::or_64 && family != op::xor_64 && !unflagged)
+		return false;
+
+	value &= get_mask(width);
+	return true;
+}
+
+static bool fold_unary(op family, uint64_t width, uint64_t a, bool unflagged, uint64_t& value) noexcept
+{
+	switch (family)
+	{
+	case op::not_64:
+		value = ~a;
+		break;
+
+	case op::neg_64:
+		value = 0ui64 - a;
+		break;
+
+	case op::sinc_64:
+	case op::uinc_64:
+		value = a + 1ui64;
+		break;
+
+	case op::sdec_64:
+	case op::udec_64:
+		value = a - 1ui64;
+		break;
+
+	default:
+		return false;
+	}
+
+	if (family != op::not_64 && !unflagged)
+		return false;
+
+	value &= get_mask(width);
+	return true;
+}
+
+// Ops the optimizer can take in place of the tail of out, count of tail ops they replace or 0;
+// only the first op of the tail may be entered by control flow; slot accesses are dropped for
+// unchecked code only, ops setting evaluation flags for code without opint checks only
+
+static uint64_t rewrite(const vector<peephole_op>& out, bool unchecked, bool unflagged, vector<peephole_op>& with)
+{
+	const uint64_t size = out.size();
+
+	if (size >= 3ui64 && !out[size - 1ui64].entry && !out[size - 2ui64].entry)
+	{
+		const peephole_op& a = out[size - 3ui64];
+		const peephole_op& b = out[size - 2ui64];
+		uint64_t a_width, a_value, b_width, b_value, width, value;
+		const op family = get_family((op)out[size - 1ui64].bytes[0ui64], width);
+
+		if (is_push(a, a_width, a_value) && is_push(b, b_width, b_value) && a_width == width
+			&& b_width == (is_shift(family) ? 1ui64 : width) && fold_binary(family, width, a_value, b_value, unflagged, value))
+		{
+			with.push_back(make_op(get_variant(op::push_64, width), width, value));
+			return 3ui64;
+		}
+	}
+
+	if (size >= 2ui64 && !out[size - 1ui64].entry)
+	{
+		const peephole_op& a = out[size - 2ui64];
+		const peephole_op& b = out[size - 1ui64];
+		uint64_t a_width, a_value, width, value;
+		const op a_family = get_family((op)a.bytes[0ui64], a_width);
+		const op family = get_family((op)b.bytes[0ui64], width);
+
+		if (is_push(a, a_width, a_value))
+		{
+			// push k; op folds k, push k; pop and identities of k drop both, multiplying by a
+			// power of two shifts instead
+
+			if (a_width == width && fold_unary(family, width, a_value, unflagged, value))
+			{
+				with.push_back(make_op(get_variant(op::push_64, width), width, value));
+				return 2ui64;
+			}
+			else if (a_width == width && family == op::pop_64)
+				return 2ui64;
+			else if (a_width == 1ui64 && is_shift(family) && a_value == 0ui64)
+				return 2ui64;
+			else if (a_width == width && (family == op::or_64 || family == op::xor_64) && a_value == 0ui64)
+				return 2ui64;
+			else if (a_width == width && family == op::and_64 && a_value == get_mask(width))
+				return 2ui64;
+			else if (a_width == width && unflagged)
+			{
+				if ((family == op::sadd_64 || family == op::uadd_64 || family == op::ssub_64 || family == op::usub_64) && a_value == 0ui64)
+					return 2ui64;
+				else if ((family == op::smul_64 || family == op::umul_64 || family == op::sdiv_64 || family == op::udiv_64) && a_value == 1ui64)
+					return 2ui64;
+				else if ((family == op::smul_64 || family == op::umul_64) && has_single_bit(a_value))
+				{
+					with.push_back(make_op(op::push_8, 1ui64, (uint64_t)countr_zero(a_value)));
+					with.push_back(make_op(get_variant(op::ushl_64, width)));
+					return 2ui64;
+				}
+			}
+		}
+		else if (a_width == width && a_family == op::dup_64 && family == op::pop_64)
+			return 2ui64;
+		else if (a_width == width && unchecked && (a_family == op::s_load_64 || a_family == op::l_load_64) && family == op::pop_64)
+			return 2ui64;
+		else if (a_width == width && unchecked && a.bytes.size() == b.bytes.size()
+			&& equal(a.bytes.begin() + (ptrdiff_t)1, a.bytes.end(), b.bytes.begin() + (ptrdiff_t)1))
+		{
+			// Load and store of the same slot cancel out, store and load of an argument slot
+			// keep the value on the stack, the slot is above the frame and never overlaps it
+
+			if ((a_family == op::s_load_64 && family == op::s_store_64) || (a_family == op::l_load_64 && family == op::l_store_64))
+				return 2ui64;
+			else if (a_family == op::s_store_64 && family == op::s_load_64 && (int8_t)a.bytes[1ui64] >= 0i8)
+			{
+				with.push_back(make_op(get_variant(op::dup_64, width)));
+				with.push_back(a);
+				with.back().ids.clear();
+				with.back().entry = false;
+				return 2ui64;
+			}
+		}
+	}
+
+	return 0ui64;
+}
+
+static inline bool is_branch(op op_code) noexcept
+{
+	return (uint8_t)op_code >= (uint8_t)op::jmp_64 && (uint8_t)op_code <= (uint8_t)op::jmp_msk_8;
+}
+
+optimizer::optimizer(const uint8_t* code, uint64_t code_size, check_type chk_type)
+{
+	const uint8_t* ecode = code + (ptrdiff_t)code_size;
+	const bool unchecked = chk_type == check_type::unchecked;
+	const bool unflagged = !has_opint_check(chk_type);
+
+	_code.assign(code, ecode);
+	_removed = 0ui64;
+
+	// Linear walk, undecodable bytes, fused ops and computed control flow keep the code as is
+
+	vector<peephole_op> ops;
+	vector<uint64_t> index(code_size + 1ui64, ~0ui64);
+
+	for (const uint8_t* opptr = code; opptr < ecode;)
+	{
+		const op op_code = (op)*opptr;
+		const uint64_t size = decoded_code::get_size(opptr, ecode);
+
+		if (size == 0ui64 || ((uint8_t)op_code > (uint8_t)op::f32_2_ui32 && op_code != op::hostcall && op_code != op::imports
+			&& op_code != op::importcall && op_code != op::nativecall_n) || op_code == op::push_flow || op_code == op::pop_flow)
+			return;
+
+		index[opptr - code] = ops.size();
+		ops.push_back(peephole_op{ vector<uint8_t>(opptr, opptr + (ptrdiff_t)size), vector<uint64_t>(1ui64, ops.size()), ~0ui64, false });
+		opptr += (ptrdiff_t)size;
+	}
+
+	index[code_size] = ops.size();
+
+	// Code start, branch targets and call returns are entered by control flow
+
+	vector<bool> entry(ops.size() + 1ui64, false);
+	entry[0ui64] = true;
+
+	for (uint64_t i = 0ui64, offset = 0ui64; i < ops.size(); offset += ops[i].bytes.size(), ++i)
+	{
+		const uint8_t* opptr = code + (ptrdiff_t)offset;
+		const uint8_t* next = opptr + (ptrdiff_t)ops[i].bytes.size();
+		const uint8_t* target = verified_code::get_target(opptr, next, (op)*opptr);
+
+		if (target != (const uint8_t*)nullptr)
+		{
+			if (target < code || target > ecode || index[target - code] == ~0ui64)
+				return;
+
+			ops[i].target = index[target - code];
+			entry[ops[i].target] = true;
+
+			if (!is_branch((op)*opptr))
+				entry[i + 1ui64] = true;
+		}
+	}
+
+	for (uint64_t i = 0ui64; i < ops.size(); ++i)
+		ops[i].entry = entry[i];
+
+	// Ops go to out one by one, each time the tail of out is rewritten as long as a rule takes
+	// it; ops taking the place of the tail are fed again, so folds chain; a branch to the op
+	// right after it is dropped, ids of dropped ops move on to the op after them
+
+	vector<peephole_op> out;
+	vector<peephole_op> feed;
+	vector<uint64_t> pending;
+	bool pending_entry = false;
+
+	for (uint64_t i = ops.size(); i > 0ui64; --i)
+		feed.push_back(move(ops[i - 1ui64]));
+
+	while (!feed.empty())
+	{
+		peephole_op o = move(feed.back());
+		feed.pop_back();
+
+		o.ids.insert(o.ids.end(), pending.begin(), pending.end());
+		o.entry = o.entry || pending_entry;
+		pending.clear();
+		pending_entry = false;
+
+		while (!out.empty() && is_branch((op)out.back().bytes[0ui64]) && find(o.ids.begin(), o.ids.end(), out.back().target) != o.ids.end())
+		{
+			o.ids.insert(o.ids.end(), out.back().ids.begin(), out.back().ids.end());
+			o.entry = o.entry || out.back().entry;
+			out.pop_back();
+			++_removed;
+		}
+
+		out.push_back(move(o));
+
+		vector<peephole_op> with;
+		const uint64_t count = rewrite(out, unchecked, unflagged, with);
+
+		if (count != 0ui64)
+		{
+			const uint64_t first = out.size() - count;
+
+			for (uint64_t j = first; j < out.size(); ++j)
+				pending.insert(pending.end(), out[j].ids.begin(), out[j].ids.end());
+
+			pending_entry = out[first].entry;
+			out.resize(first);
+			_removed += count - with.size();
+
+			if (!with.empty())
+			{
+				with.front().ids = move(pending);
+				with.front().entry = pending_entry;
+				pending.clear();
+				pending_entry = false;
+
+				for (uint64_t j = with.size(); j > 0ui64; --j)
+					feed.push_back(move(with[j - 1ui64]));
+			}
+		}
+	}
+
+	if (out.empty())
+	{
+		_removed = 0ui64;
+		return;
+	}
+
+	// Branches keep their width, distances only shrink with the code
+
+	vector<uint64_t> offsets(index[code_size] + 1ui64, ~0ui64);
+	uint64_t offset = 0ui64;
+
+	for (const peephole_op& o : out)
+	{
+		for (uint64_t id : o.ids)
+			offsets[id] = offset;
+
+		offset += o.bytes.size();
+	}
+
+	for (uint64_t id : pending)
+		offsets[id] = offset;
+
+	offsets[index[code_size]] = offset;
+
+	vector<uint8_t> opt;
+	opt.reserve(offset);
+
+	for (peephole_op& o : out)
+	{
+		if (o.target != ~0ui64)
+		{
+			const op op_code = (op)o.bytes[0ui64];
+			uint64_t width, field = 1ui64;
+
+			if (get_family(op_code, width) == op::jmp_msk_64)
+				field += 1ui64 + width;
+			else if (width == 0ui64)
+				width = 8ui64 >> ((uint64_t)op_code - (uint64_t)op::call_64);
+
+			const int64_t distance = (int64_t)offsets[o.target] - (int64_t)(opt.size() + o.bytes.size());
+
+			if (get_signed((uint64_t)distance & get_mask(width), width) != distance)
+			{
+				_removed = 0ui64;
+				return;
+			}
+
+			store_value(o.bytes.data() + (ptrdiff_t)field, width, (uint64_t)distance);
+		}
+
+		opt.insert(opt.end(), o.bytes.begin(), o.bytes.end());
+	}
+
+	_code = move(opt);
+}
+
+// flow_op - op of the code inliner and loop_optimizer walk, depth is what its function pushed
+//           before it or ~0 while the op is not reached, target is the op index a branch or call
+//           goes to or ~0
+
+struct flow_op
+{
+	const uint8_t* opptr;
+	uint64_t size;
+	uint64_t target;
+	uint64_t depth;
+	op code;
+};
+
+// flow_function - function entered at the code start or by calls, body is its ops in code order,
+//                 leaf while it neither calls, exits nor takes its frame or stack pointer and
+//                 never falls off the code end
+
+struct flow_function
+{
+	vector<uint64_t> body;
+	uint64_t size;
+	bool leaf;
+};
+
+static inline bool is_call(op op_code) noexcept
+{
+	return (uint8_t)op_code >= (uint8_t)op::call_64 && (uint8_t)op_code <= (uint8_t)op::call_8;
+}
+
+// Callee slot in the frame of a caller that pushed depth bytes, with the callee frame header gone
+// its arguments are the top of the caller stack and its locals follow right under them
+
+static inline bool map_slot(ptrdiff_t offset, uint64_t size, uint64_t depth, int64_t& mapped) noexcept
+{
+	if (offset >= (ptrdiff_t)0)
+	{
+		const int64_t address = (int64_t)offset - (int64_t)depth;
+
+		if (address >= 16i64)
+			mapped = address - 16i64;
+		else if (address + (int64_t)size <= 0i64)
+			mapped = ~(-address - (int64_t)size);
+		else
+			return false;
+	}
+	else
+		mapped = ~((int64_t)depth + (int64_t)~offset);
+
+	return mapped >= -0x8000i64 && mapped <= 0x7FFFi64;
+}
+
+static inline void put_slot(op_asm::builder<>& out, op op_code, int64_t offset)
+{
+	uint64_t width;
+	const op family = get_family(op_code, width);
+	const bool load = family == op::l_load_64 || family == op::s_load_64;
+
+	if (offset >= -0x80i64 && offset <= 0x7Fi64)
+	{
+		const uint8_t bytes[2ui64] = { (uint8_t)get_variant(load ? op::s_load_64 : op::s_store_64, width), (uint8_t)offset };
+		out.put(bytes, 2ui64);
+	}
+	else
+	{
+		uint8_t bytes[3ui64] = { (uint8_t)get_variant(load ? op::l_load_64 : op::l_store_64, width) };
+		((val16<>*)(bytes + (ptrdiff_t)1))->si = (int16_t)offset;
+		out.put(bytes, 3ui64);
+	}
+}
+
+static inline void put_branch(op_asm::builder<>& out, const flow_op& o, op_asm::label target)
+{
+	uint64_t width;
+	const op family = get_family(o.code, width);
+
+	if (is_call(o.code))
+		out.call(target);
+	else if (family == op::jmp_msk_64)
+		out.jmp_msk(target, fetch_value(o.opptr + (ptrdiff_t)2, width), (type)o.opptr[1ui64]);
+	else
+		out.branch_to(family, target);
+}
+
+// Ops of the code with the depth of every op walked from the code start and call targets, calls
+// return to the op after them; false for undecodable bytes, fused ops, computed control flow, an
+// op reached at two depths, popping under its frame or moving its frame or stack pointer
+
+static bool get_flow(const uint8_t* code, uint64_t code_size, vector<flow_op>& ops, map<uint64_t, flow_function>& functions)
+{
+	const uint8_t* ecode = code + (ptrdiff_t)code_size;
+	vector<uint64_t> index(code_size + 1ui64, ~0ui64);
+
+	for (const uint8_t* opptr = code; opptr < ecode;)
+	{
+		const op op_code = (op)*opptr;
+		const uint64_t size = decoded_code::get_size(opptr, ecode);
+
+		if (size == 0ui64 || ((uint8_t)op_code > (uint8_t)op::f32_2_ui32 && op_code != op::hostcall && op_code != op::imports
+			&& op_code != op::importcall && op_code != op::nativecall_n) || op_code == op::push_flow || op_code == op::pop_flow)
+			return false;
+
+		index[opptr - code] = ops.size();
+		ops.push_back(flow_op{ opptr, size, ~0ui64, ~0ui64, op_code });
+		opptr += (ptrdiff_t)size;
+	}
+
+	vector<uint64_t> entries(1ui64, 0ui64);
+
+	for (flow_op& o : ops)
+	{
+		const uint8_t* target = verified_code::get_target(o.opptr, o.opptr + (ptrdiff_t)o.size, o.code);
+
+		if (target != (const uint8_t*)nullptr)
+		{
+			if (target < code || target >= ecode || index[target - code] == ~0ui64)
+				return false;
+
+			o.target = index[target - code];
+
+			if (is_call(o.code))
+				entries.push_back(o.target);
+		}
+	}
+
+	for (uint64_t entry : entries)
+	{
+		if (functions.count(entry) != 0ui64)
+			continue;
+
+		flow_function& function = functions[entry];
+		vector<uint64_t> work(1ui64, entry);
+		vector<bool> seen(ops.size(), false);
+
+		function.size = 0ui64;
+		function.leaf = true;
+
+		if (ops[entry].depth != ~0ui64 && ops[entry].depth != 0ui64)
+			return false;
+
+		ops[entry].depth = 0ui64;
+		seen[entry] = true;
+
+		while (!work.empty())
+		{
+			const uint64_t i = work.back();
+			const flow_op& o = ops[i];
+			uint64_t pop, push;
+
+			work.pop_back();
+			function.body.push_back(i);
+			function.size += o.size;
+
+			if (!verified_code::get_effect(o.opptr, o.code, pop, push) || o.depth < pop)
+				return false;
+
+			if (o.code == op::exit || o.code == op::push_frame || o.code == op::push_stack || is_call(o.code))
+				function.leaf = false;
+
+			const uint64_t depth = o.depth - pop + push;
+			uint64_t next[2ui64] = { i + 1ui64, o.target };
+
+			if (o.code == op::exit || o.code == op::ret)
+				next[0ui64] = next[1ui64] = ~0ui64;
+			else if ((uint8_t)o.code >= (uint8_t)op::jmp_64 && (uint8_t)o.code <= (uint8_t)op::jmp_8)
+				next[0ui64] = ~0ui64;
+			else if (is_call(o.code))
+				next[1ui64] = ~0ui64;
+
+			if (next[0ui64] == ops.size())
+				function.leaf = false;
+
+			for (uint64_t j : next)
+				if (j < ops.size())
+				{
+					if (ops[j].depth == ~0ui64)
+						ops[j].depth = depth;
+					else if (ops[j].depth != depth)
+						return false;
+
+					if (!seen[j])
+					{
+						seen[j] = true;
+						work.push_back(j);
+					}
+				}
+		}
+
+		sort(function.body.begin(), function.body.end());
+	}
+
+	return true;
+}
+
+inliner::inliner(const uint8_t* code, uint64_t code_size, uint64_t limit)
+{
+	vector<flow_op> ops;
+	map<uint64_t, flow_function> functions;
+
+	_code.assign(code, code + (ptrdiff_t)code_size);
+	_inlined = 0ui64;
+
+	if (!get_flow(code, code_size, ops, functions))
+		return;
+
+	// Call sites of callees whose slots all map into the caller frame get the callee body, its
+	// branches go to its own copy and every ret drops what the callee left on the stack
+
+	op_asm::builder<> out;
+	vector<op_asm::label> labels;
+
+	for (uint64_t i = 0ui64; i < ops.size(); ++i)
+		labels.push_back(out.make_label());
+
+	for (uint64_t i = 0ui64; i < ops.size(); ++i)
+	{
+		const flow_op& o = ops[i];
+		const map<uint64_t, flow_function>::const_iterator callee = is_call(o.code) ? functions.find(o.target) : functions.end();
+		bool splice = o.depth != ~0ui64 && callee != functions.end() && callee->first != 0ui64 && callee->second.leaf
+			&& callee->second.size <= limit;
+
+		out.bind(labels[i]);
+
+		for (uint64_t j = 0ui64; splice && j < callee->second.body.size(); ++j)
+		{
+			const flow_op& c = ops[callee->second.body[j]];
+			ptrdiff_t offset;
+			uint64_t size;
+			int64_t mapped;
+
+			if (verified_code::get_slot(c.opptr, c.code, offset, size) && !map_slot(offset, size, o.depth, mapped))
+				splice = false;
+			else if (c.code == op::ret && c.depth > 0xFFFFui64)
+				splice = false;
+		}
+
+		if (splice)
+		{
+			const vector<uint64_t>& body = callee->second.body;
+			map<uint64_t, op_asm::label> copies;
+			const op_asm::label end = out.make_label();
+
+			for (uint64_t j : body)
+				copies[j] = out.make_label();
+
+			for (uint64_t j = 0ui64; j < body.size(); ++j)
+			{
+				const flow_op& c = ops[body[j]];
+				ptrdiff_t offset;
+				uint64_t size;
+				int64_t mapped;
+
+				out.bind(copies[body[j]]);
+
+				if (c.code == op::ret)
+				{
+					if (c.depth > 0xFFui64)
+						out.put(op_asm::__l_dealloc(val16<>((uint16_t)c.depth)));
+					else if (c.depth > 0ui64)
+						out.put(op_asm::__s_dealloc(val8<>((uint8_t)c.depth)));
+
+					if (j + 1ui64 < body.size())
+						out.jmp(end);
+				}
+				else if (c.target != ~0ui64)
+					put_branch(out, c, copies[c.target]);
+				else if (verified_code::get_slot(c.opptr, c.code, offset, size) && map_slot(offset, size, o.depth, mapped))
+					put_slot(out, c.code, mapped);
+				else
+					out.put(c.opptr, c.size);
+			}
+
+			out.bind(end);
+			++_inlined;
+		}
+		else if (o.target != ~0ui64)
+			put_branch(out, o, labels[o.target]);
+		else
+			out.put(o.opptr, o.size);
+	}
+
+	if (_inlined != 0ui64)
+		_code = out.assemble();
+}
+
+// flow_block - ops [first, last] entered at first only, succs and preds are block indices
+
+struct flow_block
+{
+	uint64_t first;
+	uint64_t last;
+	vector<uint64_t> succs;
+	vector<uint64_t> preds;
+};
+
+// loop_value - value on the symbolic stack of a loop block, known while ops [first, last] are
+//              pure and compute it alone, invariant while nothing in the loop changes it,
+//              linear while it is coef times the induction variable plus an invariant value and
+//              constant while it loads nothing, which is left to the peephole pass
+
+struct loop_value
+{
+	uint64_t first;
+	uint64_t last;
+	uint64_t width;
+	uint64_t coef;
+	bool known;
+	bool invariant;
+	bool linear;
+	bool constant;
+};
+
+// loop_slot - value kept on the stack under the loop, computed before the loop by ops [first, last]
+//             and loaded in place of every copy of them, an induction one is stepped by step right
+//             after the induction variable is stored
+
+struct loop_slot
+{
+	uint64_t first;
+	uint64_t last;
+	uint64_t width;
+	uint64_t offset;
+	uint64_t step;
+	uint64_t uses;
+	bool induction;
+};
+
+// loop_plan - rewrite of one innermost loop, ops in it are marked in body, depth is the stack
+//             depth at its header and extra what its slots push under it
+
+struct loop_plan
+{
+	vector<bool> body;
+	vector<loop_slot> slots;
+	map<uint64_t, pair<uint64_t, uint64_t>> uses;
+	uint64_t header;
+	uint64_t depth;
+	uint64_t extra;
+	uint64_t store;
+	loop_report report;
+};
+
+// Ops control never falls through
+
+static inline bool is_terminal(op op_code) noexcept
+{
+	return op_code == op::exit || op_code == op::ret || ((uint8_t)op_code >= (uint8_t)op::jmp_64 && (uint8_t)op_code <= (uint8_t)op::jmp_8);
+}
+
+// Frame slot of a load or store as its first byte address from the frame top
+
+static inline bool get_address(const flow_op& o, int64_t& address, uint64_t& size) noexcept
+{
+	ptrdiff_t offset;
+
+	if (verified_code::get_slot(o.opptr, o.code, offset, size))
+	{
+		address = offset >= (ptrdiff_t)0 ? 16i64 + (int64_t)offset : -(int64_t)~offset - (int64_t)size;
+		return true;
+	}
+	else
+		return false;
+}
+
+static inline bool is_store(op op_code) noexcept
+{
+	uint64_t width;
+	const op family = get_family(op_code, width);
+
+	return family == op::l_store_64 || family == op::s_store_64;
+}
+
+// Pure ops of a loop value, ops setting evaluation flags are pure for code without opint checks only
+
+static inline bool is_pure_binary(op family, bool unflagged) noexcept
+{
+	switch (family)
+	{
+	case op::and_64:
+	case op::or_64:
+	case op::xor_64:
+	case op::rotl_64:
+	case op::rotr_64:
+	case op::sshl_64:
+	case op::ushl_64:
+	case op::sshr_64:
+	case op::ushr_64:
+		return true;
+
+	case op::sadd_64:
+	case op::uadd_64:
+	case op::ssub_64:
+	case op::usub_64:
+	case op::smul_64:
+	case op::umul_64:
+		return unflagged;
+
+	default:
+		return false;
+	}
+}
+
+static inline bool is_pure_unary(op family, bool unflagged) noexcept
+{
+	switch (family)
+	{
+	case op::not_64:
+		return true;
+
+	case op::neg_64:
+	case op::sinc_64:
+	case op::uinc_64:
+	case op::sdec_64:
+	case op::udec_64:
+		return unflagged;
+
+	default:
+		return false;
+	}
+}
+
+// Blocks of the code and the dominator tree over them, function entries are roots
+
+static void get_blocks(const vector<flow_op>& ops, const map<uint64_t, flow_function>& functions,
+	vector<flow_block>& blocks, vector<uint64_t>& block_of, vector<uint64_t>& idom)
+{
+	vector<bool> leader(ops.size() + 1ui64, false);
+
+	leader[0ui64] = true;
+
+	for (uint64_t i = 0ui64; i < ops.size(); ++i)
+		if (ops[i].target != ~0ui64)
+		{
+			leader[ops[i].target] = true;
+
+			if (!is_call(ops[i].code))
+				leader[i + 1ui64] = true;
+		}
+		else if (is_terminal(ops[i].code))
+			leader[i + 1ui64] = true;
+
+	block_of.assign(ops.size(), ~0ui64);
+
+	for (uint64_t i = 0ui64; i < ops.size(); ++i)
+	{
+		if (leader[i])
+			blocks.push_back(flow_block{ i, i, vector<uint64_t>(), vector<uint64_t>() });
+
+		blocks.back().last = i;
+		block_of[i] = blocks.size() - 1ui64;
+	}
+
+	for (uint64_t b = 0ui64; b < blocks.size(); ++b)
+	{
+		const flow_op& o = ops[blocks[b].last];
+
+		if (o.target != ~0ui64 && !is_call(o.code))
+			blocks[b].succs.push_back(block_of[o.target]);
+
+		if (!is_terminal(o.code) && b + 1ui64 < blocks.size())
+			blocks[b].succs.push_back(b + 1ui64);
+
+		for (uint64_t s : blocks[b].succs)
+			blocks[s].preds.push_back(b);
+	}
+
+	// Iterative dominators in reverse postorder from a virtual root above all function entries
+
+	const uint64_t root = blocks.size();
+	vector<uint64_t> order, rank(root + 1ui64, ~0ui64);
+	vector<pair<uint64_t, uint64_t>> work;
+	vector<bool> seen(root, false);
+
+	for (const pair<const uint64_t, flow_function>& function : functions)
+	{
+		const uint64_t entry = block_of[function.first];
+
+		if (seen[entry])
+			continue;
+
+		seen[entry] = true;
+		work.push_back(pair<uint64_t, uint64_t>(entry, 0ui64));
+
+		while (!work.empty())
+		{
+			pair<uint64_t, uint64_t>& top = work.back();
+
+			if (top.second < blocks[top.first].succs.size())
+			{
+				const uint64_t s = blocks[top.first].succs[top.second++];
+
+				if (!seen[s])
+				{
+					seen[s] = true;
+					work.push_back(pair<uint64_t, uint64_t>(s, 0ui64));
+				}
+			}
+			else
+			{
+				order.push_back(top.first);
+				work.pop_back();
+			}
+		}
+	}
+
+	reverse(order.begin(), order.end());
+
+	for (uint64_t i = 0ui64; i < order.size(); ++i)
+		rank[order[i]] = i + 1ui64;
+
+	rank[root] = 0ui64;
+	idom.assign(root + 1ui64, ~0ui64);
+	idom[root] = root;
+
+	for (const pair<const uint64_t, flow_function>& function : functions)
+		idom[block_of[function.first]] = root;
+
+	bool changed = true;
+
+	while (changed)
+	{
+		changed = false;
+
+		for (uint64_t b : order)
+		{
+			if (idom[b] == root)
+				continue;
+
+			uint64_t dom = ~0ui64;
+
+			for (uint64_t p : blocks[b].preds)
+				if (idom[p] != ~0ui64)
+				{
+					if (dom == ~0ui64)
+						dom = p;
+					else
+					{
+						uint64_t x = p;
+
+						while (x != dom)
+						{
+							while (rank[x] > rank[dom])
+								x = idom[x];
+
+							while (rank[dom] > rank[x])
+								dom = idom[dom];
+						}
+					}
+				}
+
+			if (dom != ~0ui64 && idom[b] != dom)
+			{
+				idom[b] = dom;
+				changed = true;
+			}
+		}
+	}
+}
+
+static inline bool dominates(const vector<uint64_t>& idom, uint64_t a, uint64_t b) noexcept
+{
+	const uint64_t root = idom.size() - 1ui64;
+
+	while (b != a && b != root && idom[b] != ~0ui64)
+		b = idom[b];
+
+	return b == a;
+}
+
+// Symbolic run of the blocks of a loop, every maximal known value an op takes that is invariant,
+// or linear in the induction variable when there is one, becomes a slot candidate
+
+static void get_candidates(const vector<flow_op>& ops, const vector<flow_block>& blocks, const loop_plan& plan,
+	const vector<pair<int64_t, uint64_t>>& stores, bool clobber, bool unflagged, int64_t iv_address, uint64_t iv_first,
+	vector<loop_slot>& candidates)
+{
+	auto consider = [&](const loop_value& v)
+	{
+		if (v.known && !v.constant && v.last > v.first && (v.last < iv_first || v.first > plan.store))
+		{
+			if (v.invariant)
+				candidates.push_back(loop_slot{ v.first, v.last, v.width, 0ui64, 0ui64, 1ui64, false });
+			else if (v.linear && v.coef != 0ui64 && v.width == 8ui64 && v.last - v.first >= 2ui64)
+				candidates.push_back(loop_slot{ v.first, v.last, v.width, 0ui64, v.coef, 1ui64, true });
+		}
+	};
+
+	for (const flow_block& block : blocks)
+	{
+		if (!plan.body[block.first])
+			continue;
+
+		vector<loop_value> stack;
+
+		for (uint64_t i = block.first; i <= block.last; ++i)
+		{
+			const flow_op& o = ops[i];
+			uint64_t width;
+			const op family = get_family(o.code, width);
+			int64_t address;
+			uint64_t size;
+
+			if (family == op::push_64)
+			{
+				stack.push_back(loop_value{ i, i, width, 0ui64, true, true, true, true });
+				continue;
+			}
+			else if ((family == op::l_load_64 || family == op::s_load_64) && get_address(o, address, size))
+			{
+				bool invariant = !clobber && address >= -(int64_t)plan.depth;
+
+				for (const pair<int64_t, uint64_t>& store : stores)
+					if (store.first < address + (int64_t)size && address < store.first + (int64_t)store.second)
+						invariant = false;
+
+				const bool iv = address == iv_address && size == 8ui64;
+
+				stack.push_back(loop_value{ i, i, width, iv ? 1ui64 : 0ui64, true, invariant, invariant || iv, false });
+				continue;
+			}
+			else if (is_pure_binary(family, unflagged) && stack.size() >= 2ui64)
+			{
+				const loop_value b = stack.back();
+				stack.pop_back();
+				const loop_value a = stack.back();
+				stack.pop_back();
+
+				const bool shift = family == op::sshl_64 || family == op::ushl_64 || family == op::sshr_64
+					|| family == op::ushr_64 || family == op::rotl_64 || family == op::rotr_64;
+
+				if (a.known && b.known && a.width == width && b.width == (shift ? 1ui64 : width) && a.last + 1ui64 == b.first && b.last + 1ui64 == i)
+				{
+					loop_value v{ a.first, i, width, 0ui64, true, a.invariant && b.invariant, a.linear && b.linear, a.constant && b.constant };
+					const bool b_const = b.first == b.last && get_family(ops[b.first].code, size) == op::push_64;
+					const bool a_const = a.first == a.last && get_family(ops[a.first].code, size) == op::push_64;
+
+					if (v.linear)
+					{
+						if (family == op::sadd_64 || family == op::uadd_64)
+							v.coef = a.coef + b.coef;
+						else if (family == op::ssub_64 || family == op::usub_64)
+							v.coef = a.coef - b.coef;
+						else if ((family == op::smul_64 || family == op::umul_64) && b_const)
+							v.coef = a.coef * fetch_value(ops[b.first].opptr + (ptrdiff_t)1, width);
+						else if ((family == op::smul_64 || family == op::umul_64) && a_const)
+							v.coef = b.coef * fetch_value(ops[a.first].opptr + (ptrdiff_t)1, width);
+						else if (family == op::ushl_64 && b_const && ops[b.first].opptr[1ui64] < 64ui8)
+							v.coef = a.coef << ops[b.first].opptr[1ui64];
+						else
+							v.linear = a.coef == 0ui64 && b.coef == 0ui64;
+
+						v.linear = v.linear && (width == 8ui64 || v.coef == 0ui64);
+					}
+
+					if (v.invariant || v.linear)
+					{
+						stack.push_back(v);
+						continue;
+					}
+				}
+
+				consider(a);
+				consider(b);
+				stack.push_back(loop_value{ i, i, width, 0ui64, false, false, false, false });
+				continue;
+			}
+			else if (is_pure_unary(family, unflagged) && !stack.empty())
+			{
+				const loop_value a = stack.back();
+				stack.pop_back();
+
+				if (a.known && a.width == width && a.last + 1ui64 == i)
+				{
+					loop_value v{ a.first, i, width, a.coef, true, a.invariant, a.linear, a.constant };
+
+					if (family == op::neg_64)
+						v.coef = 0ui64 - a.coef;
+					else if (family == op::not_64)
+						v.linear = a.linear && a.coef == 0ui64;
+
+					if (v.invariant || v.linear)
+					{
+						stack.push_back(v);
+						continue;
+					}
+				}
+
+				consider(a);
+				stack.push_back(loop_value{ i, i, width, 0ui64, false, false, false, false });
+				continue;
+			}
+
+			// Any other op takes its operands as they are and leaves unknown values
+
+			uint64_t pop, push;
+			verified_code::get_effect(o.opptr, o.code, pop, push);
+
+			while (pop != 0ui64 && !stack.empty())
+			{
+				consider(stack.back());
+
+				if (stack.back().width > pop)
+				{
+					stack.clear();
+					pop = 0ui64;
+				}
+				else
+				{
+					pop -= stack.back().width;
+					stack.pop_back();
+				}
+			}
+
+			if (push != 0ui64)
+				stack.push_back(loop_value{ i, i, push, 0ui64, false, false, false, false });
+		}
+	}
+}
+
+// Dispatches a slot saves per loop iteration, an induction slot pays for its step
+
+static inline int64_t get_gain(const loop_slot& s) noexcept
+{
+	return (int64_t)s.uses * (int64_t)(s.last - s.first) - (!s.induction ? 0i64 : s.step == 1ui64 || s.step == ~0ui64 ? 3i64 : 4i64);
+}
+
+static inline void put_update(op_asm::builder<>& out, uint64_t offset, uint64_t step)
+{
+	put_slot(out, op::s_load_64, ~(int64_t)offset);
+
+	if (step == 1ui64)
+		out.put(op_asm::__uinc<val64<>>());
+	else if (step == ~0ui64)
+		out.put(op_asm::__udec<val64<>>());
+	else
+	{
+		out.put(op_asm::__push<val64<>>(val64<>(step)));
+		out.put(op_asm::__uadd<val64<>>());
+	}
+
+	put_slot(out, op::s_store_64, ~(int64_t)offset);
+}
+
+static inline void put_dealloc(op_asm::builder<>& out, uint64_t size)
+{
+	if (size > 0xFFui64)
+		out.put(op_asm::__l_dealloc(val16<>((uint16_t)size)));
+	else if (size > 0ui64)
+		out.put(op_asm::__s_dealloc(val8<>((uint8_t)size)));
+}
+
+loop_optimizer::loop_optimizer(const uint8_t* code, uint64_t code_size, check_type chk_type)
+{
+	const bool unflagged = !has_opint_check(chk_type);
+	vector<flow_op> ops;
+	map<uint64_t, flow_function> functions;
+
+	_code.assign(code, code + (ptrdiff_t)code_size);
+
+	if (!get_flow(code, code_size, ops, functions))
+		return;
+
+	vector<flow_block> blocks;
+	vector<uint64_t> block_of, idom;
+
+	get_blocks(ops, functions, blocks, block_of, idom);
+
+	// Natural loops of back edges, blocks reaching the edge source without passing its header
+
+	map<uint64_t, vector<bool>> loops;
+
+	for (uint64_t b = 0ui64; b < blocks.size(); ++b)
+		for (uint64_t h : blocks[b].succs)
+			if (idom[b] != ~0ui64 && dominates(idom, h, b))
+			{
+				vector<bool>& body = loops[h];
+				vector<uint64_t> work(1ui64, b);
+
+				body.resize(blocks.size(), false);
+				body[h] = true;
+
+				while (!work.empty())
+				{
+					const uint64_t x = work.back();
+					work.pop_back();
+
+					if (!body[x])
+					{
+						body[x] = true;
+						work.insert(work.end(), blocks[x].preds.begin(), blocks[x].preds.end());
+					}
+				}
+			}
+
+	const bool open_end = ops.empty() || !is_terminal(ops.back().code);
+	vector<loop_plan> plans;
+
+	for (const pair<const uint64_t, vector<bool>>& loop : loops)
+	{
+		bool inner = true;
+
+		for (const pair<const uint64_t, vector<bool>>& other : loops)
+			if (other.first != loop.first && loop.second[other.first])
+				inner = false;
+
+		if (!inner)
+			continue;
+
+		loop_plan plan;
+		const uint64_t header = blocks[loop.first].first;
+
+		plan.body.assign(ops.size(), false);
+		plan.header = header;
+		plan.depth = ops[header].depth;
+		plan.extra = 0ui64;
+		plan.store = ~0ui64;
+		plan.report = loop_report{ (uint64_t)(ops[header].opptr - code), 0ui64, 0ui64, 0i64 };
+
+		for (uint64_t b = 0ui64; b < blocks.size(); ++b)
+			if (loop.second[b])
+				for (uint64_t i = blocks[b].first; i <= blocks[b].last; ++i)
+					plan.body[i] = true;
+
+		// The loop keeps to the stack over its header, entered by fall through from outside only
+
+		bool fit = plan.depth != ~0ui64 && functions.count(header) == 0ui64 && (header == 0ui64 || !plan.body[header - 1ui64]);
+		bool clobber = false;
+		vector<pair<int64_t, uint64_t>> stores;
+
+		for (uint64_t i = 0ui64; fit && i < ops.size(); ++i)
+			if (plan.body[i])
+			{
+				const flow_op& o = ops[i];
+				uint64_t pop, push, width;
+				int64_t address;
+				uint64_t size;
+				const op family = get_family(o.code, width);
+
+				verified_code::get_effect(o.opptr, o.code, pop, push);
+
+				if (o.depth == ~0ui64 || o.depth - pop < plan.depth || (!is_terminal(o.code) && i + 1ui64 == ops.size()))
+					fit = false;
+				else if (family == op::ptrcpy_64 || family == op::ptrset_64 || is_call(o.code) || o.code == op::nativecall
+					|| o.code == op::nativecall_n || o.code == op::hostcall || o.code == op::importcall
+					|| o.code == op::memcpy || o.code == op::memset)
+					clobber = true;
+				else if (is_store(o.code) && get_address(o, address, size))
+					stores.push_back(pair<int64_t, uint64_t>(address, size));
+			}
+
+		if (!fit)
+			continue;
+
+		// Induction variables are 64-bit slots stored once in the loop by a step of themselves,
+		// the one saving the most is taken
+
+		vector<loop_slot> best;
+		int64_t best_saved = 0i64;
+		uint64_t best_store = ~0ui64;
+
+		for (uint64_t i = 0ui64; i <= ops.size(); ++i)
+		{
+			int64_t iv_address = INT64_MIN;
+			uint64_t iv_first = ~0ui64;
+			uint64_t step = 0ui64;
+
+			if (i < ops.size())
+			{
+				const flow_op& o = ops[i];
+				int64_t address, load_address;
+				uint64_t size, load_size, width;
+
+				if (!unflagged || clobber || !plan.body[i] || !is_store(o.code) || !get_address(o, address, size) || size != 8ui64
+					|| address < -(int64_t)plan.depth || i < 2ui64)
+					continue;
+
+				uint64_t overlaps = 0ui64;
+
+				for (const pair<int64_t, uint64_t>& store : stores)
+					if (store.first < address + 8i64 && address < store.first + (int64_t)store.second)
+						++overlaps;
+
+				const op family = get_family(ops[i - 1ui64].code, width);
+
+				if (overlaps != 1ui64)
+					continue;
+				else if ((family == op::uinc_64 || family == op::udec_64) && width == 8ui64)
+				{
+					iv_first = i - 2ui64;
+					step = family == op::uinc_64 ? 1ui64 : ~0ui64;
+				}
+				else if ((family == op::uadd_64 || family == op::usub_64) && width == 8ui64 && i >= 3ui64
+					&& get_family(ops[i - 2ui64].code, width) == op::push_64 && width == 8ui64)
+				{
+					iv_first = i - 3ui64;
+					step = fetch_value(ops[i - 2ui64].opptr + (ptrdiff_t)1, 8ui64);
+					step = family == op::uadd_64 ? step : 0ui64 - step;
+				}
+				else
+					continue;
+
+				if (block_of[iv_first] != block_of[i] || !get_address(ops[iv_first], load_address, load_size)
+					|| is_store(ops[iv_first].code) || load_address != address || load_size != 8ui64)
+					continue;
+
+				iv_address = address;
+			}
+
+			plan.store = i < ops.size() ? i : ~0ui64;
+
+			vector<loop_slot> candidates;
+			get_candidates(ops, blocks, plan, stores, clobber, unflagged, iv_address, iv_first, candidates);
+
+			// Copies of the same ops share their slot
+
+			vector<loop_slot> slots;
+			int64_t saved = 0i64;
+
+			for (const loop_slot& c : candidates)
+			{
+				const uint8_t* cbeg = ops[c.first].opptr;
+				const uint8_t* cend = ops[c.last].opptr + (ptrdiff_t)ops[c.last].size;
+				bool shared = false;
+
+				for (loop_slot& s : slots)
+					if (s.induction == c.induction && s.step == c.step
+						&& equal(cbeg, cend, ops[s.first].opptr, ops[s.last].opptr + (ptrdiff_t)ops[s.last].size))
+					{
+						++s.uses;
+						shared = true;
+					}
+
+				if (!shared)
+					slots.push_back(c);
+			}
+
+			for (loop_slot& s : slots)
+			{
+				s.step = s.induction ? s.step * step : 0ui64;
+
+				if (get_gain(s) > 0i64)
+					saved += get_gain(s);
+				else
+					s.uses = 0ui64;
+			}
+
+			slots.erase(remove_if(slots.begin(), slots.end(), [](const loop_slot& s) { return s.uses == 0ui64; }), slots.end());
+
+			if (saved > best_saved)
+			{
+				best = move(slots);
+				best_saved = saved;
+				best_store = plan.store;
+			}
+		}
+
+		if (best.empty())
+			continue;
+
+		// Slots go right under the stack at the header, frame slots under it move down by them
+
+		plan.store = best_store;
+		plan.slots = move(best);
+		plan.extra = 0ui64;
+
+		for (loop_slot& s : plan.slots)
+		{
+			s.offset = plan.depth + plan.extra;
+			plan.extra += s.width;
+		}
+
+		for (uint64_t i = 0ui64; fit && i < ops.size(); ++i)
+		{
+			int64_t address;
+			uint64_t size;
+
+			if (plan.body[i] && get_address(ops[i], address, size) && address < 0i64)
+			{
+				if (address + (int64_t)size > -(int64_t)plan.depth && address < -(int64_t)plan.depth)
+					fit = false;
+				else if (address < -(int64_t)plan.depth && -address - (int64_t)size + (int64_t)plan.extra > 0x7FFFi64)
+					fit = false;
+			}
+			else if (plan.body[i] && ops[i].target != ~0ui64 && !is_call(ops[i].code) && !plan.body[ops[i].target] && open_end)
+				fit = false;
+		}
+
+		if (!fit || plan.depth + plan.extra > 0x7FFFui64)
+			continue;
+
+		for (const loop_slot& s : plan.slots)
+		{
+			++(s.induction ? plan.report.reduced : plan.report.hoisted);
+			plan.report.saved += get_gain(s);
+		}
+
+		plans.push_back(move(plan));
+	}
+
+	if (plans.empty())
+		return;
+
+	// Preheaders compute the slots of a loop right before its header, branches into the header
+	// from outside go to them and branches out of the loop go through stubs dropping the slots
+
+	vector<uint64_t> plan_of(ops.size(), ~0ui64);
+
+	for (uint64_t p = 0ui64; p < plans.size(); ++p)
+	{
+		for (uint64_t i = 0ui64; i < ops.size(); ++i)
+			if (plans[p].body[i])
+				plan_of[i] = p;
+
+		_loops.push_back(plans[p].report);
+	}
+
+	op_asm::builder<> out;
+	vector<op_asm::label> labels, pre;
+	vector<pair<op_asm::label, pair<uint64_t, op_asm::label>>> stubs;
+
+	for (uint64_t i = 0ui64; i < ops.size(); ++i)
+		labels.push_back(out.make_label());
+
+	for (uint64_t p = 0ui64; p < plans.size(); ++p)
+		pre.push_back(out.make_label());
+
+	auto find_plan = [&](uint64_t header) -> uint64_t
+	{
+		for (uint64_t p = 0ui64; p < plans.size(); ++p)
+			if (plans[p].header == header)
+				return p;
+
+		return ~0ui64;
+	};
+
+	auto target_of = [&](uint64_t i, uint64_t target) -> op_asm::label
+	{
+		const uint64_t into = find_plan(target);
+		const op_asm::label label = into != ~0ui64 && plan_of[i] != into ? pre[into] : labels[target];
+
+		if (plan_of[i] != ~0ui64 && plan_of[target] != plan_of[i])
+		{
+			const op_asm::label stub = out.make_label();
+
+			stubs.push_back(pair<op_asm::label, pair<uint64_t, op_asm::label>>(stub, pair<uint64_t, op_asm::label>(plans[plan_of[i]].extra, label)));
+			return stub;
+		}
+		else
+			return label;
+	};
+
+	for (uint64_t i = 0ui64; i < ops.size(); ++i)
+	{
+		const flow_op& o = ops[i];
+		const uint64_t into = find_plan(i);
+		const uint64_t p = plan_of[i];
+
+		if (into != ~0ui64)
+		{
+			out.bind(pre[into]);
+
+			for (const loop_slot& s : plans[into].slots)
+				for (uint64_t j = s.first; j <= s.last; ++j)
+					out.put(ops[j].opptr, ops[j].size);
+		}
+
+		out.bind(labels[i]);
+
+		const loop_slot* use = (const loop_slot*)nullptr;
+
+		if (p != ~0ui64)
+			for (const loop_slot& s : plans[p].slots)
+				if (ops[s.first].size == o.size && s.last - s.first <= ops.size() - i - 1ui64 && plan_of[i + (s.last - s.first)] == p
+					&& equal(ops[s.first].opptr, ops[s.last].opptr + (ptrdiff_t)ops[s.last].size, o.opptr)
+					&& block_of[i] == block_of[i + (s.last - s.first)])
+					use = &s;
+
+		int64_t address;
+		uint64_t size;
+
+		if (use != (const loop_slot*)nullptr)
+		{
+			put_slot(out, get_variant(op::s_load_64, use->width), ~(int64_t)use->offset);
+
+			for (uint64_t j = i + 1ui64; j <= i + (use->last - use->first); ++j)
+				out.bind(labels[j]);
+
+			i += use->last - use->first;
+			continue;
+		}
+		else if (is_call(o.code))
+			put_branch(out, o, labels[o.target]);
+		else if (o.target != ~0ui64)
+			put_branch(out, o, target_of(i, o.target));
+		else if (p != ~0ui64 && get_address(o, address, size) && address < -(int64_t)plans[p].depth)
+			put_slot(out, o.code, ~(-address - (int64_t)size + (int64_t)plans[p].extra));
+		else
+			out.put(o.opptr, o.size);
+
+		if (p != ~0ui64 && i == plans[p].store)
+			for (const loop_slot& s : plans[p].slots)
+				if (s.induction)
+					put_update(out, s.offset, s.step);
+
+		if (p != ~0ui64 && !is_terminal(o.code) && i + 1ui64 < ops.size() && plan_of[i + 1ui64] != p)
+			put_dealloc(out, plans[p].extra);
+	}
+
+	for (const pair<op_asm::label, pair<uint64_t, op_asm::label>>& stub : stubs)
+	{
+		out.bind(stub.first);
+		put_dealloc(out, stub.second.first);
+		out.jmp(stub.second.second);
+	}
+
+	_code = out.assemble();
+}
+#ifdef X64JIT
+
+static constexpr const char* _hole_names[] =
+{
+	"__hole_opptr",
+	"__hole_end",
+	"__hole_next",
+	"__hole_target",
+	"__hole_leave",
+	"__hole_lookup",
+	"__hole_table",
+	"__hole_code",
+	"__hole_size"
+};
+
+static constexpr const char* _hole_types[] =
+{
+	"opptr",
+	"end",
+	"next",
+	"target",
+	"leave",
+	"lookup",
+	"table",
+	"code",
+	"size"
+};
+
+static_assert(sizeof(_hole_names) / sizeof(*_hole_names) == (uint64_t)stencil_hole_type::size + 1ui64);
+static_assert(sizeof(_hole_types) / sizeof(*_hole_types) == (uint64_t)stencil_hole_type::size + 1ui64);
+
+static constexpr char _stencil_prefix[] = "__stencil_";
+
+stencilgen::stencilgen(const uint8_t* obj, uint64_t obj_size)
+{
+	const Elf64_Ehdr* ehdr = (const Elf64_Ehdr*)obj;
+
+	if (obj_size < (uint64_t)sizeof(Elf64_Ehdr) || memcmp(ehdr->e_ident, ELFMAG, SELFMAG) != 0
+		|| ehdr->e_ident[EI_CLASS] != ELFCLASS64 || ehdr->e_type != ET_REL || ehdr->e_machine != EM_X86_64
+		|| ehdr->e_shentsize != (uint16_t)sizeof(Elf64_Shdr)
+		|| ehdr->e_shoff + (uint64_t)ehdr->e_shnum * (uint64_t)sizeof(Elf64_Shdr) > obj_size)
+		throw runtime_error(_err_msg_wrong_obj);
+
+	const Elf64_Shdr* shdr = (const Elf64_Shdr*)(obj + (ptrdiff_t)ehdr->e_shoff);
+	const uint64_t shnum = (uint64_t)ehdr->e_shnum;
+
+	for (uint64_t i = 0ui64; i < shnum; ++i)
+		if (shdr[i].sh_type != SHT_NOBITS && shdr[i].sh_offset + shdr[i].sh_size > obj_size)
+			throw runtime_error(_err_msg_wrong_obj);
+
+	uint64_t symtab = 0ui64;
+
+	while (symtab < shnum && shdr[symtab].sh_type != SHT_SYMTAB)
+		++symtab;
+
+	if (symtab == shnum || (uint64_t)shdr[symtab].sh_link >= shnum)
+		throw runtime_error(_err_msg_wrong_obj);
+
+	const Elf64_Sym* syms = (const Elf64_Sym*)(obj + (ptrdiff_t)shdr[symtab].sh_offset);
+	const uint64_t sym_count = shdr[symtab].sh_size / (uint64_t)sizeof(Elf64_Sym);
+	const char* strs = (const char*)(obj + (ptrdiff_t)shdr[shdr[symtab].sh_link].sh_offset);
+	const uint64_t strs_size = shdr[shdr[symtab].sh_link].sh_size;
+
+	auto get_sym_name = [&](uint64_t index) -> string
+	{
+		if (index >= sym_count || (uint64_t)syms[index].st_name >= strs_size)
+			throw runtime_error(_err_msg_wrong_obj);
+
+		return string(strs + (ptrdiff_t)syms[index].st_name, strnlen(strs + (ptrdiff_t)syms[index].st_name,
+			strs_size - (uint64_t)syms[index].st_name));
+	};
+
+	for (uint64_t i = 0ui64; i < sym_count; ++i)
+	{
+		const Elf64_Sym& sym = syms[i];
+		const string name = get_sym_name(i);
+
+		if (ELF64_ST_TYPE(sym.st_info) != STT_FUNC || name.compare(0ui64, sizeof(_stencil_prefix) - 1ui64, _stencil_prefix) != 0)
+			continue;
+
+		if ((uint64_t)sym.st_shndx >= shnum || sym.st_value + sym.st_size > shdr[sym.st_shndx].sh_size)
+			throw runtime_error(_err_msg_wrong_obj);
+
+		const uint8_t* text = obj + (ptrdiff_t)(shdr[sym.st_shndx].sh_offset + sym.st_value);
+		stencil_text stencil{ name.substr(sizeof(_stencil_prefix) - 1ui64), vector<uint8_t>(text, text + (ptrdiff_t)sym.st_size), {}, 0ui64 };
+		bool dropped = false;
+
+		for (uint64_t j = 0ui64; j < shnum && !dropped; ++j)
+		{
+			if (shdr[j].sh_type != SHT_RELA || (uint64_t)shdr[j].sh_info != (uint64_t)sym.st_shndx)
+				continue;
+
+			const Elf64_Rela* relas = (const Elf64_Rela*)(obj + (ptrdiff_t)shdr[j].sh_offset);
+			const uint64_t rela_count = shdr[j].sh_size / (uint64_t)sizeof(Elf64_Rela);
+
+			for (uint64_t k = 0ui64; k < rela_count && !dropped; ++k)
+			{
+				const Elf64_Rela& rela = relas[k];
+
+				if (rela.r_offset < sym.st_value || rela.r_offset >= sym.st_value + sym.st_size)
+					continue;
+
+				const string hole = get_sym_name((uint64_t)ELF64_R_SYM(rela.r_info));
+				uint64_t type = 0ui64;
+
+				while (type <= (uint64_t)stencil_hole_type::size && hole != _hole_names[type])
+					++type;
+
+				if (ELF64_R_TYPE(rela.r_info) != R_X86_64_64 || type > (uint64_t)stencil_hole_type::size
+					|| rela.r_offset + 8ui64 > sym.st_value + sym.st_size)
+					dropped = true;
+				else
+					stencil.holes.push_back(stencil_hole{ rela.r_offset - sym.st_value, rela.r_addend, (stencil_hole_type)type });
+			}
+		}
+
+		if (dropped)
+		{
+			_dropped.push_back(stencil.name);
+			continue;
+		}
+
+		// Closing movabs rax, __hole_next; jmp rax is cut when the next op follows right behind
+
+		const uint64_t size = (uint64_t)stencil.text.size();
+		stencil.tail = size;
+
+		if (size >= 12ui64 && stencil.text[size - 12ui64] == 0x48ui8 && stencil.text[size - 11ui64] == 0xB8ui8
+			&& stencil.text[size - 2ui64] == 0xFFui8 && stencil.text[size - 1ui64] == 0xE0ui8)
+			for (const stencil_hole& hole : stencil.holes)
+				if (hole.offset == size - 10ui64 && hole.type == stencil_hole_type::next && hole.addend == 0i64)
+					stencil.tail = size - 12ui64;
+
+		sort(stencil.holes.begin(), stencil.holes.end(), [](const stencil_hole& a, const stencil_hole& b)
+			{
+				return a.offset < b.offset;
+			});
+
+		_stencils.push_back(move(stencil));
+	}
+}
+
+string stencilgen::emit_stencils() const
+{
+	static constexpr char hex[] = "0123456789ABCDEF";
+
+	string out;
+	string table;
+
+	out += "#pragma once\n\n";
+	out += "#include <cstdint>\n\n";
+	out += "#include \"op.hpp\"\n";
+	out += "#include \"stencil.hpp\"\n\n";
+	out += "// Generated by compiler::stencilgen from stencil_src.cpp, do not edit\n\n";
+	out += "#ifdef X64JIT\n";
+	out += "namespace interpreter\n{";
+
+	for (const stencil_text& stencil : _stencils)
+	{
+		const bool shared = stencil.name == "leave" || stencil.name == "lookup" || stencil.name == "side";
+		const string text_name = "__stencil_text_" + stencil.name;
+		const string hole_name = stencil.holes.empty() ? string("nullptr") : "__stencil_hole_" + stencil.name;
+		const string item = "{ op::" + string(shared ? "nop" : stencil.name) + ", " + text_name + ", " + to_string(stencil.text.size())
+			+ "ui64, " + to_string(stencil.tail) + "ui64, " + hole_name + ", " + to_string(stencil.holes.size()) + "ui64 }";
+
+		out += "\n\tinline constexpr uint8_t " + text_name + "[] =\n\t{";
+
+		for (uint64_t i = 0ui64; i < stencil.text.size(); ++i)
+		{
+			out += i % 16ui64 == 0ui64 ? "\n\t\t" : " ";
+			out += "0x";
+			out += hex[stencil.text[i] >> 4ui8];
+			out += hex[stencil.text[i] & 0x0Fui8];
+			out += i + 1ui64 < stencil.text.size() ? "," : "";
+		}
+
+		out += "\n\t};\n";
+
+		if (!stencil.holes.empty())
+		{
+			out += "\n\tinline constexpr stencil_hole " + hole_name + "[] =\n\t{\n";
+
+			for (uint64_t i = 0ui64; i < stencil.holes.size(); ++i)
+				out += "\t\t{ " + to_string(stencil.holes[i].offset) + "ui64, " + to_string(stencil.holes[i].addend) + "i64, stencil_hole_type::"
+					+ _hole_types[(uint64_t)stencil.holes[i].type] + (i + 1ui64 < stencil.holes.size() ? " },\n" : " }\n");
+
+			out += "\t};\n";
+		}
+
+		if (shared)
+			out += "\n\tinline constexpr stencil stencil_" + stencil.name + " = " + item + ";\n";
+		else
+			table += (table.empty() ? "\t\t" : ",\n\t\t") + item;
+	}
+
+	out += "\n\t// stencils - one stencil per op that has one, ops missing here leave native code\n\n";
+	out += "\tinline constexpr stencil stencils[] =\n\t{\n" + table + "\n\t};\n";
+
+	if (!_dropped.empty())
+	{
+		out += "\n\t// Dropped: ";
+
+		for (uint64_t i = 0ui64; i < _dropped.size(); ++i)
+			out += _dropped[i] + (i + 1ui64 < _dropped.size() ? (i % 8ui64 == 7ui64 ? ",\n\t//          " : ", ") : "\n");
+	}
+
+	out += "}\n#endif";
+
+	return out;
+}
+#endif
\ No newline at end of file
@@ -1,9 +1,22 @@
 #pragma once
 
+#include <algorithm>
+#include <bit>
 #include <cstdint>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
+#include "decode.hpp"
+#include "define.hpp"
 #include "interpreter_type.hpp"
 #include "op.hpp"
+#include "op_asm.hpp"
+#include "profile.hpp"
+#include "stencil.hpp"
+#include "verify.hpp"
 
 namespace compiler
 {
@@ -11,4 +24,204 @@ namespace compiler
 	{
 		using namespace interpreter;
 	}
+
+	// op_sequence - statically adjacent ops and the number of times the first one was dispatched,
+	//               or the number of dispatches the sequence saves once picked by opgen
+
+	struct op_sequence
+	{
+		std::vector<interpreter::op> ops;
+		uint64_t count;
+	};
+
+	struct op_site;
+
+	// opgen - picks the sequences worth a generated op from a profile and writes them out as
+	//         op_gen.hpp (the table fuse_ops and the decoder read) and dispatcher_gen.hpp (the
+	//         handlers, one __dil_* call per op), a rebuild of the dispatcher picks both up
+
+	class opgen
+	{
+	private:
+		static constexpr const char _err_msg_wrong_count[] = "Wrong generated op count";
+		static constexpr const char _err_msg_wrong_size[] = "Wrong sequence length";
+
+		std::vector<op_sequence> _seqs;
+
+		static std::string __call(interpreter::op op_code);
+		static std::vector<op_site> __sites(const interpreter::op_profile& profile);
+
+	public:
+		static constexpr uint64_t max_count = (uint64_t)interpreter::op::gen_3 - (uint64_t)interpreter::op::gen_0 + 1ui64;
+		static constexpr uint64_t max_length = 3ui64;
+
+		// Only unfused straight ops with a __dil_* handler are taken, a jump may end a sequence
+
+		static bool is_straight(interpreter::op op_code) noexcept;
+		static bool is_jump(interpreter::op op_code) noexcept;
+
+		static std::vector<op_sequence> count_seqs(const interpreter::op_profile& profile, uint64_t length);
+
+		opgen() = delete;
+		opgen(const interpreter::op_profile& profile, uint64_t count = max_count);
+
+		inline const std::vector<op_sequence>& get_seqs() const noexcept
+		{
+			return _seqs;
+		}
+
+		std::string emit_ops() const;
+		std::string emit_handlers() const;
+	};
+
+	// op_site - longest run of ops opgen may fuse from one dispatched code byte, with the site
+	//           index of every op of the run or ~0 for ops never dispatched on their own
+
+	struct op_site
+	{
+		interpreter::op ops[opgen::max_length];
+		uint64_t next[opgen::max_length];
+		uint64_t length;
+		uint64_t count;
+	};
+
+	// optimizer - peephole pass over native endian unfused code: folds constant operands, drops
+	//             ops cancelling each other out and re-encodes branches over the shrunk code;
+	//             rewrites that would change evaluation flags or skip frame slot checks are made
+	//             for unchecked code only, code with computed control flow is kept as it is
+
+	class optimizer
+	{
+	private:
+		std::vector<uint8_t> _code;
+		uint64_t _removed;
+
+	public:
+		optimizer() = delete;
+		optimizer(const uint8_t* code, uint64_t code_size, interpreter::check_type chk_type);
+
+		inline const std::vector<uint8_t>& get_code() const noexcept
+		{
+			return _code;
+		}
+
+		// Ops the code is shorter by, each one a dispatch less wherever it ran
+
+		inline uint64_t get_removed() const noexcept
+		{
+			return _removed;
+		}
+	};
+
+	// inliner - splices leaf callees up to limit bytes into their call sites, a callee may not
+	//           call, exit or take its frame or stack pointer and every op of the code must have
+	//           one stack depth; callee slots are moved into the caller frame and rets drop the
+	//           stack the callee left, branches are re-encoded by op_asm::builder
+
+	class inliner
+	{
+	private:
+		std::vector<uint8_t> _code;
+		uint64_t _inlined;
+
+	public:
+		static constexpr uint64_t default_limit = 64ui64;
+
+		inliner() = delete;
+		inliner(const uint8_t* code, uint64_t code_size, uint64_t limit = default_limit);
+
+		inline const std::vector<uint8_t>& get_code() const noexcept
+		{
+			return _code;
+		}
+
+		// Call sites the code no longer dispatches call and ret for
+
+		inline uint64_t get_inlined() const noexcept
+		{
+			return _inlined;
+		}
+	};
+
+	// loop_report - loop header offset in the input code, slots hoisted and induction slots made
+	//               for it and dispatches saved per iteration
+
+	struct loop_report
+	{
+		uint64_t header;
+		uint64_t hoisted;
+		uint64_t reduced;
+		int64_t saved;
+	};
+
+	// loop_optimizer - finds natural loops over the control flow graph of native endian unfused
+	//                  code and numbers the values of their stack, pure computations of frame slots
+	//                  the loop never stores are hoisted before it and, for unchecked code, linear
+	//                  functions of a 64-bit slot stepped by a constant once per iteration become
+	//                  slots of their own stepped along with it; the slots sit under the stack at
+	//                  the loop header and are dropped on every way out of the loop
+
+	class loop_optimizer
+	{
+	private:
+		std::vector<uint8_t> _code;
+		std::vector<loop_report> _loops;
+
+	public:
+		loop_optimizer() = delete;
+		loop_optimizer(const uint8_t* code, uint64_t code_size, interpreter::check_type chk_type);
+
+		inline const std::vector<uint8_t>& get_code() const noexcept
+		{
+			return _code;
+		}
+
+		// Innermost loops rewritten, the code is kept as it is while empty
+
+		inline const std::vector<loop_report>& get_loops() const noexcept
+		{
+			return _loops;
+		}
+	};
+#ifdef X64JIT
+
+	// stencil_text - one stencil read from the object, name is the op name or leave, lookup, side
+
+	struct stencil_text
+	{
+		std::string name;
+		std::vector<uint8_t> text;
+		std::vector<interpreter::stencil_hole> holes;
+		uint64_t tail;
+	};
+
+	// stencilgen - reads the ELF object compiled from stencil_src.cpp and writes its stencils out
+	//              as stencil_gen.hpp, stencils with relocations other than 64-bit absolute ones
+	//              against __hole_* symbols are dropped and their ops stay with the interpreter
+
+	class stencilgen
+	{
+	private:
+		static constexpr const char _err_msg_wrong_obj[] = "Wrong stencil object";
+
+		std::vector<stencil_text> _stencils;
+		std::vector<std::string> _dropped;
+
+	public:
+		stencilgen() = delete;
+		stencilgen(const uint8_t* obj, uint64_t obj_size);
+
+		inline const std::vector<stencil_text>& get_stencils() const noexcept
+		{
+			return _stencils;
+		}
+
+		inline const std::vector<std::string>& get_dropped() const noexcept
+		{
+			return _dropped;
+		}
+
+		std::string emit_stencils() const;
+	};
+#endif
 }
\ No newline at end of file
@@ -0,0 +1,432 @@
+#include "decode.hpp"
+
+using namespace interpreter;
+using namespace std;
+
+static inline int64_t fetch_offset(const uint8_t* opptr, uint64_t width)
+{
+	switch (width)
+	{
+	case 8ui64:
+		return (int64_t)((const val64<>*)opptr)->si;
+
+	case 4ui64:
+		return (int64_t)((const val32<>*)opptr)->si;
+
+	case 2ui64:
+		return (int64_t)((const val16<>*)opptr)->si;
+
+	case 1ui64:
+		return (int64_t)((const val8<>*)opptr)->si;
+
+	default:
+		__assume(false);
+		break;
+	}
+}
+
+static inline uint64_t fetch_width(op op_code, op op_64)
+{
+	return 8ui64 >> ((uint64_t)op_code - (uint64_t)op_64);
+}
+
+inline void decoded_code::__def_obj() noexcept
+{
+	_code_beg = (const uint8_t*)nullptr;
+	_code_end = (const uint8_t*)nullptr;
+
+	_ops = (decoded_op*)nullptr;
+	_index = (uint32_t*)nullptr;
+	_count = 0ui64;
+}
+
+inline void decoded_code::__del_obj() noexcept
+{
+	if (_ops != (decoded_op*)nullptr)
+		delete[] _ops;
+
+	if (_index != (uint32_t*)nullptr)
+		delete[] _index;
+}
+
+inline void decoded_code::__mov_obj(decoded_code&& o) noexcept
+{
+	_code_beg = move(o._code_beg);
+	_code_end = move(o._code_end);
+
+	_ops = move(o._ops);
+	_index = move(o._index);
+	_count = move(o._count);
+}
+
+uint64_t decoded_code::get_size(const uint8_t* opptr, const uint8_t* ecode) noexcept
+{
+	const op op_code = get_base((op)*opptr);
+	uint64_t size;
+
+	switch (op_code)
+	{
+	case op::nativecall:
+	case op::nativecall_n:
+		size = ecode - opptr < (ptrdiff_t)3 ? 3ui64 : 4ui64 + (uint64_t)opptr[2];
+		break;
+
+	case op::call_64:
+	case op::jmp_64:
+	case op::jmp_a_64:
+	case op::jmp_ae_64:
+	case op::jmp_b_64:
+	case op::jmp_be_64:
+	case op::jmp_e_64:
+	case op::jmp_ne_64:
+	case op::jmp_un_64:
+	case op::push_64:
+		size = 9ui64;
+		break;
+
+	case op::call_32:
+	case op::jmp_32:
+	case op::jmp_a_32:
+	case op::jmp_ae_32:
+	case op::jmp_b_32:
+	case op::jmp_be_32:
+	case op::jmp_e_32:
+	case op::jmp_ne_32:
+	case op::jmp_un_32:
+	case op::push_32:
+		size = 5ui64;
+		break;
+
+	case op::call_16:
+	case op::jmp_16:
+	case op::jmp_a_16:
+	case op::jmp_ae_16:
+	case op::jmp_b_16:
+	case op::jmp_be_16:
+	case op::jmp_e_16:
+	case op::jmp_ne_16:
+	case op::jmp_un_16:
+	case op::push_16:
+	case op::l_alloc:
+	case op::l_allocz:
+	case op::l_dealloc:
+	case op::l_load_64:
+	case op::l_load_32:
+	case op::l_load_16:
+	case op::l_load_8:
+	case op::l_store_64:
+	case op::l_store_32:
+	case op::l_store_16:
+	case op::l_store_8:
+		size = 3ui64;
+		break;
+
+	case op::call_8:
+	case op::jmp_8:
+	case op::jmp_a_8:
+	case op::jmp_ae_8:
+	case op::jmp_b_8:
+	case op::jmp_be_8:
+	case op::jmp_e_8:
+	case op::jmp_ne_8:
+	case op::jmp_un_8:
+	case op::push_8:
+	case op::s_alloc:
+	case op::s_allocz:
+	case op::s_dealloc:
+	case op::s_load_64:
+	case op::s_load_32:
+	case op::s_load_16:
+	case op::s_load_8:
+	case op::s_store_64:
+	case op::s_store_32:
+	case op::s_store_16:
+	case op::s_store_8:
+	case op::s_ucmp_jmp_64:
+	case op::s_scmp_jmp_64:
+	case op::s_uinc_64:
+	case op::s_udec_64:
+	case op::s_uadd_64:
+	case op::s_move_64:
+		size = 2ui64;
+		break;
+
+	case op::jmp_msk_64:
+	case op::jmp_msk_32:
+	case op::jmp_msk_16:
+	case op::jmp_msk_8:
+		size = 2ui64 + fetch_width(op_code, op::jmp_msk_64) * 2ui64;
+		break;
+
+	case op::hostcall:
+	case op::importcall:
+		size = 5ui64;
+		break;
+
+	case op::callback:
+		size = ecode - opptr < (ptrdiff_t)3 ? 3ui64 : 8ui64 + (uint64_t)opptr[2];
+		break;
+
+	case op::imports:
+		size = ecode - opptr < (ptrdiff_t)3 ? 3ui64 : 3ui64 + (uint64_t)((const val16<>*)(opptr + (ptrdiff_t)1))->ui;
+		break;
+
+	default:
+		size = (uint8_t)op_code <= (uint8_t)op::f32_2_ui32 ? 1ui64 : 0ui64;
+		break;
+	}
+
+	return size == 0ui64 || ecode - opptr < (ptrdiff_t)size ? 0ui64 : size;
+}
+
+decoded_code::decoded_code() noexcept
+{
+	__def_obj();
+}
+
+decoded_code::decoded_code(const uint8_t* bcode, const uint8_t* ecode)
+{
+	const uint64_t code_size = (uint64_t)(ecode - bcode);
+
+	__def_obj();
+
+	if (code_size >= (uint64_t)~0ui32)
+		throw runtime_error(_err_msg_large_code);
+	else
+	{
+		try
+		{
+			_code_beg = bcode;
+			_code_end = ecode;
+
+			_index = (uint32_t*)new uint32_t[code_size];
+			memset(_index, 0xFFui8, (uint64_t)sizeof(uint32_t) * code_size);
+
+			for (const uint8_t* opptr = bcode; opptr < ecode; ++_count)
+			{
+				const uint64_t size = get_size(opptr, ecode);
+
+				_index[opptr - bcode] = (uint32_t)_count;
+				opptr += size == 0ui64 ? (ptrdiff_t)1 : (ptrdiff_t)size;
+			}
+
+			for (uint64_t i = 0ui64; i < code_size; ++i)
+				if (_index[i] == ~0ui32)
+					_index[i] = (uint32_t)_count;
+
+			_ops = (decoded_op*)new decoded_op[_count + 1ui64];
+			memset(_ops, 0ui8, (uint64_t)sizeof(decoded_op) * (_count + 1ui64));
+
+			decoded_op* rec = _ops;
+
+			for (const uint8_t* opptr = bcode; opptr < ecode; ++rec)
+			{
+				const uint64_t size = get_size(opptr, ecode);
+
+				if (size == 0ui64)
+				{
+					rec->code = (op)0xFFui8;
+					rec->target = (uint32_t)_count;
+
+					++opptr;
+					continue;
+				}
+
+				const uint8_t* next = opptr + (ptrdiff_t)size;
+				const op op_code = get_base((op)*opptr);
+
+				rec->code = op_code;
+				rec->target = (uint32_t)_count;
+
+				switch (op_code)
+				{
+				case op::nativecall:
+				case op::nativecall_n:
+				case op::callback:
+				case op::hostcall:
+				case op::importcall:
+					rec->operand = (uint64_t)(uintptr_t)(opptr + (ptrdiff_t)1);
+					break;
+
+				case op::push_flow:
+					rec->operand = (uint64_t)(uintptr_t)next;
+					break;
+
+				case op::call_64:
+				case op::call_32:
+				case op::call_16:
+				case op::call_8:
+					rec->code = op::call_8;
+					rec->operand = (uint64_t)(uintptr_t)next;
+					rec->target = (uint32_t)(get_op(next + (ptrdiff_t)fetch_offset(opptr + (ptrdiff_t)1,
+						fetch_width(op_code, op::call_64))) - _ops);
+					break;
+
+				case op::l_alloc:
+				case op::s_alloc:
+					rec->code = op::s_alloc;
+					rec->operand = op_code == op::l_alloc ? (uint64_t)((const val16<>*)(opptr + (ptrdiff_t)1))->ui : (uint64_t)opptr[1];
+					break;
+
+				case op::l_allocz:
+				case op::s_allocz:
+					rec->code = op::s_allocz;
+					rec->operand = op_code == op::l_allocz ? (uint64_t)((const val16<>*)(opptr + (ptrdiff_t)1))->ui : (uint64_t)opptr[1];
+					break;
+
+				case op::l_dealloc:
+				case op::s_dealloc:
+					rec->code = op::s_dealloc;
+					rec->operand = op_code == op::l_dealloc ? (uint64_t)((const val16<>*)(opptr + (ptrdiff_t)1))->ui : (uint64_t)opptr[1];
+					break;
+
+				case op::jmp_64:
+				case op::jmp_32:
+				case op::jmp_16:
+				case op::jmp_8:
+				case op::jmp_a_64:
+				case op::jmp_a_32:
+				case op::jmp_a_16:
+				case op::jmp_a_8:
+				case op::jmp_ae_64:
+				case op::jmp_ae_32:
+				case op::jmp_ae_16:
+				case op::jmp_ae_8:
+				case op::jmp_b_64:
+				case op::jmp_b_32:
+				case op::jmp_b_16:
+				case op::jmp_b_8:
+				case op::jmp_be_64:
+				case op::jmp_be_32:
+				case op::jmp_be_16:
+				case op::jmp_be_8:
+				case op::jmp_e_64:
+				case op::jmp_e_32:
+				case op::jmp_e_16:
+				case op::jmp_e_8:
+				case op::jmp_ne_64:
+				case op::jmp_ne_32:
+				case op::jmp_ne_16:
+				case op::jmp_ne_8:
+				case op::jmp_un_64:
+				case op::jmp_un_32:
+				case op::jmp_un_16:
+				case op::jmp_un_8:
+				{
+					// Every jmp_cc_b group is 64, 32, 16, 8 in a row, records keep the 8-bit one
+
+					const uint64_t group = ((uint64_t)op_code - (uint64_t)op::jmp_64) & ~3ui64;
+					const op op_64 = (op)((uint64_t)op::jmp_64 + group);
+
+					rec->code = (op)((uint64_t)op_64 + 3ui64);
+					rec->target = (uint32_t)(get_op(next + (ptrdiff_t)fetch_offset(opptr + (ptrdiff_t)1,
+						fetch_width(op_code, op_64))) - _ops);
+					break;
+				}
+
+				case op::jmp_msk_64:
+				case op::jmp_msk_32:
+				case op::jmp_msk_16:
+				case op::jmp_msk_8:
+				{
+					const uint64_t width = fetch_width(op_code, op::jmp_msk_64);
+
+					rec->mask_type = (type)opptr[1];
+					memcpy(&rec->operand, opptr + (ptrdiff_t)2, width);
+					rec->target = (uint32_t)(get_op(next + (ptrdiff_t)fetch_offset(opptr + (ptrdiff_t)(2ui64 + width),
+						width)) - _ops);
+					break;
+				}
+
+				case op::l_load_64:
+				case op::l_load_32:
+				case op::l_load_16:
+				case op::l_load_8:
+					rec->code = (op)((uint64_t)op_code - (uint64_t)op::l_load_64 + (uint64_t)op::s_load_64);
+					rec->operand = (uint64_t)fetch_offset(opptr + (ptrdiff_t)1, 2ui64);
+					break;
+
+				case op::l_store_64:
+				case op::l_store_32:
+				case op::l_store_16:
+				case op::l_store_8:
+					rec->code = (op)((uint64_t)op_code - (uint64_t)op::l_store_64 + (uint64_t)op::s_store_64);
+					rec->operand = (uint64_t)fetch_offset(opptr + (ptrdiff_t)1, 2ui64);
+					break;
+
+				case op::s_load_64:
+				case op::s_load_32:
+				case op::s_load_16:
+				case op::s_load_8:
+				case op::s_store_64:
+				case op::s_store_32:
+				case op::s_store_16:
+				case op::s_store_8:
+				case op::s_ucmp_jmp_64:
+				case op::s_scmp_jmp_64:
+				case op::s_uinc_64:
+				case op::s_udec_64:
+				case op::s_uadd_64:
+				case op::s_move_64:
+					rec->operand = (uint64_t)fetch_offset(opptr + (ptrdiff_t)1, 1ui64);
+					break;
+
+				case op::push_64:
+				case op::push_32:
+				case op::push_16:
+				case op::push_8:
+					memcpy(&rec->operand, opptr + (ptrdiff_t)1, fetch_width(op_code, op::push_64));
+					break;
+
+				default:
+					break;
+				}
+
+				// Fused ops read the records of the ops they cover, so a generated op keeps the
+				// operand of its first op and its handler finds the byte code through target
+
+				if ((op)*opptr != op_code)
+				{
+					rec->code = (op)*opptr;
+					rec->target = (uint32_t)(opptr + (ptrdiff_t)1 - bcode);
+				}
+
+				opptr = next;
+			}
+
+			rec->code = (op)0xFFui8;
+			rec->target = (uint32_t)_count;
+		}
+		catch (const exception& e)
+		{
+			__del_obj();
+			__def_obj();
+
+			throw e;
+		}
+	}
+}
+
+decoded_code::decoded_code(decoded_code&& o) noexcept
+{
+	__mov_obj(move(o));
+	o.__def_obj();
+}
+
+decoded_code::~decoded_code() noexcept
+{
+	__del_obj();
+	__def_obj();
+}
+
+decoded_code& decoded_code::operator=(decoded_code&& o) noexcept
+{
+	if (this != &o)
+	{
+		__del_obj();
+		__mov_obj(move(o));
+		o.__def_obj();
+	}
+
+	return *this;
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#include "interpreter_type.hpp"
+#include "op.hpp"
+#include "op_gen.hpp"
+
+namespace interpreter
+{
+	// decoded_op - fixed-size translation of one byte-code instruction
+	//
+	//              operand   - immediate value, frame offset, allocation size, mask
+	//                          or absolute code pointer (native endianness, zero-extended)
+	//              target    - record index of branch or call destination,
+	//                          code offset past the op byte for generated ops
+	//              code      - handler op, size variants of equal handlers share one op
+	//              mask_type - jmp_msk type
+
+	struct alignas(16ui64) decoded_op
+	{
+		uint64_t operand;
+		uint32_t target;
+		op code;
+		type mask_type;
+	};
+
+	class decoded_code
+	{
+	private:
+		static constexpr const char _err_msg_large_code[] = "Code size is too large";
+
+		const uint8_t* _code_beg;
+		const uint8_t* _code_end;
+
+		// Records are followed by one invalid record every unresolved control transfer lands on,
+		// index maps every code byte to its record or to the invalid one inside instructions
+
+		decoded_op* _ops;
+		uint32_t* _index;
+		uint64_t _count;
+
+		inline void __def_obj() noexcept;
+		inline void __del_obj() noexcept;
+		inline void __mov_obj(decoded_code&& o) noexcept;
+
+	public:
+		static uint64_t get_size(const uint8_t* opptr, const uint8_t* ecode) noexcept;
+
+		// Generated ops decode as the first op of their sequence everywhere but in dispatch
+
+		static inline op get_base(op op_code) noexcept
+		{
+			if ((uint8_t)op_code >= (uint8_t)op::gen_0 && (uint8_t)op_code <= (uint8_t)op::gen_3)
+				return gen_ops[(uint8_t)op_code - (uint8_t)op::gen_0][0ui64];
+			else
+				return op_code;
+		}
+
+		decoded_code() noexcept;
+		decoded_code(const uint8_t* bcode, const uint8_t* ecode);
+		decoded_code(const decoded_code& o) = delete;
+		decoded_code(decoded_code&& o) noexcept;
+		~decoded_code() noexcept;
+
+		inline bool empty() const noexcept
+		{
+			return _ops == (decoded_op*)nullptr;
+		}
+
+		inline const uint8_t* get_code_beg() const noexcept
+		{
+			return _code_beg;
+		}
+
+		inline uint64_t get_count() const noexcept
+		{
+			return _count;
+		}
+
+		inline const decoded_op* get_ops() const noexcept
+		{
+			return _ops;
+		}
+
+		inline const decoded_op* get_op(const uint8_t* opptr) const noexcept
+		{
+			if (opptr < _code_beg || opptr >= _code_end)
+				return _ops + (ptrdiff_t)_count;
+			else
+				return _ops + (ptrdiff_t)_index[opptr - _code_beg];
+		}
+
+		decoded_code& operator=(const decoded_code& o) = delete;
+		decoded_code& operator=(decoded_code&& o) noexcept;
+	};
+}
@@ -1,6 +1,22 @@
 #pragma once
 
 #define DEEPINLINE
+#define FUSEDOPS
+#define INLINECALLS
+#define LOOPOPT
+#define NATIVETRAMP
+#define PEEPHOLE
+
+// #define DIRECTTHREAD
+// #define PREDECODE
+// #define TOSCACHE
+// #define REGISTERVM
+// #define TEMPLATEJIT
+// #define STENCILJIT
+// #define TRACEJIT
+
+// #define OPPROFILE
+// #define STENCILGEN
 
 // #define OPINTCHECK
 
@@ -17,4 +33,21 @@
 #if (defined(_MSC_VER) && (defined(_M_ARM) || defined(_M_ARM64) || defined(_M_ARM64EC) || defined(_M_IX86) || defined(_M_X64)))
 #define MSVCBTSWAP
 #define MSVCROTATE
+#endif
+
+#if (defined(DEEPINLINE) && (defined(__GNUC__) || defined(__clang__)))
+#define GNUCTHREAD
+#endif
+
+#if (defined(DEEPINLINE) && (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__) && defined(__linux__))
+#define X64JIT
+#endif
+
+#if (defined(NATIVETRAMP) && defined(__x86_64__) && !defined(_WIN32))
+#define SYSVTRAMP
+#endif
+
+#if ((defined(FETCHCHECK) || defined(STACKCHECK) || defined(OPINTCHECK) || defined(FLOATCHECK) || defined(MTYPECHECK)) \
+	&& !(defined(FETCHCHECK) && defined(STACKCHECK) && defined(OPINTCHECK) && defined(FLOATCHECK) && defined(MTYPECHECK)))
+#define PARTIALCHECK
 #endif
\ No newline at end of file
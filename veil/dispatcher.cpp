@@ -103,6 +103,90 @@ namespace interpreter
 	};
 }
 
+void dispatcher::fuse_ops(uint8_t* code, uint64_t code_size)
+{
+	fuse_ops(code, (const uint8_t*)(code + (ptrdiff_t)code_size));
+}
+
+void dispatcher::fuse_ops(uint8_t* bcode, const uint8_t* ecode)
+{
+	// Only the first op byte is rewritten and sequences are matched on original ops ahead of
+	// the sweep, so every op inside a fused sequence keeps working as a jump target
+	//
+	// Generated ops are tried after the fixed ones and left out of profiled builds, which
+	// count what remains unfused to generate them
+
+	const uint8_t* seq[4ui64];
+
+	while (bcode < ecode)
+	{
+		uint64_t count = 0ui64;
+
+		for (const uint8_t* opptr = bcode; count < 4ui64 && opptr < ecode; ++count)
+		{
+			const uint64_t size = decoded_code::get_size(opptr, ecode);
+
+			if (size == 0ui64)
+				break;
+
+			seq[count] = opptr;
+			opptr += (ptrdiff_t)size;
+		}
+
+		if (count == 0ui64)
+		{
+			++bcode;
+			continue;
+		}
+
+		const uint64_t size = decoded_code::get_size(bcode, ecode);
+		const op op_0 = (op)*bcode;
+
+		if (op_0 == op::s_load_64 && count >= 2ui64)
+		{
+			const op op_1 = (op)*seq[1ui64];
+			const op op_2 = count >= 3ui64 ? (op)*seq[2ui64] : op::nop;
+			const op op_3 = count >= 4ui64 ? (op)*seq[3ui64] : op::nop;
+
+			const bool jcc = (uint8_t)op_3 >= (uint8_t)op::jmp_8 && (uint8_t)op_3 <= (uint8_t)op::jmp_un_8
+				&& (((uint8_t)op_3 - (uint8_t)op::jmp_8) & 3ui8) == 0ui8;
+
+			if (op_1 == op::push_64 && op_2 == op::ucmp_64 && jcc)
+				*bcode = (uint8_t)op::s_ucmp_jmp_64;
+			else if (op_1 == op::push_64 && op_2 == op::scmp_64 && jcc)
+				*bcode = (uint8_t)op::s_scmp_jmp_64;
+			else if (op_1 == op::uinc_64 && op_2 == op::s_store_64 && seq[2ui64][1ui64] == bcode[1ui64])
+				*bcode = (uint8_t)op::s_uinc_64;
+			else if (op_1 == op::udec_64 && op_2 == op::s_store_64 && seq[2ui64][1ui64] == bcode[1ui64])
+				*bcode = (uint8_t)op::s_udec_64;
+			else if (op_1 == op::s_load_64 && op_2 == op::uadd_64)
+				*bcode = (uint8_t)op::s_uadd_64;
+			else if (op_1 == op::s_store_64)
+				*bcode = (uint8_t)op::s_move_64;
+		}
+
+	#ifndef OPPROFILE
+		if ((op)*bcode == op_0 && (uint8_t)op_0 <= (uint8_t)op::f32_2_ui32)
+			for (uint64_t i = 0ui64; i < gen_count; ++i)
+			{
+				uint64_t length = 0ui64;
+
+				while (length < gen_length && gen_ops[i][length] != op::nop && length < count
+					&& gen_ops[i][length] == (op)*seq[length])
+					++length;
+
+				if (length != 0ui64 && (length == gen_length || gen_ops[i][length] == op::nop))
+				{
+					*bcode = (uint8_t)((uint64_t)op::gen_0 + i);
+					break;
+				}
+			}
+	#endif
+
+		bcode += (ptrdiff_t)size;
+	}
+}
+
 void dispatcher::rev_endian(uint8_t* code, uint64_t code_size)
 {
 	rev_endian(code, (const uint8_t*)(code + (ptrdiff_t)code_size));
@@ -215,6 +299,80 @@ void dispatcher::rev_endian(uint8_t* bcode, const uint8_t* ecode)
 			break;
 		}
 
+		case op::imports:
+		{
+			uint8_t* sptr = bcode;
+
+			if (fbyteswap<val16<>>::fbs(bcode, ecode))
+				return;
+
+			// Only entry indices are wider than a byte, the rest of an entry is stepped over
+
+			const uint8_t* send = sptr + (ptrdiff_t)2 + (ptrdiff_t)((const val16<>*)sptr)->ui;
+
+			if (send > ecode)
+				send = ecode;
+
+			while (bcode < send)
+			{
+				if (fbyteswap<val16<>>::fbs(bcode, send) || bcode + (ptrdiff_t)2 > send)
+					break;
+
+				bcode += (ptrdiff_t)3 + (ptrdiff_t)bcode[1];
+
+				for (uint64_t i = 0ui64; i < 2ui64 && bcode < send; ++i)
+					bcode += (ptrdiff_t)1 + (ptrdiff_t)*bcode;
+			}
+
+			bcode = (uint8_t*)send;
+			break;
+		}
+
+		case op::nativecall_n:
+		{
+			if (fbyteswap<val8<>>::fbs(bcode, ecode) || bcode >= ecode)
+				return;
+
+			// Argument types are single bytes, there is nothing in them to swap
+
+			if (bcode + (ptrdiff_t)2 + (ptrdiff_t)*bcode > ecode)
+				return;
+
+			bcode += (ptrdiff_t)2 + (ptrdiff_t)*bcode;
+			break;
+		}
+
+		case op::callback:
+		{
+			if (fbyteswap<val8<>>::fbs(bcode, ecode) || bcode >= ecode)
+				return;
+
+			if (bcode + (ptrdiff_t)2 + (ptrdiff_t)*bcode > ecode)
+				return;
+
+			bcode += (ptrdiff_t)2 + (ptrdiff_t)*bcode;
+
+			if (fbyteswap<val32<>>::fbs(bcode, ecode))
+				return;
+
+			break;
+		}
+
+		case op::hostcall:
+		case op::importcall:
+		{
+			if (fbyteswap<val16<>>::fbs(bcode, ecode))
+				return;
+
+			if (fbyteswap<val8<>>::fbs(bcode, ecode))
+				return;
+
+			if (fbyteswap<val8<>>::fbs(bcode, ecode))
+				return;
+
+			break;
+		}
+
 		case op::jmp_msk_64:
 		{
 			if (fbyteswap<val8<>>::fbs(bcode, ecode))
@@ -277,32 +435,135 @@ void dispatcher::rev_endian(uint8_t* bcode, const uint8_t* ecode)
 	}
 }
 
-#ifdef FETCHCHECK
-dispatcher::dispatcher(const uint8_t* code, uint64_t code_size, uint64_t cache_size, uint64_t stack_size)
-	: dispatcher(code, code + (ptrdiff_t)code_size, cache_size, stack_size) {}
+dispatcher::dispatcher(const uint8_t* code, uint64_t code_size, uint64_t cache_size, uint64_t stack_size,
+	dispatch_type disp_type, check_type chk_type)
+	: dispatcher(code, code + (ptrdiff_t)code_size, cache_size, stack_size, disp_type, chk_type) {}
+
+dispatcher::dispatcher(const uint8_t* bcode, const uint8_t* ecode, uint64_t cache_size, uint64_t stack_size,
+	dispatch_type disp_type, check_type chk_type) : _code_beg(bcode), _code_end(ecode), _dispatch_type(disp_type),
+	_check_type(chk_type), _decoded(), _register(), _nativehub(cache_size), _stack(stack_size), _opptr(bcode), _state()
+{
+	_nativehub.load(bcode, ecode);
+	_nativehub.bind_callbacks((void*)this, &__enter);
+
+	if (_dispatch_type == dispatch_type::decoded)
+		_decoded = move(decoded_code(bcode, ecode));
+
+	if (_dispatch_type == dispatch_type::registered)
+		_register = move(register_code(bcode, ecode));
+#ifdef X64JIT
+
+	if (_dispatch_type == dispatch_type::jitted)
+		_jit = move(jit_code(bcode, ecode));
+
+	if (_dispatch_type == dispatch_type::patched)
+		_stencil = move(stencil_code(bcode, ecode));
+
+	if (_dispatch_type == dispatch_type::traced)
+		_trace = move(trace_code(bcode, ecode));
+#endif
+#ifdef OPPROFILE
+
+	_profile = move(op_profile(bcode, ecode));
+#endif
+#ifdef DEEPINLINE
 
-dispatcher::dispatcher(const uint8_t* bcode, const uint8_t* ecode, uint64_t cache_size, uint64_t stack_size)
-	: _code_beg(bcode), _code_end(ecode), _nativehub(cache_size), _stack(stack_size), _opptr(bcode), _state() {}
+	if (_check_type == check_type::checked)
+		_verified = move(verified_code(bcode, ecode));
+#endif
+}
+
+#if (defined(DEEPINLINE) || !defined(FETCHCHECK))
+dispatcher::dispatcher(const uint8_t* code, uint64_t cache_size, uint64_t stack_size, dispatch_type disp_type)
+	: _code_beg(code), _code_end((const uint8_t*)nullptr), _dispatch_type(disp_type), _check_type(check_type::unchecked),
+	_decoded(), _register(), _nativehub(cache_size), _stack(stack_size), _opptr(code), _state()
+{
+	_nativehub.bind_callbacks((void*)this, &__enter);
+}
+#endif
 
 dispatcher::dispatcher(dispatcher&& o) noexcept : _code_beg(move(o._code_beg)), _code_end(move(o._code_end)),
-_nativehub(move(o._nativehub)), _stack(move(o._stack)), _opptr(move(o._opptr)), _state(move(o._state))
+	_dispatch_type(move(o._dispatch_type)), _check_type(move(o._check_type)), _decoded(move(o._decoded)),
+	_register(move(o._register)),
+#ifdef X64JIT
+	_jit(move(o._jit)), _stencil(move(o._stencil)), _trace(move(o._trace)),
+#endif
+	_nativehub(move(o._nativehub)), _stack(move(o._stack)), _opptr(move(o._opptr)), _state(move(o._state)),
+	_thrown(move(o._thrown))
 {
+	_nativehub.bind_callbacks((void*)this, &__enter);
+
+#ifdef OPPROFILE
+	_profile = move(o._profile);
+
+#endif
+#ifdef DEEPINLINE
+	_verified = move(o._verified);
+
+#endif
 	o._code_beg = (const uint8_t*)nullptr;
 	o._code_end = (const uint8_t*)nullptr;
 	o._opptr = (const uint8_t*)nullptr;
 	o._state = move(state());
+	o._thrown = (exception_ptr)nullptr;
 }
-#else
-dispatcher::dispatcher(const uint8_t* code, uint64_t cache_size, uint64_t stack_size)
-	: _nativehub(cache_size), _stack(stack_size), _opptr(code), _state() {}
 
-dispatcher::dispatcher(dispatcher&& o) noexcept
-	: _nativehub(move(o._nativehub)), _stack(move(o._stack)), _opptr(move(o._opptr)), _state(move(o._state))
+void dispatcher::__enter(void* context, const nativecallback& callback, void* ret_val, void** arg_val) noexcept
 {
-	o._opptr = (const uint8_t*)nullptr;
-	o._state = move(state());
+	((dispatcher*)context)->enter(callback, ret_val, arg_val);
+}
+
+void dispatcher::enter(const nativecallback& callback, void* ret_val, void** arg_val) noexcept
+{
+	// Native code calling back after a callback threw gets the zeroed return value until the
+	// native op returns
+
+	if (_thrown != (exception_ptr)nullptr)
+		return;
+
+	const uintptr_t ftop = _stack.get_ftop();
+	const uintptr_t stop = _stack.get_stop();
+
+	const uint8_t* opptr = _opptr;
+	const state state = _state;
+
+	try
+	{
+	#ifdef DEEPINLINE
+		// Callback frames are checked the way the code start frame is, their arguments are known
+
+		if (_check_type == check_type::checked)
+			stack_type::dil_check(_stack.get_send(), ftop, stop, 0ui64,
+				callback.get_args() + (uint64_t)sizeof(uint64_t) * 2ui64 + _verified.get_frame(callback.get_entry()));
+
+	#endif
+		// Frame above the callback frame ends where its arguments do, whatever frame the stack
+		// top was in
+
+		_stack.set_ftop(stop);
+		callback.get_call().push_args(_stack, arg_val);
+		_stack.push_frame((uintptr_t)nullptr);
+
+		const uintptr_t frame = _stack.get_ftop();
+
+		_opptr = callback.get_entry();
+		loop();
+
+		_stack.set_ftop(frame);
+		_stack.pop_frame();
+		callback.get_call().pop_ret(_stack, ret_val);
+	}
+	catch (...)
+	{
+		_thrown = current_exception();
+	}
+
+	_stack.set_ftop(ftop);
+	_stack.set_stop(stop);
+
+	_opptr = opptr;
+	_state = state;
 }
-#endif
 
 void dispatcher::exit()
 {
@@ -311,11 +572,141 @@ void dispatcher::exit()
 
 void dispatcher::init()
 {
+#ifdef DEEPINLINE
+	// Arguments the code start reads and the stack its frame or the whole run takes are checked
+	// once the arguments are pushed
+
+	if (_check_type == check_type::checked)
+		stack_type::dil_check(_stack.get_send(), _stack.get_ftop(), _stack.get_stop(), _verified.get_args(),
+			_verified.get_args() + (uint64_t)sizeof(uint64_t) * 2ui64 + _verified.get_stack());
+
+#endif
 	_stack.push_frame((uintptr_t)nullptr);
 }
 
 void dispatcher::loop()
 {
+#ifdef DEEPINLINE
+	// Checked code not proven whole runs the switch loop checking every op it has no proof for,
+	// the other loops are built with the default policy so any other policy runs the switch loop;
+	// unchecked code keeps the operand checks the default policy is built with
+
+	if (_check_type == check_type::checked)
+	{
+		if (!_verified.is_whole())
+		{
+			__loop_switch<false, checked_policy>();
+			return;
+		}
+		else if constexpr (!is_same_v<default_policy, checked_policy> && !is_same_v<default_policy, proven_policy>)
+		{
+			__loop_switch<false, proven_policy>();
+			return;
+		}
+	}
+	else if constexpr (default_policy::fetch_check || default_policy::stack_check)
+	{
+		__loop_switch<false, unchecked_policy>();
+		return;
+	}
+
+#endif
+#ifdef OPPROFILE
+	__loop_switch();
+#else
+	switch (_dispatch_type)
+	{
+	case dispatch_type::switched:
+		__loop_switch();
+		break;
+
+	case dispatch_type::threaded:
+	#ifdef GNUCTHREAD
+		__loop_thread();
+	#else
+		__loop_switch();
+	#endif
+		break;
+
+	case dispatch_type::decoded:
+	#ifdef DEEPINLINE
+		if (!_decoded.empty())
+			__loop_decode();
+		else
+			__loop_switch();
+	#else
+		__loop_switch();
+	#endif
+		break;
+
+	case dispatch_type::cached:
+	#ifdef DEEPINLINE
+		__loop_cache();
+	#else
+		__loop_switch();
+	#endif
+		break;
+
+	case dispatch_type::registered:
+	#ifdef DEEPINLINE
+		if (!_register.empty())
+			__loop_register();
+		else
+			__loop_switch();
+	#else
+		__loop_switch();
+	#endif
+		break;
+
+	case dispatch_type::jitted:
+	#ifdef X64JIT
+		if (!_jit.empty())
+			__loop_native(_jit);
+		else
+			__loop_switch();
+	#else
+		__loop_switch();
+	#endif
+		break;
+
+	case dispatch_type::patched:
+	#ifdef X64JIT
+		if (!_stencil.empty())
+			__loop_native(_stencil);
+		else
+			__loop_switch();
+	#else
+		__loop_switch();
+	#endif
+		break;
+
+	case dispatch_type::traced:
+	#ifdef X64JIT
+		if (!_trace.empty())
+			__loop_trace();
+		else
+			__loop_switch();
+	#else
+		__loop_switch();
+	#endif
+		break;
+
+	default:
+		__assume(false);
+		break;
+	}
+#endif
+}
+
+// DEEPINLINE handlers are shared with the other dispatch loops and run here as switch cases
+
+#define __OP(name) case op::name
+#define __OP_FLOW(name) case op::name
+#define __OP_NEXT break
+
+template <bool STEP, typename P>
+void dispatcher::__loop_switch()
+{
 #ifdef DEEPINLINE
 	uint8_t* data = _stack.get_data();
 	uint64_t size = _stack.get_size();
@@ -328,12 +719,27 @@ void dispatcher::loop()
 	state state = _state;
 #endif
 
-	while (true)
+	// Single step runs one op native code has no template or stencil for
+
+	do
 	{
+	#ifdef OPPROFILE
+	#ifdef DEEPINLINE
+		_profile.hit(opptr);
+	#else
+		_profile.hit(_opptr);
+	#endif
+	#endif
 	#ifdef DEEPINLINE
-		const op op_code = (op)dil_fetch<val8<>>(opptr).ui;
+		op op_code = (P::fetch_check || P::stack_check) && !_verified.is_safe(opptr)
+			? __dil_check<P>(opptr, send, ftop, stop) : (op)dil_fetch<val8<>>(opptr).ui;
+
+		// Generated ops are built from default policy handlers, any other policy runs their ops
+
+		if constexpr (!is_same_v<P, default_policy>)
+			op_code = decoded_code::get_base(op_code);
 	#else
-		const op op_code = (op)fetch<val8<>>().ui;
+		const op op_code = decoded_code::get_base((op)fetch<val8<>>().ui);
 	#endif
 
 		switch (op_code)
@@ -344,2259 +750,1369 @@ void dispatcher::loop()
 		case op::exit:
 			return;
 
+	#ifdef DEEPINLINE
+	#include "dispatcher_op_code.hpp"
+	#include "dispatcher_op_stack.hpp"
+	#else
 		case op::nativecall:
 		{
-		#ifdef DEEPINLINE
-			uintptr_t stop_temp = stop;
-			const uint8_t* opptr_temp = opptr;
+			if constexpr (default_policy::fetch_check)
+				_nativehub.call(_opptr, _stack, _code_beg, _code_end);
+			else
+				_nativehub.call(_opptr, _stack);
 
-			_nativehub.call(opptr_temp, stop_temp);
+			__dil_thrown();
+			break;
+		}
 
-			stop = stop_temp;
-			opptr = opptr_temp;
-		#else
-		#ifdef FETCHCHECK
-			_nativehub.call(_opptr, _stack, _code_beg, _code_end);
-		#else
-			_nativehub.call(_opptr, _stack);
-		#endif
-		#endif
+		case op::nativecall_n:
+		{
+			if constexpr (default_policy::fetch_check)
+				_nativehub.call_n(_opptr, _stack, _code_beg, _code_end);
+			else
+				_nativehub.call_n(_opptr, _stack);
+
+			__dil_thrown();
 			break;
 		}
 
 		case op::ret:
 		{
-		#ifdef DEEPINLINE
-			opptr = (const uint8_t*)stack_type::dil_pop_frame(ftop, stop);
-		#else
 			_opptr = (const uint8_t*)_stack.pop_frame();
-		#endif
 			break;
 		}
 
 		case op::call_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_call<val64<>>(opptr, ftop, stop);
-		#else
 			__call<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::call_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_call<val32<>>(opptr, ftop, stop);
-		#else
 			__call<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::call_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_call<val16<>>(opptr, ftop, stop);
-		#else
 			__call<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::call_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_call<val8<>>(opptr, ftop, stop);
-		#else
 			__call<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::memcpy:
 		{
-		#ifdef DEEPINLINE
-			uint8_t* dst = (uint8_t*)stack_type::dil_pop_ptr(stop);
-			uint8_t* src = (uint8_t*)stack_type::dil_pop_ptr(stop);
-			const uint64_t c = stack_type::dil_pop<val64<>>(stop).ui;
-
-			memcpy(dst, src, c);
-		#else
 			uint8_t* dst = (uint8_t*)_stack.pop_ptr();
 			uint8_t* src = (uint8_t*)_stack.pop_ptr();
 			uint64_t c = _stack.pop<val64<>>().ui;
 
 			memcpy(dst, src, c);
-		#endif
 			break;
 		}
 
 		case op::memset:
 		{
-		#ifdef DEEPINLINE
-			uint8_t* dst = (uint8_t*)stack_type::dil_pop_ptr(stop);
-			const uint8_t val = stack_type::dil_pop<val8<>>(stop).ui;
-			const uint64_t c = stack_type::dil_pop<val64<>>(stop).ui;
-
-			memset(dst, val, c);
-		#else
 			uint8_t* dst = (uint8_t*)_stack.pop_ptr();
 			uint8_t val = _stack.pop<val8<>>().ui;
 			uint64_t c = _stack.pop<val64<>>().ui;
 
 			memset(dst, val, c);
-		#endif
 			break;
 		}
 
 		case op::l_alloc:
 		{
-		#ifdef DEEPINLINE
-			stack_type::dil_alloc(stop, (uint64_t)dil_fetch<val16<>>(opptr).ui);
-		#else
 			_stack.alloc((uint64_t)fetch<val16<>>().ui);
-		#endif
 			break;
 		}
 
 		case op::s_alloc:
 		{
-		#ifdef DEEPINLINE
-			stack_type::dil_alloc(stop, (uint64_t)dil_fetch<val8<>>(opptr).ui);
-		#else
 			_stack.alloc((uint64_t)fetch<val8<>>().ui);
-		#endif
 			break;
 		}
 
 		case op::l_allocz:
 		{
-		#ifdef DEEPINLINE
-			stack_type::dil_allocz(stop, (uint64_t)dil_fetch<val16<>>(opptr).ui);
-		#else
 			_stack.allocz((uint64_t)fetch<val16<>>().ui);
-		#endif
 			break;
 		}
 
 		case op::s_allocz:
 		{
-		#ifdef DEEPINLINE
-			stack_type::dil_allocz(stop, (uint64_t)dil_fetch<val8<>>(opptr).ui);
-		#else
 			_stack.allocz((uint64_t)fetch<val8<>>().ui);
-		#endif
 			break;
 		}
 
 		case op::l_dealloc:
 		{
-		#ifdef DEEPINLINE
-			stack_type::dil_dealloc(stop, (uint64_t)dil_fetch<val16<>>(opptr).ui);
-		#else
 			_stack.dealloc((uint64_t)fetch<val16<>>().ui);
-		#endif
 			break;
 		}
 
 		case op::s_dealloc:
 		{
-		#ifdef DEEPINLINE
-			stack_type::dil_dealloc(stop, (uint64_t)dil_fetch<val8<>>(opptr).ui);
-		#else
 			_stack.dealloc((uint64_t)fetch<val8<>>().ui);
-		#endif
 			break;
 		}
 
 		case op::push_flow:
 		{
-		#ifdef DEEPINLINE
-			stack_type::dil_push_ptr(stop, (uintptr_t)opptr);
-		#else
 			_stack.push_ptr((uintptr_t)_opptr);
-		#endif
 			break;
 		}
 
 		case op::push_frame:
 		{
-		#ifdef DEEPINLINE
-			stack_type::dil_store_frame(ftop, stop);
-		#else
 			_stack.store_frame();
-		#endif
 			break;
 		}
 
 		case op::push_stack:
 		{
-		#ifdef DEEPINLINE
-			stack_type::dil_store_stack(stop);
-		#else
 			_stack.store_stack();
-		#endif
 			break;
 		}
 
 		case op::push_state:
 		{
-		#ifdef DEEPINLINE
-			stack_type::dil_push(stop, (state_val<>(state)).__value);
-		#else
 			_stack.push((state_val<>(_state)).__value);
-		#endif
 			break;
 		}
 
 		case op::pop_flow:
 		{
-		#ifdef DEEPINLINE
-			opptr = (const uint8_t*)stack_type::dil_pop_ptr(stop);
-		#else
 			_opptr = (const uint8_t*)_stack.pop_ptr();
-		#endif
 			break;
 		}
 
 		case op::pop_frame:
 		{
-		#ifdef DEEPINLINE
-			stack_type::dil_load_frame(ftop, stop);
-		#else
 			_stack.load_frame();
-		#endif
 			break;
 		}
 
 		case op::pop_stack:
 		{
-		#ifdef DEEPINLINE
-			stack_type::dil_load_stack(stop);
-		#else
 			_stack.load_stack();
-		#endif
 			break;
 		}
 
 		case op::pop_state:
 		{
-		#ifdef DEEPINLINE
-			state = (state_val<>(stack_type::dil_pop<val16<>>(stop))).__state;
-		#else
 			_state = (state_val<>(_stack.pop<val16<>>())).__state;
-		#endif
 			break;
 		}
 
 		case op::jmp_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp<val64<>>(opptr);
-		#else
 			__jmp<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::jmp_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp<val32<>>(opptr);
-		#else
 			__jmp<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::jmp_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp<val16<>>(opptr);
-		#else
 			__jmp<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::jmp_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp<val8<>>(opptr);
-		#else
 			__jmp<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::jmp_a_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp_a<val64<>>(opptr, state);
-		#else
 			__jmp_a<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::jmp_a_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp_a<val32<>>(opptr, state);
-		#else
 			__jmp_a<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::jmp_a_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp_a<val16<>>(opptr, state);
-		#else
 			__jmp_a<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::jmp_a_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp_a<val8<>>(opptr, state);
-		#else
 			__jmp_a<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::jmp_ae_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp_ae<val64<>>(opptr, state);
-		#else
 			__jmp_ae<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::jmp_ae_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp_ae<val32<>>(opptr, state);
-		#else
 			__jmp_ae<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::jmp_ae_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp_ae<val16<>>(opptr, state);
-		#else
 			__jmp_ae<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::jmp_ae_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp_ae<val8<>>(opptr, state);
-		#else
 			__jmp_ae<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::jmp_b_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp_b<val64<>>(opptr, state);
-		#else
 			__jmp_b<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::jmp_b_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp_b<val32<>>(opptr, state);
-		#else
 			__jmp_b<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::jmp_b_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp_b<val16<>>(opptr, state);
-		#else
 			__jmp_b<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::jmp_b_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp_b<val8<>>(opptr, state);
-		#else
 			__jmp_b<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::jmp_be_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp_be<val64<>>(opptr, state);
-		#else
 			__jmp_be<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::jmp_be_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp_be<val32<>>(opptr, state);
-		#else
 			__jmp_be<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::jmp_be_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp_be<val16<>>(opptr, state);
-		#else
 			__jmp_be<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::jmp_be_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp_be<val8<>>(opptr, state);
-		#else
 			__jmp_be<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::jmp_e_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp_e<val64<>>(opptr, state);
-		#else
 			__jmp_e<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::jmp_e_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp_e<val32<>>(opptr, state);
-		#else
 			__jmp_e<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::jmp_e_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp_e<val16<>>(opptr, state);
-		#else
 			__jmp_e<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::jmp_e_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp_e<val8<>>(opptr, state);
-		#else
 			__jmp_e<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::jmp_ne_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp_ne<val64<>>(opptr, state);
-		#else
 			__jmp_ne<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::jmp_ne_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp_ne<val32<>>(opptr, state);
-		#else
 			__jmp_ne<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::jmp_ne_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp_ne<val16<>>(opptr, state);
-		#else
 			__jmp_ne<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::jmp_ne_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp_ne<val8<>>(opptr, state);
-		#else
 			__jmp_ne<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::jmp_un_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp_un<val64<>>(opptr, state);
-		#else
 			__jmp_un<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::jmp_un_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp_un<val32<>>(opptr, state);
-		#else
 			__jmp_un<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::jmp_un_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp_un<val16<>>(opptr, state);
-		#else
 			__jmp_un<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::jmp_un_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp_un<val8<>>(opptr, state);
-		#else
 			__jmp_un<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::jmp_msk_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp_msk<val64<>>(opptr, state);
-		#else
 			__jmp_msk<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::jmp_msk_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp_msk<val32<>>(opptr, state);
-		#else
 			__jmp_msk<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::jmp_msk_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp_msk<val16<>>(opptr, state);
-		#else
 			__jmp_msk<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::jmp_msk_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_jmp_msk<val8<>>(opptr, state);
-		#else
 			__jmp_msk<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::l_load_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_l_load<val64<>>(opptr, ftop, stop);
-		#else
 			__l_load<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::l_load_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_l_load<val32<>>(opptr, ftop, stop);
-		#else
 			__l_load<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::l_load_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_l_load<val16<>>(opptr, ftop, stop);
-		#else
 			__l_load<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::l_load_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_l_load<val8<>>(opptr, ftop, stop);
-		#else
 			__l_load<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::l_store_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_l_store<val64<>>(opptr, ftop, stop);
-		#else
 			__l_store<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::l_store_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_l_store<val32<>>(opptr, ftop, stop);
-		#else
 			__l_store<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::l_store_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_l_store<val16<>>(opptr, ftop, stop);
-		#else
 			__l_store<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::l_store_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_l_store<val8<>>(opptr, ftop, stop);
-		#else
 			__l_store<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::s_load_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_s_load<val64<>>(opptr, ftop, stop);
-		#else
 			__s_load<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::s_load_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_s_load<val32<>>(opptr, ftop, stop);
-		#else
 			__s_load<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::s_load_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_s_load<val16<>>(opptr, ftop, stop);
-		#else
 			__s_load<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::s_load_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_s_load<val8<>>(opptr, ftop, stop);
-		#else
 			__s_load<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::s_store_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_s_store<val64<>>(opptr, ftop, stop);
-		#else
 			__s_store<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::s_store_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_s_store<val32<>>(opptr, ftop, stop);
-		#else
 			__s_store<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::s_store_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_s_store<val16<>>(opptr, ftop, stop);
-		#else
 			__s_store<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::s_store_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_s_store<val8<>>(opptr, ftop, stop);
-		#else
 			__s_store<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::push_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_push<val64<>>(opptr, stop);
-		#else
 			__push<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::push_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_push<val32<>>(opptr, stop);
-		#else
 			__push<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::push_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_push<val16<>>(opptr, stop);
-		#else
 			__push<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::push_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_push<val8<>>(opptr, stop);
-		#else
 			__push<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::pop_64:
 		{
-		#ifdef DEEPINLINE
-			stack_type::dil_rem<val64<>>(stop);
-		#else
 			_stack.rem<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::pop_32:
 		{
-		#ifdef DEEPINLINE
-			stack_type::dil_rem<val32<>>(stop);
-		#else
 			_stack.rem<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::pop_16:
 		{
-		#ifdef DEEPINLINE
-			stack_type::dil_rem<val16<>>(stop);
-		#else
 			_stack.rem<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::pop_8:
 		{
-		#ifdef DEEPINLINE
-			stack_type::dil_rem<val8<>>(stop);
-		#else
 			_stack.rem<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::dup_64:
 		{
-		#ifdef DEEPINLINE
-			stack_type::dil_dup<val64<>>(stop);
-		#else
 			_stack.dup<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::dup_32:
 		{
-		#ifdef DEEPINLINE
-			stack_type::dil_dup<val32<>>(stop);
-		#else
 			_stack.dup<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::dup_16:
 		{
-		#ifdef DEEPINLINE
-			stack_type::dil_dup<val16<>>(stop);
-		#else
 			_stack.dup<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::dup_8:
 		{
-		#ifdef DEEPINLINE
-			stack_type::dil_dup<val8<>>(stop);
-		#else
 			_stack.dup<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::ptrcpy_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_ptrcpy<val64<>>(stop);
-		#else
 			__ptrcpy<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::ptrcpy_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_ptrcpy<val32<>>(stop);
-		#else
 			__ptrcpy<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::ptrcpy_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_ptrcpy<val16<>>(stop);
-		#else
 			__ptrcpy<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::ptrcpy_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_ptrcpy<val8<>>(stop);
-		#else
 			__ptrcpy<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::ptrget_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_ptrget<val64<>>(stop);
-		#else
 			__ptrget<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::ptrget_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_ptrget<val32<>>(stop);
-		#else
 			__ptrget<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::ptrget_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_ptrget<val16<>>(stop);
-		#else
 			__ptrget<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::ptrget_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_ptrget<val8<>>(stop);
-		#else
 			__ptrget<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::ptrset_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_ptrset<val64<>>(stop);
-		#else
 			__ptrset<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::ptrset_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_ptrset<val32<>>(stop);
-		#else
 			__ptrset<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::ptrset_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_ptrset<val16<>>(stop);
-		#else
 			__ptrset<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::ptrset_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_ptrset<val8<>>(stop);
-		#else
 			__ptrset<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::neg_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_neg<val64<>>(state, stop);
-		#else
 			__neg<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::neg_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_neg<val32<>>(state, stop);
-		#else
 			__neg<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::neg_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_neg<val16<>>(state, stop);
-		#else
 			__neg<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::neg_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_neg<val8<>>(state, stop);
-		#else
 			__neg<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::not_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_not<val64<>>(stop);
-		#else
 			__not<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::not_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_not<val32<>>(stop);
-		#else
 			__not<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::not_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_not<val16<>>(stop);
-		#else
 			__not<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::not_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_not<val8<>>(stop);
-		#else
 			__not<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::sinc_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_sinc<val64<>>(state, stop);
-		#else
 			__sinc<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::sinc_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_sinc<val32<>>(state, stop);
-		#else
 			__sinc<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::sinc_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_sinc<val16<>>(state, stop);
-		#else
 			__sinc<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::sinc_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_sinc<val8<>>(state, stop);
-		#else
 			__sinc<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::uinc_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_uinc<val64<>>(state, stop);
-		#else
 			__uinc<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::uinc_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_uinc<val32<>>(state, stop);
-		#else
 			__uinc<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::uinc_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_uinc<val16<>>(state, stop);
-		#else
 			__uinc<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::uinc_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_uinc<val8<>>(state, stop);
-		#else
 			__uinc<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::sdec_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_sdec<val64<>>(state, stop);
-		#else
 			__sdec<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::sdec_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_sdec<val32<>>(state, stop);
-		#else
 			__sdec<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::sdec_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_sdec<val16<>>(state, stop);
-		#else
 			__sdec<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::sdec_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_sdec<val8<>>(state, stop);
-		#else
 			__sdec<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::udec_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_udec<val64<>>(state, stop);
-		#else
 			__udec<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::udec_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_udec<val32<>>(state, stop);
-		#else
 			__udec<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::udec_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_udec<val16<>>(state, stop);
-		#else
 			__udec<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::udec_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_udec<val8<>>(state, stop);
-		#else
 			__udec<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::and_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_and<val64<>>(stop);
-		#else
 			__and<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::and_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_and<val32<>>(stop);
-		#else
 			__and<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::and_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_and<val16<>>(stop);
-		#else
 			__and<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::and_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_and<val8<>>(stop);
-		#else
 			__and<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::or_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_or<val64<>>(stop);
-		#else
 			__or<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::or_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_or<val32<>>(stop);
-		#else
 			__or<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::or_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_or<val16<>>(stop);
-		#else
 			__or<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::or_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_or<val8<>>(stop);
-		#else
 			__or<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::xor_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_xor<val64<>>(stop);
-		#else
 			__xor<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::xor_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_xor<val32<>>(stop);
-		#else
 			__xor<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::xor_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_xor<val16<>>(stop);
-		#else
 			__xor<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::xor_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_xor<val8<>>(stop);
-		#else
 			__xor<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::sadd_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_sadd<val64<>>(state, stop);
-		#else
 			__sadd<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::sadd_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_sadd<val32<>>(state, stop);
-		#else
 			__sadd<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::sadd_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_sadd<val16<>>(state, stop);
-		#else
 			__sadd<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::sadd_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_sadd<val8<>>(state, stop);
-		#else
 			__sadd<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::uadd_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_uadd<val64<>>(state, stop);
-		#else
 			__uadd<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::uadd_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_uadd<val32<>>(state, stop);
-		#else
 			__uadd<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::uadd_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_uadd<val16<>>(state, stop);
-		#else
 			__uadd<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::uadd_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_uadd<val8<>>(state, stop);
-		#else
 			__uadd<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::ssub_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_ssub<val64<>>(state, stop);
-		#else
 			__ssub<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::ssub_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_ssub<val32<>>(state, stop);
-		#else
 			__ssub<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::ssub_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_ssub<val16<>>(state, stop);
-		#else
 			__ssub<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::ssub_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_ssub<val8<>>(state, stop);
-		#else
 			__ssub<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::usub_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_usub<val64<>>(state, stop);
-		#else
 			__usub<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::usub_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_usub<val32<>>(state, stop);
-		#else
 			__usub<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::usub_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_usub<val16<>>(state, stop);
-		#else
 			__usub<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::usub_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_usub<val8<>>(state, stop);
-		#else
 			__usub<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::smul_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_smul<val64<>>(state, stop);
-		#else
 			__smul<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::smul_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_smul<val32<>>(state, stop);
-		#else
 			__smul<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::smul_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_smul<val16<>>(state, stop);
-		#else
 			__smul<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::smul_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_smul<val8<>>(state, stop);
-		#else
 			__smul<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::umul_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_umul<val64<>>(state, stop);
-		#else
 			__umul<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::umul_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_umul<val32<>>(state, stop);
-		#else
 			__umul<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::umul_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_umul<val16<>>(state, stop);
-		#else
 			__umul<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::umul_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_umul<val8<>>(state, stop);
-		#else
 			__umul<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::smod_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_smod<val64<>>(state, stop);
-		#else
 			__smod<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::smod_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_smod<val32<>>(state, stop);
-		#else
 			__smod<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::smod_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_smod<val16<>>(state, stop);
-		#else
 			__smod<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::smod_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_smod<val8<>>(state, stop);
-		#else
 			__smod<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::umod_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_umod<val64<>>(state, stop);
-		#else
 			__umod<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::umod_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_umod<val32<>>(state, stop);
-		#else
 			__umod<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::umod_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_umod<val16<>>(state, stop);
-		#else
 			__umod<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::umod_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_umod<val8<>>(state, stop);
-		#else
 			__umod<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::sdiv_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_sdiv<val64<>>(state, stop);
-		#else
 			__sdiv<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::sdiv_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_sdiv<val32<>>(state, stop);
-		#else
 			__sdiv<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::sdiv_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_sdiv<val16<>>(state, stop);
-		#else
 			__sdiv<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::sdiv_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_sdiv<val8<>>(state, stop);
-		#else
 			__sdiv<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::udiv_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_udiv<val64<>>(state, stop);
-		#else
 			__udiv<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::udiv_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_udiv<val32<>>(state, stop);
-		#else
 			__udiv<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::udiv_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_udiv<val16<>>(state, stop);
-		#else
 			__udiv<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::udiv_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_udiv<val8<>>(state, stop);
-		#else
 			__udiv<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::scmp_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_scmp<val64<>>(state, stop);
-		#else
 			__scmp<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::scmp_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_scmp<val32<>>(state, stop);
-		#else
 			__scmp<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::scmp_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_scmp<val16<>>(state, stop);
-		#else
 			__scmp<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::scmp_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_scmp<val8<>>(state, stop);
-		#else
 			__scmp<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::ucmp_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_ucmp<val64<>>(state, stop);
-		#else
 			__ucmp<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::ucmp_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_ucmp<val32<>>(state, stop);
-		#else
 			__ucmp<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::ucmp_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_ucmp<val16<>>(state, stop);
-		#else
 			__ucmp<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::ucmp_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_ucmp<val8<>>(state, stop);
-		#else
 			__ucmp<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::rotl_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_rotl<val64<>>(stop);
-		#else
 			__rotl<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::rotl_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_rotl<val32<>>(stop);
-		#else
 			__rotl<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::rotl_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_rotl<val16<>>(stop);
-		#else
 			__rotl<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::rotl_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_rotl<val8<>>(stop);
-		#else
 			__rotl<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::rotr_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_rotr<val64<>>(stop);
-		#else
 			__rotr<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::rotr_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_rotr<val32<>>(stop);
-		#else
 			__rotr<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::rotr_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_rotr<val16<>>(stop);
-		#else
 			__rotr<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::rotr_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_rotr<val8<>>(stop);
-		#else
 			__rotr<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::sshl_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_sshl<val64<>>(stop);
-		#else
 			__sshl<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::sshl_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_sshl<val32<>>(stop);
-		#else
 			__sshl<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::sshl_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_sshl<val16<>>(stop);
-		#else
 			__sshl<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::sshl_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_sshl<val8<>>(stop);
-		#else
 			__sshl<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::ushl_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_ushl<val64<>>(stop);
-		#else
 			__ushl<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::ushl_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_ushl<val32<>>(stop);
-		#else
 			__ushl<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::ushl_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_ushl<val16<>>(stop);
-		#else
 			__ushl<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::ushl_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_ushl<val8<>>(stop);
-		#else
 			__ushl<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::sshr_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_sshr<val64<>>(stop);
-		#else
 			__sshr<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::sshr_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_sshr<val32<>>(stop);
-		#else
 			__sshr<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::sshr_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_sshr<val16<>>(stop);
-		#else
 			__sshr<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::sshr_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_sshr<val8<>>(stop);
-		#else
 			__sshr<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::ushr_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_ushr<val64<>>(stop);
-		#else
 			__ushr<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::ushr_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_ushr<val32<>>(stop);
-		#else
 			__ushr<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::ushr_16:
 		{
-		#ifdef DEEPINLINE
-			__dil_ushr<val16<>>(stop);
-		#else
 			__ushr<val16<>>();
-		#endif
 			break;
 		}
 
 		case op::ushr_8:
 		{
-		#ifdef DEEPINLINE
-			__dil_ushr<val8<>>(stop);
-		#else
 			__ushr<val8<>>();
-		#endif
 			break;
 		}
 
 		case op::fneg_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_fneg<val64<>>(stop);
-		#else
 			__fneg<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::fneg_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_fneg<val32<>>(stop);
-		#else
 			__fneg<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::fevl_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_fevl<val64<>>(state, stop);
-		#else
 			__fevl<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::fevl_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_fevl<val32<>>(state, stop);
-		#else
 			__fevl<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::fadd_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_fadd<val64<>>(stop);
-		#else
 			__fadd<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::fadd_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_fadd<val32<>>(stop);
-		#else
 			__fadd<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::fsub_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_fsub<val64<>>(stop);
-		#else
 			__fsub<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::fsub_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_fsub<val32<>>(stop);
-		#else
 			__fsub<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::fmul_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_fmul<val64<>>(stop);
-		#else
 			__fmul<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::fmul_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_fmul<val32<>>(stop);
-		#else
 			__fmul<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::fmod_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_fmod<val64<>>(stop);
-		#else
 			__fmod<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::fmod_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_fmod<val32<>>(stop);
-		#else
 			__fmod<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::fdiv_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_fdiv<val64<>>(stop);
-		#else
 			__fdiv<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::fdiv_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_fdiv<val32<>>(stop);
-		#else
 			__fdiv<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::fcmp_64:
 		{
-		#ifdef DEEPINLINE
-			__dil_fcmp<val64<>>(state, stop);
-		#else
 			__fcmp<val64<>>();
-		#endif
 			break;
 		}
 
 		case op::fcmp_32:
 		{
-		#ifdef DEEPINLINE
-			__dil_fcmp<val32<>>(state, stop);
-		#else
 			__fcmp<val32<>>();
-		#endif
 			break;
 		}
 
 		case op::si64_2_f64:
 		{
-		#ifdef DEEPINLINE
-			val64<>& v = stack_type::dil_top<val64<>>(stop);
-		#else
 			val64<>& v = _stack.top<val64<>>();
-		#endif
 
 			const int64_t si = v.si;
 			v.f = (double)si;
@@ -2606,19 +2122,11 @@ void dispatcher::loop()
 
 		case op::si64_2_f32:
 		{
-		#ifdef DEEPINLINE
-			val64<>& v = stack_type::dil_top<val64<>>(stop);
-		#else
 			val64<>& v = _stack.top<val64<>>();
-		#endif
 
 			const int64_t si = v.si;
 
-		#ifdef DEEPINLINE
-			stack_type::dil_dealloc(stop, (uint64_t)sizeof(val32<>));
-		#else
 			_stack.dealloc((uint64_t)sizeof(val32<>));
-		#endif
 
 			v.half.hi.f = (float)si;
 
@@ -2627,13 +2135,8 @@ void dispatcher::loop()
 
 		case op::si32_2_f64:
 		{
-		#ifdef DEEPINLINE
-			stack_type::dil_alloc(stop, (uint64_t)sizeof(val32<>));
-			val64<>& v = stack_type::dil_top<val64<>>(stop);
-		#else
 			_stack.alloc((uint64_t)sizeof(val32<>));
 			val64<>& v = _stack.top<val64<>>();
-		#endif
 
 			const int32_t si = v.half.hi.si;
 			v.f = (double)si;
@@ -2643,11 +2146,7 @@ void dispatcher::loop()
 
 		case op::si32_2_f32:
 		{
-		#ifdef DEEPINLINE
-			val32<>& v = stack_type::dil_top<val32<>>(stop);
-		#else
 			val32<>& v = _stack.top<val32<>>();
-		#endif
 
 			const int32_t si = v.si;
 			v.f = (float)si;
@@ -2657,11 +2156,7 @@ void dispatcher::loop()
 
 		case op::ui64_2_f64:
 		{
-		#ifdef DEEPINLINE
-			val64<>& v = stack_type::dil_top<val64<>>(stop);
-		#else
 			val64<>& v = _stack.top<val64<>>();
-		#endif
 
 			const uint64_t ui = v.ui;
 			v.f = (double)ui;
@@ -2671,19 +2166,11 @@ void dispatcher::loop()
 
 		case op::ui64_2_f32:
 		{
-		#ifdef DEEPINLINE
-			val64<>& v = stack_type::dil_top<val64<>>(stop);
-		#else
 			val64<>& v = _stack.top<val64<>>();
-		#endif
 
 			const uint64_t ui = v.ui;
 
-		#ifdef DEEPINLINE
-			stack_type::dil_dealloc(stop, (uint64_t)sizeof(val32<>));
-		#else
 			_stack.dealloc((uint64_t)sizeof(val32<>));
-		#endif
 
 			v.half.hi.f = (float)ui;
 
@@ -2692,13 +2179,8 @@ void dispatcher::loop()
 
 		case op::ui32_2_f64:
 		{
-		#ifdef DEEPINLINE
-			stack_type::dil_alloc(stop, (uint64_t)sizeof(val32<>));
-			val64<>& v = stack_type::dil_top<val64<>>(stop);
-		#else
 			_stack.alloc((uint64_t)sizeof(val32<>));
 			val64<>& v = _stack.top<val64<>>();
-		#endif
 
 			const uint32_t ui = v.half.hi.ui;
 			v.f = (double)ui;
@@ -2708,11 +2190,7 @@ void dispatcher::loop()
 
 		case op::ui32_2_f32:
 		{
-		#ifdef DEEPINLINE
-			val32<>& v = stack_type::dil_top<val32<>>(stop);
-		#else
 			val32<>& v = _stack.top<val32<>>();
-		#endif
 
 			const uint32_t ui = v.ui;
 			v.f = (float)ui;
@@ -2722,13 +2200,8 @@ void dispatcher::loop()
 
 		case op::f64_2_si64:
 		{
-		#ifdef DEEPINLINE
-			val64<>& v = stack_type::dil_top<val64<>>(stop);
-			interpreter::state& s = state;
-		#else
 			val64<>& v = _stack.top<val64<>>();
 			interpreter::state& s = _state;
-		#endif
 
 			const double f = v.f;
 
@@ -2747,21 +2220,12 @@ void dispatcher::loop()
 
 		case op::f64_2_si32:
 		{
-		#ifdef DEEPINLINE
-			val64<>& v = stack_type::dil_top<val64<>>(stop);
-			interpreter::state& s = state;
-		#else
 			val64<>& v = _stack.top<val64<>>();
 			interpreter::state& s = _state;
-		#endif
 
 			const double f = v.f;
 
-		#ifdef DEEPINLINE
-			stack_type::dil_dealloc(stop, (uint64_t)sizeof(val32<>));
-		#else
 			_stack.dealloc((uint64_t)sizeof(val32<>));
-		#endif
 
 			const bool ovf = !(f < (double)__2_POW_31);
 			const bool unf = !(f >= -(double)__2_POW_31);
@@ -2778,15 +2242,9 @@ void dispatcher::loop()
 
 		case op::f32_2_si64:
 		{
-		#ifdef DEEPINLINE
-			stack_type::dil_alloc(stop, (uint64_t)sizeof(val32<>));
-			val64<>& v = stack_type::dil_top<val64<>>(stop);
-			interpreter::state& s = state;
-		#else
 			_stack.alloc((uint64_t)sizeof(val32<>));
 			val64<>& v = _stack.top<val64<>>();
 			interpreter::state& s = _state;
-		#endif
 
 			const float f = v.half.hi.f;
 
@@ -2805,13 +2263,8 @@ void dispatcher::loop()
 
 		case op::f32_2_si32:
 		{
-		#ifdef DEEPINLINE
-			val32<>& v = stack_type::dil_top<val32<>>(stop);
-			interpreter::state& s = state;
-		#else
 			val32<>& v = _stack.top<val32<>>();
 			interpreter::state& s = _state;
-		#endif
 
 			const float f = v.f;
 
@@ -2830,13 +2283,8 @@ void dispatcher::loop()
 
 		case op::f64_2_ui64:
 		{
-		#ifdef DEEPINLINE
-			val64<>& v = stack_type::dil_top<val64<>>(stop);
-			interpreter::state& s = state;
-		#else
 			val64<>& v = _stack.top<val64<>>();
 			interpreter::state& s = _state;
-		#endif
 
 			const double f = v.f;
 
@@ -2855,21 +2303,12 @@ void dispatcher::loop()
 
 		case op::f64_2_ui32:
 		{
-		#ifdef DEEPINLINE
-			val64<>& v = stack_type::dil_top<val64<>>(stop);
-			interpreter::state& s = state;
-		#else
 			val64<>& v = _stack.top<val64<>>();
 			interpreter::state& s = _state;
-		#endif
 
 			const double f = v.f;
 
-		#ifdef DEEPINLINE
-			stack_type::dil_dealloc(stop, (uint64_t)sizeof(val32<>));
-		#else
 			_stack.dealloc((uint64_t)sizeof(val32<>));
-		#endif
 
 			const bool ovf = !(f < (double)__2_POW_32);
 			const bool unf = !(f >= (double)__0);
@@ -2886,15 +2325,9 @@ void dispatcher::loop()
 
 		case op::f32_2_ui64:
 		{
-		#ifdef DEEPINLINE
-			stack_type::dil_alloc(stop, (uint64_t)sizeof(val32<>));
-			val64<>& v = stack_type::dil_top<val64<>>(stop);
-			interpreter::state& s = state;
-		#else
 			_stack.alloc((uint64_t)sizeof(val32<>));
 			val64<>& v = _stack.top<val64<>>();
 			interpreter::state& s = _state;
-		#endif
 
 			const float f = v.half.hi.f;
 
@@ -2913,13 +2346,8 @@ void dispatcher::loop()
 
 		case op::f32_2_ui32:
 		{
-		#ifdef DEEPINLINE
-			val32<>& v = stack_type::dil_top<val32<>>(stop);
-			interpreter::state& s = state;
-		#else
 			val32<>& v = _stack.top<val32<>>();
 			interpreter::state& s = _state;
-		#endif
 
 			const float f = v.f;
 
@@ -2936,6 +2364,84 @@ void dispatcher::loop()
 			break;
 		}
 
+		// Checked loop runs fused sequences op by op, the fused op standing for its s_load_64
+
+		case op::s_ucmp_jmp_64:
+		{
+			__s_load<val64<>>();
+			break;
+		}
+
+		case op::s_scmp_jmp_64:
+		{
+			__s_load<val64<>>();
+			break;
+		}
+
+		case op::s_uinc_64:
+		{
+			__s_load<val64<>>();
+			break;
+		}
+
+		case op::s_udec_64:
+		{
+			__s_load<val64<>>();
+			break;
+		}
+
+		case op::s_uadd_64:
+		{
+			__s_load<val64<>>();
+			break;
+		}
+
+		case op::s_move_64:
+		{
+			__s_load<val64<>>();
+			break;
+		}
+
+		// Checked loop never sees generated ops, they are fetched as the first op of their sequence
+
+		case op::callback:
+		{
+			if (_check_type == check_type::checked)
+				_stack.push_ptr(_nativehub.callback(_opptr, _code_beg, _code_end));
+			else
+				_stack.push_ptr(_nativehub.callback(_opptr));
+			break;
+		}
+
+		case op::hostcall:
+		{
+			if (_check_type == check_type::checked)
+				_nativehub.host(_opptr, _stack, _code_beg, _code_end);
+			else
+				_nativehub.host(_opptr, _stack);
+
+			__dil_thrown();
+			break;
+		}
+
+		case op::imports:
+		{
+			_opptr += (ptrdiff_t)fetch<val16<>>().ui;
+			break;
+		}
+
+		case op::importcall:
+		{
+			if (_check_type == check_type::checked)
+				_nativehub.call_import(_opptr, _stack, _code_beg, _code_end);
+			else
+				_nativehub.call_import(_opptr, _stack);
+
+			__dil_thrown();
+			break;
+		}
+	#endif
+
 		default:
 		#ifdef OPRNDCHECK
 			throw runtime_error(_err_msg_wrong_opnd);
@@ -2944,7 +2450,7 @@ void dispatcher::loop()
 		#endif
 			break;
 		}
-	}
+	} while (!STEP);
 
 #ifdef DEEPINLINE
 	_stack.set_data(data);
@@ -2959,6 +2465,590 @@ void dispatcher::loop()
 #endif
 }
 
+#ifdef X64JIT
+template <typename CODE>
+void dispatcher::__loop_native(const CODE& code)
+{
+	const uintptr_t ftop = _stack.get_ftop();
+	const uintptr_t stop = _stack.get_stop();
+
+	const uint8_t* opptr = _opptr;
+	const state state = _state;
+
+	jit_context ctx;
+
+	ctx.exit = false;
+
+	while (true)
+	{
+		const uint8_t* entry = code.get_entry(_opptr);
+
+		if (entry != (const uint8_t*)nullptr)
+		{
+			ctx.stop = _stack.get_stop();
+			ctx.ftop = _stack.get_ftop();
+			ctx.opptr = _opptr;
+			ctx.comp = _state.comp.byte.value;
+			ctx.eval = _state.eval.byte.value;
+
+			code.run(entry, ctx);
+
+			// Exit op leaves the dispatcher as the other loops do, as if nothing was written back
+
+			if (ctx.exit)
+			{
+				_stack.set_ftop(ftop);
+				_stack.set_stop(stop);
+
+				_opptr = opptr;
+				_state = state;
+
+				return;
+			}
+
+			_stack.set_stop(ctx.stop);
+			_stack.set_ftop(ctx.ftop);
+
+			_opptr = ctx.opptr;
+			_state.comp.byte.value = ctx.comp;
+			_state.eval.byte.value = ctx.eval;
+		}
+
+		__loop_switch<true>();
+	}
+}
+
+void dispatcher::__loop_trace()
+{
+	const uintptr_t ftop = _stack.get_ftop();
+	const uintptr_t stop = _stack.get_stop();
+
+	const uint8_t* opptr = _opptr;
+	const state state = _state;
+
+	jit_context ctx;
+
+	ctx.exit = false;
+
+	// Interpreter runs op by op to count backward branches and record traces, a trace is entered
+	// whenever the interpreter reaches its anchor
+
+	while (true)
+	{
+		const uint8_t* entry = _trace.get_entry(_opptr);
+
+		if (entry != (const uint8_t*)nullptr)
+		{
+			ctx.stop = _stack.get_stop();
+			ctx.ftop = _stack.get_ftop();
+			ctx.opptr = _opptr;
+			ctx.comp = _state.comp.byte.value;
+			ctx.eval = _state.eval.byte.value;
+
+			_trace.run(entry, ctx);
+
+			_stack.set_stop(ctx.stop);
+			_stack.set_ftop(ctx.ftop);
+
+			_opptr = ctx.opptr;
+			_state.comp.byte.value = ctx.comp;
+		}
+
+		const uint8_t* last = _opptr;
+
+		__loop_switch<true>();
+
+		// Exit op is the only one single step leaves in place
+
+		if (_opptr == last && decoded_code::get_base((op)*last) == op::exit)
+		{
+			_trace.abort();
+
+			_stack.set_ftop(ftop);
+			_stack.set_stop(stop);
+
+			_opptr = opptr;
+			_state = state;
+
+			return;
+		}
+
+		if (_trace.recording())
+			_trace.record(last, _opptr);
+		else
+			_trace.hit(last, _opptr);
+	}
+}
+#endif
+
+#ifdef DEEPINLINE
+// Register ops read and write 64-bit frame slots and stack temporaries by offset from the frame
+// top, the stack top only matters to stepped ops and follows from the depth step records keep
+
+#define __REG(OFFSET) (((val64<>*)(ftop + (ptrdiff_t)(int64_t)(OFFSET)))->ui)
+#define __SREG(OFFSET) (((val64<>*)(ftop + (ptrdiff_t)(int64_t)(OFFSET)))->si)
+
+#ifdef GNUCTHREAD
+#define __RCASE(name) __reg_##name
+#define __RNEXT goto *__label[(uint8_t)rec->code]
+#else
+#define __RCASE(name) case reg_op::name
+#define __RNEXT continue
+#endif
+
+void dispatcher::__loop_register()
+{
+	const uintptr_t ftop_entry = _stack.get_ftop();
+	const uintptr_t stop_entry = _stack.get_stop();
+
+	const uint8_t* opptr_entry = _opptr;
+	const state state_entry = _state;
+
+	uintptr_t ftop = ftop_entry;
+	state state = state_entry;
+
+	// Flags of the last compare and checked op are computed only when something reads them
+
+	uint64_t comp_1 = 0ui64;
+	uint64_t comp_2 = 0ui64;
+	bool comp_sign = false;
+	bool comp_lazy = false;
+#ifdef OPINTCHECK
+	uint64_t eval_1 = 0ui64;
+	uint64_t eval_2 = 0ui64;
+	op eval_op = op::nop;
+#endif
+
+	const register_op* ops = _register.get_ops();
+	const register_op* rec = _register.get_op(_opptr, (uint64_t)(ftop_entry - stop_entry));
+
+	// Code that is not entered at a record starts stepped until it reaches one
+
+	register_op entry;
+
+	if (rec == (const register_op*)nullptr)
+	{
+		memset(&entry, 0ui8, sizeof(register_op));
+
+		entry.a = (uint64_t)(uintptr_t)_opptr;
+		entry.b = (uint64_t)(ftop_entry - stop_entry);
+		entry.code = reg_op::step;
+
+		rec = &entry;
+	}
+
+#ifdef GNUCTHREAD
+	static const void* const __label[28ui64] =
+	{
+		&&__reg_exit,
+		&&__reg_step,
+		&&__reg_mov_r,
+		&&__reg_mov_i,
+		&&__reg_add_r,
+		&&__reg_add_i,
+		&&__reg_sub_r,
+		&&__reg_sub_i,
+		&&__reg_mul_r,
+		&&__reg_mul_i,
+		&&__reg_and_r,
+		&&__reg_and_i,
+		&&__reg_or_r,
+		&&__reg_or_i,
+		&&__reg_xor_r,
+		&&__reg_xor_i,
+		&&__reg_not_r,
+		&&__reg_neg_r,
+		&&__reg_ucmp_r,
+		&&__reg_ucmp_i,
+		&&__reg_scmp_r,
+		&&__reg_scmp_i,
+		&&__reg_jmp,
+		&&__reg_jcc,
+		&&__reg_ucmp_jcc_r,
+		&&__reg_ucmp_jcc_i,
+		&&__reg_scmp_jcc_r,
+		&&__reg_scmp_jcc_i
+	};
+
+	__RNEXT;
+#else
+	while (true)
+		switch (rec->code)
+		{
+#endif
+		__RCASE(exit):
+		{
+			_stack.set_ftop(ftop_entry);
+			_stack.set_stop(stop_entry);
+
+			_opptr = opptr_entry;
+			_state = state_entry;
+
+			return;
+		}
+
+		__RCASE(step):
+		{
+			if (comp_lazy)
+			{
+				__dil_comp(state, comp_sign, comp_1, comp_2);
+				comp_lazy = false;
+			}
+		#ifdef OPINTCHECK
+
+			if (eval_op != op::nop)
+			{
+				__dil_eval(state, eval_op, eval_1, eval_2);
+				eval_op = op::nop;
+			}
+		#endif
+
+			_stack.set_ftop(ftop);
+			_stack.set_stop(ftop - (uintptr_t)rec->b);
+
+			_opptr = (const uint8_t*)(uintptr_t)rec->a;
+			_state = state;
+
+			do
+			{
+				const uint8_t* last = _opptr;
+
+				__loop_switch<true>();
+
+				// Exit op is the only one single step leaves in place
+
+				if (_opptr == last && decoded_code::get_base((op)*last) == op::exit)
+				{
+					_stack.set_ftop(ftop_entry);
+					_stack.set_stop(stop_entry);
+
+					_opptr = opptr_entry;
+					_state = state_entry;
+
+					return;
+				}
+
+				rec = _register.get_op(_opptr, (uint64_t)(_stack.get_ftop() - _stack.get_stop()));
+			} while (rec == (const register_op*)nullptr);
+
+			ftop = _stack.get_ftop();
+			state = _state;
+
+			__RNEXT;
+		}
+
+		__RCASE(mov_r):
+		{
+			__REG(rec->dst) = __REG(rec->a);
+			++rec;
+
+			__RNEXT;
+		}
+
+		__RCASE(mov_i):
+		{
+			__REG(rec->dst) = rec->a;
+			++rec;
+
+			__RNEXT;
+		}
+
+		__RCASE(add_r):
+		{
+		#ifdef OPINTCHECK
+			eval_op = (op)rec->cond;
+			eval_1 = __REG(rec->a);
+			eval_2 = __REG(rec->b);
+
+		#endif
+			__REG(rec->dst) = __REG(rec->a) + __REG(rec->b);
+			++rec;
+
+			__RNEXT;
+		}
+
+		__RCASE(add_i):
+		{
+		#ifdef OPINTCHECK
+			eval_op = (op)rec->cond;
+			eval_1 = __REG(rec->a);
+			eval_2 = rec->b;
+
+		#endif
+			__REG(rec->dst) = __REG(rec->a) + rec->b;
+			++rec;
+
+			__RNEXT;
+		}
+
+		__RCASE(sub_r):
+		{
+		#ifdef OPINTCHECK
+			eval_op = (op)rec->cond;
+			eval_1 = __REG(rec->a);
+			eval_2 = __REG(rec->b);
+
+		#endif
+			__REG(rec->dst) = __REG(rec->a) - __REG(rec->b);
+			++rec;
+
+			__RNEXT;
+		}
+
+		__RCASE(sub_i):
+		{
+		#ifdef OPINTCHECK
+			eval_op = (op)rec->cond;
+			eval_1 = __REG(rec->a);
+			eval_2 = rec->b;
+
+		#endif
+			__REG(rec->dst) = __REG(rec->a) - rec->b;
+			++rec;
+
+			__RNEXT;
+		}
+
+		__RCASE(mul_r):
+		{
+		#ifdef OPINTCHECK
+			eval_op = (op)rec->cond;
+			eval_1 = __REG(rec->a);
+			eval_2 = __REG(rec->b);
+
+		#endif
+			__REG(rec->dst) = __REG(rec->a) * __REG(rec->b);
+			++rec;
+
+			__RNEXT;
+		}
+
+		__RCASE(mul_i):
+		{
+		#ifdef OPINTCHECK
+			eval_op = (op)rec->cond;
+			eval_1 = __REG(rec->a);
+			eval_2 = rec->b;
+
+		#endif
+			__REG(rec->dst) = __REG(rec->a) * rec->b;
+			++rec;
+
+			__RNEXT;
+		}
+
+		__RCASE(and_r):
+		{
+			__REG(rec->dst) = __REG(rec->a) & __REG(rec->b);
+			++rec;
+
+			__RNEXT;
+		}
+
+		__RCASE(and_i):
+		{
+			__REG(rec->dst) = __REG(rec->a) & rec->b;
+			++rec;
+
+			__RNEXT;
+		}
+
+		__RCASE(or_r):
+		{
+			__REG(rec->dst) = __REG(rec->a) | __REG(rec->b);
+			++rec;
+
+			__RNEXT;
+		}
+
+		__RCASE(or_i):
+		{
+			__REG(rec->dst) = __REG(rec->a) | rec->b;
+			++rec;
+
+			__RNEXT;
+		}
+
+		__RCASE(xor_r):
+		{
+			__REG(rec->dst) = __REG(rec->a) ^ __REG(rec->b);
+			++rec;
+
+			__RNEXT;
+		}
+
+		__RCASE(xor_i):
+		{
+			__REG(rec->dst) = __REG(rec->a) ^ rec->b;
+			++rec;
+
+			__RNEXT;
+		}
+
+		__RCASE(not_r):
+		{
+			__REG(rec->dst) = ~__REG(rec->a);
+			++rec;
+
+			__RNEXT;
+		}
+
+		__RCASE(neg_r):
+		{
+		#ifdef OPINTCHECK
+			eval_op = op::neg_64;
+			eval_1 = __REG(rec->a);
+
+		#endif
+			__REG(rec->dst) = 0ui64 - __REG(rec->a);
+			++rec;
+
+			__RNEXT;
+		}
+
+		__RCASE(ucmp_r):
+		{
+			comp_1 = __REG(rec->b);
+			comp_2 = __REG(rec->a);
+			comp_sign = false;
+			comp_lazy = true;
+			++rec;
+
+			__RNEXT;
+		}
+
+		__RCASE(ucmp_i):
+		{
+			comp_1 = rec->b;
+			comp_2 = __REG(rec->a);
+			comp_sign = false;
+			comp_lazy = true;
+			++rec;
+
+			__RNEXT;
+		}
+
+		__RCASE(scmp_r):
+		{
+			comp_1 = __REG(rec->b);
+			comp_2 = __REG(rec->a);
+			comp_sign = true;
+			comp_lazy = true;
+			++rec;
+
+			__RNEXT;
+		}
+
+		__RCASE(scmp_i):
+		{
+			comp_1 = rec->b;
+			comp_2 = __REG(rec->a);
+			comp_sign = true;
+			comp_lazy = true;
+			++rec;
+
+			__RNEXT;
+		}
+
+		__RCASE(jmp):
+		{
+			rec = ops + (ptrdiff_t)rec->target;
+
+			__RNEXT;
+		}
+
+		__RCASE(jcc):
+		{
+			if (comp_lazy)
+			{
+				__dil_comp(state, comp_sign, comp_1, comp_2);
+				comp_lazy = false;
+			}
+
+			const uint64_t comp = (uint64_t)state.comp.bits.above | ((uint64_t)state.comp.bits.below << 1ui64);
+
+			rec = (((uint64_t)rec->cond >> comp) & 1ui64) != 0ui64 ? ops + (ptrdiff_t)rec->target : rec + (ptrdiff_t)1;
+
+			__RNEXT;
+		}
+
+		__RCASE(ucmp_jcc_r):
+		{
+			const uint64_t ui_1 = __REG(rec->b);
+			const uint64_t ui_2 = __REG(rec->a);
+
+			comp_1 = (uint64_t)ui_1;
+			comp_2 = (uint64_t)ui_2;
+			comp_sign = false;
+			comp_lazy = true;
+
+			const uint64_t comp = (uint64_t)(ui_1 > ui_2) | ((uint64_t)(ui_1 < ui_2) << 1ui64);
+
+			rec = (((uint64_t)rec->cond >> comp) & 1ui64) != 0ui64 ? ops + (ptrdiff_t)rec->target : rec + (ptrdiff_t)1;
+
+			__RNEXT;
+		}
+
+		__RCASE(ucmp_jcc_i):
+		{
+			const uint64_t ui_1 = rec->b;
+			const uint64_t ui_2 = __REG(rec->a);
+
+			comp_1 = (uint64_t)ui_1;
+			comp_2 = (uint64_t)ui_2;
+			comp_sign = false;
+			comp_lazy = true;
+
+			const uint64_t comp = (uint64_t)(ui_1 > ui_2) | ((uint64_t)(ui_1 < ui_2) << 1ui64);
+
+			rec = (((uint64_t)rec->cond >> comp) & 1ui64) != 0ui64 ? ops + (ptrdiff_t)rec->target : rec + (ptrdiff_t)1;
+
+			__RNEXT;
+		}
+
+		__RCASE(scmp_jcc_r):
+		{
+			const int64_t si_1 = __SREG(rec->b);
+			const int64_t si_2 = __SREG(rec->a);
+
+			comp_1 = (uint64_t)si_1;
+			comp_2 = (uint64_t)si_2;
+			comp_sign = true;
+			comp_lazy = true;
+
+			const uint64_t comp = (uint64_t)(si_1 > si_2) | ((uint64_t)(si_1 < si_2) << 1ui64);
+
+			rec = (((uint64_t)rec->cond >> comp) & 1ui64) != 0ui64 ? ops + (ptrdiff_t)rec->target : rec + (ptrdiff_t)1;
+
+			__RNEXT;
+		}
+
+		__RCASE(scmp_jcc_i):
+		{
+			const int64_t si_1 = (int64_t)rec->b;
+			const int64_t si_2 = __SREG(rec->a);
+
+			comp_1 = (uint64_t)si_1;
+			comp_2 = (uint64_t)si_2;
+			comp_sign = true;
+			comp_lazy = true;
+
+			const uint64_t comp = (uint64_t)(si_1 > si_2) | ((uint64_t)(si_1 < si_2) << 1ui64);
+
+			rec = (((uint64_t)rec->cond >> comp) & 1ui64) != 0ui64 ? ops + (ptrdiff_t)rec->target : rec + (ptrdiff_t)1;
+
+			__RNEXT;
+		}
+#ifndef GNUCTHREAD
+
+		default:
+			__assume(false);
+			break;
+		}
+#endif
+}
+#endif
+
 void dispatcher::push_ptr(uintptr_t value)
 {
 	_stack.push_ptr(value);
@@ -2971,21 +3061,35 @@ uintptr_t dispatcher::pop_ptr()
 
 dispatcher& dispatcher::operator=(dispatcher&& o) noexcept
 {
-#ifdef FETCHCHECK
 	_code_beg = move(o._code_beg);
 	_code_end = move(o._code_end);
+	_dispatch_type = move(o._dispatch_type);
+	_check_type = move(o._check_type);
+	_decoded = move(o._decoded);
+	_register = move(o._register);
+#ifdef X64JIT
+	_jit = move(o._jit);
+	_stencil = move(o._stencil);
+	_trace = move(o._trace);
+#endif
+#ifdef OPPROFILE
+	_profile = move(o._profile);
+#endif
+#ifdef DEEPINLINE
+	_verified = move(o._verified);
 #endif
 	_nativehub = move(o._nativehub);
+	_nativehub.bind_callbacks((void*)this, &__enter);
 	_stack = move(o._stack);
 	_opptr = move(o._opptr);
 	_state = move(o._state);
+	_thrown = move(o._thrown);
 
-#ifdef FETCHCHECK
 	o._code_beg = (const uint8_t*)nullptr;
 	o._code_end = (const uint8_t*)nullptr;
-#endif
 	o._opptr = (const uint8_t*)nullptr;
 	o._state = move(state());
+	o._thrown = (exception_ptr)nullptr;
 
 	return *this;
 }
\ No newline at end of file
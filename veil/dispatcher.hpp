@@ -4,15 +4,24 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <exception>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 
+#include "decode.hpp"
 #include "define.hpp"
 #include "interpreter_type.hpp"
+#include "jit.hpp"
 #include "native.hpp"
 #include "op.hpp"
+#include "profile.hpp"
+#include "register.hpp"
 #include "stack_be.hpp"
 #include "stack_le.hpp"
+#include "stencil.hpp"
+#include "verify.hpp"
 
 #ifdef MSVCROTATE
 #include <intrin.h>
@@ -93,10 +102,10 @@ namespace interpreter
 			uint64_t& rl
 		)
 		{
-			const uint64_t hi = (uint64_t)o1_h * (uint64_t)o1_l;
+			const uint64_t hi = (uint64_t)o1_h * (uint64_t)o2_h;
 			const uint64_t m1 = (uint64_t)o1_h * (uint64_t)o2_l;
 			const uint64_t m2 = (uint64_t)o2_h * (uint64_t)o1_l;
-			const uint64_t lo = (uint64_t)o2_h * (uint64_t)o2_l;
+			const uint64_t lo = (uint64_t)o1_l * (uint64_t)o2_l;
 
 			const uint64_t __m1 = m1 + (lo >> 0x20ui8);
 			const uint64_t __m2 = m2 + (uint64_t)((uint32_t)__m1);
@@ -358,25 +367,52 @@ namespace interpreter
 	};
 #endif
 
+	struct stencil_ops;
+
 	class dispatcher
 	{
 	private:
+	#ifdef X64JIT
+		// Stencils are compiled from the handlers below
+
+		friend struct stencil_ops;
+
+	#endif
 		using stack_type = stack<std::endian::native>;
 
+		// Checked code proven whole runs without fetch and stack checks
+
+		using proven_policy = check_policy<false, false, checked_policy::opint_check, checked_policy::float_check,
+			checked_policy::mtype_check>;
+
 		static constexpr const char _err_msg_fetch_code[] = "Fetch out of code range";
 		static constexpr const char _err_msg_wrong_fltp[] = "Wrong float class";
 		static constexpr const char _err_msg_wrong_opnd[] = "Wrong operand";
 		static constexpr const char _err_msg_wrong_type[] = "Wrong mask type";
 
-	#ifdef FETCHCHECK
 		const uint8_t* _code_beg;
 		const uint8_t* _code_end;
-	#endif
 
+		dispatch_type _dispatch_type;
+		check_type _check_type;
+		decoded_code _decoded;
+		register_code _register;
+	#ifdef X64JIT
+		jit_code _jit;
+		stencil_code _stencil;
+		trace_code _trace;
+	#endif
 		nativehub _nativehub;
 		stack_type _stack;
 		const uint8_t* _opptr;
 		state _state;
+		std::exception_ptr _thrown;
+	#ifdef OPPROFILE
+		op_profile _profile;
+	#endif
+	#ifdef DEEPINLINE
+		verified_code _verified;
+	#endif
 
 		template <VALUE V>
 		static inline V dil_fetch(const uint8_t*& opptr)
@@ -387,6 +423,61 @@ namespace interpreter
 			return t;
 		}
 
+		// Operand of a decoded record read as a value of the op width, decode stores its bytes at
+		// the start of the record operand
+
+		template <VALUE V>
+		static inline V dil_operand(const decoded_op& rec) noexcept
+		{
+			V t;
+			memcpy(&t, &rec.operand, sizeof(V));
+
+			return t;
+		}
+
+	#ifdef DEEPINLINE
+		// Checks op the code verifier does not prove and fetches it, fused and generated ops run
+		// as their first op so every op after it is checked on its own
+
+		template <typename P>
+		inline op __dil_check(const uint8_t*& opptr, uintptr_t send, uintptr_t ftop, uintptr_t stop) const
+		{
+			const uint8_t* bcode = _verified.get_code_beg();
+			const uint8_t* ecode = _verified.get_code_end();
+
+			if (P::fetch_check && (opptr < bcode || opptr >= ecode))
+				throw std::runtime_error(_err_msg_fetch_code);
+			else
+			{
+				const uint64_t size = decoded_code::get_size(opptr, ecode);
+				const op op_code = verified_code::get_base((op)*opptr);
+
+				if (P::stack_check && size != 0ui64)
+				{
+					uint64_t pop, push, slot;
+					ptrdiff_t offset;
+
+					verified_code::get_effect(opptr, op_code, pop, push);
+
+					if ((uint64_t)op_code >= (uint64_t)op::call_64 && (uint64_t)op_code <= (uint64_t)op::call_8)
+						push = (uint64_t)sizeof(uint64_t) * 2ui64
+							+ _verified.get_frame(verified_code::get_target(opptr, opptr + (ptrdiff_t)size, op_code));
+
+					stack_type::dil_check(send, ftop, stop, pop, push);
+
+					if (verified_code::get_slot(opptr, op_code, offset, slot))
+						stack_type::dil_check_slot(ftop, stop, offset, slot, pop);
+				}
+				else if (P::fetch_check && size == 0ui64 && (uint8_t)op_code <= (uint8_t)op::f32_2_ui32)
+					throw std::runtime_error(_err_msg_fetch_code);
+
+				++opptr;
+				return op_code;
+			}
+		}
+
+	#endif
+
 		template <VALUE V>
 		static inline void __dil_and(uintptr_t& stop)
 		{
@@ -406,6 +497,89 @@ namespace interpreter
 			opptr += os;
 		}
 
+		// Register loop keeps the operands of the last compare and of the last checked op, their
+		// flags are computed here only when an op reads the state
+
+		static inline void __dil_comp(state& state, bool sign, uint64_t ui_1, uint64_t ui_2)
+		{
+			if (sign)
+			{
+				state.comp.bits.above = (int64_t)ui_1 > (int64_t)ui_2;
+				state.comp.bits.below = (int64_t)ui_1 < (int64_t)ui_2;
+			}
+			else
+			{
+				state.comp.bits.above = ui_1 > ui_2;
+				state.comp.bits.below = ui_1 < ui_2;
+			}
+		}
+
+		static inline void __dil_eval(state& state, op op_code, uint64_t ui_1, uint64_t ui_2)
+		{
+			const int64_t si_1 = (int64_t)ui_1;
+			const int64_t si_2 = (int64_t)ui_2;
+
+			val64<> v(ui_1);
+
+			switch (op_code)
+			{
+			case op::sadd_64:
+				state.eval.bits.iovf = si_2 > 0i64 && si_1 > numeric_limits<int64_t>::max() - si_2;
+				state.eval.bits.iunf = si_2 < 0i64 && si_1 < numeric_limits<int64_t>::min() - si_2;
+				break;
+
+			case op::uadd_64:
+				state.eval.bits.iovf = ui_1 > numeric_limits<uint64_t>::max() - ui_2;
+				state.eval.bits.iunf = false;
+				break;
+
+			case op::ssub_64:
+				state.eval.bits.iovf = si_2 < 0i64 && si_1 > numeric_limits<int64_t>::max() + si_2;
+				state.eval.bits.iunf = si_2 > 0i64 && si_1 < numeric_limits<int64_t>::min() + si_2;
+				break;
+
+			case op::usub_64:
+				state.eval.bits.iovf = false;
+				state.eval.bits.iunf = ui_1 < ui_2;
+				break;
+
+			case op::smul_64:
+				__mul<val64<>>::smul(v, si_2, state);
+				break;
+
+			case op::umul_64:
+				__mul<val64<>>::umul(v, ui_2, state);
+				break;
+
+			case op::sinc_64:
+				state.eval.bits.iovf = si_1 == numeric_limits<int64_t>::max();
+				state.eval.bits.iunf = false;
+				break;
+
+			case op::uinc_64:
+				state.eval.bits.iovf = ui_1 == numeric_limits<uint64_t>::max();
+				state.eval.bits.iunf = false;
+				break;
+
+			case op::sdec_64:
+				state.eval.bits.iovf = false;
+				state.eval.bits.iunf = si_1 == numeric_limits<int64_t>::min();
+				break;
+
+			case op::udec_64:
+				state.eval.bits.iovf = false;
+				state.eval.bits.iunf = ui_1 == numeric_limits<uint64_t>::min();
+				break;
+
+			case op::neg_64:
+				state.eval.bits.ierr = si_1 == numeric_limits<int64_t>::min();
+				break;
+
+			default:
+				break;
+			}
+		}
+
 		template <VALUE V>
 		static inline void __dil_fadd(uintptr_t& stop)
 		{
@@ -437,7 +611,7 @@ namespace interpreter
 			v.f /= f;
 		}
 
-		template <VALUE V>
+		template <VALUE V, typename P = default_policy>
 		static inline void __dil_fevl(state& state, uintptr_t& stop)
 		{
 			using vf_t = decltype(V::f);
@@ -472,11 +646,10 @@ namespace interpreter
 				break;
 
 			default:
-			#ifdef FLOATCHECK
-				throw std::runtime_error(_err_msg_wrong_fltp);
-			#else
-				__assume(false);
-			#endif
+				if constexpr (P::float_check)
+					throw std::runtime_error(_err_msg_wrong_fltp);
+				else
+					__assume(false);
 				break;
 			}
 		}
@@ -519,6 +692,23 @@ namespace interpreter
 			v.f -= f;
 		}
 
+		// Handlers of gen_0 .. gen_3 are specialised in dispatcher_gen.hpp, opptr points past the
+		// generated op and every op after the first of a sequence has its op byte skipped
+
+		template <uint64_t N>
+		static inline void __dil_gen(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state);
+
+		// jmp_cc_8 ops are 4 apart in order jmp, a, ae, b, be, e, ne, un and every nibble
+		// of the mask is the truth table of one condition indexed by above * 2 + below
+
+		static inline bool __dil_jcc(op jcc, const state& state)
+		{
+			const uint32_t cc = (uint32_t)jcc - (uint32_t)op::jmp_8;
+			const uint32_t ab = ((uint32_t)state.comp.bits.above << 1ui32) | (uint32_t)state.comp.bits.below;
+
+			return (bool)((0x8613254Fui32 >> (cc + ab)) & 1ui32);
+		}
+
 		template <VALUE V>
 		static inline void __dil_jmp(const uint8_t*& opptr)
 		{
@@ -618,15 +808,14 @@ namespace interpreter
 			stack_type::dil_store<V>(ftop, stop, os);
 		}
 
-		template <VALUE V>
+		template <VALUE V, typename P = default_policy>
 		static inline void __dil_neg(state& state, const uintptr_t& stop)
 		{
 			using vsi_t = decltype(V::si);
 			V& v = stack_type::dil_top<V>(stop);
 
-		#ifdef OPINTCHECK
-			state.eval.bits.ierr = v.si == numeric_limits<vsi_t>::min();
-		#endif
+			if constexpr (P::opint_check)
+				state.eval.bits.ierr = v.si == numeric_limits<vsi_t>::min();
 
 			v.si = -v.si;
 		}
@@ -727,16 +916,122 @@ namespace interpreter
 		}
 
 		template <VALUE V>
+		static inline void __dil_s_move(const uint8_t*& opptr, const uintptr_t& ftop)
+		{
+			const ptrdiff_t os_1 = (ptrdiff_t)dil_fetch<val8<>>(opptr).si;
+
+			opptr += (ptrdiff_t)sizeof(op);
+			const ptrdiff_t os_2 = (ptrdiff_t)dil_fetch<val8<>>(opptr).si;
+
+			stack_type::dil_get<V>(ftop, os_2) = stack_type::dil_get<V>(ftop, os_1);
+		}
+
+		template <VALUE V>
+		static inline void __dil_s_scmp_jmp(const uint8_t*& opptr, const uintptr_t& ftop, state& state)
+		{
+			using vsi_t = decltype(V::si);
+			const vsi_t si_2 = stack_type::dil_get<V>(ftop, (ptrdiff_t)dil_fetch<val8<>>(opptr).si).si;
+
+			opptr += (ptrdiff_t)sizeof(op);
+			const vsi_t si_1 = dil_fetch<V>(opptr).si;
+
+			opptr += (ptrdiff_t)sizeof(op);
+			const op jcc = (op)dil_fetch<val8<>>(opptr).ui;
+			const ptrdiff_t os = (ptrdiff_t)dil_fetch<val8<>>(opptr).si;
+
+			state.comp.bits.above = si_1 > si_2;
+			state.comp.bits.below = si_1 < si_2;
+
+			if (__dil_jcc(jcc, state))
+				opptr += os;
+		}
+
+		template <VALUE V, typename P = default_policy>
+		static inline void __dil_s_uadd(const uint8_t*& opptr, const uintptr_t& ftop, state& state, uintptr_t& stop)
+		{
+			using vui_t = decltype(V::ui);
+			const vui_t ui_1 = stack_type::dil_get<V>(ftop, (ptrdiff_t)dil_fetch<val8<>>(opptr).si).ui;
+
+			opptr += (ptrdiff_t)sizeof(op);
+			const vui_t ui_2 = stack_type::dil_get<V>(ftop, (ptrdiff_t)dil_fetch<val8<>>(opptr).si).ui;
+
+			opptr += (ptrdiff_t)sizeof(op);
+
+			if constexpr (P::opint_check)
+			{
+				state.eval.bits.iovf = ui_1 > numeric_limits<vui_t>::max() - ui_2;
+				state.eval.bits.iunf = false;
+			}
+
+			stack_type::dil_push<V>(stop, V((vui_t)(ui_1 + ui_2)));
+		}
+
+		template <VALUE V>
+		static inline void __dil_s_ucmp_jmp(const uint8_t*& opptr, const uintptr_t& ftop, state& state)
+		{
+			using vui_t = decltype(V::ui);
+			const vui_t ui_2 = stack_type::dil_get<V>(ftop, (ptrdiff_t)dil_fetch<val8<>>(opptr).si).ui;
+
+			opptr += (ptrdiff_t)sizeof(op);
+			const vui_t ui_1 = dil_fetch<V>(opptr).ui;
+
+			opptr += (ptrdiff_t)sizeof(op);
+			const op jcc = (op)dil_fetch<val8<>>(opptr).ui;
+			const ptrdiff_t os = (ptrdiff_t)dil_fetch<val8<>>(opptr).si;
+
+			state.comp.bits.above = ui_1 > ui_2;
+			state.comp.bits.below = ui_1 < ui_2;
+
+			if (__dil_jcc(jcc, state))
+				opptr += os;
+		}
+
+		template <VALUE V, typename P = default_policy>
+		static inline void __dil_s_udec(const uint8_t*& opptr, const uintptr_t& ftop, state& state)
+		{
+			using vui_t = decltype(V::ui);
+			V& v = stack_type::dil_get<V>(ftop, (ptrdiff_t)dil_fetch<val8<>>(opptr).si);
+
+			opptr += (ptrdiff_t)(sizeof(op) * 2ui64 + sizeof(val8<>));
+
+			if constexpr (P::opint_check)
+			{
+				state.eval.bits.iovf = false;
+				state.eval.bits.iunf = v.ui == numeric_limits<vui_t>::min();
+			}
+
+			--v.ui;
+		}
+
+		template <VALUE V, typename P = default_policy>
+		static inline void __dil_s_uinc(const uint8_t*& opptr, const uintptr_t& ftop, state& state)
+		{
+			using vui_t = decltype(V::ui);
+			V& v = stack_type::dil_get<V>(ftop, (ptrdiff_t)dil_fetch<val8<>>(opptr).si);
+
+			opptr += (ptrdiff_t)(sizeof(op) * 2ui64 + sizeof(val8<>));
+
+			if constexpr (P::opint_check)
+			{
+				state.eval.bits.iovf = v.ui == numeric_limits<vui_t>::max();
+				state.eval.bits.iunf = false;
+			}
+
+			++v.ui;
+		}
+
+		template <VALUE V, typename P = default_policy>
 		static inline void __dil_sadd(state& state, uintptr_t& stop)
 		{
 			using vsi_t = decltype(V::si);
 			const vsi_t si = stack_type::dil_pop<V>(stop).si;
 			V& v = stack_type::dil_top<V>(stop);
 
-		#ifdef OPINTCHECK
-			state.eval.bits.iovf = si > (vsi_t)0 && v.si > numeric_limits<vsi_t>::max() - si;
-			state.eval.bits.iunf = si < (vsi_t)0 && v.si < numeric_limits<vsi_t>::min() - si;
-		#endif
+			if constexpr (P::opint_check)
+			{
+				state.eval.bits.iovf = si > (vsi_t)0 && v.si > numeric_limits<vsi_t>::max() - si;
+				state.eval.bits.iunf = si < (vsi_t)0 && v.si < numeric_limits<vsi_t>::min() - si;
+			}
 
 			v.si += si;
 		}
@@ -752,21 +1047,22 @@ namespace interpreter
 			state.comp.bits.below = si_1 < si_2;
 		}
 
-		template <VALUE V>
+		template <VALUE V, typename P = default_policy>
 		static inline void __dil_sdec(state& state, const uintptr_t& stop)
 		{
 			using vsi_t = decltype(V::si);
 			V& v = stack_type::dil_top<V>(stop);
 
-		#ifdef OPINTCHECK
-			state.eval.bits.iovf = false;
-			state.eval.bits.iunf = v.si == numeric_limits<vsi_t>::min();
-		#endif
+			if constexpr (P::opint_check)
+			{
+				state.eval.bits.iovf = false;
+				state.eval.bits.iunf = v.si == numeric_limits<vsi_t>::min();
+			}
 
 			--v.si;
 		}
 
-		template <VALUE V>
+		template <VALUE V, typename P = default_policy>
 		static inline void __dil_sdiv(state& state, uintptr_t& stop)
 		{
 			using vsi_t = decltype(V::si);
@@ -774,29 +1070,30 @@ namespace interpreter
 			V& v = stack_type::dil_top<V>(stop);
 
 			bool zeromirror = si == (vsi_t)0 || (si == (vsi_t)-1 && v.si == numeric_limits<vsi_t>::min());
-		#ifdef OPINTCHECK
-			state.eval.bits.ierr = zeromirror;
-		#endif
+
+			if constexpr (P::opint_check)
+				state.eval.bits.ierr = zeromirror;
 
 			if (!zeromirror)
 				v.si /= si;
 		}
 
-		template <VALUE V>
+		template <VALUE V, typename P = default_policy>
 		static inline void __dil_sinc(state& state, const uintptr_t& stop)
 		{
 			using vsi_t = decltype(V::si);
 			V& v = stack_type::dil_top<V>(stop);
 
-		#ifdef OPINTCHECK
-			state.eval.bits.iovf = v.si == numeric_limits<vsi_t>::max();
-			state.eval.bits.iunf = false;
-		#endif
+			if constexpr (P::opint_check)
+			{
+				state.eval.bits.iovf = v.si == numeric_limits<vsi_t>::max();
+				state.eval.bits.iunf = false;
+			}
 
 			++v.si;
 		}
 
-		template <VALUE V>
+		template <VALUE V, typename P = default_policy>
 		static inline void __dil_smod(state& state, uintptr_t& stop)
 		{
 			using vsi_t = decltype(V::si);
@@ -804,9 +1101,9 @@ namespace interpreter
 			V& v = stack_type::dil_top<V>(stop);
 
 			bool zero = si == (vsi_t)0;
-		#ifdef OPINTCHECK
-			state.eval.bits.ierr = zero;
-		#endif
+
+			if constexpr (P::opint_check)
+				state.eval.bits.ierr = zero;
 
 			if (!zero)
 			{
@@ -817,18 +1114,17 @@ namespace interpreter
 			}
 		}
 
-		template <VALUE V>
+		template <VALUE V, typename P = default_policy>
 		static inline void __dil_smul(state& state, uintptr_t& stop)
 		{
 			using vsi_t = decltype(V::si);
 			const vsi_t si = stack_type::dil_pop<V>(stop).si;
 			V& v = stack_type::dil_top<V>(stop);
 
-		#ifdef OPINTCHECK
-			__mul<V>::smul(v, si, state);
-		#else
-			v.si *= si;
-		#endif
+			if constexpr (P::opint_check)
+				__mul<V>::smul(v, si, state);
+			else
+				v.si *= si;
 		}
 
 		template <VALUE V>
@@ -849,32 +1145,34 @@ namespace interpreter
 			v.si >>= c;
 		}
 
-		template <VALUE V>
+		template <VALUE V, typename P = default_policy>
 		static inline void __dil_ssub(state& state, uintptr_t& stop)
 		{
 			using vsi_t = decltype(V::si);
 			const vsi_t si = stack_type::dil_pop<V>(stop).si;
 			V& v = stack_type::dil_top<V>(stop);
 
-		#ifdef OPINTCHECK
-			state.eval.bits.iovf = si < (vsi_t)0 && v.si > numeric_limits<vsi_t>::max() + si;
-			state.eval.bits.iunf = si > (vsi_t)0 && v.si < numeric_limits<vsi_t>::min() + si;
-		#endif
+			if constexpr (P::opint_check)
+			{
+				state.eval.bits.iovf = si < (vsi_t)0 && v.si > numeric_limits<vsi_t>::max() + si;
+				state.eval.bits.iunf = si > (vsi_t)0 && v.si < numeric_limits<vsi_t>::min() + si;
+			}
 
 			v.si -= si;
 		}
 
-		template <VALUE V>
+		template <VALUE V, typename P = default_policy>
 		static inline void __dil_uadd(state& state, uintptr_t& stop)
 		{
 			using vui_t = decltype(V::ui);
 			const vui_t ui = stack_type::dil_pop<V>(stop).ui;
 			V& v = stack_type::dil_top<V>(stop);
 
-		#ifdef OPINTCHECK
-			state.eval.bits.iovf = v.ui > numeric_limits<vui_t>::max() - ui;
-			state.eval.bits.iunf = false;
-		#endif
+			if constexpr (P::opint_check)
+			{
+				state.eval.bits.iovf = v.ui > numeric_limits<vui_t>::max() - ui;
+				state.eval.bits.iunf = false;
+			}
 
 			v.ui += ui;
 		}
@@ -890,21 +1188,22 @@ namespace interpreter
 			state.comp.bits.below = ui_1 < ui_2;
 		}
 
-		template <VALUE V>
+		template <VALUE V, typename P = default_policy>
 		static inline void __dil_udec(state& state, const uintptr_t& stop)
 		{
 			using vui_t = decltype(V::ui);
 			V& v = stack_type::dil_top<V>(stop);
 
-		#ifdef OPINTCHECK
-			state.eval.bits.iovf = false;
-			state.eval.bits.iunf = v.ui == numeric_limits<vui_t>::min();
-		#endif
+			if constexpr (P::opint_check)
+			{
+				state.eval.bits.iovf = false;
+				state.eval.bits.iunf = v.ui == numeric_limits<vui_t>::min();
+			}
 
 			--v.ui;
 		}
 
-		template <VALUE V>
+		template <VALUE V, typename P = default_policy>
 		static inline void __dil_udiv(state& state, uintptr_t& stop)
 		{
 			using vui_t = decltype(V::ui);
@@ -912,29 +1211,30 @@ namespace interpreter
 			V& v = stack_type::dil_top<V>(stop);
 
 			bool zero = ui == (vui_t)0;
-		#ifdef OPINTCHECK
-			state.eval.bits.ierr = zero;
-		#endif
+
+			if constexpr (P::opint_check)
+				state.eval.bits.ierr = zero;
 
 			if (!zero)
 				v.ui /= ui;
 		}
 
-		template <VALUE V>
+		template <VALUE V, typename P = default_policy>
 		static inline void __dil_uinc(state& state, const uintptr_t& stop)
 		{
 			using vui_t = decltype(V::ui);
 			V& v = stack_type::dil_top<V>(stop);
 
-		#ifdef OPINTCHECK
-			state.eval.bits.iovf = v.ui == numeric_limits<vui_t>::max();
-			state.eval.bits.iunf = false;
-		#endif
+			if constexpr (P::opint_check)
+			{
+				state.eval.bits.iovf = v.ui == numeric_limits<vui_t>::max();
+				state.eval.bits.iunf = false;
+			}
 
 			++v.ui;
 		}
 
-		template <VALUE V>
+		template <VALUE V, typename P = default_policy>
 		static inline void __dil_umod(state& state, uintptr_t& stop)
 		{
 			using vui_t = decltype(V::ui);
@@ -942,26 +1242,25 @@ namespace interpreter
 			V& v = stack_type::dil_top<V>(stop);
 
 			bool zero = ui == (vui_t)0;
-		#ifdef OPINTCHECK
-			state.eval.bits.ierr = zero;
-		#endif
+
+			if constexpr (P::opint_check)
+				state.eval.bits.ierr = zero;
 
 			if (!zero)
 				v.ui %= ui;
 		}
 
-		template <VALUE V>
+		template <VALUE V, typename P = default_policy>
 		static inline void __dil_umul(state& state, uintptr_t& stop)
 		{
 			using vui_t = decltype(V::ui);
 			const vui_t ui = stack_type::dil_pop<V>(stop).ui;
 			V& v = stack_type::dil_top<V>(stop);
 
-		#ifdef OPINTCHECK
-			__mul<V>::umul(v, ui, state);
-		#else
-			v.ui *= ui;
-		#endif
+			if constexpr (P::opint_check)
+				__mul<V>::umul(v, ui, state);
+			else
+				v.ui *= ui;
 		}
 
 		template <VALUE V>
@@ -982,17 +1281,18 @@ namespace interpreter
 			v.ui >>= c;
 		}
 
-		template <VALUE V>
+		template <VALUE V, typename P = default_policy>
 		static inline void __dil_usub(state& state, uintptr_t& stop)
 		{
 			using vui_t = decltype(V::ui);
 			const vui_t ui = stack_type::dil_pop<V>(stop).ui;
 			V& v = stack_type::dil_top<V>(stop);
 
-		#ifdef OPINTCHECK
-			state.eval.bits.iovf = false;
-			state.eval.bits.iunf = v.ui < ui;
-		#endif
+			if constexpr (P::opint_check)
+			{
+				state.eval.bits.iovf = false;
+				state.eval.bits.iunf = v.ui < ui;
+			}
 
 			v.ui -= ui;
 		}
@@ -1010,22 +1310,16 @@ namespace interpreter
 		template <VALUE V>
 		inline V fetch()
 		{
-		#ifdef FETCHCHECK
-			if (_opptr < _code_beg || _opptr + (ptrdiff_t)sizeof(V) > _code_end)
-				throw std::runtime_error(_err_msg_fetch_code);
-			else
+			if constexpr (default_policy::fetch_check)
 			{
-				V t = *((V*)_opptr);
-				_opptr += (ptrdiff_t)sizeof(V);
-
-				return t;
+				if (_opptr < _code_beg || _opptr + (ptrdiff_t)sizeof(V) > _code_end)
+					throw std::runtime_error(_err_msg_fetch_code);
 			}
-		#else
+
 			V t = *((V*)_opptr);
 			_opptr += (ptrdiff_t)sizeof(V);
 
 			return t;
-		#endif
 		}
 
 		template <VALUE V>
@@ -1113,11 +1407,10 @@ namespace interpreter
 				break;
 
 			default:
-			#ifdef FLOATCHECK
-				throw std::runtime_error(_err_msg_wrong_fltp);
-			#else
-				__assume(false);
-			#endif
+				if constexpr (default_policy::float_check)
+					throw std::runtime_error(_err_msg_wrong_fltp);
+				else
+					__assume(false);
 				break;
 			}
 		}
@@ -1265,9 +1558,8 @@ namespace interpreter
 			using vsi_t = decltype(V::si);
 			V& v = _stack.top<V>();
 
-		#ifdef OPINTCHECK
-			_state.eval.bits.ierr = v.si == numeric_limits<vsi_t>::min();
-		#endif
+			if constexpr (default_policy::opint_check)
+				_state.eval.bits.ierr = v.si == numeric_limits<vsi_t>::min();
 
 			v.si = -v.si;
 		}
@@ -1374,10 +1666,11 @@ namespace interpreter
 			const vsi_t si = _stack.pop<V>().si;
 			V& v = _stack.top<V>();
 
-		#ifdef OPINTCHECK
-			_state.eval.bits.iovf = si > (vsi_t)0 && v.si > numeric_limits<vsi_t>::max() - si;
-			_state.eval.bits.iunf = si < (vsi_t)0 && v.si < numeric_limits<vsi_t>::min() - si;
-		#endif
+			if constexpr (default_policy::opint_check)
+			{
+				_state.eval.bits.iovf = si > (vsi_t)0 && v.si > numeric_limits<vsi_t>::max() - si;
+				_state.eval.bits.iunf = si < (vsi_t)0 && v.si < numeric_limits<vsi_t>::min() - si;
+			}
 
 			v.si += si;
 		}
@@ -1399,10 +1692,11 @@ namespace interpreter
 			using vsi_t = decltype(V::si);
 			V& v = _stack.top<V>();
 
-		#ifdef OPINTCHECK
-			_state.eval.bits.iovf = false;
-			_state.eval.bits.iunf = v.si == numeric_limits<vsi_t>::min();
-		#endif
+			if constexpr (default_policy::opint_check)
+			{
+				_state.eval.bits.iovf = false;
+				_state.eval.bits.iunf = v.si == numeric_limits<vsi_t>::min();
+			}
 
 			--v.si;
 		}
@@ -1415,9 +1709,9 @@ namespace interpreter
 			V& v = _stack.top<V>();
 
 			bool zeromirror = si == (vsi_t)0 || (si == (vsi_t)-1 && v.si == numeric_limits<vsi_t>::min());
-		#ifdef OPINTCHECK
-			_state.eval.bits.ierr = zeromirror;
-		#endif
+
+			if constexpr (default_policy::opint_check)
+				_state.eval.bits.ierr = zeromirror;
 
 			if (!zeromirror)
 				v.si /= si;
@@ -1429,10 +1723,11 @@ namespace interpreter
 			using vsi_t = decltype(V::si);
 			V& v = _stack.top<V>();
 
-		#ifdef OPINTCHECK
-			_state.eval.bits.iovf = v.si == numeric_limits<vsi_t>::max();
-			_state.eval.bits.iunf = false;
-		#endif
+			if constexpr (default_policy::opint_check)
+			{
+				_state.eval.bits.iovf = v.si == numeric_limits<vsi_t>::max();
+				_state.eval.bits.iunf = false;
+			}
 
 			++v.si;
 		}
@@ -1445,9 +1740,9 @@ namespace interpreter
 			V& v = _stack.top<V>();
 
 			bool zero = si == (vsi_t)0;
-		#ifdef OPINTCHECK
-			_state.eval.bits.ierr = zero;
-		#endif
+
+			if constexpr (default_policy::opint_check)
+				_state.eval.bits.ierr = zero;
 
 			if (!zero)
 			{
@@ -1465,11 +1760,10 @@ namespace interpreter
 			const vsi_t si = _stack.pop<V>().si;
 			V& v = _stack.top<V>();
 
-		#ifdef OPINTCHECK
-			__mul<V>::smul(v, si, _state);
-		#else
-			v.si *= si;
-		#endif
+			if constexpr (default_policy::opint_check)
+				__mul<V>::smul(v, si, _state);
+			else
+				v.si *= si;
 		}
 
 		template <VALUE V>
@@ -1497,10 +1791,11 @@ namespace interpreter
 			const vsi_t si = _stack.pop<V>().si;
 			V& v = _stack.top<V>();
 
-		#ifdef OPINTCHECK
-			_state.eval.bits.iovf = si < (vsi_t)0 && v.si > numeric_limits<vsi_t>::max() + si;
-			_state.eval.bits.iunf = si > (vsi_t)0 && v.si < numeric_limits<vsi_t>::min() + si;
-		#endif
+			if constexpr (default_policy::opint_check)
+			{
+				_state.eval.bits.iovf = si < (vsi_t)0 && v.si > numeric_limits<vsi_t>::max() + si;
+				_state.eval.bits.iunf = si > (vsi_t)0 && v.si < numeric_limits<vsi_t>::min() + si;
+			}
 
 			v.si -= si;
 		}
@@ -1512,10 +1807,11 @@ namespace interpreter
 			const vui_t ui = _stack.pop<V>().ui;
 			V& v = _stack.top<V>();
 
-		#ifdef OPINTCHECK
-			_state.eval.bits.iovf = v.ui > numeric_limits<vui_t>::max() - ui;
-			_state.eval.bits.iunf = false;
-		#endif
+			if constexpr (default_policy::opint_check)
+			{
+				_state.eval.bits.iovf = v.ui > numeric_limits<vui_t>::max() - ui;
+				_state.eval.bits.iunf = false;
+			}
 
 			v.ui += ui;
 		}
@@ -1537,10 +1833,11 @@ namespace interpreter
 			using vui_t = decltype(V::ui);
 			V& v = _stack.top<V>();
 
-		#ifdef OPINTCHECK
-			_state.eval.bits.iovf = false;
-			_state.eval.bits.iunf = v.ui == numeric_limits<vui_t>::min();
-		#endif
+			if constexpr (default_policy::opint_check)
+			{
+				_state.eval.bits.iovf = false;
+				_state.eval.bits.iunf = v.ui == numeric_limits<vui_t>::min();
+			}
 
 			--v.ui;
 		}
@@ -1553,9 +1850,9 @@ namespace interpreter
 			V& v = _stack.top<V>();
 
 			bool zero = ui == (vui_t)0;
-		#ifdef OPINTCHECK
-			_state.eval.bits.ierr = zero;
-		#endif
+
+			if constexpr (default_policy::opint_check)
+				_state.eval.bits.ierr = zero;
 
 			if (!zero)
 				v.ui /= ui;
@@ -1567,10 +1864,11 @@ namespace interpreter
 			using vui_t = decltype(V::ui);
 			V& v = _stack.top<V>();
 
-		#ifdef OPINTCHECK
-			_state.eval.bits.iovf = v.ui == numeric_limits<vui_t>::max();
-			_state.eval.bits.iunf = false;
-		#endif
+			if constexpr (default_policy::opint_check)
+			{
+				_state.eval.bits.iovf = v.ui == numeric_limits<vui_t>::max();
+				_state.eval.bits.iunf = false;
+			}
 
 			++v.ui;
 		}
@@ -1583,9 +1881,9 @@ namespace interpreter
 			V& v = _stack.top<V>();
 
 			bool zero = ui == (vui_t)0;
-		#ifdef OPINTCHECK
-			_state.eval.bits.ierr = zero;
-		#endif
+
+			if constexpr (default_policy::opint_check)
+				_state.eval.bits.ierr = zero;
 
 			if (!zero)
 				v.ui %= ui;
@@ -1598,11 +1896,10 @@ namespace interpreter
 			const vui_t ui = _stack.pop<V>().ui;
 			V& v = _stack.top<V>();
 
-		#ifdef OPINTCHECK
-			__mul<V>::umul(v, ui, _state);
-		#else
-			v.ui *= ui;
-		#endif
+			if constexpr (default_policy::opint_check)
+				__mul<V>::umul(v, ui, _state);
+			else
+				v.ui *= ui;
 		}
 
 		template <VALUE V>
@@ -1630,10 +1927,11 @@ namespace interpreter
 			const vui_t ui = _stack.pop<V>().ui;
 			V& v = _stack.top<V>();
 
-		#ifdef OPINTCHECK
-			_state.eval.bits.iovf = false;
-			_state.eval.bits.iunf = v.ui < ui;
-		#endif
+			if constexpr (default_policy::opint_check)
+			{
+				_state.eval.bits.iovf = false;
+				_state.eval.bits.iunf = v.ui < ui;
+			}
 
 			v.ui -= ui;
 		}
@@ -1648,16 +1946,78 @@ namespace interpreter
 			v.ui ^= ui;
 		}
 
+		// Native code an op calls may call back, the callback frame goes under the stack top the
+		// loop keeps to itself until then
+
+		inline void __dil_native(uintptr_t stop) noexcept
+		{
+			_stack.set_stop(stop);
+		}
+
+		// Callbacks do not throw through the native frames that called them, what they throw is
+		// kept until the native op returns
+
+		inline void __dil_thrown()
+		{
+			if (_thrown != (std::exception_ptr)nullptr)
+				std::rethrow_exception(std::exchange(_thrown, (std::exception_ptr)nullptr));
+		}
+
+		static void __enter(void* context, const nativecallback& callback, void* ret_val, void** arg_val) noexcept;
+		void enter(const nativecallback& callback, void* ret_val, void** arg_val) noexcept;
+
+		template <bool STEP = false, typename P = default_policy>
+		void __loop_switch();
+	#ifdef GNUCTHREAD
+		void __loop_thread();
+	#endif
+	#ifdef DEEPINLINE
+		void __loop_decode();
+		void __loop_cache();
+		void __loop_register();
+	#endif
+	#ifdef X64JIT
+		template <typename CODE>
+		void __loop_native(const CODE& code);
+		void __loop_trace();
+	#endif
+
 	public:
+	#if (defined(TRACEJIT) && defined(X64JIT))
+		static constexpr dispatch_type default_dispatch = dispatch_type::traced;
+	#elif (defined(STENCILJIT) && defined(X64JIT))
+		static constexpr dispatch_type default_dispatch = dispatch_type::patched;
+	#elif (defined(TEMPLATEJIT) && defined(X64JIT))
+		static constexpr dispatch_type default_dispatch = dispatch_type::jitted;
+	#elif (defined(REGISTERVM) && defined(DEEPINLINE))
+		static constexpr dispatch_type default_dispatch = dispatch_type::registered;
+	#elif (defined(TOSCACHE) && defined(DEEPINLINE))
+		static constexpr dispatch_type default_dispatch = dispatch_type::cached;
+	#elif defined(PREDECODE)
+		static constexpr dispatch_type default_dispatch = dispatch_type::decoded;
+	#elif defined(DIRECTTHREAD)
+		static constexpr dispatch_type default_dispatch = dispatch_type::threaded;
+	#else
+		static constexpr dispatch_type default_dispatch = dispatch_type::switched;
+	#endif
+		static constexpr check_type default_check = default_policy::fetch_check || default_policy::stack_check
+			? check_type::checked : check_type::unchecked;
+
+		static void fuse_ops(uint8_t* code, uint64_t code_size);
+		static void fuse_ops(uint8_t* bcode, const uint8_t* ecode);
 		static void rev_endian(uint8_t* code, uint64_t code_size);
 		static void rev_endian(uint8_t* bcode, const uint8_t* ecode);
 
 		dispatcher() = delete;
-	#ifdef FETCHCHECK
-		dispatcher(const uint8_t* code, uint64_t code_size, uint64_t cache_size, uint64_t stack_size);
-		dispatcher(const uint8_t* bcode, const uint8_t* ecode, uint64_t cache_size, uint64_t stack_size);
-	#else
-		dispatcher(const uint8_t* code, uint64_t cache_size, uint64_t stack_size);
+		dispatcher(const uint8_t* code, uint64_t code_size, uint64_t cache_size, uint64_t stack_size,
+			dispatch_type disp_type = default_dispatch, check_type chk_type = default_check);
+		dispatcher(const uint8_t* bcode, const uint8_t* ecode, uint64_t cache_size, uint64_t stack_size,
+			dispatch_type disp_type = default_dispatch, check_type chk_type = default_check);
+	#if (defined(DEEPINLINE) || !defined(FETCHCHECK))
+		// Code of unknown size runs unchecked
+
+		dispatcher(const uint8_t* code, uint64_t cache_size, uint64_t stack_size,
+			dispatch_type disp_type = default_dispatch);
 	#endif
 		dispatcher(const dispatcher& o) = delete;
 		dispatcher(dispatcher&& o) noexcept;
@@ -1682,7 +2042,26 @@ namespace interpreter
 			return _stack.pop<V>();
 		}
 
+		inline nativehub& get_nativehub() noexcept
+		{
+			return _nativehub;
+		}
+
+		inline const nativehub& get_nativehub() const noexcept
+		{
+			return _nativehub;
+		}
+
+	#ifdef OPPROFILE
+		inline const op_profile& get_profile() const noexcept
+		{
+			return _profile;
+		}
+
+	#endif
 		dispatcher& operator=(const dispatcher& o) = delete;
 		dispatcher& operator=(dispatcher&& o) noexcept;
 	};
-}
\ No newline at end of file
+}
+
+#include "dispatcher_gen.hpp"
\ No newline at end of file
@@ -0,0 +1,1714 @@
+#include "dispatcher.hpp"
+
+using namespace interpreter;
+using namespace std;
+
+#ifdef DEEPINLINE
+#define __2_POW_64 18446744073709551616.0
+#define __2_POW_63 9223372036854775808.0
+#define __2_POW_32 4294967296.0
+#define __2_POW_31 2147483648.0
+#define __0 0.0
+
+// Up to two 64-bit values from the top of the stack stay in tos_0 and tos_1 instead of memory,
+// the switch goes over op and cache state together so every cached op has a handler for each
+// state; ops that are not cached spill the cache and run the handlers of dispatcher::loop
+
+#define __TOS(OP, N) (((uint64_t)op::OP << 2ui64) | N)
+
+// With labels as values every handler also gets its own indirect jump through a table
+// of op and cache state, otherwise handlers break back to the switch
+
+#ifdef GNUCTHREAD
+#define __CASE(OP, N) case __TOS(OP, N): __tos_##OP##_##N
+#define __NEXT goto *__label[((uint64_t)dil_fetch<val8<>>(opptr).ui << 2ui64) | cached]
+#else
+#define __CASE(OP, N) case __TOS(OP, N)
+#define __NEXT break
+#endif
+
+// Frame slots below stop may still be cached, ops reading them in memory spill first
+
+#define __ALIASED(K) ((uintptr_t)&stack_type::dil_get<val64<>>(ftop, (ptrdiff_t)((const val8<>*)(opptr + (ptrdiff_t)K))->si) < stop)
+
+#define __KEEP(OP) \
+	__CASE(OP, 0): \
+	__CASE(OP, 1): \
+	__CASE(OP, 2)
+
+#define __SPILL(OP) \
+	__CASE(OP, 2): \
+		stack_type::dil_push<val64<>>(stop, val64<>(tos_1)); \
+		[[fallthrough]]; \
+	__CASE(OP, 1): \
+		stack_type::dil_push<val64<>>(stop, val64<>(tos_0)); \
+		cached = 0ui64; \
+		[[fallthrough]]; \
+	__CASE(OP, 0)
+
+// Cached ops keep their own handlers, the shared handlers of every other op spill the cache first
+// unless the op leaves the stack alone
+
+#define __OP(name) __SPILL(name)
+#define __OP_FLOW(name) __KEEP(name)
+#define __OP_NEXT __NEXT
+
+#define __CACHED_l_load_64
+#define __CACHED_l_store_64
+#define __CACHED_s_load_64
+#define __CACHED_s_store_64
+#define __CACHED_push_64
+#define __CACHED_pop_64
+#define __CACHED_dup_64
+#define __CACHED_not_64
+#define __CACHED_and_64
+#define __CACHED_or_64
+#define __CACHED_xor_64
+#define __CACHED_scmp_64
+#define __CACHED_ucmp_64
+#define __CACHED_s_ucmp_jmp_64
+#define __CACHED_s_scmp_jmp_64
+#define __CACHED_s_uinc_64
+#define __CACHED_s_udec_64
+#define __CACHED_s_move_64
+
+#ifndef OPINTCHECK
+#define __CACHED_neg_64
+#define __CACHED_sinc_64
+#define __CACHED_uinc_64
+#define __CACHED_sdec_64
+#define __CACHED_udec_64
+#define __CACHED_sadd_64
+#define __CACHED_uadd_64
+#define __CACHED_ssub_64
+#define __CACHED_usub_64
+#define __CACHED_smul_64
+#define __CACHED_umul_64
+#define __CACHED_s_uadd_64
+#endif
+
+void dispatcher::__loop_cache()
+{
+	using P = default_policy;
+
+	uintptr_t ftop = _stack.get_ftop();
+	uintptr_t stop = _stack.get_stop();
+
+	const uint8_t* opptr = _opptr;
+	state state = _state;
+
+	// stop is where the stack in memory ends, tos_0 is the top when cached is not zero
+
+	uint64_t tos_0 = 0ui64;
+	uint64_t tos_1 = 0ui64;
+	uint64_t cached = 0ui64;
+
+#ifdef GNUCTHREAD
+	static const void* const __label[1024ui64] =
+	{
+		&&__tos_nop_0,
+		&&__tos_nop_1,
+		&&__tos_nop_2,
+		&&__tos_default,
+		&&__tos_exit_0,
+		&&__tos_exit_1,
+		&&__tos_exit_2,
+		&&__tos_default,
+		&&__tos_nativecall_0,
+		&&__tos_nativecall_1,
+		&&__tos_nativecall_2,
+		&&__tos_default,
+		&&__tos_ret_0,
+		&&__tos_ret_1,
+		&&__tos_ret_2,
+		&&__tos_default,
+		&&__tos_call_64_0,
+		&&__tos_call_64_1,
+		&&__tos_call_64_2,
+		&&__tos_default,
+		&&__tos_call_32_0,
+		&&__tos_call_32_1,
+		&&__tos_call_32_2,
+		&&__tos_default,
+		&&__tos_call_16_0,
+		&&__tos_call_16_1,
+		&&__tos_call_16_2,
+		&&__tos_default,
+		&&__tos_call_8_0,
+		&&__tos_call_8_1,
+		&&__tos_call_8_2,
+		&&__tos_default,
+		&&__tos_memcpy_0,
+		&&__tos_memcpy_1,
+		&&__tos_memcpy_2,
+		&&__tos_default,
+		&&__tos_memset_0,
+		&&__tos_memset_1,
+		&&__tos_memset_2,
+		&&__tos_default,
+		&&__tos_l_alloc_0,
+		&&__tos_l_alloc_1,
+		&&__tos_l_alloc_2,
+		&&__tos_default,
+		&&__tos_s_alloc_0,
+		&&__tos_s_alloc_1,
+		&&__tos_s_alloc_2,
+		&&__tos_default,
+		&&__tos_l_allocz_0,
+		&&__tos_l_allocz_1,
+		&&__tos_l_allocz_2,
+		&&__tos_default,
+		&&__tos_s_allocz_0,
+		&&__tos_s_allocz_1,
+		&&__tos_s_allocz_2,
+		&&__tos_default,
+		&&__tos_l_dealloc_0,
+		&&__tos_l_dealloc_1,
+		&&__tos_l_dealloc_2,
+		&&__tos_default,
+		&&__tos_s_dealloc_0,
+		&&__tos_s_dealloc_1,
+		&&__tos_s_dealloc_2,
+		&&__tos_default,
+		&&__tos_push_flow_0,
+		&&__tos_push_flow_1,
+		&&__tos_push_flow_2,
+		&&__tos_default,
+		&&__tos_push_frame_0,
+		&&__tos_push_frame_1,
+		&&__tos_push_frame_2,
+		&&__tos_default,
+		&&__tos_push_stack_0,
+		&&__tos_push_stack_1,
+		&&__tos_push_stack_2,
+		&&__tos_default,
+		&&__tos_push_state_0,
+		&&__tos_push_state_1,
+		&&__tos_push_state_2,
+		&&__tos_default,
+		&&__tos_pop_flow_0,
+		&&__tos_pop_flow_1,
+		&&__tos_pop_flow_2,
+		&&__tos_default,
+		&&__tos_pop_frame_0,
+		&&__tos_pop_frame_1,
+		&&__tos_pop_frame_2,
+		&&__tos_default,
+		&&__tos_pop_stack_0,
+		&&__tos_pop_stack_1,
+		&&__tos_pop_stack_2,
+		&&__tos_default,
+		&&__tos_pop_state_0,
+		&&__tos_pop_state_1,
+		&&__tos_pop_state_2,
+		&&__tos_default,
+		&&__tos_jmp_64_0,
+		&&__tos_jmp_64_1,
+		&&__tos_jmp_64_2,
+		&&__tos_default,
+		&&__tos_jmp_32_0,
+		&&__tos_jmp_32_1,
+		&&__tos_jmp_32_2,
+		&&__tos_default,
+		&&__tos_jmp_16_0,
+		&&__tos_jmp_16_1,
+		&&__tos_jmp_16_2,
+		&&__tos_default,
+		&&__tos_jmp_8_0,
+		&&__tos_jmp_8_1,
+		&&__tos_jmp_8_2,
+		&&__tos_default,
+		&&__tos_jmp_a_64_0,
+		&&__tos_jmp_a_64_1,
+		&&__tos_jmp_a_64_2,
+		&&__tos_default,
+		&&__tos_jmp_a_32_0,
+		&&__tos_jmp_a_32_1,
+		&&__tos_jmp_a_32_2,
+		&&__tos_default,
+		&&__tos_jmp_a_16_0,
+		&&__tos_jmp_a_16_1,
+		&&__tos_jmp_a_16_2,
+		&&__tos_default,
+		&&__tos_jmp_a_8_0,
+		&&__tos_jmp_a_8_1,
+		&&__tos_jmp_a_8_2,
+		&&__tos_default,
+		&&__tos_jmp_ae_64_0,
+		&&__tos_jmp_ae_64_1,
+		&&__tos_jmp_ae_64_2,
+		&&__tos_default,
+		&&__tos_jmp_ae_32_0,
+		&&__tos_jmp_ae_32_1,
+		&&__tos_jmp_ae_32_2,
+		&&__tos_default,
+		&&__tos_jmp_ae_16_0,
+		&&__tos_jmp_ae_16_1,
+		&&__tos_jmp_ae_16_2,
+		&&__tos_default,
+		&&__tos_jmp_ae_8_0,
+		&&__tos_jmp_ae_8_1,
+		&&__tos_jmp_ae_8_2,
+		&&__tos_default,
+		&&__tos_jmp_b_64_0,
+		&&__tos_jmp_b_64_1,
+		&&__tos_jmp_b_64_2,
+		&&__tos_default,
+		&&__tos_jmp_b_32_0,
+		&&__tos_jmp_b_32_1,
+		&&__tos_jmp_b_32_2,
+		&&__tos_default,
+		&&__tos_jmp_b_16_0,
+		&&__tos_jmp_b_16_1,
+		&&__tos_jmp_b_16_2,
+		&&__tos_default,
+		&&__tos_jmp_b_8_0,
+		&&__tos_jmp_b_8_1,
+		&&__tos_jmp_b_8_2,
+		&&__tos_default,
+		&&__tos_jmp_be_64_0,
+		&&__tos_jmp_be_64_1,
+		&&__tos_jmp_be_64_2,
+		&&__tos_default,
+		&&__tos_jmp_be_32_0,
+		&&__tos_jmp_be_32_1,
+		&&__tos_jmp_be_32_2,
+		&&__tos_default,
+		&&__tos_jmp_be_16_0,
+		&&__tos_jmp_be_16_1,
+		&&__tos_jmp_be_16_2,
+		&&__tos_default,
+		&&__tos_jmp_be_8_0,
+		&&__tos_jmp_be_8_1,
+		&&__tos_jmp_be_8_2,
+		&&__tos_default,
+		&&__tos_jmp_e_64_0,
+		&&__tos_jmp_e_64_1,
+		&&__tos_jmp_e_64_2,
+		&&__tos_default,
+		&&__tos_jmp_e_32_0,
+		&&__tos_jmp_e_32_1,
+		&&__tos_jmp_e_32_2,
+		&&__tos_default,
+		&&__tos_jmp_e_16_0,
+		&&__tos_jmp_e_16_1,
+		&&__tos_jmp_e_16_2,
+		&&__tos_default,
+		&&__tos_jmp_e_8_0,
+		&&__tos_jmp_e_8_1,
+		&&__tos_jmp_e_8_2,
+		&&__tos_default,
+		&&__tos_jmp_ne_64_0,
+		&&__tos_jmp_ne_64_1,
+		&&__tos_jmp_ne_64_2,
+		&&__tos_default,
+		&&__tos_jmp_ne_32_0,
+		&&__tos_jmp_ne_32_1,
+		&&__tos_jmp_ne_32_2,
+		&&__tos_default,
+		&&__tos_jmp_ne_16_0,
+		&&__tos_jmp_ne_16_1,
+		&&__tos_jmp_ne_16_2,
+		&&__tos_default,
+		&&__tos_jmp_ne_8_0,
+		&&__tos_jmp_ne_8_1,
+		&&__tos_jmp_ne_8_2,
+		&&__tos_default,
+		&&__tos_jmp_un_64_0,
+		&&__tos_jmp_un_64_1,
+		&&__tos_jmp_un_64_2,
+		&&__tos_default,
+		&&__tos_jmp_un_32_0,
+		&&__tos_jmp_un_32_1,
+		&&__tos_jmp_un_32_2,
+		&&__tos_default,
+		&&__tos_jmp_un_16_0,
+		&&__tos_jmp_un_16_1,
+		&&__tos_jmp_un_16_2,
+		&&__tos_default,
+		&&__tos_jmp_un_8_0,
+		&&__tos_jmp_un_8_1,
+		&&__tos_jmp_un_8_2,
+		&&__tos_default,
+		&&__tos_jmp_msk_64_0,
+		&&__tos_jmp_msk_64_1,
+		&&__tos_jmp_msk_64_2,
+		&&__tos_default,
+		&&__tos_jmp_msk_32_0,
+		&&__tos_jmp_msk_32_1,
+		&&__tos_jmp_msk_32_2,
+		&&__tos_default,
+		&&__tos_jmp_msk_16_0,
+		&&__tos_jmp_msk_16_1,
+		&&__tos_jmp_msk_16_2,
+		&&__tos_default,
+		&&__tos_jmp_msk_8_0,
+		&&__tos_jmp_msk_8_1,
+		&&__tos_jmp_msk_8_2,
+		&&__tos_default,
+		&&__tos_l_load_64_0,
+		&&__tos_l_load_64_1,
+		&&__tos_l_load_64_2,
+		&&__tos_default,
+		&&__tos_l_load_32_0,
+		&&__tos_l_load_32_1,
+		&&__tos_l_load_32_2,
+		&&__tos_default,
+		&&__tos_l_load_16_0,
+		&&__tos_l_load_16_1,
+		&&__tos_l_load_16_2,
+		&&__tos_default,
+		&&__tos_l_load_8_0,
+		&&__tos_l_load_8_1,
+		&&__tos_l_load_8_2,
+		&&__tos_default,
+		&&__tos_l_store_64_0,
+		&&__tos_l_store_64_1,
+		&&__tos_l_store_64_2,
+		&&__tos_default,
+		&&__tos_l_store_32_0,
+		&&__tos_l_store_32_1,
+		&&__tos_l_store_32_2,
+		&&__tos_default,
+		&&__tos_l_store_16_0,
+		&&__tos_l_store_16_1,
+		&&__tos_l_store_16_2,
+		&&__tos_default,
+		&&__tos_l_store_8_0,
+		&&__tos_l_store_8_1,
+		&&__tos_l_store_8_2,
+		&&__tos_default,
+		&&__tos_s_load_64_0,
+		&&__tos_s_load_64_1,
+		&&__tos_s_load_64_2,
+		&&__tos_default,
+		&&__tos_s_load_32_0,
+		&&__tos_s_load_32_1,
+		&&__tos_s_load_32_2,
+		&&__tos_default,
+		&&__tos_s_load_16_0,
+		&&__tos_s_load_16_1,
+		&&__tos_s_load_16_2,
+		&&__tos_default,
+		&&__tos_s_load_8_0,
+		&&__tos_s_load_8_1,
+		&&__tos_s_load_8_2,
+		&&__tos_default,
+		&&__tos_s_store_64_0,
+		&&__tos_s_store_64_1,
+		&&__tos_s_store_64_2,
+		&&__tos_default,
+		&&__tos_s_store_32_0,
+		&&__tos_s_store_32_1,
+		&&__tos_s_store_32_2,
+		&&__tos_default,
+		&&__tos_s_store_16_0,
+		&&__tos_s_store_16_1,
+		&&__tos_s_store_16_2,
+		&&__tos_default,
+		&&__tos_s_store_8_0,
+		&&__tos_s_store_8_1,
+		&&__tos_s_store_8_2,
+		&&__tos_default,
+		&&__tos_push_64_0,
+		&&__tos_push_64_1,
+		&&__tos_push_64_2,
+		&&__tos_default,
+		&&__tos_push_32_0,
+		&&__tos_push_32_1,
+		&&__tos_push_32_2,
+		&&__tos_default,
+		&&__tos_push_16_0,
+		&&__tos_push_16_1,
+		&&__tos_push_16_2,
+		&&__tos_default,
+		&&__tos_push_8_0,
+		&&__tos_push_8_1,
+		&&__tos_push_8_2,
+		&&__tos_default,
+		&&__tos_pop_64_0,
+		&&__tos_pop_64_1,
+		&&__tos_pop_64_2,
+		&&__tos_default,
+		&&__tos_pop_32_0,
+		&&__tos_pop_32_1,
+		&&__tos_pop_32_2,
+		&&__tos_default,
+		&&__tos_pop_16_0,
+		&&__tos_pop_16_1,
+		&&__tos_pop_16_2,
+		&&__tos_default,
+		&&__tos_pop_8_0,
+		&&__tos_pop_8_1,
+		&&__tos_pop_8_2,
+		&&__tos_default,
+		&&__tos_dup_64_0,
+		&&__tos_dup_64_1,
+		&&__tos_dup_64_2,
+		&&__tos_default,
+		&&__tos_dup_32_0,
+		&&__tos_dup_32_1,
+		&&__tos_dup_32_2,
+		&&__tos_default,
+		&&__tos_dup_16_0,
+		&&__tos_dup_16_1,
+		&&__tos_dup_16_2,
+		&&__tos_default,
+		&&__tos_dup_8_0,
+		&&__tos_dup_8_1,
+		&&__tos_dup_8_2,
+		&&__tos_default,
+		&&__tos_ptrcpy_64_0,
+		&&__tos_ptrcpy_64_1,
+		&&__tos_ptrcpy_64_2,
+		&&__tos_default,
+		&&__tos_ptrcpy_32_0,
+		&&__tos_ptrcpy_32_1,
+		&&__tos_ptrcpy_32_2,
+		&&__tos_default,
+		&&__tos_ptrcpy_16_0,
+		&&__tos_ptrcpy_16_1,
+		&&__tos_ptrcpy_16_2,
+		&&__tos_default,
+		&&__tos_ptrcpy_8_0,
+		&&__tos_ptrcpy_8_1,
+		&&__tos_ptrcpy_8_2,
+		&&__tos_default,
+		&&__tos_ptrget_64_0,
+		&&__tos_ptrget_64_1,
+		&&__tos_ptrget_64_2,
+		&&__tos_default,
+		&&__tos_ptrget_32_0,
+		&&__tos_ptrget_32_1,
+		&&__tos_ptrget_32_2,
+		&&__tos_default,
+		&&__tos_ptrget_16_0,
+		&&__tos_ptrget_16_1,
+		&&__tos_ptrget_16_2,
+		&&__tos_default,
+		&&__tos_ptrget_8_0,
+		&&__tos_ptrget_8_1,
+		&&__tos_ptrget_8_2,
+		&&__tos_default,
+		&&__tos_ptrset_64_0,
+		&&__tos_ptrset_64_1,
+		&&__tos_ptrset_64_2,
+		&&__tos_default,
+		&&__tos_ptrset_32_0,
+		&&__tos_ptrset_32_1,
+		&&__tos_ptrset_32_2,
+		&&__tos_default,
+		&&__tos_ptrset_16_0,
+		&&__tos_ptrset_16_1,
+		&&__tos_ptrset_16_2,
+		&&__tos_default,
+		&&__tos_ptrset_8_0,
+		&&__tos_ptrset_8_1,
+		&&__tos_ptrset_8_2,
+		&&__tos_default,
+		&&__tos_neg_64_0,
+		&&__tos_neg_64_1,
+		&&__tos_neg_64_2,
+		&&__tos_default,
+		&&__tos_neg_32_0,
+		&&__tos_neg_32_1,
+		&&__tos_neg_32_2,
+		&&__tos_default,
+		&&__tos_neg_16_0,
+		&&__tos_neg_16_1,
+		&&__tos_neg_16_2,
+		&&__tos_default,
+		&&__tos_neg_8_0,
+		&&__tos_neg_8_1,
+		&&__tos_neg_8_2,
+		&&__tos_default,
+		&&__tos_not_64_0,
+		&&__tos_not_64_1,
+		&&__tos_not_64_2,
+		&&__tos_default,
+		&&__tos_not_32_0,
+		&&__tos_not_32_1,
+		&&__tos_not_32_2,
+		&&__tos_default,
+		&&__tos_not_16_0,
+		&&__tos_not_16_1,
+		&&__tos_not_16_2,
+		&&__tos_default,
+		&&__tos_not_8_0,
+		&&__tos_not_8_1,
+		&&__tos_not_8_2,
+		&&__tos_default,
+		&&__tos_sinc_64_0,
+		&&__tos_sinc_64_1,
+		&&__tos_sinc_64_2,
+		&&__tos_default,
+		&&__tos_sinc_32_0,
+		&&__tos_sinc_32_1,
+		&&__tos_sinc_32_2,
+		&&__tos_default,
+		&&__tos_sinc_16_0,
+		&&__tos_sinc_16_1,
+		&&__tos_sinc_16_2,
+		&&__tos_default,
+		&&__tos_sinc_8_0,
+		&&__tos_sinc_8_1,
+		&&__tos_sinc_8_2,
+		&&__tos_default,
+		&&__tos_uinc_64_0,
+		&&__tos_uinc_64_1,
+		&&__tos_uinc_64_2,
+		&&__tos_default,
+		&&__tos_uinc_32_0,
+		&&__tos_uinc_32_1,
+		&&__tos_uinc_32_2,
+		&&__tos_default,
+		&&__tos_uinc_16_0,
+		&&__tos_uinc_16_1,
+		&&__tos_uinc_16_2,
+		&&__tos_default,
+		&&__tos_uinc_8_0,
+		&&__tos_uinc_8_1,
+		&&__tos_uinc_8_2,
+		&&__tos_default,
+		&&__tos_sdec_64_0,
+		&&__tos_sdec_64_1,
+		&&__tos_sdec_64_2,
+		&&__tos_default,
+		&&__tos_sdec_32_0,
+		&&__tos_sdec_32_1,
+		&&__tos_sdec_32_2,
+		&&__tos_default,
+		&&__tos_sdec_16_0,
+		&&__tos_sdec_16_1,
+		&&__tos_sdec_16_2,
+		&&__tos_default,
+		&&__tos_sdec_8_0,
+		&&__tos_sdec_8_1,
+		&&__tos_sdec_8_2,
+		&&__tos_default,
+		&&__tos_udec_64_0,
+		&&__tos_udec_64_1,
+		&&__tos_udec_64_2,
+		&&__tos_default,
+		&&__tos_udec_32_0,
+		&&__tos_udec_32_1,
+		&&__tos_udec_32_2,
+		&&__tos_default,
+		&&__tos_udec_16_0,
+		&&__tos_udec_16_1,
+		&&__tos_udec_16_2,
+		&&__tos_default,
+		&&__tos_udec_8_0,
+		&&__tos_udec_8_1,
+		&&__tos_udec_8_2,
+		&&__tos_default,
+		&&__tos_and_64_0,
+		&&__tos_and_64_1,
+		&&__tos_and_64_2,
+		&&__tos_default,
+		&&__tos_and_32_0,
+		&&__tos_and_32_1,
+		&&__tos_and_32_2,
+		&&__tos_default,
+		&&__tos_and_16_0,
+		&&__tos_and_16_1,
+		&&__tos_and_16_2,
+		&&__tos_default,
+		&&__tos_and_8_0,
+		&&__tos_and_8_1,
+		&&__tos_and_8_2,
+		&&__tos_default,
+		&&__tos_or_64_0,
+		&&__tos_or_64_1,
+		&&__tos_or_64_2,
+		&&__tos_default,
+		&&__tos_or_32_0,
+		&&__tos_or_32_1,
+		&&__tos_or_32_2,
+		&&__tos_default,
+		&&__tos_or_16_0,
+		&&__tos_or_16_1,
+		&&__tos_or_16_2,
+		&&__tos_default,
+		&&__tos_or_8_0,
+		&&__tos_or_8_1,
+		&&__tos_or_8_2,
+		&&__tos_default,
+		&&__tos_xor_64_0,
+		&&__tos_xor_64_1,
+		&&__tos_xor_64_2,
+		&&__tos_default,
+		&&__tos_xor_32_0,
+		&&__tos_xor_32_1,
+		&&__tos_xor_32_2,
+		&&__tos_default,
+		&&__tos_xor_16_0,
+		&&__tos_xor_16_1,
+		&&__tos_xor_16_2,
+		&&__tos_default,
+		&&__tos_xor_8_0,
+		&&__tos_xor_8_1,
+		&&__tos_xor_8_2,
+		&&__tos_default,
+		&&__tos_sadd_64_0,
+		&&__tos_sadd_64_1,
+		&&__tos_sadd_64_2,
+		&&__tos_default,
+		&&__tos_sadd_32_0,
+		&&__tos_sadd_32_1,
+		&&__tos_sadd_32_2,
+		&&__tos_default,
+		&&__tos_sadd_16_0,
+		&&__tos_sadd_16_1,
+		&&__tos_sadd_16_2,
+		&&__tos_default,
+		&&__tos_sadd_8_0,
+		&&__tos_sadd_8_1,
+		&&__tos_sadd_8_2,
+		&&__tos_default,
+		&&__tos_uadd_64_0,
+		&&__tos_uadd_64_1,
+		&&__tos_uadd_64_2,
+		&&__tos_default,
+		&&__tos_uadd_32_0,
+		&&__tos_uadd_32_1,
+		&&__tos_uadd_32_2,
+		&&__tos_default,
+		&&__tos_uadd_16_0,
+		&&__tos_uadd_16_1,
+		&&__tos_uadd_16_2,
+		&&__tos_default,
+		&&__tos_uadd_8_0,
+		&&__tos_uadd_8_1,
+		&&__tos_uadd_8_2,
+		&&__tos_default,
+		&&__tos_ssub_64_0,
+		&&__tos_ssub_64_1,
+		&&__tos_ssub_64_2,
+		&&__tos_default,
+		&&__tos_ssub_32_0,
+		&&__tos_ssub_32_1,
+		&&__tos_ssub_32_2,
+		&&__tos_default,
+		&&__tos_ssub_16_0,
+		&&__tos_ssub_16_1,
+		&&__tos_ssub_16_2,
+		&&__tos_default,
+		&&__tos_ssub_8_0,
+		&&__tos_ssub_8_1,
+		&&__tos_ssub_8_2,
+		&&__tos_default,
+		&&__tos_usub_64_0,
+		&&__tos_usub_64_1,
+		&&__tos_usub_64_2,
+		&&__tos_default,
+		&&__tos_usub_32_0,
+		&&__tos_usub_32_1,
+		&&__tos_usub_32_2,
+		&&__tos_default,
+		&&__tos_usub_16_0,
+		&&__tos_usub_16_1,
+		&&__tos_usub_16_2,
+		&&__tos_default,
+		&&__tos_usub_8_0,
+		&&__tos_usub_8_1,
+		&&__tos_usub_8_2,
+		&&__tos_default,
+		&&__tos_smul_64_0,
+		&&__tos_smul_64_1,
+		&&__tos_smul_64_2,
+		&&__tos_default,
+		&&__tos_smul_32_0,
+		&&__tos_smul_32_1,
+		&&__tos_smul_32_2,
+		&&__tos_default,
+		&&__tos_smul_16_0,
+		&&__tos_smul_16_1,
+		&&__tos_smul_16_2,
+		&&__tos_default,
+		&&__tos_smul_8_0,
+		&&__tos_smul_8_1,
+		&&__tos_smul_8_2,
+		&&__tos_default,
+		&&__tos_umul_64_0,
+		&&__tos_umul_64_1,
+		&&__tos_umul_64_2,
+		&&__tos_default,
+		&&__tos_umul_32_0,
+		&&__tos_umul_32_1,
+		&&__tos_umul_32_2,
+		&&__tos_default,
+		&&__tos_umul_16_0,
+		&&__tos_umul_16_1,
+		&&__tos_umul_16_2,
+		&&__tos_default,
+		&&__tos_umul_8_0,
+		&&__tos_umul_8_1,
+		&&__tos_umul_8_2,
+		&&__tos_default,
+		&&__tos_smod_64_0,
+		&&__tos_smod_64_1,
+		&&__tos_smod_64_2,
+		&&__tos_default,
+		&&__tos_smod_32_0,
+		&&__tos_smod_32_1,
+		&&__tos_smod_32_2,
+		&&__tos_default,
+		&&__tos_smod_16_0,
+		&&__tos_smod_16_1,
+		&&__tos_smod_16_2,
+		&&__tos_default,
+		&&__tos_smod_8_0,
+		&&__tos_smod_8_1,
+		&&__tos_smod_8_2,
+		&&__tos_default,
+		&&__tos_umod_64_0,
+		&&__tos_umod_64_1,
+		&&__tos_umod_64_2,
+		&&__tos_default,
+		&&__tos_umod_32_0,
+		&&__tos_umod_32_1,
+		&&__tos_umod_32_2,
+		&&__tos_default,
+		&&__tos_umod_16_0,
+		&&__tos_umod_16_1,
+		&&__tos_umod_16_2,
+		&&__tos_default,
+		&&__tos_umod_8_0,
+		&&__tos_umod_8_1,
+		&&__tos_umod_8_2,
+		&&__tos_default,
+		&&__tos_sdiv_64_0,
+		&&__tos_sdiv_64_1,
+		&&__tos_sdiv_64_2,
+		&&__tos_default,
+		&&__tos_sdiv_32_0,
+		&&__tos_sdiv_32_1,
+		&&__tos_sdiv_32_2,
+		&&__tos_default,
+		&&__tos_sdiv_16_0,
+		&&__tos_sdiv_16_1,
+		&&__tos_sdiv_16_2,
+		&&__tos_default,
+		&&__tos_sdiv_8_0,
+		&&__tos_sdiv_8_1,
+		&&__tos_sdiv_8_2,
+		&&__tos_default,
+		&&__tos_udiv_64_0,
+		&&__tos_udiv_64_1,
+		&&__tos_udiv_64_2,
+		&&__tos_default,
+		&&__tos_udiv_32_0,
+		&&__tos_udiv_32_1,
+		&&__tos_udiv_32_2,
+		&&__tos_default,
+		&&__tos_udiv_16_0,
+		&&__tos_udiv_16_1,
+		&&__tos_udiv_16_2,
+		&&__tos_default,
+		&&__tos_udiv_8_0,
+		&&__tos_udiv_8_1,
+		&&__tos_udiv_8_2,
+		&&__tos_default,
+		&&__tos_scmp_64_0,
+		&&__tos_scmp_64_1,
+		&&__tos_scmp_64_2,
+		&&__tos_default,
+		&&__tos_scmp_32_0,
+		&&__tos_scmp_32_1,
+		&&__tos_scmp_32_2,
+		&&__tos_default,
+		&&__tos_scmp_16_0,
+		&&__tos_scmp_16_1,
+		&&__tos_scmp_16_2,
+		&&__tos_default,
+		&&__tos_scmp_8_0,
+		&&__tos_scmp_8_1,
+		&&__tos_scmp_8_2,
+		&&__tos_default,
+		&&__tos_ucmp_64_0,
+		&&__tos_ucmp_64_1,
+		&&__tos_ucmp_64_2,
+		&&__tos_default,
+		&&__tos_ucmp_32_0,
+		&&__tos_ucmp_32_1,
+		&&__tos_ucmp_32_2,
+		&&__tos_default,
+		&&__tos_ucmp_16_0,
+		&&__tos_ucmp_16_1,
+		&&__tos_ucmp_16_2,
+		&&__tos_default,
+		&&__tos_ucmp_8_0,
+		&&__tos_ucmp_8_1,
+		&&__tos_ucmp_8_2,
+		&&__tos_default,
+		&&__tos_rotl_64_0,
+		&&__tos_rotl_64_1,
+		&&__tos_rotl_64_2,
+		&&__tos_default,
+		&&__tos_rotl_32_0,
+		&&__tos_rotl_32_1,
+		&&__tos_rotl_32_2,
+		&&__tos_default,
+		&&__tos_rotl_16_0,
+		&&__tos_rotl_16_1,
+		&&__tos_rotl_16_2,
+		&&__tos_default,
+		&&__tos_rotl_8_0,
+		&&__tos_rotl_8_1,
+		&&__tos_rotl_8_2,
+		&&__tos_default,
+		&&__tos_rotr_64_0,
+		&&__tos_rotr_64_1,
+		&&__tos_rotr_64_2,
+		&&__tos_default,
+		&&__tos_rotr_32_0,
+		&&__tos_rotr_32_1,
+		&&__tos_rotr_32_2,
+		&&__tos_default,
+		&&__tos_rotr_16_0,
+		&&__tos_rotr_16_1,
+		&&__tos_rotr_16_2,
+		&&__tos_default,
+		&&__tos_rotr_8_0,
+		&&__tos_rotr_8_1,
+		&&__tos_rotr_8_2,
+		&&__tos_default,
+		&&__tos_sshl_64_0,
+		&&__tos_sshl_64_1,
+		&&__tos_sshl_64_2,
+		&&__tos_default,
+		&&__tos_sshl_32_0,
+		&&__tos_sshl_32_1,
+		&&__tos_sshl_32_2,
+		&&__tos_default,
+		&&__tos_sshl_16_0,
+		&&__tos_sshl_16_1,
+		&&__tos_sshl_16_2,
+		&&__tos_default,
+		&&__tos_sshl_8_0,
+		&&__tos_sshl_8_1,
+		&&__tos_sshl_8_2,
+		&&__tos_default,
+		&&__tos_ushl_64_0,
+		&&__tos_ushl_64_1,
+		&&__tos_ushl_64_2,
+		&&__tos_default,
+		&&__tos_ushl_32_0,
+		&&__tos_ushl_32_1,
+		&&__tos_ushl_32_2,
+		&&__tos_default,
+		&&__tos_ushl_16_0,
+		&&__tos_ushl_16_1,
+		&&__tos_ushl_16_2,
+		&&__tos_default,
+		&&__tos_ushl_8_0,
+		&&__tos_ushl_8_1,
+		&&__tos_ushl_8_2,
+		&&__tos_default,
+		&&__tos_sshr_64_0,
+		&&__tos_sshr_64_1,
+		&&__tos_sshr_64_2,
+		&&__tos_default,
+		&&__tos_sshr_32_0,
+		&&__tos_sshr_32_1,
+		&&__tos_sshr_32_2,
+		&&__tos_default,
+		&&__tos_sshr_16_0,
+		&&__tos_sshr_16_1,
+		&&__tos_sshr_16_2,
+		&&__tos_default,
+		&&__tos_sshr_8_0,
+		&&__tos_sshr_8_1,
+		&&__tos_sshr_8_2,
+		&&__tos_default,
+		&&__tos_ushr_64_0,
+		&&__tos_ushr_64_1,
+		&&__tos_ushr_64_2,
+		&&__tos_default,
+		&&__tos_ushr_32_0,
+		&&__tos_ushr_32_1,
+		&&__tos_ushr_32_2,
+		&&__tos_default,
+		&&__tos_ushr_16_0,
+		&&__tos_ushr_16_1,
+		&&__tos_ushr_16_2,
+		&&__tos_default,
+		&&__tos_ushr_8_0,
+		&&__tos_ushr_8_1,
+		&&__tos_ushr_8_2,
+		&&__tos_default,
+		&&__tos_fneg_64_0,
+		&&__tos_fneg_64_1,
+		&&__tos_fneg_64_2,
+		&&__tos_default,
+		&&__tos_fneg_32_0,
+		&&__tos_fneg_32_1,
+		&&__tos_fneg_32_2,
+		&&__tos_default,
+		&&__tos_fevl_64_0,
+		&&__tos_fevl_64_1,
+		&&__tos_fevl_64_2,
+		&&__tos_default,
+		&&__tos_fevl_32_0,
+		&&__tos_fevl_32_1,
+		&&__tos_fevl_32_2,
+		&&__tos_default,
+		&&__tos_fadd_64_0,
+		&&__tos_fadd_64_1,
+		&&__tos_fadd_64_2,
+		&&__tos_default,
+		&&__tos_fadd_32_0,
+		&&__tos_fadd_32_1,
+		&&__tos_fadd_32_2,
+		&&__tos_default,
+		&&__tos_fsub_64_0,
+		&&__tos_fsub_64_1,
+		&&__tos_fsub_64_2,
+		&&__tos_default,
+		&&__tos_fsub_32_0,
+		&&__tos_fsub_32_1,
+		&&__tos_fsub_32_2,
+		&&__tos_default,
+		&&__tos_fmul_64_0,
+		&&__tos_fmul_64_1,
+		&&__tos_fmul_64_2,
+		&&__tos_default,
+		&&__tos_fmul_32_0,
+		&&__tos_fmul_32_1,
+		&&__tos_fmul_32_2,
+		&&__tos_default,
+		&&__tos_fmod_64_0,
+		&&__tos_fmod_64_1,
+		&&__tos_fmod_64_2,
+		&&__tos_default,
+		&&__tos_fmod_32_0,
+		&&__tos_fmod_32_1,
+		&&__tos_fmod_32_2,
+		&&__tos_default,
+		&&__tos_fdiv_64_0,
+		&&__tos_fdiv_64_1,
+		&&__tos_fdiv_64_2,
+		&&__tos_default,
+		&&__tos_fdiv_32_0,
+		&&__tos_fdiv_32_1,
+		&&__tos_fdiv_32_2,
+		&&__tos_default,
+		&&__tos_fcmp_64_0,
+		&&__tos_fcmp_64_1,
+		&&__tos_fcmp_64_2,
+		&&__tos_default,
+		&&__tos_fcmp_32_0,
+		&&__tos_fcmp_32_1,
+		&&__tos_fcmp_32_2,
+		&&__tos_default,
+		&&__tos_si64_2_f64_0,
+		&&__tos_si64_2_f64_1,
+		&&__tos_si64_2_f64_2,
+		&&__tos_default,
+		&&__tos_si64_2_f32_0,
+		&&__tos_si64_2_f32_1,
+		&&__tos_si64_2_f32_2,
+		&&__tos_default,
+		&&__tos_si32_2_f64_0,
+		&&__tos_si32_2_f64_1,
+		&&__tos_si32_2_f64_2,
+		&&__tos_default,
+		&&__tos_si32_2_f32_0,
+		&&__tos_si32_2_f32_1,
+		&&__tos_si32_2_f32_2,
+		&&__tos_default,
+		&&__tos_ui64_2_f64_0,
+		&&__tos_ui64_2_f64_1,
+		&&__tos_ui64_2_f64_2,
+		&&__tos_default,
+		&&__tos_ui64_2_f32_0,
+		&&__tos_ui64_2_f32_1,
+		&&__tos_ui64_2_f32_2,
+		&&__tos_default,
+		&&__tos_ui32_2_f64_0,
+		&&__tos_ui32_2_f64_1,
+		&&__tos_ui32_2_f64_2,
+		&&__tos_default,
+		&&__tos_ui32_2_f32_0,
+		&&__tos_ui32_2_f32_1,
+		&&__tos_ui32_2_f32_2,
+		&&__tos_default,
+		&&__tos_f64_2_si64_0,
+		&&__tos_f64_2_si64_1,
+		&&__tos_f64_2_si64_2,
+		&&__tos_default,
+		&&__tos_f64_2_si32_0,
+		&&__tos_f64_2_si32_1,
+		&&__tos_f64_2_si32_2,
+		&&__tos_default,
+		&&__tos_f32_2_si64_0,
+		&&__tos_f32_2_si64_1,
+		&&__tos_f32_2_si64_2,
+		&&__tos_default,
+		&&__tos_f32_2_si32_0,
+		&&__tos_f32_2_si32_1,
+		&&__tos_f32_2_si32_2,
+		&&__tos_default,
+		&&__tos_f64_2_ui64_0,
+		&&__tos_f64_2_ui64_1,
+		&&__tos_f64_2_ui64_2,
+		&&__tos_default,
+		&&__tos_f64_2_ui32_0,
+		&&__tos_f64_2_ui32_1,
+		&&__tos_f64_2_ui32_2,
+		&&__tos_default,
+		&&__tos_f32_2_ui64_0,
+		&&__tos_f32_2_ui64_1,
+		&&__tos_f32_2_ui64_2,
+		&&__tos_default,
+		&&__tos_f32_2_ui32_0,
+		&&__tos_f32_2_ui32_1,
+		&&__tos_f32_2_ui32_2,
+		&&__tos_default,
+		&&__tos_s_ucmp_jmp_64_0,
+		&&__tos_s_ucmp_jmp_64_1,
+		&&__tos_s_ucmp_jmp_64_2,
+		&&__tos_default,
+		&&__tos_s_scmp_jmp_64_0,
+		&&__tos_s_scmp_jmp_64_1,
+		&&__tos_s_scmp_jmp_64_2,
+		&&__tos_default,
+		&&__tos_s_uinc_64_0,
+		&&__tos_s_uinc_64_1,
+		&&__tos_s_uinc_64_2,
+		&&__tos_default,
+		&&__tos_s_udec_64_0,
+		&&__tos_s_udec_64_1,
+		&&__tos_s_udec_64_2,
+		&&__tos_default,
+		&&__tos_s_uadd_64_0,
+		&&__tos_s_uadd_64_1,
+		&&__tos_s_uadd_64_2,
+		&&__tos_default,
+		&&__tos_s_move_64_0,
+		&&__tos_s_move_64_1,
+		&&__tos_s_move_64_2,
+		&&__tos_default,
+		&&__tos_gen_0_0,
+		&&__tos_gen_0_1,
+		&&__tos_gen_0_2,
+		&&__tos_default,
+		&&__tos_gen_1_0,
+		&&__tos_gen_1_1,
+		&&__tos_gen_1_2,
+		&&__tos_default,
+		&&__tos_gen_2_0,
+		&&__tos_gen_2_1,
+		&&__tos_gen_2_2,
+		&&__tos_default,
+		&&__tos_gen_3_0,
+		&&__tos_gen_3_1,
+		&&__tos_gen_3_2,
+		&&__tos_default,
+		&&__tos_hostcall_0,
+		&&__tos_hostcall_1,
+		&&__tos_hostcall_2,
+		&&__tos_default,
+		&&__tos_imports_0,
+		&&__tos_imports_1,
+		&&__tos_imports_2,
+		&&__tos_default,
+		&&__tos_importcall_0,
+		&&__tos_importcall_1,
+		&&__tos_importcall_2,
+		&&__tos_default,
+		&&__tos_nativecall_n_0,
+		&&__tos_nativecall_n_1,
+		&&__tos_nativecall_n_2,
+		&&__tos_default,
+		&&__tos_callback_0,
+		&&__tos_callback_1,
+		&&__tos_callback_2,
+		&&__tos_default,
+		&&__tos_default,
+		&&__tos_default,
+		&&__tos_default,
+		&&__tos_default
+	};
+#endif
+
+	while (true)
+	{
+		const op op_code = (op)dil_fetch<val8<>>(opptr).ui;
+
+		switch (((uint64_t)op_code << 2ui64) | cached)
+		{
+		__KEEP(nop):
+			__NEXT;
+
+		__KEEP(exit):
+			return;
+
+		__CASE(l_load_64, 0):
+		{
+			val64<>& v = stack_type::dil_get<val64<>>(ftop, (ptrdiff_t)dil_fetch<val16<>>(opptr).si);
+
+			tos_0 = v.ui;
+			cached = 1ui64;
+			__NEXT;
+		}
+
+		__CASE(l_load_64, 1):
+		{
+			val64<>& v = stack_type::dil_get<val64<>>(ftop, (ptrdiff_t)dil_fetch<val16<>>(opptr).si);
+
+			if ((uintptr_t)&v < stop)
+				stack_type::dil_push<val64<>>(stop, val64<>(tos_0));
+			else
+			{
+				tos_1 = tos_0;
+				cached = 2ui64;
+			}
+
+			tos_0 = v.ui;
+			__NEXT;
+		}
+
+		__CASE(l_load_64, 2):
+		{
+			val64<>& v = stack_type::dil_get<val64<>>(ftop, (ptrdiff_t)dil_fetch<val16<>>(opptr).si);
+
+			stack_type::dil_push<val64<>>(stop, val64<>(tos_1));
+
+			if ((uintptr_t)&v < stop)
+			{
+				stack_type::dil_push<val64<>>(stop, val64<>(tos_0));
+				cached = 1ui64;
+			}
+			else
+				tos_1 = tos_0;
+
+			tos_0 = v.ui;
+			__NEXT;
+		}
+
+		__CASE(l_store_64, 0):
+			tos_0 = stack_type::dil_pop<val64<>>(stop).ui;
+			[[fallthrough]];
+
+		__CASE(l_store_64, 1):
+			stack_type::dil_get<val64<>>(ftop, (ptrdiff_t)dil_fetch<val16<>>(opptr).si).ui = tos_0;
+			cached = 0ui64;
+			__NEXT;
+
+		__CASE(l_store_64, 2):
+		{
+			val64<>& v = stack_type::dil_get<val64<>>(ftop, (ptrdiff_t)dil_fetch<val16<>>(opptr).si);
+			const uint64_t ui = tos_0;
+
+			if ((uintptr_t)&v < stop)
+			{
+				stack_type::dil_push<val64<>>(stop, val64<>(tos_1));
+				cached = 0ui64;
+			}
+			else
+			{
+				tos_0 = tos_1;
+				cached = 1ui64;
+			}
+
+			v.ui = ui;
+			__NEXT;
+		}
+
+		__CASE(s_load_64, 0):
+		{
+			val64<>& v = stack_type::dil_get<val64<>>(ftop, (ptrdiff_t)dil_fetch<val8<>>(opptr).si);
+
+			tos_0 = v.ui;
+			cached = 1ui64;
+			__NEXT;
+		}
+
+		__CASE(s_load_64, 1):
+		{
+			val64<>& v = stack_type::dil_get<val64<>>(ftop, (ptrdiff_t)dil_fetch<val8<>>(opptr).si);
+
+			if ((uintptr_t)&v < stop)
+				stack_type::dil_push<val64<>>(stop, val64<>(tos_0));
+			else
+			{
+				tos_1 = tos_0;
+				cached = 2ui64;
+			}
+
+			tos_0 = v.ui;
+			__NEXT;
+		}
+
+		__CASE(s_load_64, 2):
+		{
+			val64<>& v = stack_type::dil_get<val64<>>(ftop, (ptrdiff_t)dil_fetch<val8<>>(opptr).si);
+
+			stack_type::dil_push<val64<>>(stop, val64<>(tos_1));
+
+			if ((uintptr_t)&v < stop)
+			{
+				stack_type::dil_push<val64<>>(stop, val64<>(tos_0));
+				cached = 1ui64;
+			}
+			else
+				tos_1 = tos_0;
+
+			tos_0 = v.ui;
+			__NEXT;
+		}
+
+		__CASE(s_store_64, 0):
+			tos_0 = stack_type::dil_pop<val64<>>(stop).ui;
+			[[fallthrough]];
+
+		__CASE(s_store_64, 1):
+			stack_type::dil_get<val64<>>(ftop, (ptrdiff_t)dil_fetch<val8<>>(opptr).si).ui = tos_0;
+			cached = 0ui64;
+			__NEXT;
+
+		__CASE(s_store_64, 2):
+		{
+			val64<>& v = stack_type::dil_get<val64<>>(ftop, (ptrdiff_t)dil_fetch<val8<>>(opptr).si);
+			const uint64_t ui = tos_0;
+
+			if ((uintptr_t)&v < stop)
+			{
+				stack_type::dil_push<val64<>>(stop, val64<>(tos_1));
+				cached = 0ui64;
+			}
+			else
+			{
+				tos_0 = tos_1;
+				cached = 1ui64;
+			}
+
+			v.ui = ui;
+			__NEXT;
+		}
+
+		__CASE(push_64, 2):
+			stack_type::dil_push<val64<>>(stop, val64<>(tos_1));
+			--cached;
+			[[fallthrough]];
+
+		__CASE(push_64, 1):
+			tos_1 = tos_0;
+			[[fallthrough]];
+
+		__CASE(push_64, 0):
+			tos_0 = dil_fetch<val64<>>(opptr).ui;
+			++cached;
+			__NEXT;
+
+		__CASE(pop_64, 0):
+			stack_type::dil_rem<val64<>>(stop);
+			__NEXT;
+
+		__CASE(pop_64, 2):
+			tos_0 = tos_1;
+			[[fallthrough]];
+
+		__CASE(pop_64, 1):
+			--cached;
+			__NEXT;
+
+		__CASE(dup_64, 0):
+			tos_0 = stack_type::dil_top<val64<>>(stop).ui;
+			cached = 1ui64;
+			__NEXT;
+
+		__CASE(dup_64, 2):
+			stack_type::dil_push<val64<>>(stop, val64<>(tos_1));
+			[[fallthrough]];
+
+		__CASE(dup_64, 1):
+			tos_1 = tos_0;
+			cached = 2ui64;
+			__NEXT;
+
+	#ifndef OPINTCHECK
+		__CASE(neg_64, 0):
+			tos_0 = stack_type::dil_pop<val64<>>(stop).ui;
+			cached = 1ui64;
+			[[fallthrough]];
+
+		__CASE(neg_64, 1):
+		__CASE(neg_64, 2):
+			tos_0 = (uint64_t)-(int64_t)tos_0;
+			__NEXT;
+	#endif
+
+		__CASE(not_64, 0):
+			tos_0 = stack_type::dil_pop<val64<>>(stop).ui;
+			cached = 1ui64;
+			[[fallthrough]];
+
+		__CASE(not_64, 1):
+		__CASE(not_64, 2):
+			tos_0 = ~tos_0;
+			__NEXT;
+
+	#ifndef OPINTCHECK
+		__CASE(sinc_64, 0):
+			tos_0 = stack_type::dil_pop<val64<>>(stop).ui;
+			cached = 1ui64;
+			[[fallthrough]];
+
+		__CASE(sinc_64, 1):
+		__CASE(sinc_64, 2):
+			tos_0 = tos_0 + 1ui64;
+			__NEXT;
+	#endif
+
+	#ifndef OPINTCHECK
+		__CASE(uinc_64, 0):
+			tos_0 = stack_type::dil_pop<val64<>>(stop).ui;
+			cached = 1ui64;
+			[[fallthrough]];
+
+		__CASE(uinc_64, 1):
+		__CASE(uinc_64, 2):
+			tos_0 = tos_0 + 1ui64;
+			__NEXT;
+	#endif
+
+	#ifndef OPINTCHECK
+		__CASE(sdec_64, 0):
+			tos_0 = stack_type::dil_pop<val64<>>(stop).ui;
+			cached = 1ui64;
+			[[fallthrough]];
+
+		__CASE(sdec_64, 1):
+		__CASE(sdec_64, 2):
+			tos_0 = tos_0 - 1ui64;
+			__NEXT;
+	#endif
+
+	#ifndef OPINTCHECK
+		__CASE(udec_64, 0):
+			tos_0 = stack_type::dil_pop<val64<>>(stop).ui;
+			cached = 1ui64;
+			[[fallthrough]];
+
+		__CASE(udec_64, 1):
+		__CASE(udec_64, 2):
+			tos_0 = tos_0 - 1ui64;
+			__NEXT;
+	#endif
+
+		__CASE(and_64, 0):
+			tos_0 = stack_type::dil_pop<val64<>>(stop).ui;
+			[[fallthrough]];
+
+		__CASE(and_64, 1):
+			tos_1 = stack_type::dil_pop<val64<>>(stop).ui;
+			[[fallthrough]];
+
+		__CASE(and_64, 2):
+			tos_0 = tos_1 & tos_0;
+			cached = 1ui64;
+			__NEXT;
+
+		__CASE(or_64, 0):
+			tos_0 = stack_type::dil_pop<val64<>>(stop).ui;
+			[[fallthrough]];
+
+		__CASE(or_64, 1):
+			tos_1 = stack_type::dil_pop<val64<>>(stop).ui;
+			[[fallthrough]];
+
+		__CASE(or_64, 2):
+			tos_0 = tos_1 | tos_0;
+			cached = 1ui64;
+			__NEXT;
+
+		__CASE(xor_64, 0):
+			tos_0 = stack_type::dil_pop<val64<>>(stop).ui;
+			[[fallthrough]];
+
+		__CASE(xor_64, 1):
+			tos_1 = stack_type::dil_pop<val64<>>(stop).ui;
+			[[fallthrough]];
+
+		__CASE(xor_64, 2):
+			tos_0 = tos_1 ^ tos_0;
+			cached = 1ui64;
+			__NEXT;
+
+	#ifndef OPINTCHECK
+		__CASE(sadd_64, 0):
+			tos_0 = stack_type::dil_pop<val64<>>(stop).ui;
+			[[fallthrough]];
+
+		__CASE(sadd_64, 1):
+			tos_1 = stack_type::dil_pop<val64<>>(stop).ui;
+			[[fallthrough]];
+
+		__CASE(sadd_64, 2):
+			tos_0 = tos_1 + tos_0;
+			cached = 1ui64;
+			__NEXT;
+	#endif
+
+	#ifndef OPINTCHECK
+		__CASE(uadd_64, 0):
+			tos_0 = stack_type::dil_pop<val64<>>(stop).ui;
+			[[fallthrough]];
+
+		__CASE(uadd_64, 1):
+			tos_1 = stack_type::dil_pop<val64<>>(stop).ui;
+			[[fallthrough]];
+
+		__CASE(uadd_64, 2):
+			tos_0 = tos_1 + tos_0;
+			cached = 1ui64;
+			__NEXT;
+	#endif
+
+	#ifndef OPINTCHECK
+		__CASE(ssub_64, 0):
+			tos_0 = stack_type::dil_pop<val64<>>(stop).ui;
+			[[fallthrough]];
+
+		__CASE(ssub_64, 1):
+			tos_1 = stack_type::dil_pop<val64<>>(stop).ui;
+			[[fallthrough]];
+
+		__CASE(ssub_64, 2):
+			tos_0 = tos_1 - tos_0;
+			cached = 1ui64;
+			__NEXT;
+	#endif
+
+	#ifndef OPINTCHECK
+		__CASE(usub_64, 0):
+			tos_0 = stack_type::dil_pop<val64<>>(stop).ui;
+			[[fallthrough]];
+
+		__CASE(usub_64, 1):
+			tos_1 = stack_type::dil_pop<val64<>>(stop).ui;
+			[[fallthrough]];
+
+		__CASE(usub_64, 2):
+			tos_0 = tos_1 - tos_0;
+			cached = 1ui64;
+			__NEXT;
+	#endif
+
+	#ifndef OPINTCHECK
+		__CASE(smul_64, 0):
+			tos_0 = stack_type::dil_pop<val64<>>(stop).ui;
+			[[fallthrough]];
+
+		__CASE(smul_64, 1):
+			tos_1 = stack_type::dil_pop<val64<>>(stop).ui;
+			[[fallthrough]];
+
+		__CASE(smul_64, 2):
+			tos_0 = tos_1 * tos_0;
+			cached = 1ui64;
+			__NEXT;
+	#endif
+
+	#ifndef OPINTCHECK
+		__CASE(umul_64, 0):
+			tos_0 = stack_type::dil_pop<val64<>>(stop).ui;
+			[[fallthrough]];
+
+		__CASE(umul_64, 1):
+			tos_1 = stack_type::dil_pop<val64<>>(stop).ui;
+			[[fallthrough]];
+
+		__CASE(umul_64, 2):
+			tos_0 = tos_1 * tos_0;
+			cached = 1ui64;
+			__NEXT;
+	#endif
+
+		__CASE(scmp_64, 0):
+			tos_0 = stack_type::dil_pop<val64<>>(stop).ui;
+			[[fallthrough]];
+
+		__CASE(scmp_64, 1):
+			tos_1 = stack_type::dil_pop<val64<>>(stop).ui;
+			[[fallthrough]];
+
+		__CASE(scmp_64, 2):
+			state.comp.bits.above = (int64_t)tos_0 > (int64_t)tos_1;
+			state.comp.bits.below = (int64_t)tos_0 < (int64_t)tos_1;
+			cached = 0ui64;
+			__NEXT;
+
+		__CASE(ucmp_64, 0):
+			tos_0 = stack_type::dil_pop<val64<>>(stop).ui;
+			[[fallthrough]];
+
+		__CASE(ucmp_64, 1):
+			tos_1 = stack_type::dil_pop<val64<>>(stop).ui;
+			[[fallthrough]];
+
+		__CASE(ucmp_64, 2):
+			state.comp.bits.above = tos_0 > tos_1;
+			state.comp.bits.below = tos_0 < tos_1;
+			cached = 0ui64;
+			__NEXT;
+
+		__CASE(s_ucmp_jmp_64, 2):
+		__CASE(s_ucmp_jmp_64, 1):
+			if (__ALIASED(0))
+			{
+				if (cached == 2ui64)
+					stack_type::dil_push<val64<>>(stop, val64<>(tos_1));
+
+				stack_type::dil_push<val64<>>(stop, val64<>(tos_0));
+				cached = 0ui64;
+			}
+
+			[[fallthrough]];
+
+		__CASE(s_ucmp_jmp_64, 0):
+			__dil_s_ucmp_jmp<val64<>>(opptr, ftop, state);
+			__NEXT;
+
+		__CASE(s_scmp_jmp_64, 2):
+		__CASE(s_scmp_jmp_64, 1):
+			if (__ALIASED(0))
+			{
+				if (cached == 2ui64)
+					stack_type::dil_push<val64<>>(stop, val64<>(tos_1));
+
+				stack_type::dil_push<val64<>>(stop, val64<>(tos_0));
+				cached = 0ui64;
+			}
+
+			[[fallthrough]];
+
+		__CASE(s_scmp_jmp_64, 0):
+			__dil_s_scmp_jmp<val64<>>(opptr, ftop, state);
+			__NEXT;
+
+		__CASE(s_uinc_64, 2):
+		__CASE(s_uinc_64, 1):
+			if (__ALIASED(0))
+			{
+				if (cached == 2ui64)
+					stack_type::dil_push<val64<>>(stop, val64<>(tos_1));
+
+				stack_type::dil_push<val64<>>(stop, val64<>(tos_0));
+				cached = 0ui64;
+			}
+
+			[[fallthrough]];
+
+		__CASE(s_uinc_64, 0):
+			__dil_s_uinc<val64<>>(opptr, ftop, state);
+			__NEXT;
+
+		__CASE(s_udec_64, 2):
+		__CASE(s_udec_64, 1):
+			if (__ALIASED(0))
+			{
+				if (cached == 2ui64)
+					stack_type::dil_push<val64<>>(stop, val64<>(tos_1));
+
+				stack_type::dil_push<val64<>>(stop, val64<>(tos_0));
+				cached = 0ui64;
+			}
+
+			[[fallthrough]];
+
+		__CASE(s_udec_64, 0):
+			__dil_s_udec<val64<>>(opptr, ftop, state);
+			__NEXT;
+
+	#ifndef OPINTCHECK
+		__CASE(s_uadd_64, 0):
+		{
+			val64<>& v_1 = stack_type::dil_get<val64<>>(ftop, (ptrdiff_t)dil_fetch<val8<>>(opptr).si);
+			opptr += (ptrdiff_t)sizeof(op);
+			val64<>& v_2 = stack_type::dil_get<val64<>>(ftop, (ptrdiff_t)dil_fetch<val8<>>(opptr).si);
+			opptr += (ptrdiff_t)sizeof(op);
+
+			tos_0 = v_1.ui + v_2.ui;
+			cached = 1ui64;
+			__NEXT;
+		}
+
+		__CASE(s_uadd_64, 1):
+		{
+			val64<>& v_1 = stack_type::dil_get<val64<>>(ftop, (ptrdiff_t)dil_fetch<val8<>>(opptr).si);
+			opptr += (ptrdiff_t)sizeof(op);
+			val64<>& v_2 = stack_type::dil_get<val64<>>(ftop, (ptrdiff_t)dil_fetch<val8<>>(opptr).si);
+			opptr += (ptrdiff_t)sizeof(op);
+
+			if ((uintptr_t)&v_1 < stop || (uintptr_t)&v_2 < stop)
+				stack_type::dil_push<val64<>>(stop, val64<>(tos_0));
+			else
+			{
+				tos_1 = tos_0;
+				cached = 2ui64;
+			}
+
+			tos_0 = v_1.ui + v_2.ui;
+			__NEXT;
+		}
+
+		__CASE(s_uadd_64, 2):
+		{
+			val64<>& v_1 = stack_type::dil_get<val64<>>(ftop, (ptrdiff_t)dil_fetch<val8<>>(opptr).si);
+			opptr += (ptrdiff_t)sizeof(op);
+			val64<>& v_2 = stack_type::dil_get<val64<>>(ftop, (ptrdiff_t)dil_fetch<val8<>>(opptr).si);
+			opptr += (ptrdiff_t)sizeof(op);
+
+			stack_type::dil_push<val64<>>(stop, val64<>(tos_1));
+
+			if ((uintptr_t)&v_1 < stop || (uintptr_t)&v_2 < stop)
+			{
+				stack_type::dil_push<val64<>>(stop, val64<>(tos_0));
+				cached = 1ui64;
+			}
+			else
+				tos_1 = tos_0;
+
+			tos_0 = v_1.ui + v_2.ui;
+			__NEXT;
+		}
+	#endif
+
+		__CASE(s_move_64, 2):
+		__CASE(s_move_64, 1):
+			if (__ALIASED(0) || __ALIASED(2))
+			{
+				if (cached == 2ui64)
+					stack_type::dil_push<val64<>>(stop, val64<>(tos_1));
+
+				stack_type::dil_push<val64<>>(stop, val64<>(tos_0));
+				cached = 0ui64;
+			}
+
+			[[fallthrough]];
+
+		__CASE(s_move_64, 0):
+			__dil_s_move<val64<>>(opptr, ftop);
+			__NEXT;
+
+	#include "dispatcher_op_code.hpp"
+	#include "dispatcher_op_stack.hpp"
+
+	#ifdef GNUCTHREAD
+		__tos_default:
+	#endif
+		default:
+		#ifdef OPRNDCHECK
+			throw runtime_error(_err_msg_wrong_opnd);
+		#else
+			__assume(false);
+		#endif
+			__NEXT;
+		}
+	}
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,782 @@
+#include "dispatcher.hpp"
+
+using namespace interpreter;
+using namespace std;
+
+#ifdef DEEPINLINE
+#define __2_POW_64 18446744073709551616.0
+#define __2_POW_63 9223372036854775808.0
+#define __2_POW_32 4294967296.0
+#define __2_POW_31 2147483648.0
+#define __0 0.0
+
+// Handlers run over decoded_op records instead of the byte stream: operands are already
+// decoded and aligned, branch targets are record indices and size variants of the same
+// handler share one op; code pointers only appear on the stack (call, ret, *_flow);
+// ops that only work on the stack run the handlers every other loop includes
+
+#ifdef GNUCTHREAD
+#define __CASE(name) __op_##name
+#define __NEXT goto *__label[(uint8_t)rec->code]
+#else
+#define __CASE(name) case op::name
+#define __NEXT continue
+#endif
+
+#define __OP(name) __CASE(name)
+#define __OP_NEXT ++rec; __NEXT
+
+void dispatcher::__loop_decode()
+{
+	using P = default_policy;
+
+	uintptr_t ftop = _stack.get_ftop();
+	uintptr_t stop = _stack.get_stop();
+
+	const decoded_op* ops = _decoded.get_ops();
+	const decoded_op* rec = _decoded.get_op(_opptr);
+	state state = _state;
+
+#ifdef GNUCTHREAD
+	static const void* const __label[256ui64] =
+	{
+		&&__op_nop,
+		&&__op_exit,
+		&&__op_nativecall,
+		&&__op_ret,
+		&&__op_default,
+		&&__op_default,
+		&&__op_default,
+		&&__op_call_8,
+		&&__op_memcpy,
+		&&__op_memset,
+		&&__op_default,
+		&&__op_s_alloc,
+		&&__op_default,
+		&&__op_s_allocz,
+		&&__op_default,
+		&&__op_s_dealloc,
+		&&__op_push_flow,
+		&&__op_push_frame,
+		&&__op_push_stack,
+		&&__op_push_state,
+		&&__op_pop_flow,
+		&&__op_pop_frame,
+		&&__op_pop_stack,
+		&&__op_pop_state,
+		&&__op_default,
+		&&__op_default,
+		&&__op_default,
+		&&__op_jmp_8,
+		&&__op_default,
+		&&__op_default,
+		&&__op_default,
+		&&__op_jmp_a_8,
+		&&__op_default,
+		&&__op_default,
+		&&__op_default,
+		&&__op_jmp_ae_8,
+		&&__op_default,
+		&&__op_default,
+		&&__op_default,
+		&&__op_jmp_b_8,
+		&&__op_default,
+		&&__op_default,
+		&&__op_default,
+		&&__op_jmp_be_8,
+		&&__op_default,
+		&&__op_default,
+		&&__op_default,
+		&&__op_jmp_e_8,
+		&&__op_default,
+		&&__op_default,
+		&&__op_default,
+		&&__op_jmp_ne_8,
+		&&__op_default,
+		&&__op_default,
+		&&__op_default,
+		&&__op_jmp_un_8,
+		&&__op_jmp_msk_64,
+		&&__op_jmp_msk_32,
+		&&__op_jmp_msk_16,
+		&&__op_jmp_msk_8,
+		&&__op_default,
+		&&__op_default,
+		&&__op_default,
+		&&__op_default,
+		&&__op_default,
+		&&__op_default,
+		&&__op_default,
+		&&__op_default,
+		&&__op_s_load_64,
+		&&__op_s_load_32,
+		&&__op_s_load_16,
+		&&__op_s_load_8,
+		&&__op_s_store_64,
+		&&__op_s_store_32,
+		&&__op_s_store_16,
+		&&__op_s_store_8,
+		&&__op_push_64,
+		&&__op_push_32,
+		&&__op_push_16,
+		&&__op_push_8,
+		&&__op_pop_64,
+		&&__op_pop_32,
+		&&__op_pop_16,
+		&&__op_pop_8,
+		&&__op_dup_64,
+		&&__op_dup_32,
+		&&__op_dup_16,
+		&&__op_dup_8,
+		&&__op_ptrcpy_64,
+		&&__op_ptrcpy_32,
+		&&__op_ptrcpy_16,
+		&&__op_ptrcpy_8,
+		&&__op_ptrget_64,
+		&&__op_ptrget_32,
+		&&__op_ptrget_16,
+		&&__op_ptrget_8,
+		&&__op_ptrset_64,
+		&&__op_ptrset_32,
+		&&__op_ptrset_16,
+		&&__op_ptrset_8,
+		&&__op_neg_64,
+		&&__op_neg_32,
+		&&__op_neg_16,
+		&&__op_neg_8,
+		&&__op_not_64,
+		&&__op_not_32,
+		&&__op_not_16,
+		&&__op_not_8,
+		&&__op_sinc_64,
+		&&__op_sinc_32,
+		&&__op_sinc_16,
+		&&__op_sinc_8,
+		&&__op_uinc_64,
+		&&__op_uinc_32,
+		&&__op_uinc_16,
+		&&__op_uinc_8,
+		&&__op_sdec_64,
+		&&__op_sdec_32,
+		&&__op_sdec_16,
+		&&__op_sdec_8,
+		&&__op_udec_64,
+		&&__op_udec_32,
+		&&__op_udec_16,
+		&&__op_udec_8,
+		&&__op_and_64,
+		&&__op_and_32,
+		&&__op_and_16,
+		&&__op_and_8,
+		&&__op_or_64,
+		&&__op_or_32,
+		&&__op_or_16,
+		&&__op_or_8,
+		&&__op_xor_64,
+		&&__op_xor_32,
+		&&__op_xor_16,
+		&&__op_xor_8,
+		&&__op_sadd_64,
+		&&__op_sadd_32,
+		&&__op_sadd_16,
+		&&__op_sadd_8,
+		&&__op_uadd_64,
+		&&__op_uadd_32,
+		&&__op_uadd_16,
+		&&__op_uadd_8,
+		&&__op_ssub_64,
+		&&__op_ssub_32,
+		&&__op_ssub_16,
+		&&__op_ssub_8,
+		&&__op_usub_64,
+		&&__op_usub_32,
+		&&__op_usub_16,
+		&&__op_usub_8,
+		&&__op_smul_64,
+		&&__op_smul_32,
+		&&__op_smul_16,
+		&&__op_smul_8,
+		&&__op_umul_64,
+		&&__op_umul_32,
+		&&__op_umul_16,
+		&&__op_umul_8,
+		&&__op_smod_64,
+		&&__op_smod_32,
+		&&__op_smod_16,
+		&&__op_smod_8,
+		&&__op_umod_64,
+		&&__op_umod_32,
+		&&__op_umod_16,
+		&&__op_umod_8,
+		&&__op_sdiv_64,
+		&&__op_sdiv_32,
+		&&__op_sdiv_16,
+		&&__op_sdiv_8,
+		&&__op_udiv_64,
+		&&__op_udiv_32,
+		&&__op_udiv_16,
+		&&__op_udiv_8,
+		&&__op_scmp_64,
+		&&__op_scmp_32,
+		&&__op_scmp_16,
+		&&__op_scmp_8,
+		&&__op_ucmp_64,
+		&&__op_ucmp_32,
+		&&__op_ucmp_16,
+		&&__op_ucmp_8,
+		&&__op_rotl_64,
+		&&__op_rotl_32,
+		&&__op_rotl_16,
+		&&__op_rotl_8,
+		&&__op_rotr_64,
+		&&__op_rotr_32,
+		&&__op_rotr_16,
+		&&__op_rotr_8,
+		&&__op_sshl_64,
+		&&__op_sshl_32,
+		&&__op_sshl_16,
+		&&__op_sshl_8,
+		&&__op_ushl_64,
+		&&__op_ushl_32,
+		&&__op_ushl_16,
+		&&__op_ushl_8,
+		&&__op_sshr_64,
+		&&__op_sshr_32,
+		&&__op_sshr_16,
+		&&__op_sshr_8,
+		&&__op_ushr_64,
+		&&__op_ushr_32,
+		&&__op_ushr_16,
+		&&__op_ushr_8,
+		&&__op_fneg_64,
+		&&__op_fneg_32,
+		&&__op_fevl_64,
+		&&__op_fevl_32,
+		&&__op_fadd_64,
+		&&__op_fadd_32,
+		&&__op_fsub_64,
+		&&__op_fsub_32,
+		&&__op_fmul_64,
+		&&__op_fmul_32,
+		&&__op_fmod_64,
+		&&__op_fmod_32,
+		&&__op_fdiv_64,
+		&&__op_fdiv_32,
+		&&__op_fcmp_64,
+		&&__op_fcmp_32,
+		&&__op_si64_2_f64,
+		&&__op_si64_2_f32,
+		&&__op_si32_2_f64,
+		&&__op_si32_2_f32,
+		&&__op_ui64_2_f64,
+		&&__op_ui64_2_f32,
+		&&__op_ui32_2_f64,
+		&&__op_ui32_2_f32,
+		&&__op_f64_2_si64,
+		&&__op_f64_2_si32,
+		&&__op_f32_2_si64,
+		&&__op_f32_2_si32,
+		&&__op_f64_2_ui64,
+		&&__op_f64_2_ui32,
+		&&__op_f32_2_ui64,
+		&&__op_f32_2_ui32,
+		&&__op_s_ucmp_jmp_64,
+		&&__op_s_scmp_jmp_64,
+		&&__op_s_uinc_64,
+		&&__op_s_udec_64,
+		&&__op_s_uadd_64,
+		&&__op_s_move_64,
+		&&__op_gen_0,
+		&&__op_gen_1,
+		&&__op_gen_2,
+		&&__op_gen_3,
+		&&__op_hostcall,
+		&&__op_imports,
+		&&__op_importcall,
+		&&__op_nativecall_n,
+		&&__op_callback,
+		&&__op_default
+	};
+
+	__NEXT;
+#else
+	while (true)
+	switch (rec->code)
+	{
+#endif
+
+__CASE(nop):
+	++rec;
+	__NEXT;
+
+__CASE(exit):
+	return;
+
+__CASE(nativecall):
+	{
+		__dil_native(stop);
+
+		uintptr_t stop_temp = stop;
+		const uint8_t* opptr_temp = (const uint8_t*)rec->operand;
+
+		_nativehub.call(opptr_temp, stop_temp);
+		__dil_thrown();
+
+		stop = stop_temp;
+		++rec;
+
+		__NEXT;
+	}
+
+__CASE(nativecall_n):
+	{
+		__dil_native(stop);
+
+		uintptr_t stop_temp = stop;
+		const uint8_t* opptr_temp = (const uint8_t*)rec->operand;
+
+		_nativehub.call_n(opptr_temp, stop_temp);
+		__dil_thrown();
+
+		stop = stop_temp;
+		++rec;
+
+		__NEXT;
+	}
+
+__CASE(ret):
+	{
+		rec = _decoded.get_op((const uint8_t*)stack_type::dil_pop_frame(ftop, stop));
+
+		__NEXT;
+	}
+
+__CASE(call_8):
+	{
+		stack_type::dil_push_frame(ftop, stop, (uintptr_t)rec->operand);
+		rec = ops + (ptrdiff_t)rec->target;
+
+		__NEXT;
+	}
+
+__CASE(s_alloc):
+	{
+		stack_type::dil_alloc(stop, rec->operand);
+		++rec;
+
+		__NEXT;
+	}
+
+__CASE(s_allocz):
+	{
+		stack_type::dil_allocz(stop, rec->operand);
+		++rec;
+
+		__NEXT;
+	}
+
+__CASE(s_dealloc):
+	{
+		stack_type::dil_dealloc(stop, rec->operand);
+		++rec;
+
+		__NEXT;
+	}
+
+__CASE(push_flow):
+	{
+		stack_type::dil_push_ptr(stop, (uintptr_t)rec->operand);
+		++rec;
+
+		__NEXT;
+	}
+
+__CASE(pop_flow):
+	{
+		rec = _decoded.get_op((const uint8_t*)stack_type::dil_pop_ptr(stop));
+
+		__NEXT;
+	}
+
+__CASE(jmp_8):
+	{
+		rec = ops + (ptrdiff_t)rec->target;
+
+		__NEXT;
+	}
+
+__CASE(jmp_a_8):
+	{
+		rec = state.comp.bits.above && !state.comp.bits.below ? ops + (ptrdiff_t)rec->target : rec + (ptrdiff_t)1;
+
+		__NEXT;
+	}
+
+__CASE(jmp_ae_8):
+	{
+		rec = !state.comp.bits.below ? ops + (ptrdiff_t)rec->target : rec + (ptrdiff_t)1;
+
+		__NEXT;
+	}
+
+__CASE(jmp_b_8):
+	{
+		rec = !state.comp.bits.above && state.comp.bits.below ? ops + (ptrdiff_t)rec->target : rec + (ptrdiff_t)1;
+
+		__NEXT;
+	}
+
+__CASE(jmp_be_8):
+	{
+		rec = !state.comp.bits.above ? ops + (ptrdiff_t)rec->target : rec + (ptrdiff_t)1;
+
+		__NEXT;
+	}
+
+__CASE(jmp_e_8):
+	{
+		rec = !state.comp.bits.above && !state.comp.bits.below ? ops + (ptrdiff_t)rec->target : rec + (ptrdiff_t)1;
+
+		__NEXT;
+	}
+
+__CASE(jmp_ne_8):
+	{
+		rec = (bool)(state.comp.bits.above ^ state.comp.bits.below) ? ops + (ptrdiff_t)rec->target : rec + (ptrdiff_t)1;
+
+		__NEXT;
+	}
+
+__CASE(jmp_un_8):
+	{
+		rec = state.comp.bits.above && state.comp.bits.below ? ops + (ptrdiff_t)rec->target : rec + (ptrdiff_t)1;
+
+		__NEXT;
+	}
+
+__CASE(jmp_msk_64):
+	{
+		rec = match<val64<>>::check(state, dil_operand<val64<>>(*rec), rec->mask_type) ?
+			ops + (ptrdiff_t)rec->target : rec + (ptrdiff_t)1;
+
+		__NEXT;
+	}
+
+__CASE(jmp_msk_32):
+	{
+		rec = match<val32<>>::check(state, dil_operand<val32<>>(*rec), rec->mask_type) ?
+			ops + (ptrdiff_t)rec->target : rec + (ptrdiff_t)1;
+
+		__NEXT;
+	}
+
+__CASE(jmp_msk_16):
+	{
+		rec = match<val16<>>::check(state, dil_operand<val16<>>(*rec), rec->mask_type) ?
+			ops + (ptrdiff_t)rec->target : rec + (ptrdiff_t)1;
+
+		__NEXT;
+	}
+
+__CASE(jmp_msk_8):
+	{
+		rec = match<val8<>>::check(state, dil_operand<val8<>>(*rec), rec->mask_type) ?
+			ops + (ptrdiff_t)rec->target : rec + (ptrdiff_t)1;
+
+		__NEXT;
+	}
+
+__CASE(s_load_64):
+	{
+		stack_type::dil_load<val64<>>(ftop, stop, (ptrdiff_t)rec->operand);
+		++rec;
+
+		__NEXT;
+	}
+
+__CASE(s_load_32):
+	{
+		stack_type::dil_load<val32<>>(ftop, stop, (ptrdiff_t)rec->operand);
+		++rec;
+
+		__NEXT;
+	}
+
+__CASE(s_load_16):
+	{
+		stack_type::dil_load<val16<>>(ftop, stop, (ptrdiff_t)rec->operand);
+		++rec;
+
+		__NEXT;
+	}
+
+__CASE(s_load_8):
+	{
+		stack_type::dil_load<val8<>>(ftop, stop, (ptrdiff_t)rec->operand);
+		++rec;
+
+		__NEXT;
+	}
+
+__CASE(s_store_64):
+	{
+		stack_type::dil_store<val64<>>(ftop, stop, (ptrdiff_t)rec->operand);
+		++rec;
+
+		__NEXT;
+	}
+
+__CASE(s_store_32):
+	{
+		stack_type::dil_store<val32<>>(ftop, stop, (ptrdiff_t)rec->operand);
+		++rec;
+
+		__NEXT;
+	}
+
+__CASE(s_store_16):
+	{
+		stack_type::dil_store<val16<>>(ftop, stop, (ptrdiff_t)rec->operand);
+		++rec;
+
+		__NEXT;
+	}
+
+__CASE(s_store_8):
+	{
+		stack_type::dil_store<val8<>>(ftop, stop, (ptrdiff_t)rec->operand);
+		++rec;
+
+		__NEXT;
+	}
+
+__CASE(push_64):
+	{
+		stack_type::dil_push<val64<>>(stop, dil_operand<val64<>>(*rec));
+		++rec;
+
+		__NEXT;
+	}
+
+__CASE(push_32):
+	{
+		stack_type::dil_push<val32<>>(stop, dil_operand<val32<>>(*rec));
+		++rec;
+
+		__NEXT;
+	}
+
+__CASE(push_16):
+	{
+		stack_type::dil_push<val16<>>(stop, dil_operand<val16<>>(*rec));
+		++rec;
+
+		__NEXT;
+	}
+
+__CASE(push_8):
+	{
+		stack_type::dil_push<val8<>>(stop, dil_operand<val8<>>(*rec));
+		++rec;
+
+		__NEXT;
+	}
+
+__CASE(s_ucmp_jmp_64):
+	{
+		const uint64_t ui_2 = stack_type::dil_get<val64<>>(ftop, (ptrdiff_t)rec->operand).ui;
+		const uint64_t ui_1 = dil_operand<val64<>>(rec[1]).ui;
+
+		state.comp.bits.above = ui_1 > ui_2;
+		state.comp.bits.below = ui_1 < ui_2;
+
+		rec = __dil_jcc(rec[3].code, state) ? ops + (ptrdiff_t)rec[3].target : rec + (ptrdiff_t)4;
+
+		__NEXT;
+	}
+
+__CASE(s_scmp_jmp_64):
+	{
+		const int64_t si_2 = stack_type::dil_get<val64<>>(ftop, (ptrdiff_t)rec->operand).si;
+		const int64_t si_1 = dil_operand<val64<>>(rec[1]).si;
+
+		state.comp.bits.above = si_1 > si_2;
+		state.comp.bits.below = si_1 < si_2;
+
+		rec = __dil_jcc(rec[3].code, state) ? ops + (ptrdiff_t)rec[3].target : rec + (ptrdiff_t)4;
+
+		__NEXT;
+	}
+
+__CASE(s_uinc_64):
+	{
+		val64<>& v = stack_type::dil_get<val64<>>(ftop, (ptrdiff_t)rec->operand);
+
+		if constexpr (default_policy::opint_check)
+		{
+			state.eval.bits.iovf = v.ui == numeric_limits<uint64_t>::max();
+			state.eval.bits.iunf = false;
+		}
+
+		++v.ui;
+		rec += (ptrdiff_t)3;
+
+		__NEXT;
+	}
+
+__CASE(s_udec_64):
+	{
+		val64<>& v = stack_type::dil_get<val64<>>(ftop, (ptrdiff_t)rec->operand);
+
+		if constexpr (default_policy::opint_check)
+		{
+			state.eval.bits.iovf = false;
+			state.eval.bits.iunf = v.ui == numeric_limits<uint64_t>::min();
+		}
+
+		--v.ui;
+		rec += (ptrdiff_t)3;
+
+		__NEXT;
+	}
+
+__CASE(s_uadd_64):
+	{
+		const uint64_t ui_1 = stack_type::dil_get<val64<>>(ftop, (ptrdiff_t)rec->operand).ui;
+		const uint64_t ui_2 = stack_type::dil_get<val64<>>(ftop, (ptrdiff_t)rec[1].operand).ui;
+
+		if constexpr (default_policy::opint_check)
+		{
+			state.eval.bits.iovf = ui_1 > numeric_limits<uint64_t>::max() - ui_2;
+			state.eval.bits.iunf = false;
+		}
+
+		stack_type::dil_push<val64<>>(stop, val64<>(ui_1 + ui_2));
+		rec += (ptrdiff_t)3;
+
+		__NEXT;
+	}
+
+__CASE(s_move_64):
+	{
+		stack_type::dil_get<val64<>>(ftop, (ptrdiff_t)rec[1].operand) = stack_type::dil_get<val64<>>(ftop, (ptrdiff_t)rec->operand);
+		rec += (ptrdiff_t)2;
+
+		__NEXT;
+	}
+
+__CASE(gen_0):
+	{
+		const uint8_t* opptr = _decoded.get_code_beg() + (ptrdiff_t)rec->target;
+
+		__dil_gen<0ui64>(opptr, ftop, stop, state);
+		rec = _decoded.get_op(opptr);
+
+		__NEXT;
+	}
+
+__CASE(gen_1):
+	{
+		const uint8_t* opptr = _decoded.get_code_beg() + (ptrdiff_t)rec->target;
+
+		__dil_gen<1ui64>(opptr, ftop, stop, state);
+		rec = _decoded.get_op(opptr);
+
+		__NEXT;
+	}
+
+__CASE(gen_2):
+	{
+		const uint8_t* opptr = _decoded.get_code_beg() + (ptrdiff_t)rec->target;
+
+		__dil_gen<2ui64>(opptr, ftop, stop, state);
+		rec = _decoded.get_op(opptr);
+
+		__NEXT;
+	}
+
+__CASE(gen_3):
+	{
+		const uint8_t* opptr = _decoded.get_code_beg() + (ptrdiff_t)rec->target;
+
+		__dil_gen<3ui64>(opptr, ftop, stop, state);
+		rec = _decoded.get_op(opptr);
+
+		__NEXT;
+	}
+
+__CASE(hostcall):
+	{
+		__dil_native(stop);
+
+		uintptr_t stop_temp = stop;
+		const uint8_t* opptr_temp = (const uint8_t*)rec->operand;
+
+		if (_check_type == check_type::checked)
+			_nativehub.host(opptr_temp, stop_temp, _code_beg, _code_end);
+		else
+			_nativehub.host(opptr_temp, stop_temp);
+
+		__dil_thrown();
+
+		stop = stop_temp;
+		++rec;
+
+		__NEXT;
+	}
+
+__CASE(imports):
+	++rec;
+	__NEXT;
+
+__CASE(importcall):
+	{
+		__dil_native(stop);
+
+		uintptr_t stop_temp = stop;
+		const uint8_t* opptr_temp = (const uint8_t*)rec->operand;
+
+		if (_check_type == check_type::checked)
+			_nativehub.call_import(opptr_temp, stop_temp, _code_beg, _code_end);
+		else
+			_nativehub.call_import(opptr_temp, stop_temp);
+
+		__dil_thrown();
+
+		stop = stop_temp;
+		++rec;
+
+		__NEXT;
+	}
+
+__CASE(callback):
+	{
+		const uint8_t* opptr_temp = (const uint8_t*)rec->operand;
+
+		if (_check_type == check_type::checked)
+			stack_type::dil_push_ptr(stop, _nativehub.callback(opptr_temp, _code_beg, _code_end));
+		else
+			stack_type::dil_push_ptr(stop, _nativehub.callback(opptr_temp));
+
+		++rec;
+
+		__NEXT;
+	}
+
+#include "dispatcher_op_stack.hpp"
+
+#ifdef GNUCTHREAD
+__op_default:
+#else
+	default:
+#endif
+#ifdef OPRNDCHECK
+	throw runtime_error(_err_msg_wrong_opnd);
+#else
+	__assume(false);
+#endif
+#ifndef GNUCTHREAD
+	}
+#endif
+}
+#endif
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "dispatcher.hpp"
+
+// Generated by compiler::opgen, do not edit
+
+namespace interpreter
+{
+	// gen_0 - reserved, fuse_ops never emits an op without a sequence and the handler only fills its
+	//         case of the dispatch loops
+
+	template <>
+	inline void dispatcher::__dil_gen<0ui64>([[maybe_unused]] const uint8_t*& opptr, [[maybe_unused]] uintptr_t& ftop,
+		[[maybe_unused]] uintptr_t& stop, [[maybe_unused]] state& state)
+	{
+	}
+
+	// gen_1 - reserved, fuse_ops never emits an op without a sequence and the handler only fills its
+	//         case of the dispatch loops
+
+	template <>
+	inline void dispatcher::__dil_gen<1ui64>([[maybe_unused]] const uint8_t*& opptr, [[maybe_unused]] uintptr_t& ftop,
+		[[maybe_unused]] uintptr_t& stop, [[maybe_unused]] state& state)
+	{
+	}
+
+	// gen_2 - reserved, fuse_ops never emits an op without a sequence and the handler only fills its
+	//         case of the dispatch loops
+
+	template <>
+	inline void dispatcher::__dil_gen<2ui64>([[maybe_unused]] const uint8_t*& opptr, [[maybe_unused]] uintptr_t& ftop,
+		[[maybe_unused]] uintptr_t& stop, [[maybe_unused]] state& state)
+	{
+	}
+
+	// gen_3 - reserved, fuse_ops never emits an op without a sequence and the handler only fills its
+	//         case of the dispatch loops
+
+	template <>
+	inline void dispatcher::__dil_gen<3ui64>([[maybe_unused]] const uint8_t*& opptr, [[maybe_unused]] uintptr_t& ftop,
+		[[maybe_unused]] uintptr_t& stop, [[maybe_unused]] state& state)
+	{
+	}
+}
\ No newline at end of file
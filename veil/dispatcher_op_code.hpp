@@ -0,0 +1,675 @@
+// Handlers of the ops that take operands from the byte code or move through it, loops running the
+// byte code itself include them next to dispatcher_op_stack.hpp
+//
+// __OP_FLOW(name) - starts the handler of op name, which leaves the stack alone
+
+__OP(nativecall):
+	{
+		__dil_native(stop);
+
+		uintptr_t stop_temp = stop;
+		const uint8_t* opptr_temp = opptr;
+
+		_nativehub.call(opptr_temp, stop_temp);
+		__dil_thrown();
+
+		stop = stop_temp;
+		opptr = opptr_temp;
+
+		__OP_NEXT;
+	}
+
+__OP(nativecall_n):
+	{
+		__dil_native(stop);
+
+		uintptr_t stop_temp = stop;
+		const uint8_t* opptr_temp = opptr;
+
+		_nativehub.call_n(opptr_temp, stop_temp);
+		__dil_thrown();
+
+		stop = stop_temp;
+		opptr = opptr_temp;
+
+		__OP_NEXT;
+	}
+
+__OP(ret):
+	{
+		opptr = (const uint8_t*)stack_type::dil_pop_frame(ftop, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(call_64):
+	{
+		__dil_call<val64<>>(opptr, ftop, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(call_32):
+	{
+		__dil_call<val32<>>(opptr, ftop, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(call_16):
+	{
+		__dil_call<val16<>>(opptr, ftop, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(call_8):
+	{
+		__dil_call<val8<>>(opptr, ftop, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(l_alloc):
+	{
+		stack_type::dil_alloc(stop, (uint64_t)dil_fetch<val16<>>(opptr).ui);
+
+		__OP_NEXT;
+	}
+
+__OP(s_alloc):
+	{
+		stack_type::dil_alloc(stop, (uint64_t)dil_fetch<val8<>>(opptr).ui);
+
+		__OP_NEXT;
+	}
+
+__OP(l_allocz):
+	{
+		stack_type::dil_allocz(stop, (uint64_t)dil_fetch<val16<>>(opptr).ui);
+
+		__OP_NEXT;
+	}
+
+__OP(s_allocz):
+	{
+		stack_type::dil_allocz(stop, (uint64_t)dil_fetch<val8<>>(opptr).ui);
+
+		__OP_NEXT;
+	}
+
+__OP(l_dealloc):
+	{
+		stack_type::dil_dealloc(stop, (uint64_t)dil_fetch<val16<>>(opptr).ui);
+
+		__OP_NEXT;
+	}
+
+__OP(s_dealloc):
+	{
+		stack_type::dil_dealloc(stop, (uint64_t)dil_fetch<val8<>>(opptr).ui);
+
+		__OP_NEXT;
+	}
+
+__OP(push_flow):
+	{
+		stack_type::dil_push_ptr(stop, (uintptr_t)opptr);
+
+		__OP_NEXT;
+	}
+
+__OP(pop_flow):
+	{
+		opptr = (const uint8_t*)stack_type::dil_pop_ptr(stop);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_64):
+	{
+		__dil_jmp<val64<>>(opptr);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_32):
+	{
+		__dil_jmp<val32<>>(opptr);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_16):
+	{
+		__dil_jmp<val16<>>(opptr);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_8):
+	{
+		__dil_jmp<val8<>>(opptr);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_a_64):
+	{
+		__dil_jmp_a<val64<>>(opptr, state);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_a_32):
+	{
+		__dil_jmp_a<val32<>>(opptr, state);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_a_16):
+	{
+		__dil_jmp_a<val16<>>(opptr, state);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_a_8):
+	{
+		__dil_jmp_a<val8<>>(opptr, state);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_ae_64):
+	{
+		__dil_jmp_ae<val64<>>(opptr, state);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_ae_32):
+	{
+		__dil_jmp_ae<val32<>>(opptr, state);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_ae_16):
+	{
+		__dil_jmp_ae<val16<>>(opptr, state);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_ae_8):
+	{
+		__dil_jmp_ae<val8<>>(opptr, state);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_b_64):
+	{
+		__dil_jmp_b<val64<>>(opptr, state);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_b_32):
+	{
+		__dil_jmp_b<val32<>>(opptr, state);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_b_16):
+	{
+		__dil_jmp_b<val16<>>(opptr, state);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_b_8):
+	{
+		__dil_jmp_b<val8<>>(opptr, state);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_be_64):
+	{
+		__dil_jmp_be<val64<>>(opptr, state);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_be_32):
+	{
+		__dil_jmp_be<val32<>>(opptr, state);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_be_16):
+	{
+		__dil_jmp_be<val16<>>(opptr, state);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_be_8):
+	{
+		__dil_jmp_be<val8<>>(opptr, state);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_e_64):
+	{
+		__dil_jmp_e<val64<>>(opptr, state);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_e_32):
+	{
+		__dil_jmp_e<val32<>>(opptr, state);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_e_16):
+	{
+		__dil_jmp_e<val16<>>(opptr, state);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_e_8):
+	{
+		__dil_jmp_e<val8<>>(opptr, state);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_ne_64):
+	{
+		__dil_jmp_ne<val64<>>(opptr, state);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_ne_32):
+	{
+		__dil_jmp_ne<val32<>>(opptr, state);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_ne_16):
+	{
+		__dil_jmp_ne<val16<>>(opptr, state);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_ne_8):
+	{
+		__dil_jmp_ne<val8<>>(opptr, state);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_un_64):
+	{
+		__dil_jmp_un<val64<>>(opptr, state);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_un_32):
+	{
+		__dil_jmp_un<val32<>>(opptr, state);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_un_16):
+	{
+		__dil_jmp_un<val16<>>(opptr, state);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_un_8):
+	{
+		__dil_jmp_un<val8<>>(opptr, state);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_msk_64):
+	{
+		__dil_jmp_msk<val64<>>(opptr, state);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_msk_32):
+	{
+		__dil_jmp_msk<val32<>>(opptr, state);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_msk_16):
+	{
+		__dil_jmp_msk<val16<>>(opptr, state);
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(jmp_msk_8):
+	{
+		__dil_jmp_msk<val8<>>(opptr, state);
+
+		__OP_NEXT;
+	}
+
+#ifndef __CACHED_l_load_64
+__OP(l_load_64):
+	{
+		__dil_l_load<val64<>>(opptr, ftop, stop);
+
+		__OP_NEXT;
+	}
+#endif
+
+__OP(l_load_32):
+	{
+		__dil_l_load<val32<>>(opptr, ftop, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(l_load_16):
+	{
+		__dil_l_load<val16<>>(opptr, ftop, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(l_load_8):
+	{
+		__dil_l_load<val8<>>(opptr, ftop, stop);
+
+		__OP_NEXT;
+	}
+
+#ifndef __CACHED_l_store_64
+__OP(l_store_64):
+	{
+		__dil_l_store<val64<>>(opptr, ftop, stop);
+
+		__OP_NEXT;
+	}
+#endif
+
+__OP(l_store_32):
+	{
+		__dil_l_store<val32<>>(opptr, ftop, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(l_store_16):
+	{
+		__dil_l_store<val16<>>(opptr, ftop, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(l_store_8):
+	{
+		__dil_l_store<val8<>>(opptr, ftop, stop);
+
+		__OP_NEXT;
+	}
+
+#ifndef __CACHED_s_load_64
+__OP(s_load_64):
+	{
+		__dil_s_load<val64<>>(opptr, ftop, stop);
+
+		__OP_NEXT;
+	}
+#endif
+
+__OP(s_load_32):
+	{
+		__dil_s_load<val32<>>(opptr, ftop, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(s_load_16):
+	{
+		__dil_s_load<val16<>>(opptr, ftop, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(s_load_8):
+	{
+		__dil_s_load<val8<>>(opptr, ftop, stop);
+
+		__OP_NEXT;
+	}
+
+#ifndef __CACHED_s_store_64
+__OP(s_store_64):
+	{
+		__dil_s_store<val64<>>(opptr, ftop, stop);
+
+		__OP_NEXT;
+	}
+#endif
+
+__OP(s_store_32):
+	{
+		__dil_s_store<val32<>>(opptr, ftop, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(s_store_16):
+	{
+		__dil_s_store<val16<>>(opptr, ftop, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(s_store_8):
+	{
+		__dil_s_store<val8<>>(opptr, ftop, stop);
+
+		__OP_NEXT;
+	}
+
+#ifndef __CACHED_push_64
+__OP(push_64):
+	{
+		__dil_push<val64<>>(opptr, stop);
+
+		__OP_NEXT;
+	}
+#endif
+
+__OP(push_32):
+	{
+		__dil_push<val32<>>(opptr, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(push_16):
+	{
+		__dil_push<val16<>>(opptr, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(push_8):
+	{
+		__dil_push<val8<>>(opptr, stop);
+
+		__OP_NEXT;
+	}
+
+#ifndef __CACHED_s_ucmp_jmp_64
+__OP(s_ucmp_jmp_64):
+	{
+		__dil_s_ucmp_jmp<val64<>>(opptr, ftop, state);
+
+		__OP_NEXT;
+	}
+#endif
+
+#ifndef __CACHED_s_scmp_jmp_64
+__OP(s_scmp_jmp_64):
+	{
+		__dil_s_scmp_jmp<val64<>>(opptr, ftop, state);
+
+		__OP_NEXT;
+	}
+#endif
+
+#ifndef __CACHED_s_uinc_64
+__OP(s_uinc_64):
+	{
+		__dil_s_uinc<val64<>, P>(opptr, ftop, state);
+
+		__OP_NEXT;
+	}
+#endif
+
+#ifndef __CACHED_s_udec_64
+__OP(s_udec_64):
+	{
+		__dil_s_udec<val64<>, P>(opptr, ftop, state);
+
+		__OP_NEXT;
+	}
+#endif
+
+#ifndef __CACHED_s_uadd_64
+__OP(s_uadd_64):
+	{
+		__dil_s_uadd<val64<>, P>(opptr, ftop, state, stop);
+
+		__OP_NEXT;
+	}
+#endif
+
+#ifndef __CACHED_s_move_64
+__OP(s_move_64):
+	{
+		__dil_s_move<val64<>>(opptr, ftop);
+
+		__OP_NEXT;
+	}
+#endif
+
+__OP(gen_0):
+	{
+		__dil_gen<0ui64>(opptr, ftop, stop, state);
+
+		__OP_NEXT;
+	}
+
+__OP(gen_1):
+	{
+		__dil_gen<1ui64>(opptr, ftop, stop, state);
+
+		__OP_NEXT;
+	}
+
+__OP(gen_2):
+	{
+		__dil_gen<2ui64>(opptr, ftop, stop, state);
+
+		__OP_NEXT;
+	}
+
+__OP(gen_3):
+	{
+		__dil_gen<3ui64>(opptr, ftop, stop, state);
+
+		__OP_NEXT;
+	}
+
+__OP(hostcall):
+	{
+		__dil_native(stop);
+
+		uintptr_t stop_temp = stop;
+		const uint8_t* opptr_temp = opptr;
+
+		// Proven code is verified with the stack bytes of the op, so checked code of any policy
+		// has them checked against the bound function
+
+		if (_check_type == check_type::checked)
+			_nativehub.host(opptr_temp, stop_temp, _code_beg, _code_end);
+		else
+			_nativehub.host(opptr_temp, stop_temp);
+
+		__dil_thrown();
+
+		stop = stop_temp;
+		opptr = opptr_temp;
+
+		__OP_NEXT;
+	}
+
+__OP_FLOW(imports):
+	{
+		opptr += (ptrdiff_t)dil_fetch<val16<>>(opptr).ui;
+
+		__OP_NEXT;
+	}
+
+__OP(importcall):
+	{
+		__dil_native(stop);
+
+		uintptr_t stop_temp = stop;
+		const uint8_t* opptr_temp = opptr;
+
+		if (_check_type == check_type::checked)
+			_nativehub.call_import(opptr_temp, stop_temp, _code_beg, _code_end);
+		else
+			_nativehub.call_import(opptr_temp, stop_temp);
+
+		__dil_thrown();
+
+		stop = stop_temp;
+		opptr = opptr_temp;
+
+		__OP_NEXT;
+	}
+
+__OP(callback):
+	{
+		const uint8_t* opptr_temp = opptr;
+
+		if (_check_type == check_type::checked)
+			stack_type::dil_push_ptr(stop, _nativehub.callback(opptr_temp, _code_beg, _code_end));
+		else
+			stack_type::dil_push_ptr(stop, _nativehub.callback(opptr_temp));
+
+		opptr = opptr_temp;
+
+		__OP_NEXT;
+	}
@@ -0,0 +1,1371 @@
+// Handlers of the ops that only work on the stack and the state, every loop running DEEPINLINE
+// handlers includes them so its dispatch mode cannot run different code
+//
+// __OP(name)     - starts the handler of op name in the including loop
+// __OP_NEXT      - ends a handler and runs the next op
+// __CACHED_<op>  - defined when the loop keeps the operands of op in registers with its own handler
+// P              - check policy of the handlers
+
+__OP(memcpy):
+	{
+		uint8_t* dst = (uint8_t*)stack_type::dil_pop_ptr(stop);
+		uint8_t* src = (uint8_t*)stack_type::dil_pop_ptr(stop);
+		const uint64_t c = stack_type::dil_pop<val64<>>(stop).ui;
+
+		memcpy(dst, src, c);
+
+		__OP_NEXT;
+	}
+
+__OP(memset):
+	{
+		uint8_t* dst = (uint8_t*)stack_type::dil_pop_ptr(stop);
+		const uint8_t val = stack_type::dil_pop<val8<>>(stop).ui;
+		const uint64_t c = stack_type::dil_pop<val64<>>(stop).ui;
+
+		memset(dst, val, c);
+
+		__OP_NEXT;
+	}
+
+__OP(push_frame):
+	{
+		stack_type::dil_store_frame(ftop, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(push_stack):
+	{
+		stack_type::dil_store_stack(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(push_state):
+	{
+		stack_type::dil_push(stop, (state_val<>(state)).__value);
+
+		__OP_NEXT;
+	}
+
+__OP(pop_frame):
+	{
+		stack_type::dil_load_frame(ftop, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(pop_stack):
+	{
+		stack_type::dil_load_stack(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(pop_state):
+	{
+		state = (state_val<>(stack_type::dil_pop<val16<>>(stop))).__state;
+
+		__OP_NEXT;
+	}
+
+#ifndef __CACHED_pop_64
+__OP(pop_64):
+	{
+		stack_type::dil_rem<val64<>>(stop);
+
+		__OP_NEXT;
+	}
+#endif
+
+__OP(pop_32):
+	{
+		stack_type::dil_rem<val32<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(pop_16):
+	{
+		stack_type::dil_rem<val16<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(pop_8):
+	{
+		stack_type::dil_rem<val8<>>(stop);
+
+		__OP_NEXT;
+	}
+
+#ifndef __CACHED_dup_64
+__OP(dup_64):
+	{
+		stack_type::dil_dup<val64<>>(stop);
+
+		__OP_NEXT;
+	}
+#endif
+
+__OP(dup_32):
+	{
+		stack_type::dil_dup<val32<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(dup_16):
+	{
+		stack_type::dil_dup<val16<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(dup_8):
+	{
+		stack_type::dil_dup<val8<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(ptrcpy_64):
+	{
+		__dil_ptrcpy<val64<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(ptrcpy_32):
+	{
+		__dil_ptrcpy<val32<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(ptrcpy_16):
+	{
+		__dil_ptrcpy<val16<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(ptrcpy_8):
+	{
+		__dil_ptrcpy<val8<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(ptrget_64):
+	{
+		__dil_ptrget<val64<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(ptrget_32):
+	{
+		__dil_ptrget<val32<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(ptrget_16):
+	{
+		__dil_ptrget<val16<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(ptrget_8):
+	{
+		__dil_ptrget<val8<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(ptrset_64):
+	{
+		__dil_ptrset<val64<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(ptrset_32):
+	{
+		__dil_ptrset<val32<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(ptrset_16):
+	{
+		__dil_ptrset<val16<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(ptrset_8):
+	{
+		__dil_ptrset<val8<>>(stop);
+
+		__OP_NEXT;
+	}
+
+#ifndef __CACHED_neg_64
+__OP(neg_64):
+	{
+		__dil_neg<val64<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+#endif
+
+__OP(neg_32):
+	{
+		__dil_neg<val32<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(neg_16):
+	{
+		__dil_neg<val16<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(neg_8):
+	{
+		__dil_neg<val8<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+#ifndef __CACHED_not_64
+__OP(not_64):
+	{
+		__dil_not<val64<>>(stop);
+
+		__OP_NEXT;
+	}
+#endif
+
+__OP(not_32):
+	{
+		__dil_not<val32<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(not_16):
+	{
+		__dil_not<val16<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(not_8):
+	{
+		__dil_not<val8<>>(stop);
+
+		__OP_NEXT;
+	}
+
+#ifndef __CACHED_sinc_64
+__OP(sinc_64):
+	{
+		__dil_sinc<val64<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+#endif
+
+__OP(sinc_32):
+	{
+		__dil_sinc<val32<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(sinc_16):
+	{
+		__dil_sinc<val16<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(sinc_8):
+	{
+		__dil_sinc<val8<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+#ifndef __CACHED_uinc_64
+__OP(uinc_64):
+	{
+		__dil_uinc<val64<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+#endif
+
+__OP(uinc_32):
+	{
+		__dil_uinc<val32<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(uinc_16):
+	{
+		__dil_uinc<val16<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(uinc_8):
+	{
+		__dil_uinc<val8<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+#ifndef __CACHED_sdec_64
+__OP(sdec_64):
+	{
+		__dil_sdec<val64<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+#endif
+
+__OP(sdec_32):
+	{
+		__dil_sdec<val32<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(sdec_16):
+	{
+		__dil_sdec<val16<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(sdec_8):
+	{
+		__dil_sdec<val8<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+#ifndef __CACHED_udec_64
+__OP(udec_64):
+	{
+		__dil_udec<val64<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+#endif
+
+__OP(udec_32):
+	{
+		__dil_udec<val32<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(udec_16):
+	{
+		__dil_udec<val16<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(udec_8):
+	{
+		__dil_udec<val8<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+#ifndef __CACHED_and_64
+__OP(and_64):
+	{
+		__dil_and<val64<>>(stop);
+
+		__OP_NEXT;
+	}
+#endif
+
+__OP(and_32):
+	{
+		__dil_and<val32<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(and_16):
+	{
+		__dil_and<val16<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(and_8):
+	{
+		__dil_and<val8<>>(stop);
+
+		__OP_NEXT;
+	}
+
+#ifndef __CACHED_or_64
+__OP(or_64):
+	{
+		__dil_or<val64<>>(stop);
+
+		__OP_NEXT;
+	}
+#endif
+
+__OP(or_32):
+	{
+		__dil_or<val32<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(or_16):
+	{
+		__dil_or<val16<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(or_8):
+	{
+		__dil_or<val8<>>(stop);
+
+		__OP_NEXT;
+	}
+
+#ifndef __CACHED_xor_64
+__OP(xor_64):
+	{
+		__dil_xor<val64<>>(stop);
+
+		__OP_NEXT;
+	}
+#endif
+
+__OP(xor_32):
+	{
+		__dil_xor<val32<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(xor_16):
+	{
+		__dil_xor<val16<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(xor_8):
+	{
+		__dil_xor<val8<>>(stop);
+
+		__OP_NEXT;
+	}
+
+#ifndef __CACHED_sadd_64
+__OP(sadd_64):
+	{
+		__dil_sadd<val64<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+#endif
+
+__OP(sadd_32):
+	{
+		__dil_sadd<val32<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(sadd_16):
+	{
+		__dil_sadd<val16<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(sadd_8):
+	{
+		__dil_sadd<val8<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+#ifndef __CACHED_uadd_64
+__OP(uadd_64):
+	{
+		__dil_uadd<val64<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+#endif
+
+__OP(uadd_32):
+	{
+		__dil_uadd<val32<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(uadd_16):
+	{
+		__dil_uadd<val16<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(uadd_8):
+	{
+		__dil_uadd<val8<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+#ifndef __CACHED_ssub_64
+__OP(ssub_64):
+	{
+		__dil_ssub<val64<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+#endif
+
+__OP(ssub_32):
+	{
+		__dil_ssub<val32<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(ssub_16):
+	{
+		__dil_ssub<val16<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(ssub_8):
+	{
+		__dil_ssub<val8<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+#ifndef __CACHED_usub_64
+__OP(usub_64):
+	{
+		__dil_usub<val64<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+#endif
+
+__OP(usub_32):
+	{
+		__dil_usub<val32<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(usub_16):
+	{
+		__dil_usub<val16<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(usub_8):
+	{
+		__dil_usub<val8<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+#ifndef __CACHED_smul_64
+__OP(smul_64):
+	{
+		__dil_smul<val64<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+#endif
+
+__OP(smul_32):
+	{
+		__dil_smul<val32<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(smul_16):
+	{
+		__dil_smul<val16<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(smul_8):
+	{
+		__dil_smul<val8<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+#ifndef __CACHED_umul_64
+__OP(umul_64):
+	{
+		__dil_umul<val64<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+#endif
+
+__OP(umul_32):
+	{
+		__dil_umul<val32<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(umul_16):
+	{
+		__dil_umul<val16<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(umul_8):
+	{
+		__dil_umul<val8<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(smod_64):
+	{
+		__dil_smod<val64<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(smod_32):
+	{
+		__dil_smod<val32<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(smod_16):
+	{
+		__dil_smod<val16<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(smod_8):
+	{
+		__dil_smod<val8<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(umod_64):
+	{
+		__dil_umod<val64<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(umod_32):
+	{
+		__dil_umod<val32<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(umod_16):
+	{
+		__dil_umod<val16<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(umod_8):
+	{
+		__dil_umod<val8<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(sdiv_64):
+	{
+		__dil_sdiv<val64<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(sdiv_32):
+	{
+		__dil_sdiv<val32<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(sdiv_16):
+	{
+		__dil_sdiv<val16<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(sdiv_8):
+	{
+		__dil_sdiv<val8<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(udiv_64):
+	{
+		__dil_udiv<val64<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(udiv_32):
+	{
+		__dil_udiv<val32<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(udiv_16):
+	{
+		__dil_udiv<val16<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(udiv_8):
+	{
+		__dil_udiv<val8<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+#ifndef __CACHED_scmp_64
+__OP(scmp_64):
+	{
+		__dil_scmp<val64<>>(state, stop);
+
+		__OP_NEXT;
+	}
+#endif
+
+__OP(scmp_32):
+	{
+		__dil_scmp<val32<>>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(scmp_16):
+	{
+		__dil_scmp<val16<>>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(scmp_8):
+	{
+		__dil_scmp<val8<>>(state, stop);
+
+		__OP_NEXT;
+	}
+
+#ifndef __CACHED_ucmp_64
+__OP(ucmp_64):
+	{
+		__dil_ucmp<val64<>>(state, stop);
+
+		__OP_NEXT;
+	}
+#endif
+
+__OP(ucmp_32):
+	{
+		__dil_ucmp<val32<>>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(ucmp_16):
+	{
+		__dil_ucmp<val16<>>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(ucmp_8):
+	{
+		__dil_ucmp<val8<>>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(rotl_64):
+	{
+		__dil_rotl<val64<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(rotl_32):
+	{
+		__dil_rotl<val32<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(rotl_16):
+	{
+		__dil_rotl<val16<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(rotl_8):
+	{
+		__dil_rotl<val8<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(rotr_64):
+	{
+		__dil_rotr<val64<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(rotr_32):
+	{
+		__dil_rotr<val32<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(rotr_16):
+	{
+		__dil_rotr<val16<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(rotr_8):
+	{
+		__dil_rotr<val8<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(sshl_64):
+	{
+		__dil_sshl<val64<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(sshl_32):
+	{
+		__dil_sshl<val32<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(sshl_16):
+	{
+		__dil_sshl<val16<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(sshl_8):
+	{
+		__dil_sshl<val8<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(ushl_64):
+	{
+		__dil_ushl<val64<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(ushl_32):
+	{
+		__dil_ushl<val32<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(ushl_16):
+	{
+		__dil_ushl<val16<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(ushl_8):
+	{
+		__dil_ushl<val8<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(sshr_64):
+	{
+		__dil_sshr<val64<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(sshr_32):
+	{
+		__dil_sshr<val32<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(sshr_16):
+	{
+		__dil_sshr<val16<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(sshr_8):
+	{
+		__dil_sshr<val8<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(ushr_64):
+	{
+		__dil_ushr<val64<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(ushr_32):
+	{
+		__dil_ushr<val32<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(ushr_16):
+	{
+		__dil_ushr<val16<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(ushr_8):
+	{
+		__dil_ushr<val8<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(fneg_64):
+	{
+		__dil_fneg<val64<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(fneg_32):
+	{
+		__dil_fneg<val32<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(fevl_64):
+	{
+		__dil_fevl<val64<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(fevl_32):
+	{
+		__dil_fevl<val32<>, P>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(fadd_64):
+	{
+		__dil_fadd<val64<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(fadd_32):
+	{
+		__dil_fadd<val32<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(fsub_64):
+	{
+		__dil_fsub<val64<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(fsub_32):
+	{
+		__dil_fsub<val32<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(fmul_64):
+	{
+		__dil_fmul<val64<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(fmul_32):
+	{
+		__dil_fmul<val32<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(fmod_64):
+	{
+		__dil_fmod<val64<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(fmod_32):
+	{
+		__dil_fmod<val32<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(fdiv_64):
+	{
+		__dil_fdiv<val64<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(fdiv_32):
+	{
+		__dil_fdiv<val32<>>(stop);
+
+		__OP_NEXT;
+	}
+
+__OP(fcmp_64):
+	{
+		__dil_fcmp<val64<>>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(fcmp_32):
+	{
+		__dil_fcmp<val32<>>(state, stop);
+
+		__OP_NEXT;
+	}
+
+__OP(si64_2_f64):
+	{
+		val64<>& v = stack_type::dil_top<val64<>>(stop);
+
+		const int64_t si = v.si;
+		v.f = (double)si;
+
+		__OP_NEXT;
+	}
+
+__OP(si64_2_f32):
+	{
+		val64<>& v = stack_type::dil_top<val64<>>(stop);
+
+		const int64_t si = v.si;
+
+		stack_type::dil_dealloc(stop, (uint64_t)sizeof(val32<>));
+
+		v.half.hi.f = (float)si;
+
+		__OP_NEXT;
+	}
+
+__OP(si32_2_f64):
+	{
+		stack_type::dil_alloc(stop, (uint64_t)sizeof(val32<>));
+		val64<>& v = stack_type::dil_top<val64<>>(stop);
+
+		const int32_t si = v.half.hi.si;
+		v.f = (double)si;
+
+		__OP_NEXT;
+	}
+
+__OP(si32_2_f32):
+	{
+		val32<>& v = stack_type::dil_top<val32<>>(stop);
+
+		const int32_t si = v.si;
+		v.f = (float)si;
+
+		__OP_NEXT;
+	}
+
+__OP(ui64_2_f64):
+	{
+		val64<>& v = stack_type::dil_top<val64<>>(stop);
+
+		const uint64_t ui = v.ui;
+		v.f = (double)ui;
+
+		__OP_NEXT;
+	}
+
+__OP(ui64_2_f32):
+	{
+		val64<>& v = stack_type::dil_top<val64<>>(stop);
+
+		const uint64_t ui = v.ui;
+
+		stack_type::dil_dealloc(stop, (uint64_t)sizeof(val32<>));
+
+		v.half.hi.f = (float)ui;
+
+		__OP_NEXT;
+	}
+
+__OP(ui32_2_f64):
+	{
+		stack_type::dil_alloc(stop, (uint64_t)sizeof(val32<>));
+		val64<>& v = stack_type::dil_top<val64<>>(stop);
+
+		const uint32_t ui = v.half.hi.ui;
+		v.f = (double)ui;
+
+		__OP_NEXT;
+	}
+
+__OP(ui32_2_f32):
+	{
+		val32<>& v = stack_type::dil_top<val32<>>(stop);
+
+		const uint32_t ui = v.ui;
+		v.f = (float)ui;
+
+		__OP_NEXT;
+	}
+
+__OP(f64_2_si64):
+	{
+		val64<>& v = stack_type::dil_top<val64<>>(stop);
+		interpreter::state& s = state;
+
+		const double f = v.f;
+
+		const bool ovf = !(f < (double)__2_POW_63);
+		const bool unf = !(f >= -(double)__2_POW_63);
+
+		s.eval.bits.ierr = ovf && unf;
+		s.eval.bits.iovf = ovf && !unf;
+		s.eval.bits.iunf = !ovf && unf;
+
+		if (!ovf && !unf)
+			v.si = (int64_t)f;
+
+		__OP_NEXT;
+	}
+
+__OP(f64_2_si32):
+	{
+		val64<>& v = stack_type::dil_top<val64<>>(stop);
+		interpreter::state& s = state;
+
+		const double f = v.f;
+
+		stack_type::dil_dealloc(stop, (uint64_t)sizeof(val32<>));
+
+		const bool ovf = !(f < (double)__2_POW_31);
+		const bool unf = !(f >= -(double)__2_POW_31);
+
+		s.eval.bits.ierr = ovf && unf;
+		s.eval.bits.iovf = ovf && !unf;
+		s.eval.bits.iunf = !ovf && unf;
+
+		if (!ovf && !unf)
+			v.half.hi.si = (int32_t)f;
+
+		__OP_NEXT;
+	}
+
+__OP(f32_2_si64):
+	{
+		stack_type::dil_alloc(stop, (uint64_t)sizeof(val32<>));
+		val64<>& v = stack_type::dil_top<val64<>>(stop);
+		interpreter::state& s = state;
+
+		const float f = v.half.hi.f;
+
+		const bool ovf = !(f < (float)__2_POW_63);
+		const bool unf = !(f >= -(float)__2_POW_63);
+
+		s.eval.bits.ierr = ovf && unf;
+		s.eval.bits.iovf = ovf && !unf;
+		s.eval.bits.iunf = !ovf && unf;
+
+		if (!ovf && !unf)
+			v.si = (int64_t)f;
+
+		__OP_NEXT;
+	}
+
+__OP(f32_2_si32):
+	{
+		val32<>& v = stack_type::dil_top<val32<>>(stop);
+		interpreter::state& s = state;
+
+		const float f = v.f;
+
+		const bool ovf = !(f < (float)__2_POW_31);
+		const bool unf = !(f >= -(float)__2_POW_31);
+
+		s.eval.bits.ierr = ovf && unf;
+		s.eval.bits.iovf = ovf && !unf;
+		s.eval.bits.iunf = !ovf && unf;
+
+		if (!ovf && !unf)
+			v.si = (int32_t)f;
+
+		__OP_NEXT;
+	}
+
+__OP(f64_2_ui64):
+	{
+		val64<>& v = stack_type::dil_top<val64<>>(stop);
+		interpreter::state& s = state;
+
+		const double f = v.f;
+
+		const bool ovf = !(f < (double)__2_POW_64);
+		const bool unf = !(f >= (double)__0);
+
+		s.eval.bits.ierr = ovf && unf;
+		s.eval.bits.iovf = ovf && !unf;
+		s.eval.bits.iunf = !ovf && unf;
+
+		if (!ovf && !unf)
+			v.ui = (uint64_t)f;
+
+		__OP_NEXT;
+	}
+
+__OP(f64_2_ui32):
+	{
+		val64<>& v = stack_type::dil_top<val64<>>(stop);
+		interpreter::state& s = state;
+
+		const double f = v.f;
+
+		stack_type::dil_dealloc(stop, (uint64_t)sizeof(val32<>));
+
+		const bool ovf = !(f < (double)__2_POW_32);
+		const bool unf = !(f >= (double)__0);
+
+		s.eval.bits.ierr = ovf && unf;
+		s.eval.bits.iovf = ovf && !unf;
+		s.eval.bits.iunf = !ovf && unf;
+
+		if (!ovf && !unf)
+			v.half.hi.ui = (uint32_t)f;
+
+		__OP_NEXT;
+	}
+
+__OP(f32_2_ui64):
+	{
+		stack_type::dil_alloc(stop, (uint64_t)sizeof(val32<>));
+		val64<>& v = stack_type::dil_top<val64<>>(stop);
+		interpreter::state& s = state;
+
+		const float f = v.half.hi.f;
+
+		const bool ovf = !(f < (float)__2_POW_64);
+		const bool unf = !(f >= (float)__0);
+
+		s.eval.bits.ierr = ovf && unf;
+		s.eval.bits.iovf = ovf && !unf;
+		s.eval.bits.iunf = !ovf && unf;
+
+		if (!ovf && !unf)
+			v.ui = (uint64_t)f;
+
+		__OP_NEXT;
+	}
+
+__OP(f32_2_ui32):
+	{
+		val32<>& v = stack_type::dil_top<val32<>>(stop);
+		interpreter::state& s = state;
+
+		const float f = v.f;
+
+		const bool ovf = !(f < (float)__2_POW_32);
+		const bool unf = !(f >= (float)__0);
+
+		s.eval.bits.ierr = ovf && unf;
+		s.eval.bits.iovf = ovf && !unf;
+		s.eval.bits.iunf = !ovf && unf;
+
+		if (!ovf && !unf)
+			v.ui = (uint32_t)f;
+
+		__OP_NEXT;
+	}
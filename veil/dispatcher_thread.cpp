@@ -0,0 +1,311 @@
+#include "dispatcher.hpp"
+
+using namespace interpreter;
+using namespace std;
+
+#ifdef GNUCTHREAD
+#define __2_POW_64 18446744073709551616.0
+#define __2_POW_63 9223372036854775808.0
+#define __2_POW_32 4294967296.0
+#define __2_POW_31 2147483648.0
+#define __0 0.0
+
+// Every handler ends with its own indirect jump through the label table, so the
+// branch predictor sees one dispatch site per op instead of the single shared one
+// of the switch loop; both loops include the same handlers
+
+#define __NEXT goto *__label[dil_fetch<val8<>>(opptr).ui]
+
+#define __OP(name) __op_##name
+#define __OP_FLOW(name) __op_##name
+#define __OP_NEXT __NEXT
+
+void dispatcher::__loop_thread()
+{
+	using P = default_policy;
+
+	uintptr_t ftop = _stack.get_ftop();
+	uintptr_t stop = _stack.get_stop();
+
+	const uint8_t* opptr = _opptr;
+	state state = _state;
+
+	static const void* const __label[256ui64] =
+	{
+		&&__op_nop,
+		&&__op_exit,
+		&&__op_nativecall,
+		&&__op_ret,
+		&&__op_call_64,
+		&&__op_call_32,
+		&&__op_call_16,
+		&&__op_call_8,
+		&&__op_memcpy,
+		&&__op_memset,
+		&&__op_l_alloc,
+		&&__op_s_alloc,
+		&&__op_l_allocz,
+		&&__op_s_allocz,
+		&&__op_l_dealloc,
+		&&__op_s_dealloc,
+		&&__op_push_flow,
+		&&__op_push_frame,
+		&&__op_push_stack,
+		&&__op_push_state,
+		&&__op_pop_flow,
+		&&__op_pop_frame,
+		&&__op_pop_stack,
+		&&__op_pop_state,
+		&&__op_jmp_64,
+		&&__op_jmp_32,
+		&&__op_jmp_16,
+		&&__op_jmp_8,
+		&&__op_jmp_a_64,
+		&&__op_jmp_a_32,
+		&&__op_jmp_a_16,
+		&&__op_jmp_a_8,
+		&&__op_jmp_ae_64,
+		&&__op_jmp_ae_32,
+		&&__op_jmp_ae_16,
+		&&__op_jmp_ae_8,
+		&&__op_jmp_b_64,
+		&&__op_jmp_b_32,
+		&&__op_jmp_b_16,
+		&&__op_jmp_b_8,
+		&&__op_jmp_be_64,
+		&&__op_jmp_be_32,
+		&&__op_jmp_be_16,
+		&&__op_jmp_be_8,
+		&&__op_jmp_e_64,
+		&&__op_jmp_e_32,
+		&&__op_jmp_e_16,
+		&&__op_jmp_e_8,
+		&&__op_jmp_ne_64,
+		&&__op_jmp_ne_32,
+		&&__op_jmp_ne_16,
+		&&__op_jmp_ne_8,
+		&&__op_jmp_un_64,
+		&&__op_jmp_un_32,
+		&&__op_jmp_un_16,
+		&&__op_jmp_un_8,
+		&&__op_jmp_msk_64,
+		&&__op_jmp_msk_32,
+		&&__op_jmp_msk_16,
+		&&__op_jmp_msk_8,
+		&&__op_l_load_64,
+		&&__op_l_load_32,
+		&&__op_l_load_16,
+		&&__op_l_load_8,
+		&&__op_l_store_64,
+		&&__op_l_store_32,
+		&&__op_l_store_16,
+		&&__op_l_store_8,
+		&&__op_s_load_64,
+		&&__op_s_load_32,
+		&&__op_s_load_16,
+		&&__op_s_load_8,
+		&&__op_s_store_64,
+		&&__op_s_store_32,
+		&&__op_s_store_16,
+		&&__op_s_store_8,
+		&&__op_push_64,
+		&&__op_push_32,
+		&&__op_push_16,
+		&&__op_push_8,
+		&&__op_pop_64,
+		&&__op_pop_32,
+		&&__op_pop_16,
+		&&__op_pop_8,
+		&&__op_dup_64,
+		&&__op_dup_32,
+		&&__op_dup_16,
+		&&__op_dup_8,
+		&&__op_ptrcpy_64,
+		&&__op_ptrcpy_32,
+		&&__op_ptrcpy_16,
+		&&__op_ptrcpy_8,
+		&&__op_ptrget_64,
+		&&__op_ptrget_32,
+		&&__op_ptrget_16,
+		&&__op_ptrget_8,
+		&&__op_ptrset_64,
+		&&__op_ptrset_32,
+		&&__op_ptrset_16,
+		&&__op_ptrset_8,
+		&&__op_neg_64,
+		&&__op_neg_32,
+		&&__op_neg_16,
+		&&__op_neg_8,
+		&&__op_not_64,
+		&&__op_not_32,
+		&&__op_not_16,
+		&&__op_not_8,
+		&&__op_sinc_64,
+		&&__op_sinc_32,
+		&&__op_sinc_16,
+		&&__op_sinc_8,
+		&&__op_uinc_64,
+		&&__op_uinc_32,
+		&&__op_uinc_16,
+		&&__op_uinc_8,
+		&&__op_sdec_64,
+		&&__op_sdec_32,
+		&&__op_sdec_16,
+		&&__op_sdec_8,
+		&&__op_udec_64,
+		&&__op_udec_32,
+		&&__op_udec_16,
+		&&__op_udec_8,
+		&&__op_and_64,
+		&&__op_and_32,
+		&&__op_and_16,
+		&&__op_and_8,
+		&&__op_or_64,
+		&&__op_or_32,
+		&&__op_or_16,
+		&&__op_or_8,
+		&&__op_xor_64,
+		&&__op_xor_32,
+		&&__op_xor_16,
+		&&__op_xor_8,
+		&&__op_sadd_64,
+		&&__op_sadd_32,
+		&&__op_sadd_16,
+		&&__op_sadd_8,
+		&&__op_uadd_64,
+		&&__op_uadd_32,
+		&&__op_uadd_16,
+		&&__op_uadd_8,
+		&&__op_ssub_64,
+		&&__op_ssub_32,
+		&&__op_ssub_16,
+		&&__op_ssub_8,
+		&&__op_usub_64,
+		&&__op_usub_32,
+		&&__op_usub_16,
+		&&__op_usub_8,
+		&&__op_smul_64,
+		&&__op_smul_32,
+		&&__op_smul_16,
+		&&__op_smul_8,
+		&&__op_umul_64,
+		&&__op_umul_32,
+		&&__op_umul_16,
+		&&__op_umul_8,
+		&&__op_smod_64,
+		&&__op_smod_32,
+		&&__op_smod_16,
+		&&__op_smod_8,
+		&&__op_umod_64,
+		&&__op_umod_32,
+		&&__op_umod_16,
+		&&__op_umod_8,
+		&&__op_sdiv_64,
+		&&__op_sdiv_32,
+		&&__op_sdiv_16,
+		&&__op_sdiv_8,
+		&&__op_udiv_64,
+		&&__op_udiv_32,
+		&&__op_udiv_16,
+		&&__op_udiv_8,
+		&&__op_scmp_64,
+		&&__op_scmp_32,
+		&&__op_scmp_16,
+		&&__op_scmp_8,
+		&&__op_ucmp_64,
+		&&__op_ucmp_32,
+		&&__op_ucmp_16,
+		&&__op_ucmp_8,
+		&&__op_rotl_64,
+		&&__op_rotl_32,
+		&&__op_rotl_16,
+		&&__op_rotl_8,
+		&&__op_rotr_64,
+		&&__op_rotr_32,
+		&&__op_rotr_16,
+		&&__op_rotr_8,
+		&&__op_sshl_64,
+		&&__op_sshl_32,
+		&&__op_sshl_16,
+		&&__op_sshl_8,
+		&&__op_ushl_64,
+		&&__op_ushl_32,
+		&&__op_ushl_16,
+		&&__op_ushl_8,
+		&&__op_sshr_64,
+		&&__op_sshr_32,
+		&&__op_sshr_16,
+		&&__op_sshr_8,
+		&&__op_ushr_64,
+		&&__op_ushr_32,
+		&&__op_ushr_16,
+		&&__op_ushr_8,
+		&&__op_fneg_64,
+		&&__op_fneg_32,
+		&&__op_fevl_64,
+		&&__op_fevl_32,
+		&&__op_fadd_64,
+		&&__op_fadd_32,
+		&&__op_fsub_64,
+		&&__op_fsub_32,
+		&&__op_fmul_64,
+		&&__op_fmul_32,
+		&&__op_fmod_64,
+		&&__op_fmod_32,
+		&&__op_fdiv_64,
+		&&__op_fdiv_32,
+		&&__op_fcmp_64,
+		&&__op_fcmp_32,
+		&&__op_si64_2_f64,
+		&&__op_si64_2_f32,
+		&&__op_si32_2_f64,
+		&&__op_si32_2_f32,
+		&&__op_ui64_2_f64,
+		&&__op_ui64_2_f32,
+		&&__op_ui32_2_f64,
+		&&__op_ui32_2_f32,
+		&&__op_f64_2_si64,
+		&&__op_f64_2_si32,
+		&&__op_f32_2_si64,
+		&&__op_f32_2_si32,
+		&&__op_f64_2_ui64,
+		&&__op_f64_2_ui32,
+		&&__op_f32_2_ui64,
+		&&__op_f32_2_ui32,
+		&&__op_s_ucmp_jmp_64,
+		&&__op_s_scmp_jmp_64,
+		&&__op_s_uinc_64,
+		&&__op_s_udec_64,
+		&&__op_s_uadd_64,
+		&&__op_s_move_64,
+		&&__op_gen_0,
+		&&__op_gen_1,
+		&&__op_gen_2,
+		&&__op_gen_3,
+		&&__op_hostcall,
+		&&__op_imports,
+		&&__op_importcall,
+		&&__op_nativecall_n,
+		&&__op_callback,
+		&&__op_default
+	};
+
+	__NEXT;
+
+__op_nop:
+	__NEXT;
+
+__op_exit:
+	return;
+
+#include "dispatcher_op_code.hpp"
+#include "dispatcher_op_stack.hpp"
+
+__op_default:
+#ifdef OPRNDCHECK
+	throw runtime_error(_err_msg_wrong_opnd);
+#else
+	__assume(false);
+#endif
+}
+#endif
\ No newline at end of file
@@ -20,8 +20,11 @@ inline void ::interpreter::interpreter::__mov_obj(interpreter&& o) noexcept
 	_disp = move(o._disp);
 }
 
-::interpreter::interpreter::interpreter(const uint8_t* code, uint64_t code_size, uint64_t cache_size, uint64_t stack_size, endian endianness)
+::interpreter::interpreter::interpreter(const uint8_t* code, uint64_t code_size, uint64_t cache_size, uint64_t stack_size, endian endianness,
+	dispatch_type disp_type, check_type chk_type)
 {
+	__def_obj();
+
 	if (code_size == 0ui64)
 		throw runtime_error(_err_msg_zero_size);
 	else
@@ -36,10 +39,49 @@ inline void ::interpreter::interpreter::__mov_obj(interpreter&& o) noexcept
 				uint8_t* code_copy = (uint8_t*)new uint8_t * [code_size];
 				memcpy(code_copy, code, (uint64_t)sizeof(uint8_t) * code_size);
 
+				_code = (const uint8_t*)code_copy;
+
 				if (endianness != endian::native)
 					dispatcher::rev_endian(code_copy, code_size);
 
-				_code = (const uint8_t*)code_copy;
+			#ifdef INLINECALLS
+				compiler::inliner inl(code_copy, code_size);
+
+				if (inl.get_inlined() != 0ui64)
+				{
+					code_size = (uint64_t)inl.get_code().size();
+					code_copy = (uint8_t*)new uint8_t * [code_size];
+					memcpy(code_copy, inl.get_code().data(), (uint64_t)sizeof(uint8_t) * code_size);
+
+					__del_obj();
+					_code = (const uint8_t*)code_copy;
+				}
+			#endif
+
+			#ifdef LOOPOPT
+				compiler::loop_optimizer lopt(code_copy, code_size, chk_type);
+
+				if (!lopt.get_loops().empty())
+				{
+					code_size = (uint64_t)lopt.get_code().size();
+					code_copy = (uint8_t*)new uint8_t * [code_size];
+					memcpy(code_copy, lopt.get_code().data(), (uint64_t)sizeof(uint8_t) * code_size);
+
+					__del_obj();
+					_code = (const uint8_t*)code_copy;
+				}
+			#endif
+
+			#ifdef PEEPHOLE
+				compiler::optimizer opt(code_copy, code_size, chk_type);
+
+				code_size = (uint64_t)opt.get_code().size();
+				memcpy(code_copy, opt.get_code().data(), (uint64_t)sizeof(uint8_t) * code_size);
+			#endif
+
+			#ifdef FUSEDOPS
+				dispatcher::fuse_ops(code_copy, code_size);
+			#endif
 
 				break;
 			}
@@ -48,11 +90,7 @@ inline void ::interpreter::interpreter::__mov_obj(interpreter&& o) noexcept
 				throw runtime_error(_err_msg_wrong_end);
 			}
 
-		#ifdef FETCHCHECK
-			_disp.emplace(_code, code_size, cache_size, stack_size);
-		#else
-			_disp.emplace(_code, cache_size, stack_size);
-		#endif
+			_disp.emplace(_code, code_size, cache_size, stack_size, disp_type, chk_type);
 		}
 		catch (const exception& e)
 		{
@@ -5,6 +5,7 @@
 #include <stdexcept>
 #include <utility>
 
+#include "compiler.hpp"
 #include "dispatcher.hpp"
 
 namespace interpreter
@@ -56,7 +57,8 @@ namespace interpreter
 
 	public:
 		interpreter() = delete;
-		interpreter(const uint8_t* code, uint64_t code_size, uint64_t cache_size, uint64_t stack_size, std::endian endianness);
+		interpreter(const uint8_t* code, uint64_t code_size, uint64_t cache_size, uint64_t stack_size, std::endian endianness,
+			dispatch_type disp_type = dispatcher::default_dispatch, check_type chk_type = dispatcher::default_check);
 		interpreter(const interpreter& o) = delete;
 		interpreter(interpreter&& o) noexcept;
 		~interpreter() noexcept;
@@ -83,6 +85,26 @@ namespace interpreter
 
 		void execute(const vtype* atype, const void** aval, uint64_t count, vtype rtype, void* rval);
 
+		// Host functions are bound to the hub before code calling them is executed
+
+		inline nativehub& get_nativehub()
+		{
+			return _disp.value().get_nativehub();
+		}
+
+		inline const nativehub& get_nativehub() const
+		{
+			return _disp.value().get_nativehub();
+		}
+
+	#ifdef OPPROFILE
+		inline const op_profile& get_profile() const
+		{
+			return _disp.value().get_profile();
+		}
+
+	#endif
+
 		interpreter& operator=(const interpreter& o) = delete;
 		interpreter& operator=(interpreter&& o) noexcept;
 	};
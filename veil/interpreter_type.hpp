@@ -3,8 +3,11 @@
 #include <bit>
 #include <concepts>
 #include <cstdint>
+#include <type_traits>
 #include <utility>
 
+#include "define.hpp"
+
 namespace interpreter
 {
 	enum class abi_type : uint8_t
@@ -86,6 +89,24 @@ namespace interpreter
 		__ptr,
 	};
 
+	enum class check_type : uint8_t
+	{
+		unchecked,
+		checked
+	};
+
+	enum class dispatch_type : uint8_t
+	{
+		switched,
+		threaded,
+		decoded,
+		cached,
+		registered,
+		jitted,
+		patched,
+		traced
+	};
+
 	enum class type : uint8_t
 	{
 		v0 = 0ui8,
@@ -131,6 +152,69 @@ namespace interpreter
 		}
 	};
 
+	// check_policy - checks ops are run with, every flag is known at compile time so a dispatch
+	//                loop instantiated with a policy holds none of the checks it leaves off
+
+	template <bool FETCH, bool STACK, bool OPINT, bool FLOAT, bool MTYPE>
+	struct check_policy
+	{
+	public:
+		static constexpr bool fetch_check = FETCH;
+		static constexpr bool stack_check = STACK;
+		static constexpr bool opint_check = OPINT;
+		static constexpr bool float_check = FLOAT;
+		static constexpr bool mtype_check = MTYPE;
+	};
+
+	using unchecked_policy = check_policy<false, false, false, false, false>;
+	using checked_policy = check_policy<true, true, true, true, true>;
+
+	// Check defines only choose the policy dispatchers get when none is given, dispatch loops
+	// not instantiated per policy are built with it, each define turns on its own check
+
+#ifdef FETCHCHECK
+	static constexpr bool FETCH_ON = true;
+#else
+	static constexpr bool FETCH_ON = false;
+#endif
+#ifdef STACKCHECK
+	static constexpr bool STACK_ON = true;
+#else
+	static constexpr bool STACK_ON = false;
+#endif
+#ifdef OPINTCHECK
+	static constexpr bool OPINT_ON = true;
+#else
+	static constexpr bool OPINT_ON = false;
+#endif
+#ifdef FLOATCHECK
+	static constexpr bool FLOAT_ON = true;
+#else
+	static constexpr bool FLOAT_ON = false;
+#endif
+#ifdef MTYPECHECK
+	static constexpr bool MTYPE_ON = true;
+#else
+	static constexpr bool MTYPE_ON = false;
+#endif
+
+	using default_policy = check_policy<FETCH_ON, STACK_ON, OPINT_ON, FLOAT_ON, MTYPE_ON>;
+
+	// Opint checks code of a check type runs with, inlined dispatch runs checked code with every
+	// opint check and unchecked code with the default ones unless they have fetch or stack checks
+
+	static constexpr bool has_opint_check(check_type chk_type) noexcept
+	{
+	#ifdef DEEPINLINE
+		if (chk_type == check_type::checked)
+			return checked_policy::opint_check;
+		else
+			return !default_policy::fetch_check && !default_policy::stack_check && default_policy::opint_check;
+	#else
+		return default_policy::opint_check;
+	#endif
+	}
+
 	struct comp_bits
 	{
 	public:
@@ -660,4 +744,61 @@ namespace interpreter
 
 	template <typename T>
 	concept VALUE_IPTR_VOID = VALUE_IPTR<T> || std::same_as<T, VOID>;
+
+	// HOST - argument and return types of host functions, numbers go on the stack as the value of
+	//        their width and pointers as 64 bits
+
+	template <typename T>
+	concept HOST = VALUE<T> || FLOAT<T> || SINT<T> || UINT<T> || std::is_pointer_v<T>;
+
+	template <typename T>
+	concept HOST_VOID = HOST<T> || std::same_as<T, void>;
+
+	template <HOST_VOID T>
+	inline constexpr uint64_t host_size = std::is_void_v<T> ? 0ui64 : std::is_pointer_v<T> ? 8ui64 : (uint64_t)sizeof(T);
+
+	// host_sig - stack bytes the host function F pops as arguments and pushes as return value
+
+	template <auto F, typename T = decltype(F)>
+	struct host_sig;
+
+	template <auto F, HOST_VOID R, HOST ...A>
+	struct host_sig<F, R(*)(A...)>
+	{
+		static constexpr uint64_t pop = (0ui64 + ... + host_size<A>);
+		static constexpr uint64_t push = host_size<R>;
+	};
+
+	template <auto F, HOST_VOID R, HOST ...A>
+	struct host_sig<F, R(*)(A...) noexcept> : host_sig<F, R(*)(A...)> {};
+
+	// arg_size - stack bytes of a native call argument or return value of the inner type
+
+	inline constexpr uint64_t arg_size(arg_i_type type) noexcept
+	{
+		switch (type)
+		{
+		case arg_i_type::__val64f:
+		case arg_i_type::__val64s:
+		case arg_i_type::__val64u:
+		case arg_i_type::__ptr:
+			return 8ui64;
+
+		case arg_i_type::__val32f:
+		case arg_i_type::__val32s:
+		case arg_i_type::__val32u:
+			return 4ui64;
+
+		case arg_i_type::__val16s:
+		case arg_i_type::__val16u:
+			return 2ui64;
+
+		case arg_i_type::__val8s:
+		case arg_i_type::__val8u:
+			return 1ui64;
+
+		default:
+			return 0ui64;
+		}
+	}
 }
\ No newline at end of file
@@ -0,0 +1,1229 @@
+#include "jit.hpp"
+
+#ifdef X64JIT
+#include <sys/mman.h>
+
+using namespace interpreter;
+using namespace std;
+
+// Jitted code keeps stop in rbx, ftop in rbp, the context in r12, the entry table in r13 and
+// the comparison flags in r14, rax, rcx, rdx and rdi are scratch
+
+static constexpr uint8_t rax = 0ui8;
+static constexpr uint8_t rcx = 1ui8;
+static constexpr uint8_t rdx = 2ui8;
+static constexpr uint8_t rbx = 3ui8;
+static constexpr uint8_t rbp = 5ui8;
+static constexpr uint8_t r12 = 12ui8;
+static constexpr uint8_t r13 = 13ui8;
+static constexpr uint8_t r14 = 14ui8;
+
+static constexpr uint64_t _enter_pos = 0ui64;
+static constexpr uint64_t _exit_pos = 32ui64;
+
+static constexpr int32_t ctx_stop = (int32_t)offsetof(jit_context, stop);
+static constexpr int32_t ctx_ftop = (int32_t)offsetof(jit_context, ftop);
+static constexpr int32_t ctx_opptr = (int32_t)offsetof(jit_context, opptr);
+static constexpr int32_t ctx_comp = (int32_t)offsetof(jit_context, comp);
+static constexpr int32_t ctx_exit = (int32_t)offsetof(jit_context, exit);
+
+struct text_fixup
+{
+	uint64_t pos;
+	const uint8_t* target;
+};
+
+static inline void emit_32(vector<uint8_t>& text, uint32_t value)
+{
+	for (uint64_t i = 0ui64; i < 4ui64; ++i)
+		text.push_back((uint8_t)(value >> (i * 8ui64)));
+}
+
+static inline void emit_64(vector<uint8_t>& text, uint64_t value)
+{
+	for (uint64_t i = 0ui64; i < 8ui64; ++i)
+		text.push_back((uint8_t)(value >> (i * 8ui64)));
+}
+
+static inline void patch_32(vector<uint8_t>& text, uint64_t pos, uint64_t target)
+{
+	const uint32_t rel = (uint32_t)(int32_t)((int64_t)target - (int64_t)(pos + 4ui64));
+
+	for (uint64_t i = 0ui64; i < 4ui64; ++i)
+		text[pos + i] = (uint8_t)(rel >> (i * 8ui64));
+}
+
+static inline void emit_rex(vector<uint8_t>& text, bool wide, uint8_t reg, uint8_t base)
+{
+	const uint8_t rex = 0x40ui8 | (wide ? 8ui8 : 0ui8) | ((reg & 8ui8) >> 1ui8) | ((base & 8ui8) >> 3ui8);
+
+	if (rex != 0x40ui8)
+		text.push_back(rex);
+}
+
+// op reg, [base + disp32]
+
+static inline void emit_mem(vector<uint8_t>& text, bool half, bool wide, initializer_list<uint8_t> code,
+	uint8_t reg, uint8_t base, int32_t disp)
+{
+	if (half)
+		text.push_back(0x66ui8);
+
+	emit_rex(text, wide, reg, base);
+	text.insert(text.end(), code);
+	text.push_back(0x80ui8 | ((reg & 7ui8) << 3ui8) | (base & 7ui8));
+
+	if ((base & 7ui8) == 4ui8)
+		text.push_back(0x24ui8);
+
+	emit_32(text, (uint32_t)disp);
+}
+
+// op rm, reg
+
+static inline void emit_reg(vector<uint8_t>& text, bool wide, initializer_list<uint8_t> code, uint8_t reg, uint8_t rm)
+{
+	emit_rex(text, wide, reg, rm);
+	text.insert(text.end(), code);
+	text.push_back(0xC0ui8 | ((reg & 7ui8) << 3ui8) | (rm & 7ui8));
+}
+
+static inline void emit_load(vector<uint8_t>& text, uint64_t width, bool sign, uint8_t reg, uint8_t base, int32_t disp)
+{
+	switch (width)
+	{
+	case 8ui64:
+		emit_mem(text, false, true, { 0x8Bui8 }, reg, base, disp);
+		break;
+
+	case 4ui64:
+		emit_mem(text, false, sign, { sign ? 0x63ui8 : 0x8Bui8 }, reg, base, disp);
+		break;
+
+	case 2ui64:
+		emit_mem(text, false, sign, { 0x0Fui8, sign ? 0xBFui8 : 0xB7ui8 }, reg, base, disp);
+		break;
+
+	case 1ui64:
+		emit_mem(text, false, sign, { 0x0Fui8, sign ? 0xBEui8 : 0xB6ui8 }, reg, base, disp);
+		break;
+
+	default:
+		__assume(false);
+		break;
+	}
+}
+
+static inline void emit_store(vector<uint8_t>& text, uint64_t width, uint8_t reg, uint8_t base, int32_t disp)
+{
+	emit_mem(text, width == 2ui64, width == 8ui64, { width == 1ui64 ? (uint8_t)0x88ui8 : (uint8_t)0x89ui8 }, reg, base, disp);
+}
+
+// Group and ALU ops on [rbx] of the given width, code is the 16/32/64-bit opcode and the
+// 8-bit one is right below it
+
+static inline void emit_top(vector<uint8_t>& text, uint64_t width, uint8_t code, uint8_t reg)
+{
+	emit_mem(text, width == 2ui64, width == 8ui64, { width == 1ui64 ? (uint8_t)(code - 1ui8) : code }, reg, rbx, 0i32);
+}
+
+static inline void emit_stop(vector<uint8_t>& text, int64_t delta)
+{
+	if (delta == 0i64)
+		return;
+
+	const uint8_t ext = delta > 0i64 ? 0ui8 : 5ui8;
+	const uint64_t size = delta > 0i64 ? (uint64_t)delta : (uint64_t)-delta;
+
+	if (size < 0x80ui64)
+	{
+		emit_reg(text, true, { 0x83ui8 }, ext, rbx);
+		text.push_back((uint8_t)size);
+	}
+	else
+	{
+		emit_reg(text, true, { 0x81ui8 }, ext, rbx);
+		emit_32(text, (uint32_t)size);
+	}
+}
+
+static inline void emit_imm(vector<uint8_t>& text, uint8_t reg, uint64_t value)
+{
+	emit_rex(text, true, 0ui8, reg);
+	text.push_back(0xB8ui8 | (reg & 7ui8));
+	emit_64(text, value);
+}
+
+static inline void emit_jmp(vector<uint8_t>& text, vector<text_fixup>& fixups, const uint8_t* target)
+{
+	text.push_back(0xE9ui8);
+	fixups.push_back(text_fixup{ (uint64_t)text.size(), target });
+	emit_32(text, 0ui32);
+}
+
+static inline void emit_jcc(vector<uint8_t>& text, vector<text_fixup>& fixups, uint8_t cc, const uint8_t* target)
+{
+	text.push_back(0x0Fui8);
+	text.push_back(0x80ui8 | cc);
+	fixups.push_back(text_fixup{ (uint64_t)text.size(), target });
+	emit_32(text, 0ui32);
+}
+
+static inline void emit_exit(vector<uint8_t>& text, const uint8_t* opptr, uint64_t exit_pos)
+{
+	emit_imm(text, rax, (uint64_t)(uintptr_t)opptr);
+	text.push_back(0xE9ui8);
+	emit_32(text, 0ui32);
+	patch_32(text, text.size() - 4ui64, exit_pos);
+}
+
+// Enter saves what SysV wants preserved and keeps the context in r12
+
+static inline void emit_save(vector<uint8_t>& text)
+{
+	text.insert(text.end(), { 0x53ui8, 0x55ui8, 0x41ui8, 0x54ui8, 0x41ui8, 0x55ui8, 0x41ui8, 0x56ui8, 0x41ui8, 0x57ui8 });
+	text.insert(text.end(), { 0x49ui8, 0x89ui8, 0xFCui8 });
+}
+
+static inline void emit_load_ctx(vector<uint8_t>& text)
+{
+	emit_mem(text, false, true, { 0x8Bui8 }, rbx, r12, ctx_stop);
+	emit_mem(text, false, true, { 0x8Bui8 }, rbp, r12, ctx_ftop);
+	emit_mem(text, false, false, { 0x0Fui8, 0xB6ui8 }, r14, r12, ctx_comp);
+	text.insert(text.end(), { 0x41ui8, 0x83ui8, 0xE6ui8, 0x03ui8 });
+}
+
+// Exit writes the registers back with the op to resume at from rax and returns
+
+static inline void emit_store_ctx(vector<uint8_t>& text)
+{
+	emit_mem(text, false, true, { 0x89ui8 }, rax, r12, ctx_opptr);
+	emit_mem(text, false, true, { 0x89ui8 }, rbx, r12, ctx_stop);
+	emit_mem(text, false, true, { 0x89ui8 }, rbp, r12, ctx_ftop);
+	emit_mem(text, false, false, { 0x88ui8 }, r14, r12, ctx_comp);
+	text.insert(text.end(), { 0x41ui8, 0x5Fui8, 0x41ui8, 0x5Eui8, 0x41ui8, 0x5Dui8, 0x41ui8, 0x5Cui8, 0x5Dui8, 0x5Bui8, 0xC3ui8 });
+}
+
+static inline int64_t fetch_offset(const uint8_t* opptr, uint64_t width)
+{
+	switch (width)
+	{
+	case 8ui64:
+		return (int64_t)((const val64<>*)opptr)->si;
+
+	case 4ui64:
+		return (int64_t)((const val32<>*)opptr)->si;
+
+	case 2ui64:
+		return (int64_t)((const val16<>*)opptr)->si;
+
+	case 1ui64:
+		return (int64_t)((const val8<>*)opptr)->si;
+
+	default:
+		__assume(false);
+		break;
+	}
+}
+
+static inline uint64_t fetch_width(op op_code, op op_64)
+{
+	return 8ui64 >> ((uint64_t)op_code - (uint64_t)op_64);
+}
+
+// Frame slot displacement from ftop, see stack::__dil_get_vptr
+
+static inline int32_t frame_disp(int64_t offset, uint64_t width)
+{
+	if (offset >= 0i64)
+		return (int32_t)(offset + 16i64);
+	else
+		return (int32_t)(offset + 1i64 - (int64_t)width);
+}
+
+// Fused ops run as their first op, the rest of their sequence follows in place
+
+static inline op get_template(op op_code)
+{
+	if ((uint8_t)op_code >= (uint8_t)op::s_ucmp_jmp_64 && (uint8_t)op_code <= (uint8_t)op::s_move_64)
+		return op::s_load_64;
+	else
+		return decoded_code::get_base(op_code);
+}
+
+static inline void emit_call(vector<uint8_t>& text, const uint8_t* next)
+{
+	emit_imm(text, rax, (uint64_t)(uintptr_t)next);
+	emit_store(text, 8ui64, rax, rbx, -8i32);
+	emit_store(text, 8ui64, rbp, rbx, -16i32);
+	emit_stop(text, -16i64);
+	emit_reg(text, true, { 0x89ui8 }, rbx, rbp);
+}
+
+// Return address is left in rcx
+
+static inline void emit_ret(vector<uint8_t>& text)
+{
+	emit_reg(text, true, { 0x89ui8 }, rbp, rbx);
+	emit_load(text, 8ui64, false, rbp, rbx, 0i32);
+	emit_load(text, 8ui64, false, rcx, rbx, 8i32);
+	emit_stop(text, 16i64);
+}
+
+// Tests r14, which holds above * 1 + below * 2, for a jmp_cc_64 group and returns the condition
+// code of the taken branch, each condition is one compare
+
+static inline uint8_t emit_cond(vector<uint8_t>& text, op op_64)
+{
+	switch (op_64)
+	{
+	case op::jmp_a_64:
+		text.insert(text.end(), { 0x41ui8, 0x83ui8, 0xFEui8, 0x01ui8 });
+		return 0x4ui8;
+
+	case op::jmp_ae_64:
+		text.insert(text.end(), { 0x41ui8, 0xF6ui8, 0xC6ui8, 0x02ui8 });
+		return 0x4ui8;
+
+	case op::jmp_b_64:
+		text.insert(text.end(), { 0x41ui8, 0x83ui8, 0xFEui8, 0x02ui8 });
+		return 0x4ui8;
+
+	case op::jmp_be_64:
+		text.insert(text.end(), { 0x41ui8, 0xF6ui8, 0xC6ui8, 0x01ui8 });
+		return 0x4ui8;
+
+	case op::jmp_e_64:
+		text.insert(text.end(), { 0x41ui8, 0x83ui8, 0xFEui8, 0x00ui8 });
+		return 0x4ui8;
+
+	case op::jmp_ne_64:
+		text.insert(text.end(), { 0x41ui8, 0x8Dui8, 0x46ui8, 0xFFui8, 0x83ui8, 0xF8ui8, 0x02ui8 });
+		return 0x2ui8;
+
+	case op::jmp_un_64:
+		text.insert(text.end(), { 0x41ui8, 0x83ui8, 0xFEui8, 0x03ui8 });
+		return 0x4ui8;
+
+	default:
+		__assume(false);
+		break;
+	}
+}
+
+// Template of an op that keeps to the straight line, false for control flow and ops without one
+
+static bool emit_op(vector<uint8_t>& text, const uint8_t* opptr, const uint8_t* next, op op_code)
+{
+	switch (op_code)
+	{
+	case op::nop:
+		break;
+
+	case op::l_alloc:
+	case op::s_alloc:
+		emit_stop(text, -(int64_t)(op_code == op::l_alloc ? (uint64_t)((const val16<>*)(opptr + (ptrdiff_t)1))->ui : (uint64_t)opptr[1]));
+		break;
+
+	case op::l_allocz:
+	case op::s_allocz:
+	{
+		const uint64_t alloc = op_code == op::l_allocz ? (uint64_t)((const val16<>*)(opptr + (ptrdiff_t)1))->ui : (uint64_t)opptr[1];
+
+		if (alloc != 0ui64)
+		{
+			emit_stop(text, -(int64_t)alloc);
+			text.insert(text.end(), { 0x48ui8, 0x89ui8, 0xDFui8, 0xB9ui8 });
+			emit_32(text, (uint32_t)alloc);
+			text.insert(text.end(), { 0x31ui8, 0xC0ui8, 0xF3ui8, 0xAAui8 });
+		}
+
+		break;
+	}
+
+	case op::l_dealloc:
+	case op::s_dealloc:
+		emit_stop(text, (int64_t)(op_code == op::l_dealloc ? (uint64_t)((const val16<>*)(opptr + (ptrdiff_t)1))->ui : (uint64_t)opptr[1]));
+		break;
+
+	case op::push_flow:
+		emit_imm(text, rax, (uint64_t)(uintptr_t)next);
+		emit_stop(text, -8i64);
+		emit_store(text, 8ui64, rax, rbx, 0i32);
+		break;
+
+	case op::push_frame:
+		emit_stop(text, -8i64);
+		emit_store(text, 8ui64, rbp, rbx, 0i32);
+		break;
+
+	case op::push_stack:
+		emit_reg(text, true, { 0x89ui8 }, rbx, rax);
+		emit_stop(text, -8i64);
+		emit_store(text, 8ui64, rax, rbx, 0i32);
+		break;
+
+	case op::pop_frame:
+		emit_load(text, 8ui64, false, rbp, rbx, 0i32);
+		emit_stop(text, 8i64);
+		break;
+
+	case op::pop_stack:
+		emit_load(text, 8ui64, false, rbx, rbx, 0i32);
+		break;
+
+	case op::l_load_64:
+	case op::l_load_32:
+	case op::l_load_16:
+	case op::l_load_8:
+	{
+		const uint64_t width = fetch_width(op_code, op::l_load_64);
+
+		emit_load(text, width, false, rax, rbp, frame_disp(fetch_offset(opptr + (ptrdiff_t)1, 2ui64), width));
+		emit_stop(text, -(int64_t)width);
+		emit_store(text, width, rax, rbx, 0i32);
+		break;
+	}
+
+	case op::l_store_64:
+	case op::l_store_32:
+	case op::l_store_16:
+	case op::l_store_8:
+	{
+		const uint64_t width = fetch_width(op_code, op::l_store_64);
+
+		emit_load(text, width, false, rax, rbx, 0i32);
+		emit_stop(text, (int64_t)width);
+		emit_store(text, width, rax, rbp, frame_disp(fetch_offset(opptr + (ptrdiff_t)1, 2ui64), width));
+		break;
+	}
+
+	case op::s_load_64:
+	case op::s_load_32:
+	case op::s_load_16:
+	case op::s_load_8:
+	{
+		const uint64_t width = fetch_width(op_code, op::s_load_64);
+
+		emit_load(text, width, false, rax, rbp, frame_disp(fetch_offset(opptr + (ptrdiff_t)1, 1ui64), width));
+		emit_stop(text, -(int64_t)width);
+		emit_store(text, width, rax, rbx, 0i32);
+		break;
+	}
+
+	case op::s_store_64:
+	case op::s_store_32:
+	case op::s_store_16:
+	case op::s_store_8:
+	{
+		const uint64_t width = fetch_width(op_code, op::s_store_64);
+
+		emit_load(text, width, false, rax, rbx, 0i32);
+		emit_stop(text, (int64_t)width);
+		emit_store(text, width, rax, rbp, frame_disp(fetch_offset(opptr + (ptrdiff_t)1, 1ui64), width));
+		break;
+	}
+
+	case op::push_64:
+	case op::push_32:
+	case op::push_16:
+	case op::push_8:
+	{
+		const uint64_t width = fetch_width(op_code, op::push_64);
+		uint64_t value = 0ui64;
+
+		memcpy(&value, opptr + (ptrdiff_t)1, width);
+		emit_stop(text, -(int64_t)width);
+
+		if (width == 8ui64 && (int64_t)value != (int64_t)(int32_t)value)
+		{
+			emit_imm(text, rax, value);
+			emit_store(text, width, rax, rbx, 0i32);
+		}
+		else
+		{
+			emit_top(text, width, 0xC7ui8, 0ui8);
+			text.insert(text.end(), opptr + (ptrdiff_t)1, opptr + (ptrdiff_t)(1ui64 + (width == 8ui64 ? 4ui64 : width)));
+		}
+
+		break;
+	}
+
+	case op::pop_64:
+	case op::pop_32:
+	case op::pop_16:
+	case op::pop_8:
+		emit_stop(text, (int64_t)fetch_width(op_code, op::pop_64));
+		break;
+
+	case op::dup_64:
+	case op::dup_32:
+	case op::dup_16:
+	case op::dup_8:
+	{
+		const uint64_t width = fetch_width(op_code, op::dup_64);
+
+		emit_load(text, width, false, rax, rbx, 0i32);
+		emit_stop(text, -(int64_t)width);
+		emit_store(text, width, rax, rbx, 0i32);
+		break;
+	}
+
+	case op::not_64:
+	case op::not_32:
+	case op::not_16:
+	case op::not_8:
+		emit_top(text, fetch_width(op_code, op::not_64), 0xF7ui8, 2ui8);
+		break;
+
+	case op::and_64:
+	case op::and_32:
+	case op::and_16:
+	case op::and_8:
+	case op::or_64:
+	case op::or_32:
+	case op::or_16:
+	case op::or_8:
+	case op::xor_64:
+	case op::xor_32:
+	case op::xor_16:
+	case op::xor_8:
+#ifndef OPINTCHECK
+	case op::sadd_64:
+	case op::sadd_32:
+	case op::sadd_16:
+	case op::sadd_8:
+	case op::uadd_64:
+	case op::uadd_32:
+	case op::uadd_16:
+	case op::uadd_8:
+	case op::ssub_64:
+	case op::ssub_32:
+	case op::ssub_16:
+	case op::ssub_8:
+	case op::usub_64:
+	case op::usub_32:
+	case op::usub_16:
+	case op::usub_8:
+#endif
+	{
+		// Popped value in rax goes into the new top with a read-modify-write op
+
+		const uint64_t group = ((uint64_t)op_code - (uint64_t)op::and_64) >> 2ui64;
+		const uint64_t width = 8ui64 >> (((uint64_t)op_code - (uint64_t)op::and_64) & 3ui64);
+		const uint8_t code[] = { 0x21ui8, 0x09ui8, 0x31ui8, 0x01ui8, 0x01ui8, 0x29ui8, 0x29ui8 };
+
+		emit_load(text, width, false, rax, rbx, 0i32);
+		emit_stop(text, (int64_t)width);
+		emit_top(text, width, code[group], rax);
+		break;
+	}
+
+#ifndef OPINTCHECK
+	case op::neg_64:
+	case op::neg_32:
+	case op::neg_16:
+	case op::neg_8:
+		emit_top(text, fetch_width(op_code, op::neg_64), 0xF7ui8, 3ui8);
+		break;
+
+	case op::sinc_64:
+	case op::sinc_32:
+	case op::sinc_16:
+	case op::sinc_8:
+	case op::uinc_64:
+	case op::uinc_32:
+	case op::uinc_16:
+	case op::uinc_8:
+	case op::sdec_64:
+	case op::sdec_32:
+	case op::sdec_16:
+	case op::sdec_8:
+	case op::udec_64:
+	case op::udec_32:
+	case op::udec_16:
+	case op::udec_8:
+	{
+		const bool dec = (uint8_t)op_code >= (uint8_t)op::sdec_64;
+
+		emit_top(text, 8ui64 >> (((uint64_t)op_code - (uint64_t)op::sinc_64) & 3ui64), 0xFFui8, dec ? 1ui8 : 0ui8);
+		break;
+	}
+
+	case op::smul_64:
+	case op::smul_32:
+	case op::smul_16:
+	case op::smul_8:
+	case op::umul_64:
+	case op::umul_32:
+	case op::umul_16:
+	case op::umul_8:
+	{
+		// Low half of the product is the same for signed and unsigned operands
+
+		const uint64_t width = 8ui64 >> (((uint64_t)op_code - (uint64_t)op::smul_64) & 3ui64);
+
+		emit_load(text, width, false, rax, rbx, 0i32);
+		emit_stop(text, (int64_t)width);
+		emit_load(text, width, false, rcx, rbx, 0i32);
+		text.insert(text.end(), { 0x48ui8, 0x0Fui8, 0xAFui8, 0xC1ui8 });
+		emit_store(text, width, rax, rbx, 0i32);
+		break;
+	}
+#endif
+
+	case op::scmp_64:
+	case op::scmp_32:
+	case op::scmp_16:
+	case op::scmp_8:
+	case op::ucmp_64:
+	case op::ucmp_32:
+	case op::ucmp_16:
+	case op::ucmp_8:
+	{
+		const bool sign = (uint8_t)op_code <= (uint8_t)op::scmp_8;
+		const uint64_t width = 8ui64 >> (((uint64_t)op_code - (uint64_t)op::scmp_64) & 3ui64);
+
+		emit_load(text, width, sign, rax, rbx, 0i32);
+		emit_load(text, width, sign, rcx, rbx, (int32_t)width);
+		emit_stop(text, (int64_t)(width * 2ui64));
+		text.insert(text.end(), { 0x48ui8, 0x39ui8, 0xC8ui8 });
+		text.insert(text.end(), { 0x0Fui8, sign ? (uint8_t)0x9Fui8 : (uint8_t)0x97ui8, 0xC0ui8 });
+		text.insert(text.end(), { 0x0Fui8, sign ? (uint8_t)0x9Cui8 : (uint8_t)0x92ui8, 0xC1ui8 });
+		text.insert(text.end(), { 0x00ui8, 0xC9ui8, 0x08ui8, 0xC8ui8, 0x44ui8, 0x0Fui8, 0xB6ui8, 0xF0ui8 });
+		break;
+	}
+
+	default:
+		return false;
+	}
+
+	return true;
+}
+
+inline void jit_code::__def_obj() noexcept
+{
+	_code_beg = (const uint8_t*)nullptr;
+	_code_end = (const uint8_t*)nullptr;
+
+	_text = (uint8_t*)nullptr;
+	_text_size = 0ui64;
+
+	_entry = (const uint8_t**)nullptr;
+}
+
+inline void jit_code::__del_obj() noexcept
+{
+	if (_text != (uint8_t*)nullptr)
+		munmap(_text, _text_size);
+
+	if (_entry != (const uint8_t**)nullptr)
+		delete[] _entry;
+}
+
+inline void jit_code::__mov_obj(jit_code&& o) noexcept
+{
+	_code_beg = move(o._code_beg);
+	_code_end = move(o._code_end);
+
+	_text = move(o._text);
+	_text_size = move(o._text_size);
+
+	_entry = move(o._entry);
+}
+
+void jit_code::__emit(vector<uint8_t>& text)
+{
+	const uint64_t code_size = (uint64_t)(_code_end - _code_beg);
+
+	vector<uint64_t> native(code_size, ~0ui64);
+	vector<text_fixup> fixups;
+
+	// Enter: void (jit_context* ctx, const uint8_t* entry)
+
+	emit_save(text);
+	text.insert(text.end(), { 0x49ui8, 0xBDui8 });
+	emit_64(text, (uint64_t)(uintptr_t)_entry);
+	text.push_back(0xE9ui8);
+	emit_32(text, 0ui32);
+
+	while (text.size() < _exit_pos)
+		text.push_back(0xCCui8);
+
+	// Exit at _exit_pos: rax holds the op to resume at
+
+	emit_store_ctx(text);
+
+	// Enter tail loads registers and jumps to the entry in rsi
+
+	const uint64_t load_pos = text.size();
+
+	emit_load_ctx(text);
+	text.insert(text.end(), { 0xFFui8, 0xE6ui8 });
+
+	// Indirect jump to the byte code address in rcx, leaves jitted code for addresses that are
+	// no op start
+
+	const uint64_t indirect_pos = text.size();
+
+	text.insert(text.end(), { 0x48ui8, 0x89ui8, 0xC8ui8 });
+	emit_imm(text, rdx, (uint64_t)(uintptr_t)_code_beg);
+	text.insert(text.end(), { 0x48ui8, 0x29ui8, 0xD0ui8 });
+	emit_imm(text, rdx, code_size);
+	text.insert(text.end(), { 0x48ui8, 0x39ui8, 0xD0ui8, 0x73ui8, 0x0Cui8 });
+	text.insert(text.end(), { 0x49ui8, 0x8Bui8, 0x44ui8, 0xC5ui8, 0x00ui8 });
+	text.insert(text.end(), { 0x48ui8, 0x85ui8, 0xC0ui8, 0x74ui8, 0x02ui8 });
+	text.insert(text.end(), { 0xFFui8, 0xE0ui8 });
+	text.insert(text.end(), { 0x48ui8, 0x89ui8, 0xC8ui8 });
+	text.push_back(0xE9ui8);
+	emit_32(text, 0ui32);
+	patch_32(text, text.size() - 4ui64, _exit_pos);
+
+	// Enter jumps over the exit to the register loads
+
+	patch_32(text, _enter_pos + 24ui64, load_pos);
+
+	for (const uint8_t* opptr = _code_beg; opptr < _code_end;)
+	{
+		const uint64_t size = decoded_code::get_size(opptr, _code_end);
+
+		native[opptr - _code_beg] = (uint64_t)text.size();
+
+		if (size == 0ui64)
+		{
+			emit_exit(text, opptr, _exit_pos);
+			++opptr;
+			continue;
+		}
+
+		const uint8_t* next = opptr + (ptrdiff_t)size;
+		const op op_code = get_template((op)*opptr);
+
+		switch (op_code)
+		{
+		case op::exit:
+			emit_mem(text, false, false, { 0xC6ui8 }, 0ui8, r12, ctx_exit);
+			text.push_back(1ui8);
+			emit_exit(text, opptr, _exit_pos);
+			break;
+
+		case op::call_64:
+		case op::call_32:
+		case op::call_16:
+		case op::call_8:
+			emit_call(text, next);
+			emit_jmp(text, fixups, next + (ptrdiff_t)fetch_offset(opptr + (ptrdiff_t)1, fetch_width(op_code, op::call_64)));
+			break;
+
+		case op::ret:
+			emit_ret(text);
+			text.push_back(0xE9ui8);
+			emit_32(text, 0ui32);
+			patch_32(text, text.size() - 4ui64, indirect_pos);
+			break;
+
+		case op::pop_flow:
+			emit_load(text, 8ui64, false, rcx, rbx, 0i32);
+			emit_stop(text, 8i64);
+			text.push_back(0xE9ui8);
+			emit_32(text, 0ui32);
+			patch_32(text, text.size() - 4ui64, indirect_pos);
+			break;
+
+		case op::jmp_64:
+		case op::jmp_32:
+		case op::jmp_16:
+		case op::jmp_8:
+			emit_jmp(text, fixups, next + (ptrdiff_t)fetch_offset(opptr + (ptrdiff_t)1, fetch_width(op_code, op::jmp_64)));
+			break;
+
+		case op::jmp_a_64:
+		case op::jmp_a_32:
+		case op::jmp_a_16:
+		case op::jmp_a_8:
+		case op::jmp_ae_64:
+		case op::jmp_ae_32:
+		case op::jmp_ae_16:
+		case op::jmp_ae_8:
+		case op::jmp_b_64:
+		case op::jmp_b_32:
+		case op::jmp_b_16:
+		case op::jmp_b_8:
+		case op::jmp_be_64:
+		case op::jmp_be_32:
+		case op::jmp_be_16:
+		case op::jmp_be_8:
+		case op::jmp_e_64:
+		case op::jmp_e_32:
+		case op::jmp_e_16:
+		case op::jmp_e_8:
+		case op::jmp_ne_64:
+		case op::jmp_ne_32:
+		case op::jmp_ne_16:
+		case op::jmp_ne_8:
+		case op::jmp_un_64:
+		case op::jmp_un_32:
+		case op::jmp_un_16:
+		case op::jmp_un_8:
+		{
+			const uint64_t group = ((uint64_t)op_code - (uint64_t)op::jmp_64) & ~3ui64;
+			const op op_64 = (op)((uint64_t)op::jmp_64 + group);
+			const uint8_t* target = next + (ptrdiff_t)fetch_offset(opptr + (ptrdiff_t)1, fetch_width(op_code, op_64));
+
+			emit_jcc(text, fixups, emit_cond(text, op_64), target);
+			break;
+		}
+
+		default:
+			if (!emit_op(text, opptr, next, op_code))
+				emit_exit(text, opptr, _exit_pos);
+
+			break;
+		}
+
+		opptr = next;
+	}
+
+	emit_exit(text, _code_end, _exit_pos);
+
+	// Branches to anything but an op start leave jitted code at their target
+
+	for (const text_fixup& fixup : fixups)
+	{
+		if (fixup.target >= _code_beg && fixup.target < _code_end && native[fixup.target - _code_beg] != ~0ui64)
+			patch_32(text, fixup.pos, native[fixup.target - _code_beg]);
+		else
+		{
+			patch_32(text, fixup.pos, text.size());
+			emit_exit(text, fixup.target, _exit_pos);
+		}
+	}
+
+	for (uint64_t i = 0ui64; i < code_size; ++i)
+		_entry[i] = native[i] == ~0ui64 ? (const uint8_t*)nullptr : (const uint8_t*)(uintptr_t)native[i];
+}
+
+jit_code::jit_code() noexcept
+{
+	__def_obj();
+}
+
+jit_code::jit_code(const uint8_t* bcode, const uint8_t* ecode)
+{
+	const uint64_t code_size = (uint64_t)(ecode - bcode);
+
+	__def_obj();
+
+	if (code_size >= (uint64_t)~0ui32)
+		throw runtime_error(_err_msg_large_code);
+	else
+	{
+		try
+		{
+			_code_beg = bcode;
+			_code_end = ecode;
+
+			_entry = (const uint8_t**)new const uint8_t*[code_size];
+
+			vector<uint8_t> text;
+			text.reserve(code_size * 16ui64 + 256ui64);
+
+			__emit(text);
+
+			void* data = mmap(nullptr, text.size(), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+			if (data == MAP_FAILED)
+				throw runtime_error(_err_msg_exec_map);
+
+			memcpy(data, text.data(), text.size());
+
+			_text = (uint8_t*)data;
+			_text_size = (uint64_t)text.size();
+
+			if (mprotect(data, text.size(), PROT_READ | PROT_EXEC) != 0)
+				throw runtime_error(_err_msg_exec_map);
+
+			// Entry table was filled with text offsets before the text had an address
+
+			for (uint64_t i = 0ui64; i < code_size; ++i)
+				if (_entry[i] != (const uint8_t*)nullptr)
+					_entry[i] = _text + (ptrdiff_t)(uintptr_t)_entry[i];
+		}
+		catch (const exception& e)
+		{
+			__del_obj();
+			__def_obj();
+
+			throw e;
+		}
+	}
+}
+
+jit_code::jit_code(jit_code&& o) noexcept
+{
+	__mov_obj(move(o));
+	o.__def_obj();
+}
+
+jit_code::~jit_code() noexcept
+{
+	__del_obj();
+	__def_obj();
+}
+
+jit_code& jit_code::operator=(jit_code&& o) noexcept
+{
+	if (this != &o)
+	{
+		__del_obj();
+		__mov_obj(move(o));
+		o.__def_obj();
+	}
+
+	return *this;
+}
+
+// Number of ops a fused or generated op covers, the interpreter runs all of them in one step
+
+static inline uint64_t get_length(op op_code)
+{
+	switch (op_code)
+	{
+	case op::s_ucmp_jmp_64:
+	case op::s_scmp_jmp_64:
+		return 4ui64;
+
+	case op::s_uinc_64:
+	case op::s_udec_64:
+	case op::s_uadd_64:
+		return 3ui64;
+
+	case op::s_move_64:
+		return 2ui64;
+
+	case op::gen_0:
+	case op::gen_1:
+	case op::gen_2:
+	case op::gen_3:
+	{
+		const op* seq = gen_ops[(uint64_t)op_code - (uint64_t)op::gen_0];
+		uint64_t length = 0ui64;
+
+		while (length < gen_length && seq[length] != op::nop)
+			++length;
+
+		return length;
+	}
+
+	default:
+		return 1ui64;
+	}
+}
+
+inline void trace_code::__def_obj() noexcept
+{
+	_code_beg = (const uint8_t*)nullptr;
+	_code_end = (const uint8_t*)nullptr;
+
+	_counts = (uint32_t*)nullptr;
+	_entry = (const uint8_t**)nullptr;
+
+	_texts.clear();
+	_steps.clear();
+	_anchor = (const uint8_t*)nullptr;
+}
+
+inline void trace_code::__del_obj() noexcept
+{
+	for (const trace_text& text : _texts)
+		munmap(text.text, text.size);
+
+	if (_counts != (uint32_t*)nullptr)
+		delete[] _counts;
+
+	if (_entry != (const uint8_t**)nullptr)
+		delete[] _entry;
+}
+
+inline void trace_code::__mov_obj(trace_code&& o) noexcept
+{
+	_code_beg = move(o._code_beg);
+	_code_end = move(o._code_end);
+
+	_counts = move(o._counts);
+	_entry = move(o._entry);
+
+	_texts = move(o._texts);
+	_steps = move(o._steps);
+	_anchor = move(o._anchor);
+}
+
+bool trace_code::__emit(vector<uint8_t>& text) const
+{
+	vector<text_fixup> fixups;
+
+	// Enter: void (jit_context* ctx), the loop starts right behind the register loads
+
+	emit_save(text);
+	emit_load_ctx(text);
+
+	const uint64_t loop_pos = text.size();
+
+	const uint8_t* leave = (const uint8_t*)nullptr;
+
+	for (uint64_t j = 0ui64; j < (uint64_t)_steps.size() && leave == (const uint8_t*)nullptr; ++j)
+	{
+		const trace_step& step = _steps[j];
+		const uint8_t* opptr = step.opptr;
+		const uint64_t length = get_length((op)*opptr);
+
+		// Fused and generated ops are compiled as the ops they cover, only the last may branch
+
+		for (uint64_t i = 0ui64; i < length && leave == (const uint8_t*)nullptr; ++i)
+		{
+			const uint64_t size = decoded_code::get_size(opptr, _code_end);
+
+			if (size == 0ui64)
+				return false;
+
+			const uint8_t* next = opptr + (ptrdiff_t)size;
+			const op op_code = get_template((op)*opptr);
+			const bool last = i + 1ui64 == length;
+
+			switch (op_code)
+			{
+			case op::call_64:
+			case op::call_32:
+			case op::call_16:
+			case op::call_8:
+				if (!last)
+					return false;
+
+				emit_call(text, next);
+				break;
+
+			case op::ret:
+				if (!last)
+					return false;
+
+				// Guard on the return address the recording returned to
+
+				emit_imm(text, rax, (uint64_t)(uintptr_t)step.next);
+				emit_mem(text, false, true, { 0x39ui8 }, rax, rbp, 8i32);
+				emit_jcc(text, fixups, 0x5ui8, opptr);
+				emit_ret(text);
+				break;
+
+			case op::jmp_64:
+			case op::jmp_32:
+			case op::jmp_16:
+			case op::jmp_8:
+				if (!last)
+					return false;
+
+				break;
+
+			case op::jmp_a_64:
+			case op::jmp_a_32:
+			case op::jmp_a_16:
+			case op::jmp_a_8:
+			case op::jmp_ae_64:
+			case op::jmp_ae_32:
+			case op::jmp_ae_16:
+			case op::jmp_ae_8:
+			case op::jmp_b_64:
+			case op::jmp_b_32:
+			case op::jmp_b_16:
+			case op::jmp_b_8:
+			case op::jmp_be_64:
+			case op::jmp_be_32:
+			case op::jmp_be_16:
+			case op::jmp_be_8:
+			case op::jmp_e_64:
+			case op::jmp_e_32:
+			case op::jmp_e_16:
+			case op::jmp_e_8:
+			case op::jmp_ne_64:
+			case op::jmp_ne_32:
+			case op::jmp_ne_16:
+			case op::jmp_ne_8:
+			case op::jmp_un_64:
+			case op::jmp_un_32:
+			case op::jmp_un_16:
+			case op::jmp_un_8:
+			{
+				if (!last)
+					return false;
+
+				const uint64_t group = ((uint64_t)op_code - (uint64_t)op::jmp_64) & ~3ui64;
+				const op op_64 = (op)((uint64_t)op::jmp_64 + group);
+				const uint8_t* target = next + (ptrdiff_t)fetch_offset(opptr + (ptrdiff_t)1, fetch_width(op_code, op_64));
+				const uint8_t cc = emit_cond(text, op_64);
+
+				// Guard leaves the trace for the direction the recording did not take
+
+				if (step.next == target && target != next)
+					emit_jcc(text, fixups, cc ^ 1ui8, next);
+				else
+					emit_jcc(text, fixups, cc, target);
+
+				break;
+			}
+
+			default:
+				if (!emit_op(text, opptr, next, op_code))
+				{
+					// Trace ends at an op without template and leaves for the interpreter there
+
+					if (text.size() == loop_pos)
+						return false;
+
+					leave = opptr;
+				}
+				else if (last && step.next != next)
+					return false;
+
+				break;
+			}
+
+			opptr = next;
+		}
+	}
+
+	// Trace closes at the anchor it started from
+
+	if (leave != (const uint8_t*)nullptr)
+		emit_jmp(text, fixups, leave);
+	else
+	{
+		text.push_back(0xE9ui8);
+		emit_32(text, 0ui32);
+		patch_32(text, text.size() - 4ui64, loop_pos);
+	}
+
+	const uint64_t exit_pos = text.size();
+
+	emit_store_ctx(text);
+
+	// Side exits, one per byte code address
+
+	vector<text_fixup> exits;
+
+	for (const text_fixup& fixup : fixups)
+	{
+		uint64_t pos = ~0ui64;
+
+		for (const text_fixup& exit : exits)
+			if (exit.target == fixup.target)
+				pos = exit.pos;
+
+		if (pos == ~0ui64)
+		{
+			pos = text.size();
+			exits.push_back(text_fixup{ pos, fixup.target });
+			emit_exit(text, fixup.target, exit_pos);
+		}
+
+		patch_32(text, fixup.pos, pos);
+	}
+
+	return true;
+}
+
+void trace_code::__compile()
+{
+	vector<uint8_t> text;
+	text.reserve(_steps.size() * 32ui64 + 256ui64);
+
+	const bool emitted = __emit(text);
+	const uint8_t* anchor = _anchor;
+
+	abort();
+
+	if (emitted)
+	{
+		void* data = mmap(nullptr, text.size(), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+		if (data == MAP_FAILED)
+			throw runtime_error(_err_msg_exec_map);
+
+		memcpy(data, text.data(), text.size());
+		_texts.push_back(trace_text{ (uint8_t*)data, (uint64_t)text.size() });
+
+		if (mprotect(data, text.size(), PROT_READ | PROT_EXEC) != 0)
+			throw runtime_error(_err_msg_exec_map);
+
+		_entry[anchor - _code_beg] = (const uint8_t*)data;
+	}
+}
+
+trace_code::trace_code() noexcept
+{
+	__def_obj();
+}
+
+trace_code::trace_code(const uint8_t* bcode, const uint8_t* ecode)
+{
+	const uint64_t code_size = (uint64_t)(ecode - bcode);
+
+	__def_obj();
+
+	if (code_size >= (uint64_t)~0ui32)
+		throw runtime_error(_err_msg_large_code);
+	else
+	{
+		try
+		{
+			_code_beg = bcode;
+			_code_end = ecode;
+
+			_counts = (uint32_t*)new uint32_t[code_size];
+			memset(_counts, 0ui8, (uint64_t)sizeof(uint32_t) * code_size);
+
+			_entry = (const uint8_t**)new const uint8_t*[code_size];
+			memset(_entry, 0ui8, (uint64_t)sizeof(const uint8_t*) * code_size);
+		}
+		catch (const exception& e)
+		{
+			__del_obj();
+			__def_obj();
+
+			throw e;
+		}
+	}
+}
+
+trace_code::trace_code(trace_code&& o) noexcept
+{
+	__mov_obj(move(o));
+	o.__def_obj();
+}
+
+trace_code::~trace_code() noexcept
+{
+	__del_obj();
+	__def_obj();
+}
+
+void trace_code::record(const uint8_t* last, const uint8_t* opptr)
+{
+	_steps.push_back(trace_step{ last, opptr });
+
+	if (opptr == _anchor)
+		__compile();
+	else if ((uint64_t)_steps.size() >= _max_steps)
+		abort();
+}
+
+trace_code& trace_code::operator=(trace_code&& o) noexcept
+{
+	if (this != &o)
+	{
+		__del_obj();
+		__mov_obj(move(o));
+		o.__def_obj();
+	}
+
+	return *this;
+}
+#endif
\ No newline at end of file
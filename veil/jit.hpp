@@ -0,0 +1,211 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "decode.hpp"
+#include "define.hpp"
+#include "interpreter_type.hpp"
+#include "op.hpp"
+
+#ifdef X64JIT
+namespace interpreter
+{
+	// jit_context - machine state jitted code is entered with and returns
+	//
+	//               stop, ftop - stack registers
+	//               opptr      - op to resume at, exit op or op without template
+	//               comp       - comparison flags, above in bit 0 and below in bit 1
+	//               eval       - evaluation flags, kept as they are by jit_code
+	//               exit       - exit op was reached
+
+	struct jit_context
+	{
+		uintptr_t stop;
+		uintptr_t ftop;
+		const uint8_t* opptr;
+		uint8_t comp;
+		uint8_t eval;
+		bool exit;
+	};
+
+	// jit_code - baseline x86-64 translation of byte code, one fixed template per op with the
+	//            stack top in rbx and the frame top in rbp; ops without a template leave jitted
+	//            code for the interpreter, which runs them and enters jitted code again
+
+	class jit_code
+	{
+	private:
+		static constexpr const char _err_msg_exec_map[] = "Executable memory mapping failed";
+		static constexpr const char _err_msg_large_code[] = "Code size is too large";
+
+		const uint8_t* _code_beg;
+		const uint8_t* _code_end;
+
+		uint8_t* _text;
+		uint64_t _text_size;
+
+		// Native address of every op start, null inside instructions
+
+		const uint8_t** _entry;
+
+		inline void __def_obj() noexcept;
+		inline void __del_obj() noexcept;
+		inline void __mov_obj(jit_code&& o) noexcept;
+
+		void __emit(std::vector<uint8_t>& text);
+
+	public:
+		jit_code() noexcept;
+		jit_code(const uint8_t* bcode, const uint8_t* ecode);
+		jit_code(const jit_code& o) = delete;
+		jit_code(jit_code&& o) noexcept;
+		~jit_code() noexcept;
+
+		inline bool empty() const noexcept
+		{
+			return _text == (uint8_t*)nullptr;
+		}
+
+		inline const uint8_t* get_entry(const uint8_t* opptr) const noexcept
+		{
+			if (opptr < _code_beg || opptr >= _code_end)
+				return (const uint8_t*)nullptr;
+			else
+				return _entry[opptr - _code_beg];
+		}
+
+		inline void run(const uint8_t* entry, jit_context& ctx) const
+		{
+			((void (*)(jit_context*, const uint8_t*))_text)(&ctx, entry);
+		}
+
+		jit_code& operator=(const jit_code& o) = delete;
+		jit_code& operator=(jit_code&& o) noexcept;
+	};
+
+	// trace_code - hot loops recorded from the interpreter and compiled to straight x86-64 with
+	//              the jit_code templates; a backward branch whose target is reached hot_count
+	//              times starts recording at that target, the recorded ops up to the target again
+	//              become one trace with guards on the recorded branch directions, a failed guard
+	//              leaves the trace for the interpreter at the op it stopped before
+
+	class trace_code
+	{
+	private:
+		static constexpr const char _err_msg_exec_map[] = "Executable memory mapping failed";
+		static constexpr const char _err_msg_large_code[] = "Code size is too large";
+
+		static constexpr uint32_t _hot_count = 64ui32;
+		static constexpr uint64_t _max_steps = 256ui64;
+
+		// Op the interpreter ran and the op it went on to, next tells the branch direction
+
+		struct trace_step
+		{
+			const uint8_t* opptr;
+			const uint8_t* next;
+		};
+
+		struct trace_text
+		{
+			uint8_t* text;
+			uint64_t size;
+		};
+
+		const uint8_t* _code_beg;
+		const uint8_t* _code_end;
+
+		// Backward branch hits of every target, ~0 once tracing it failed
+
+		uint32_t* _counts;
+
+		// Native address of the trace anchored at every op, null for most
+
+		const uint8_t** _entry;
+
+		std::vector<trace_text> _texts;
+		std::vector<trace_step> _steps;
+		const uint8_t* _anchor;
+
+		inline void __def_obj() noexcept;
+		inline void __del_obj() noexcept;
+		inline void __mov_obj(trace_code&& o) noexcept;
+
+		bool __emit(std::vector<uint8_t>& text) const;
+		void __compile();
+
+	public:
+		trace_code() noexcept;
+		trace_code(const uint8_t* bcode, const uint8_t* ecode);
+		trace_code(const trace_code& o) = delete;
+		trace_code(trace_code&& o) noexcept;
+		~trace_code() noexcept;
+
+		inline bool empty() const noexcept
+		{
+			return _entry == (const uint8_t**)nullptr;
+		}
+
+		inline bool recording() const noexcept
+		{
+			return _anchor != (const uint8_t*)nullptr;
+		}
+
+		// Traces are not entered while another is recorded, the recording goes through them
+
+		inline const uint8_t* get_entry(const uint8_t* opptr) const noexcept
+		{
+			if (_anchor != (const uint8_t*)nullptr || opptr < _code_beg || opptr >= _code_end)
+				return (const uint8_t*)nullptr;
+			else
+				return _entry[opptr - _code_beg];
+		}
+
+		// Counts the interpreter going from the op at last to opptr
+
+		inline void hit(const uint8_t* last, const uint8_t* opptr) noexcept
+		{
+			if (opptr <= last && opptr >= _code_beg && is_branch((op)*last))
+			{
+				uint32_t& count = _counts[opptr - _code_beg];
+
+				if (count != ~0ui32 && ++count >= _hot_count)
+				{
+					count = ~0ui32;
+					_anchor = opptr;
+				}
+			}
+		}
+
+		void record(const uint8_t* last, const uint8_t* opptr);
+
+		inline void abort() noexcept
+		{
+			_steps.clear();
+			_anchor = (const uint8_t*)nullptr;
+		}
+
+		inline void run(const uint8_t* entry, jit_context& ctx) const
+		{
+			((void (*)(jit_context*))entry)(&ctx);
+		}
+
+		static inline bool is_branch(op op_code) noexcept
+		{
+			op_code = decoded_code::get_base(op_code);
+
+			return ((uint8_t)op_code >= (uint8_t)op::jmp_64 && (uint8_t)op_code <= (uint8_t)op::jmp_msk_8)
+				|| op_code == op::s_ucmp_jmp_64 || op_code == op::s_scmp_jmp_64;
+		}
+
+		trace_code& operator=(const trace_code& o) = delete;
+		trace_code& operator=(trace_code&& o) noexcept;
+	};
+}
+#endif
\ No newline at end of file
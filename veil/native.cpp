@@ -1,6 +1,14 @@
 #include "native.hpp"
 
 #include "arch_define.hpp"
+#include "decode.hpp"
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
 
 using namespace interpreter;
 using namespace std;
@@ -10,29 +18,18 @@ inline void nativecall::__cpy_obj(const nativecall& o)
 	_abi_type = o._abi_type;
 	_arg_count = o._arg_count;
 
-	_arg_io_type = (arg_type*)new arg_type[_arg_count];
-	memcpy(_arg_io_type, o._arg_io_type, (uint64_t)sizeof(arg_type) * _arg_count);
-	_ret_io_type = o._ret_io_type;
+	alloc();
+	memcpy(_block, o._block, get_block_size(_arg_count));
 
-	_arg_type = (ffi_type**)new ffi_type * [_arg_count];
-	memcpy(_arg_type, o._arg_type, (uint64_t)sizeof(ffi_type*) * _arg_count);
+	_ret_io_type = o._ret_io_type;
 	_ret_type = o._ret_type;
 
-	_arg_val = (void**)new void* [_arg_count];
-	for (uint64_t i = 0ui64; i < _arg_count; ++i)
-		if (o._arg_val[i] == (void*)nullptr)
-			_arg_val[i] = (void*)nullptr;
-		else
-		{
-			_arg_val[i] = get_val(_arg_io_type[i]);
-			memcpy(_arg_val[i], o._arg_val[i], get_asize(_arg_io_type[i]));
-		}
-
-	uint64_t ret_val_size = get_rsize(_ret_io_type);
-	_ret_val = (void*)new uint8_t[ret_val_size];
-	memcpy(_ret_val, o._ret_val, ret_val_size);
-
 	_cif = o._cif;
+	_cif.arg_types = _arg_type;
+#ifdef SYSVTRAMP
+
+	_trampoline = o._trampoline;
+#endif
 }
 
 inline void nativecall::__def_obj() noexcept
@@ -50,27 +47,18 @@ inline void nativecall::__def_obj() noexcept
 	_ret_val = (void*)nullptr;
 
 	memset(&_cif, 0ui8, (uint64_t)sizeof(ffi_cif));
+
+	_block = (uint8_t*)nullptr;
+#ifdef SYSVTRAMP
+
+	_trampoline = (trampoline)nullptr;
+#endif
 }
 
 inline void nativecall::__del_obj() noexcept
 {
-	if (_arg_io_type != (arg_type*)nullptr)
-		delete[] _arg_io_type;
-
-	if (_arg_type != (ffi_type**)nullptr)
-		delete[] _arg_type;
-
-	if (_arg_val != (void**)nullptr)
-	{
-		for (uint64_t i = 0ui64; i < _arg_count; ++i)
-			if (_arg_val[i] != (void*)nullptr)
-				delete _arg_val[i];
-
-		delete[] _arg_val;
-	}
-
-	if (_ret_val != (void*)nullptr)
-		delete[] _ret_val;
+	if (_block != (uint8_t*)nullptr && _block != _inline)
+		delete[] _block;
 }
 
 inline void nativecall::__mov_obj(nativecall&& o) noexcept
@@ -78,16 +66,27 @@ inline void nativecall::__mov_obj(nativecall&& o) noexcept
 	_abi_type = move(o._abi_type);
 	_arg_count = move(o._arg_count);
 
-	_arg_io_type = move(o._arg_io_type);
-	_ret_io_type = move(o._ret_io_type);
+	// An inline block moves with the object, so do the arrays in it and the ffi_cif pointing to them
 
-	_arg_type = move(o._arg_type);
-	_ret_type = move(o._ret_type);
+	if (o._block == o._inline)
+	{
+		memcpy(_inline, o._inline, get_block_size(_arg_count));
+		_block = _inline;
+	}
+	else
+		_block = move(o._block);
 
-	_arg_val = move(o._arg_val);
-	_ret_val = move(o._ret_val);
+	map();
+
+	_ret_io_type = move(o._ret_io_type);
+	_ret_type = move(o._ret_type);
 
 	_cif = move(o._cif);
+	_cif.arg_types = _arg_type;
+#ifdef SYSVTRAMP
+
+	_trampoline = move(o._trampoline);
+#endif
 }
 
 inline ffi_abi nativecall::get_abi(abi_type type)
@@ -225,29 +224,9 @@ inline ffi_abi nativecall::get_abi(abi_type type)
 	}
 }
 
-inline uint64_t nativecall::get_asize(arg_type type)
-{
-	switch (type.outer)
-	{
-	case arg_o_type::__void: return 0ui64;
-	case arg_o_type::__flt64: return (uint64_t)sizeof(double);
-	case arg_o_type::__sint64: return (uint64_t)sizeof(int64_t);
-	case arg_o_type::__uint64: return (uint64_t)sizeof(uint64_t);
-	case arg_o_type::__flt32: return (uint64_t)sizeof(float);
-	case arg_o_type::__sint32: return (uint64_t)sizeof(int32_t);
-	case arg_o_type::__uint32: return (uint64_t)sizeof(uint32_t);
-	case arg_o_type::__sint16: return (uint64_t)sizeof(int16_t);
-	case arg_o_type::__uint16: return (uint64_t)sizeof(uint16_t);
-	case arg_o_type::__sint8: return (uint64_t)sizeof(int8_t);
-	case arg_o_type::__uint8: return (uint64_t)sizeof(uint8_t);
-	case arg_o_type::__ptr: return (uint64_t)sizeof(void*);
-	default: throw runtime_error(_err_msg_wrong_type);
-	}
-}
-
-inline uint64_t nativecall::get_rsize(arg_type type)
+inline uint64_t nativecall::get_block_size(uint64_t count) noexcept
 {
-	return max(get_asize(type), (uint64_t)sizeof(ffi_arg)) / (uint64_t)sizeof(uint8_t);
+	return count * _arg_size + _slot_size;
 }
 
 inline ffi_type* nativecall::get_type(arg_type type)
@@ -270,51 +249,241 @@ inline ffi_type* nativecall::get_type(arg_type type)
 	}
 }
 
-inline void* nativecall::get_val(arg_type type)
+inline void nativecall::alloc()
+{
+	_block = _arg_count <= _inline_count ? _inline : (uint8_t*)new uint8_t[get_block_size(_arg_count)];
+	map();
+}
+
+inline void nativecall::init()
+{
+	for (uint64_t i = 0ui64; i < _arg_count; ++i)
+		_arg_type[i] = get_type(_arg_io_type[i]);
+
+	_ret_type = get_type(_ret_io_type);
+
+	ffi_prep_cif(&_cif, get_abi(_abi_type), (unsigned int)_arg_count, _ret_type, _arg_type);
+#ifdef SYSVTRAMP
+
+	_trampoline = get_trampoline();
+#endif
+}
+
+// Block layout: ffi types, value pointers, argument buffers, return value buffer, io types
+
+#ifdef SYSVTRAMP
+// 0 for 64-bit integers and pointers, 1 for doubles, ~0 for what needs a conversion or other registers
+
+inline uint64_t nativecall::get_tramp_class(arg_type type) noexcept
 {
 	switch (type.outer)
 	{
-	case arg_o_type::__void: return (void*)nullptr;
-	case arg_o_type::__flt64: return (void*)new double;
-	case arg_o_type::__sint64: return (void*)new int64_t;
-	case arg_o_type::__uint64: return (void*)new uint64_t;
-	case arg_o_type::__flt32: return (void*)new float;
-	case arg_o_type::__sint32: return (void*)new int32_t;
-	case arg_o_type::__uint32: return (void*)new uint32_t;
-	case arg_o_type::__sint16: return (void*)new int16_t;
-	case arg_o_type::__uint16: return (void*)new uint16_t;
-	case arg_o_type::__sint8: return (void*)new int8_t;
-	case arg_o_type::__uint8: return (void*)new uint8_t;
-	case arg_o_type::__ptr: return (void*)new void*;
-	default: throw runtime_error(_err_msg_wrong_type);
+	case arg_o_type::__flt64: return type.inner == arg_i_type::__val64f ? 1ui64 : ~0ui64;
+	case arg_o_type::__sint64:
+	case arg_o_type::__uint64: return type.inner == arg_i_type::__val64s || type.inner == arg_i_type::__val64u ? 0ui64 : ~0ui64;
+	case arg_o_type::__ptr: return type.inner == arg_i_type::__ptr ? 0ui64 : ~0ui64;
+	default: return ~0ui64;
 	}
 }
 
-inline void nativecall::init()
+inline nativecall::trampoline nativecall::get_trampoline() const noexcept
 {
-	_arg_type = (ffi_type**)new ffi_type * [_arg_count];
-	_arg_val = (void**)new void* [_arg_count];
+	static constexpr array<trampoline, 3ui64 * _tramp_lists> tramps = get_tramps(make_integer_sequence<uint64_t, 3ui64 * _tramp_lists>());
+
+	if ((_abi_type != abi_type::NONE && _abi_type != abi_type::UNIX64) || _arg_count > _tramp_count)
+		return (trampoline)nullptr;
+
+	uint64_t mask = 0ui64;
 
 	for (uint64_t i = 0ui64; i < _arg_count; ++i)
 	{
-		_arg_type[i] = get_type(_arg_io_type[i]);
-		_arg_val[i] = get_val(_arg_io_type[i]);
+		const uint64_t arg_class = get_tramp_class(_arg_io_type[i]);
+
+		if (arg_class == ~0ui64)
+			return (trampoline)nullptr;
+		else
+			mask |= arg_class << i;
 	}
 
-	_ret_type = get_type(_ret_io_type);
-	_ret_val = (void*)new uint8_t[get_rsize(_ret_io_type)];
+	uint64_t ret = 0ui64;
 
-	ffi_prep_cif(&_cif, get_abi(_abi_type), (unsigned int)_arg_count, _ret_type, _arg_type);
+	if (_ret_io_type.inner != arg_i_type::__void || _ret_io_type.outer != arg_o_type::__void)
+	{
+		const uint64_t ret_class = get_tramp_class(_ret_io_type);
+
+		if (ret_class == ~0ui64)
+			return (trampoline)nullptr;
+		else
+			ret = ret_class + 1ui64;
+	}
+
+	return tramps[ret * _tramp_lists + (1ui64 << _arg_count) - 1ui64 + mask];
+}
+
+#endif
+void nativecall::call_n(uintptr_t native_ptr, uint64_t count, const uint8_t* const* column, uint8_t* result)
+{
+	const uint64_t ret_size = result != (uint8_t*)nullptr ? (uint64_t)_cif.rtype->size : 0ui64;
+#ifdef SYSVTRAMP
+
+	// Columns of trampoline calls hold 64-bit elements only
+
+	if (_trampoline != (trampoline)nullptr)
+	{
+		uint64_t arg[_tramp_count];
+
+		for (uint64_t i = 0ui64; i < count; ++i)
+		{
+			for (uint64_t j = 0ui64; j < _arg_count; ++j)
+				arg[j] = ((const uint64_t*)column[j])[i];
+
+			const uint64_t ret = _trampoline(native_ptr, arg);
+
+			if (ret_size != 0ui64)
+				((uint64_t*)result)[i] = ret;
+		}
+
+		return;
+	}
+#endif
+
+	// Arguments are passed from the columns in place, no element is converted or copied
+
+	void* arg_val[256ui64];
+
+	for (uint64_t i = 0ui64; i < count; ++i)
+	{
+		for (uint64_t j = 0ui64; j < _arg_count; ++j)
+			arg_val[j] = (void*)(column[j] + (ptrdiff_t)(i * (uint64_t)_arg_type[j]->size));
+
+		ffi_call(&_cif, (void (*)())native_ptr, _ret_val, arg_val);
+
+		if (ret_size != 0ui64)
+			memcpy(result + (ptrdiff_t)(i * ret_size), _ret_val, ret_size);
+	}
+}
+
+inline void nativecall::map() noexcept
+{
+	uint8_t* data = _block;
+
+	_arg_type = (ffi_type**)data;
+	data += (ptrdiff_t)((uint64_t)sizeof(ffi_type*) * _arg_count);
+
+	_arg_val = (void**)data;
+	data += (ptrdiff_t)((uint64_t)sizeof(void*) * _arg_count);
+
+	for (uint64_t i = 0ui64; i < _arg_count; ++i)
+	{
+		_arg_val[i] = (void*)data;
+		data += (ptrdiff_t)_slot_size;
+	}
+
+	_ret_val = (void*)data;
+	data += (ptrdiff_t)_slot_size;
+
+	_arg_io_type = (arg_type*)data;
+}
+
+inline void nativecall::push_value(stack<>& stack, arg_type type, void* mem)
+{
+	switch (type.inner)
+	{
+	case arg_i_type::__void: break;
+	case arg_i_type::__val64f: stack.push(val64<>(convert<double>(mem, type.outer))); break;
+	case arg_i_type::__val64s: stack.push(val64<>(convert<int64_t>(mem, type.outer))); break;
+	case arg_i_type::__val64u: stack.push(val64<>(convert<uint64_t>(mem, type.outer))); break;
+	case arg_i_type::__val32f: stack.push(val32<>(convert<float>(mem, type.outer))); break;
+	case arg_i_type::__val32s: stack.push(val32<>(convert<int32_t>(mem, type.outer))); break;
+	case arg_i_type::__val32u: stack.push(val32<>(convert<uint32_t>(mem, type.outer))); break;
+	case arg_i_type::__val16s: stack.push(val16<>(convert<int16_t>(mem, type.outer))); break;
+	case arg_i_type::__val16u: stack.push(val16<>(convert<uint16_t>(mem, type.outer))); break;
+	case arg_i_type::__val8s: stack.push(val8<>(convert<int8_t>(mem, type.outer))); break;
+	case arg_i_type::__val8u: stack.push(val8<>(convert<uint8_t>(mem, type.outer))); break;
+	case arg_i_type::__ptr:
+		if (type.outer == arg_o_type::__ptr)
+		{
+			stack.push_ptr((uintptr_t) * ((void**)mem));
+			break;
+		}
+		// else fall to default: throw
+		[[fallthrough]];
+	default: throw runtime_error(_err_msg_wrong_type);
+	}
+}
+
+inline void nativecall::pop_value(stack<>& stack, arg_type type, void* mem)
+{
+	switch (type.inner)
+	{
+	case arg_i_type::__void: convert(mem, type.outer, 0ui8); break;
+	case arg_i_type::__val64f: convert(mem, type.outer, stack.pop<val64<>>().f); break;
+	case arg_i_type::__val64s: convert(mem, type.outer, stack.pop<val64<>>().si); break;
+	case arg_i_type::__val64u: convert(mem, type.outer, stack.pop<val64<>>().ui); break;
+	case arg_i_type::__val32f: convert(mem, type.outer, stack.pop<val32<>>().f); break;
+	case arg_i_type::__val32s: convert(mem, type.outer, stack.pop<val32<>>().si); break;
+	case arg_i_type::__val32u: convert(mem, type.outer, stack.pop<val32<>>().ui); break;
+	case arg_i_type::__val16s: convert(mem, type.outer, stack.pop<val16<>>().si); break;
+	case arg_i_type::__val16u: convert(mem, type.outer, stack.pop<val16<>>().ui); break;
+	case arg_i_type::__val8s: convert(mem, type.outer, stack.pop<val8<>>().si); break;
+	case arg_i_type::__val8u: convert(mem, type.outer, stack.pop<val8<>>().ui); break;
+	case arg_i_type::__ptr:
+		if (type.outer == arg_o_type::__ptr)
+		{
+			*((void**)mem) = (void*)stack.pop_ptr();
+			break;
+		}
+		// else fall to default: throw
+		[[fallthrough]];
+	default: throw runtime_error(_err_msg_wrong_type);
+	}
+}
+
+void nativecall::push_args(stack<>& stack, void* const* arg_val) const
+{
+	// Return value slot starts zeroed whatever its outer type is
+
+	uint64_t zero[2ui64] = { 0ui64, 0ui64 };
+
+	push_value(stack, _ret_io_type, (void*)zero);
+
+	for (uint64_t i = _arg_count; i != 0ui64; --i)
+		push_value(stack, _arg_io_type[i - 1ui64], arg_val[i - 1ui64]);
+}
+
+void nativecall::pop_ret(stack<>& stack, void* ret_val) const
+{
+	uint64_t scratch[2ui64];
+
+	for (uint64_t i = 0ui64; i < _arg_count; ++i)
+		pop_value(stack, _arg_io_type[i], (void*)scratch);
+
+	pop_value(stack, _ret_io_type, ret_val);
+
+	// Closures return integers narrower than ffi_arg widened to it
+
+	switch (_ret_io_type.outer)
+	{
+	case arg_o_type::__sint32: *((ffi_sarg*)ret_val) = (ffi_sarg) * ((int32_t*)ret_val); break;
+	case arg_o_type::__uint32: *((ffi_arg*)ret_val) = (ffi_arg) * ((uint32_t*)ret_val); break;
+	case arg_o_type::__sint16: *((ffi_sarg*)ret_val) = (ffi_sarg) * ((int16_t*)ret_val); break;
+	case arg_o_type::__uint16: *((ffi_arg*)ret_val) = (ffi_arg) * ((uint16_t*)ret_val); break;
+	case arg_o_type::__sint8: *((ffi_sarg*)ret_val) = (ffi_sarg) * ((int8_t*)ret_val); break;
+	case arg_o_type::__uint8: *((ffi_arg*)ret_val) = (ffi_arg) * ((uint8_t*)ret_val); break;
+	default: break;
+	}
 }
 
 nativecall::nativecall(const uint8_t*& opptr)
 {
+	__def_obj();
+
 	try
 	{
 		_abi_type = (abi_type)fetch_without_check<val8<>>(opptr).ui;
 		_arg_count = (uint64_t)fetch_without_check<val8<>>(opptr).ui;
 
-		_arg_io_type = (arg_type*)new arg_type[_arg_count];
+		alloc();
 		fetch_without_check<val8<>>(opptr, (uint8_t*)_arg_io_type, _arg_count);
 		_ret_io_type = arg_type_val<>(fetch_without_check<val8<>>(opptr)).__arg_type;
 
@@ -331,12 +500,14 @@ nativecall::nativecall(const uint8_t*& opptr)
 
 nativecall::nativecall(const uint8_t*& opptr, const uint8_t* bcode, const uint8_t* ecode)
 {
+	__def_obj();
+
 	try
 	{
 		_abi_type = (abi_type)fetch_with_check<val8<>>(opptr, bcode, ecode).ui;
 		_arg_count = (uint64_t)fetch_with_check<val8<>>(opptr, bcode, ecode).ui;
 
-		_arg_io_type = (arg_type*)new arg_type[_arg_count];
+		alloc();
 		fetch_with_check<val8<>>(opptr, (uint8_t*)_arg_io_type, _arg_count, bcode, ecode);
 		_ret_io_type = arg_type_val<>(fetch_with_check<val8<>>(opptr, bcode, ecode)).__arg_type;
 
@@ -353,6 +524,8 @@ nativecall::nativecall(const uint8_t*& opptr, const uint8_t* bcode, const uint8_
 
 nativecall::nativecall(const nativecall& o)
 {
+	__def_obj();
+
 	try
 	{
 		__cpy_obj(o);
@@ -378,24 +551,6 @@ nativecall::~nativecall() noexcept
 	__def_obj();
 }
 
-void nativecall::prep(const uint8_t*& opptr)
-{
-	fetch_without_check<val8<>>(opptr).ui;
-	fetch_without_check<val8<>>(opptr).ui;
-
-	fetch_without_check<val8<>>(opptr, (uint8_t*)_arg_io_type, _arg_count);
-	_ret_io_type = arg_type_val<>(fetch_without_check<val8<>>(opptr)).__arg_type;
-}
-
-void nativecall::prep(const uint8_t*& opptr, const uint8_t* bcode, const uint8_t* ecode)
-{
-	fetch_with_check<val8<>>(opptr, bcode, ecode).ui;
-	fetch_with_check<val8<>>(opptr, bcode, ecode).ui;
-
-	fetch_with_check<val8<>>(opptr, (uint8_t*)_arg_io_type, _arg_count, bcode, ecode);
-	_ret_io_type = arg_type_val<>(fetch_with_check<val8<>>(opptr, bcode, ecode)).__arg_type;
-}
-
 nativecall& nativecall::operator=(const nativecall& o)
 {
 	try
@@ -423,18 +578,309 @@ nativecall& nativecall::operator=(nativecall&& o) noexcept
 	return *this;
 }
 
-nativehub::nativehub(uint64_t size) : _cache(), _queue(), _count(0ui64), _size(size) {}
+void nativecallback::handler(ffi_cif* cif, void* ret_val, void** arg_val, void* user_data)
+{
+	const nativecallback& callback = *((const nativecallback*)user_data);
+	nativehub& hub = *callback._hub;
+
+	// Return value is zeroed for callbacks that throw, libffi widens integers under ffi_arg
+
+	const uint64_t size = (uint64_t)cif->rtype->size;
+
+	memset(ret_val, 0ui8, size < (uint64_t)sizeof(ffi_arg) ? (uint64_t)sizeof(ffi_arg) : size);
+
+	++hub._nested;
+	hub._enter(hub._context, callback, ret_val, arg_val);
+	--hub._nested;
+}
+
+nativecallback::nativecallback(const uint8_t* site, const uint8_t* entry, nativecall&& call, nativehub* hub)
+	: _site(site), _entry(entry), _call(move(call)), _closure((ffi_closure*)nullptr), _code((void*)nullptr), _hub(hub)
+{
+	_closure = (ffi_closure*)ffi_closure_alloc((uint64_t)sizeof(ffi_closure), &_code);
+
+	if (_closure == (ffi_closure*)nullptr)
+		throw runtime_error(_err_msg_closure);
+	else if (ffi_prep_closure_loc(_closure, _call.get_cif(), &handler, (void*)this, _code) != FFI_OK)
+	{
+		ffi_closure_free(_closure);
+		throw runtime_error(_err_msg_closure);
+	}
+}
+
+nativecallback::~nativecallback() noexcept
+{
+	if (_closure != (ffi_closure*)nullptr)
+		ffi_closure_free(_closure);
+}
+
+nativeentry& nativehub::add(uint64_t hash, nativecall&& v)
+{
+	if ((uint64_t)_entries.size() < _size)
+	{
+		// Entries move when the table grows, so do the ones sites point to
+
+		if (_entries.size() == _entries.capacity())
+			++_epoch;
+
+		_entries.push_back(nativeentry{ hash, move(v), false });
+
+		if ((uint64_t)_index.size() < (uint64_t)_entries.size() * 2ui64)
+			rehash(max(_index_min, (uint64_t)_index.size() * 2ui64));
+		else
+			place(hash, (uint64_t)_entries.size() - 1ui64);
+
+		return _entries.back();
+	}
+	else
+	{
+		// CLOCK gives every referenced entry the hand passes a second chance
+
+		while (_entries[_hand].referenced)
+		{
+			_entries[_hand].referenced = false;
+			_hand = (_hand + 1ui64) % (uint64_t)_entries.size();
+		}
+
+		nativeentry& entry = _entries[_hand];
+		const uint64_t mask = (uint64_t)_index.size() - 1ui64;
+		uint64_t pos = entry.hash & mask;
+
+		while (_index[pos] != _hand)
+			pos = (pos + 1ui64) & mask;
+
+		erase(pos);
+
+		entry.hash = hash;
+		entry.call = move(v);
+
+		place(hash, _hand);
+		_hand = (_hand + 1ui64) % (uint64_t)_entries.size();
+
+		++_epoch;
+		++_evictions;
+
+		return entry;
+	}
+}
+
+void nativehub::erase(uint64_t pos) noexcept
+{
+	const uint64_t mask = (uint64_t)_index.size() - 1ui64;
+
+	// Backward shift, later slots of the probe sequence move into the hole unless it would put
+	// them before their home slot
+
+	_index[pos] = ~0ui64;
+
+	for (uint64_t i = (pos + 1ui64) & mask; _index[i] != ~0ui64; i = (i + 1ui64) & mask)
+	{
+		const uint64_t home = _entries[_index[i]].hash & mask;
+
+		if (((i - home) & mask) >= ((i - pos) & mask))
+		{
+			_index[pos] = _index[i];
+			_index[i] = ~0ui64;
+			pos = i;
+		}
+	}
+}
+
+void nativehub::import_section(const uint8_t* bcode, const uint8_t* ecode)
+{
+	const uint8_t* opptr = bcode;
+
+	while (opptr < ecode)
+	{
+		if (opptr + (ptrdiff_t)2 > ecode)
+			throw runtime_error(_err_msg_fetch_code);
+
+		const uint64_t index = (uint64_t)((const val16<>*)opptr)->ui;
+		const uint8_t* call_ptr = opptr += (ptrdiff_t)2;
+
+		nativecall call(opptr, bcode, ecode);
+		string library = fetch_name(opptr, ecode);
+		string symbol = fetch_name(opptr, ecode);
+
+		// Inlining copies the code an import section is in, its entries are defined again
+
+		if (index < (uint64_t)_imports.size() && _imports[index].has_value())
+		{
+			const nativeimport& entry = _imports[index].value();
+
+			if (!entry.call.is_same(call_ptr) || entry.library != library || entry.symbol != symbol)
+				throw runtime_error(_err_msg_wrong_import);
+		}
+		else
+		{
+			if (index >= (uint64_t)_imports.size())
+				_imports.resize(index + 1ui64);
+
+			const uintptr_t target = resolve(library, symbol);
+			const uint64_t pop = call.get_pop();
+			const uint64_t push = call.get_push();
+
+			_imports[index].emplace(nativeimport{ move(library), move(symbol), move(call), target, pop, push });
+		}
+	}
+}
+
+void nativehub::place(uint64_t hash, uint64_t i) noexcept
+{
+	const uint64_t mask = (uint64_t)_index.size() - 1ui64;
+	uint64_t pos = hash & mask;
+
+	while (_index[pos] != ~0ui64)
+		pos = (pos + 1ui64) & mask;
+
+	_index[pos] = i;
+}
+
+void nativehub::rehash(uint64_t size)
+{
+	_index.assign(size, ~0ui64);
+
+	for (uint64_t i = 0ui64; i < (uint64_t)_entries.size(); ++i)
+		place(_entries[i].hash, i);
+}
+
+nativehub::nativehub(uint64_t size)
+	: _entries(), _index(), _sites(), _hosts(), _imports(), _libraries(), _callbacks(), _context((void*)nullptr), _enter((nativecallback::enter_type)nullptr),
+	_nested(0ui64), _hand(0ui64), _epoch(1ui64), _size(size), _hits(0ui64), _misses(0ui64), _evictions(0ui64) {}
 
 nativehub::nativehub(nativehub&& o) noexcept
-	: _cache(move(o._cache)), _queue(move(o._queue)), _count(move(o._count)), _size(move(o._size)) {}
+	: _entries(move(o._entries)), _index(move(o._index)), _sites(move(o._sites)), _hosts(move(o._hosts)), _imports(move(o._imports)),
+	_libraries(move(o._libraries)), _callbacks(move(o._callbacks)), _context(move(o._context)), _enter(move(o._enter)), _nested(move(o._nested)),
+	_hand(move(o._hand)), _epoch(move(o._epoch)), _size(move(o._size)), _hits(move(o._hits)), _misses(move(o._misses)), _evictions(move(o._evictions))
+{
+	o._sites.fill(nativesite());
 
-nativehub& nativehub::operator=(nativehub&& o) noexcept
+	for (const auto& [site, callback] : _callbacks)
+		callback->set_hub(this);
+}
+
+uintptr_t nativehub::resolve(const string& library, const string& symbol)
+{
+	uint64_t i = 0ui64;
+
+	while (i < (uint64_t)_libraries.size() && _libraries[i].name != library)
+		++i;
+
+	if (i == (uint64_t)_libraries.size())
+	{
+		// Empty library name is the running program, its handle is not one to close
+
+	#ifdef _WIN32
+		void* handle = library.empty() ? (void*)GetModuleHandleA(nullptr) : (void*)LoadLibraryA(library.c_str());
+		void (*release)(void*) = library.empty() ? +[](void*) {} : +[](void* handle) { FreeLibrary((HMODULE)handle); };
+	#else
+		void* handle = dlopen(library.empty() ? nullptr : library.c_str(), RTLD_NOW | RTLD_LOCAL);
+		void (*release)(void*) = [](void* handle) { dlclose(handle); };
+	#endif
+
+		if (handle == nullptr)
+			throw runtime_error(_err_msg_import_lib);
+		else
+			_libraries.push_back(nativelibrary{ library, unique_ptr<void, void (*)(void*)>(handle, release) });
+	}
+
+#ifdef _WIN32
+	const uintptr_t target = (uintptr_t)GetProcAddress((HMODULE)_libraries[i].handle.get(), symbol.c_str());
+#else
+	const uintptr_t target = (uintptr_t)dlsym(_libraries[i].handle.get(), symbol.c_str());
+#endif
+
+	if (target == (uintptr_t)nullptr)
+		throw runtime_error(_err_msg_import_sym);
+	else
+		return target;
+}
+
+void nativehub::load(const uint8_t* bcode, const uint8_t* ecode)
+{
+	// Sections go first, an importcall may come before the section of its entry
+
+	for (const uint8_t* opptr = bcode; opptr < ecode;)
+	{
+		const uint64_t size = decoded_code::get_size(opptr, ecode);
+
+		if (size == 0ui64)
+			++opptr;
+		else if (opptr + (ptrdiff_t)size > ecode)
+			break;
+		else
+		{
+			if ((op)*opptr == op::imports)
+				import_section(opptr + (ptrdiff_t)3, opptr + (ptrdiff_t)size);
+
+			opptr += (ptrdiff_t)size;
+		}
+	}
+
+	for (const uint8_t* opptr = bcode; opptr < ecode;)
+	{
+		const uint64_t size = decoded_code::get_size(opptr, ecode);
+
+		if (size == 0ui64)
+			++opptr;
+		else if (opptr + (ptrdiff_t)size > ecode)
+			break;
+		else
+		{
+			if ((op)*opptr == op::importcall)
+			{
+				const uint64_t index = (uint64_t)((const val16<>*)(opptr + (ptrdiff_t)1))->ui;
+
+				if (index >= (uint64_t)_imports.size() || !_imports[index].has_value()
+					|| _imports[index]->pop != (uint64_t)opptr[3ui64] || _imports[index]->push != (uint64_t)opptr[4ui64])
+					throw runtime_error(_err_msg_wrong_import);
+			}
+			else if ((op)*opptr == op::callback && !_callbacks.contains(opptr + (ptrdiff_t)1))
+			{
+				const uint8_t* site = opptr + (ptrdiff_t)1;
+
+				__prepare(site, bcode, ecode);
+			}
+
+			opptr += (ptrdiff_t)size;
+		}
+	}
+}
+
+uint64_t nativehub::get_host(const string& name) const noexcept
 {
-	_cache = move(o._cache);
-	_queue = move(o._queue);
+	for (uint64_t i = 0ui64; i < (uint64_t)_hosts.size(); ++i)
+		if (_hosts[i].name == name)
+			return i;
+
+	return ~0ui64;
+}
 
-	_count = move(o._count);
+nativehub& nativehub::operator=(nativehub&& o) noexcept
+{
+	_entries = move(o._entries);
+	_index = move(o._index);
+	_sites = move(o._sites);
+	o._sites.fill(nativesite());
+	_hosts = move(o._hosts);
+	_imports = move(o._imports);
+	_libraries = move(o._libraries);
+	_callbacks = move(o._callbacks);
+
+	for (const auto& [site, callback] : _callbacks)
+		callback->set_hub(this);
+
+	_context = move(o._context);
+	_enter = move(o._enter);
+	_nested = move(o._nested);
+
+	_hand = move(o._hand);
+	_epoch = move(o._epoch);
 	_size = move(o._size);
 
+	_hits = move(o._hits);
+	_misses = move(o._misses);
+	_evictions = move(o._evictions);
+
 	return *this;
 }
\ No newline at end of file
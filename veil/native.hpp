@@ -1,12 +1,18 @@
 #pragma once
 
+#include <array>
 #include <bit>
 #include <concepts>
 #include <cstdint>
-#include <list>
-#include <map>
+#include <memory>
+#include <optional>
 #include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "interpreter_type.hpp"
 #include "stack_be.hpp"
@@ -25,6 +31,14 @@ namespace interpreter
 		static constexpr const char _err_msg_wrong_abit[] = "Wrong ABI type";
 		static constexpr const char _err_msg_wrong_type[] = "Wrong argument type";
 
+		// Argument and return value buffers hold any arg_o_type and what ffi_call stores as return
+
+		static constexpr uint64_t _inline_count = 8ui64;
+		static constexpr uint64_t _slot_size = (uint64_t)sizeof(uint64_t) > (uint64_t)sizeof(ffi_arg)
+			? (uint64_t)sizeof(uint64_t) : (uint64_t)sizeof(ffi_arg);
+
+		static constexpr uint64_t _arg_size = (uint64_t)sizeof(ffi_type*) + (uint64_t)sizeof(void*) + _slot_size + (uint64_t)sizeof(arg_type);
+
 		abi_type _abi_type;
 		uint64_t _arg_count;
 
@@ -39,6 +53,71 @@ namespace interpreter
 
 		ffi_cif _cif;
 
+		// All of the above arrays and buffers live in one block, inline up to _inline_count arguments
+
+		uint8_t* _block;
+		alignas(uint64_t) uint8_t _inline[_inline_count * _arg_size + _slot_size];
+	#ifdef SYSVTRAMP
+
+		// trampoline - calls the target straight with the bits of up to _tramp_count 64-bit integer,
+		//              pointer or double arguments, the compiler puts them in SysV registers; returns
+		//              the bits of the result, signatures it has no trampoline for go through ffi_call
+
+		using trampoline = uint64_t(*)(uintptr_t native_ptr, const uint64_t* arg);
+
+		static constexpr uint64_t _tramp_count = 4ui64;
+		static constexpr uint64_t _tramp_lists = (2ui64 << _tramp_count) - 1ui64;
+
+		trampoline _trampoline;
+
+		// Argument list number is 2^count - 1 + mask, mask has a bit set for every double argument
+
+		static constexpr uint64_t get_tramp_count(uint64_t list) noexcept
+		{
+			return (uint64_t)std::bit_width(list + 1ui64) - 1ui64;
+		}
+
+		static constexpr uint64_t get_tramp_mask(uint64_t list) noexcept
+		{
+			return list + 1ui64 - (1ui64 << get_tramp_count(list));
+		}
+
+		template <uint64_t mask, uint64_t index>
+		using tramp_arg = std::conditional_t<((mask >> index) & 1ui64) != 0ui64, double, uint64_t>;
+
+		// Return class ret is 0 for void, 1 for 64-bit integer or pointer and 2 for double
+
+		template <uint64_t ret, uint64_t mask, uint64_t ...index>
+		static uint64_t tramp(uintptr_t native_ptr, const uint64_t* arg)
+		{
+			if constexpr (ret == 0ui64)
+			{
+				((void(*)(tramp_arg<mask, index>...))native_ptr)(std::bit_cast<tramp_arg<mask, index>>(arg[index])...);
+				return 0ui64;
+			}
+			else if constexpr (ret == 1ui64)
+				return ((uint64_t(*)(tramp_arg<mask, index>...))native_ptr)(std::bit_cast<tramp_arg<mask, index>>(arg[index])...);
+			else
+				return std::bit_cast<uint64_t>(((double(*)(tramp_arg<mask, index>...))native_ptr)(std::bit_cast<tramp_arg<mask, index>>(arg[index])...));
+		}
+
+		template <uint64_t ret, uint64_t mask, uint64_t ...index>
+		static constexpr trampoline get_tramp(std::integer_sequence<uint64_t, index...>) noexcept
+		{
+			return &tramp<ret, mask, index...>;
+		}
+
+		template <uint64_t ...sig>
+		static constexpr std::array<trampoline, sizeof...(sig)> get_tramps(std::integer_sequence<uint64_t, sig...>) noexcept
+		{
+			return { get_tramp<sig / _tramp_lists, get_tramp_mask(sig % _tramp_lists)>(
+				std::make_integer_sequence<uint64_t, get_tramp_count(sig % _tramp_lists)>())... };
+		}
+
+		static inline uint64_t get_tramp_class(arg_type type) noexcept;
+		inline trampoline get_trampoline() const noexcept;
+	#endif
+
 		template <VALUE V>
 		static inline V fetch_with_check(const uint8_t*& opptr, const uint8_t* bcode, const uint8_t* ecode)
 		{
@@ -86,10 +165,8 @@ namespace interpreter
 		}
 
 		static inline ffi_abi get_abi(abi_type type);
-		static inline uint64_t get_asize(arg_type type);
-		static inline uint64_t get_rsize(arg_type type);
+		static inline uint64_t get_block_size(uint64_t count) noexcept;
 		static inline ffi_type* get_type(arg_type type);
-		static inline void* get_val(arg_type type);
 
 		template <typename T>
 		static inline void convert(void* mem, arg_o_type type, T value)
@@ -138,7 +215,14 @@ namespace interpreter
 		inline void __del_obj() noexcept;
 		inline void __mov_obj(nativecall&& o) noexcept;
 
+		inline void alloc();
 		inline void init();
+		inline void map() noexcept;
+
+		static inline void push_value(stack<>& stack, arg_type type, void* mem);
+		static inline void pop_value(stack<>& stack, arg_type type, void* mem);
+
+		void call_n(uintptr_t native_ptr, uint64_t count, const uint8_t* const* column, uint8_t* result);
 
 	public:
 		nativecall() = delete;
@@ -153,6 +237,26 @@ namespace interpreter
 		{
 			using stack_type = stack<endianness>;
 
+		#ifdef SYSVTRAMP
+			if (_trampoline != (trampoline)nullptr)
+			{
+				uint64_t arg[_tramp_count];
+
+				for (uint64_t i = 0ui64; i < _arg_count; ++i)
+					arg[i] = _arg_io_type[i].inner == arg_i_type::__ptr ? (uint64_t)stack_type::dil_pop_ptr(stop)
+						: stack_type::template dil_pop<val64<>>(stop).ui;
+
+				const uint64_t ret = _trampoline(native_ptr, arg);
+
+				if (_ret_io_type.inner == arg_i_type::__ptr)
+					stack_type::dil_push_ptr(stop, (uintptr_t)ret);
+				else if (_ret_io_type.inner != arg_i_type::__void)
+					stack_type::template dil_push(stop, val64<>(ret));
+
+				return;
+			}
+
+		#endif
 			for (uint64_t i = 0ui64; i < _arg_count; ++i)
 				switch (_arg_io_type[i].inner)
 				{
@@ -170,7 +274,7 @@ namespace interpreter
 				case arg_i_type::__ptr:
 					if (_arg_io_type[i].outer == arg_o_type::__ptr)
 					{
-						*((void**)(_arg_val[i])) = (void*)stack_type::template dil_pop_ptr(stop);
+						*((void**)(_arg_val[i])) = (void*)stack_type::dil_pop_ptr(stop);
 						break;
 					}
 					// else fall to default: throw
@@ -195,7 +299,7 @@ namespace interpreter
 			case arg_i_type::__ptr:
 				if (_ret_io_type.outer == arg_o_type::__ptr)
 				{
-					stack_type::template dil_push_ptr(stop, (uintptr_t) * ((void**)_ret_val));
+					stack_type::dil_push_ptr(stop, (uintptr_t) * ((void**)_ret_val));
 					break;
 				}
 				// else fall to default: throw
@@ -206,20 +310,39 @@ namespace interpreter
 		template <std::endian endianness = std::endian::native>
 		void call(stack<endianness>& stack, uintptr_t native_ptr)
 		{
+		#ifdef SYSVTRAMP
+			if (_trampoline != (trampoline)nullptr)
+			{
+				uint64_t arg[_tramp_count];
+
+				for (uint64_t i = 0ui64; i < _arg_count; ++i)
+					arg[i] = _arg_io_type[i].inner == arg_i_type::__ptr ? (uint64_t)stack.pop_ptr() : stack.template pop<val64<>>().ui;
+
+				const uint64_t ret = _trampoline(native_ptr, arg);
+
+				if (_ret_io_type.inner == arg_i_type::__ptr)
+					stack.push_ptr((uintptr_t)ret);
+				else if (_ret_io_type.inner != arg_i_type::__void)
+					stack.push(val64<>(ret));
+
+				return;
+			}
+
+		#endif
 			for (uint64_t i = 0ui64; i < _arg_count; ++i)
 				switch (_arg_io_type[i].inner)
 				{
 				case arg_i_type::__void: convert(_arg_val[i], _arg_io_type[i].outer, 0ui8); break;
-				case arg_i_type::__val64f: convert(_arg_val[i], _arg_io_type[i].outer, stack.pop<val64<>>().f); break;
-				case arg_i_type::__val64s: convert(_arg_val[i], _arg_io_type[i].outer, stack.pop<val64<>>().si); break;
-				case arg_i_type::__val64u: convert(_arg_val[i], _arg_io_type[i].outer, stack.pop<val64<>>().ui); break;
-				case arg_i_type::__val32f: convert(_arg_val[i], _arg_io_type[i].outer, stack.pop<val32<>>().f); break;
-				case arg_i_type::__val32s: convert(_arg_val[i], _arg_io_type[i].outer, stack.pop<val32<>>().si); break;
-				case arg_i_type::__val32u: convert(_arg_val[i], _arg_io_type[i].outer, stack.pop<val32<>>().ui); break;
-				case arg_i_type::__val16s: convert(_arg_val[i], _arg_io_type[i].outer, stack.pop<val16<>>().si); break;
-				case arg_i_type::__val16u: convert(_arg_val[i], _arg_io_type[i].outer, stack.pop<val16<>>().ui); break;
-				case arg_i_type::__val8s: convert(_arg_val[i], _arg_io_type[i].outer, stack.pop<val8<>>().si); break;
-				case arg_i_type::__val8u: convert(_arg_val[i], _arg_io_type[i].outer, stack.pop<val8<>>().ui); break;
+				case arg_i_type::__val64f: convert(_arg_val[i], _arg_io_type[i].outer, stack.template pop<val64<>>().f); break;
+				case arg_i_type::__val64s: convert(_arg_val[i], _arg_io_type[i].outer, stack.template pop<val64<>>().si); break;
+				case arg_i_type::__val64u: convert(_arg_val[i], _arg_io_type[i].outer, stack.template pop<val64<>>().ui); break;
+				case arg_i_type::__val32f: convert(_arg_val[i], _arg_io_type[i].outer, stack.template pop<val32<>>().f); break;
+				case arg_i_type::__val32s: convert(_arg_val[i], _arg_io_type[i].outer, stack.template pop<val32<>>().si); break;
+				case arg_i_type::__val32u: convert(_arg_val[i], _arg_io_type[i].outer, stack.template pop<val32<>>().ui); break;
+				case arg_i_type::__val16s: convert(_arg_val[i], _arg_io_type[i].outer, stack.template pop<val16<>>().si); break;
+				case arg_i_type::__val16u: convert(_arg_val[i], _arg_io_type[i].outer, stack.template pop<val16<>>().ui); break;
+				case arg_i_type::__val8s: convert(_arg_val[i], _arg_io_type[i].outer, stack.template pop<val8<>>().si); break;
+				case arg_i_type::__val8u: convert(_arg_val[i], _arg_io_type[i].outer, stack.template pop<val8<>>().ui); break;
 				case arg_i_type::__ptr:
 					if (_arg_io_type[i].outer == arg_o_type::__ptr)
 					{
@@ -256,26 +379,258 @@ namespace interpreter
 			}
 		}
 
-		void prep(const uint8_t*& opptr);
-		void prep(const uint8_t*& opptr, const uint8_t* bcode, const uint8_t* ecode);
+		// Bytes of the abi_type, arg_count and arg_io_type operands
+
+		inline uint64_t get_size() const noexcept
+		{
+			return _arg_count + 3ui64;
+		}
+
+		// Columns are popped as nativecall_n takes them, every call of the batch shares what the
+		// call costs apart from ffi_call itself
+
+		template <std::endian endianness = std::endian::native>
+		void call_n(uintptr_t& stop, uintptr_t native_ptr)
+		{
+			using stack_type = stack<endianness>;
+
+			const uint8_t* column[256ui64];
+			const uint64_t count = stack_type::template dil_pop<val64<>>(stop).ui;
+			uint8_t* result = _ret_io_type.outer != arg_o_type::__void ? (uint8_t*)stack_type::dil_pop_ptr(stop) : (uint8_t*)nullptr;
+
+			for (uint64_t i = 0ui64; i < _arg_count; ++i)
+				column[i] = (const uint8_t*)stack_type::dil_pop_ptr(stop);
+
+			call_n(native_ptr, count, column, result);
+		}
+
+		template <std::endian endianness = std::endian::native>
+		void call_n(stack<endianness>& stack, uintptr_t native_ptr)
+		{
+			const uint8_t* column[256ui64];
+			const uint64_t count = stack.template pop<val64<>>().ui;
+			uint8_t* result = _ret_io_type.outer != arg_o_type::__void ? (uint8_t*)stack.pop_ptr() : (uint8_t*)nullptr;
+
+			for (uint64_t i = 0ui64; i < _arg_count; ++i)
+				column[i] = (const uint8_t*)stack.pop_ptr();
+
+			call_n(native_ptr, count, column, result);
+		}
+
+		// Stack bytes the call pops and pushes, not counting the address of the native target
+
+		inline uint64_t get_pop() const noexcept
+		{
+			uint64_t pop = 0ui64;
+
+			for (uint64_t i = 0ui64; i < _arg_count; ++i)
+				pop += arg_size(_arg_io_type[i].inner);
+
+			return pop;
+		}
+
+		inline uint64_t get_push() const noexcept
+		{
+			return arg_size(_ret_io_type.inner);
+		}
+
+		// Callback frames take the arguments native code passed converted to their inner types,
+		// pushed as execute pushes them, and give back the return value slot converted to its
+		// outer type the way ffi_closure returns it
+
+		void push_args(stack<>& stack, void* const* arg_val) const;
+		void pop_ret(stack<>& stack, void* ret_val) const;
+
+		inline ffi_cif* get_cif() noexcept
+		{
+			return &_cif;
+		}
+
+		// Operands at opptr, get_size() bytes of them, are the ones the call was prepared from
+
+		inline bool is_same(const uint8_t* opptr) const noexcept
+		{
+			return opptr[0ui64] == (uint8_t)_abi_type && (uint64_t)opptr[1ui64] == _arg_count
+				&& memcmp(opptr + (ptrdiff_t)2, _arg_io_type, (uint64_t)sizeof(arg_type) * _arg_count) == 0
+				&& opptr[_arg_count + 2ui64] == arg_type_val<>(_ret_io_type).__value.ui;
+		}
 
 		nativecall& operator=(const nativecall& o);
 		nativecall& operator=(nativecall&& o) noexcept;
 	};
 
+	// nativeentry - call prepared for one signature, the abi_type, arg_count and arg_io_type operands
+	//               hashed to hash, referenced while called since the clock hand passed it
+
+	struct nativeentry
+	{
+		uint64_t hash;
+		nativecall call;
+		bool referenced;
+	};
+
+	// nativesite - inline cache entry of nativecall ops, opptr is where the operands of the op
+	//              start and entry its interned signature, valid while no cached call was evicted
+	//              or moved since epoch
+
+	struct nativesite
+	{
+		const uint8_t* opptr;
+		nativeentry* entry;
+		uint64_t epoch;
+	};
+
+	// nativehost - host function bound by name, the glue generated for its type pops its arguments
+	//              and pushes its return value on either stack, pop and push are the bytes it takes
+
+	struct nativehost
+	{
+		std::string name;
+		void (*dil_call)(uintptr_t& stop);
+		void (*call)(stack<>& stack);
+		uint64_t pop;
+		uint64_t push;
+	};
+
+	// nativeimport - import entry resolved when the code was loaded, target is the symbol its call
+	//                was prepared for, pop and push are the bytes the call takes
+
+	struct nativeimport
+	{
+		std::string library;
+		std::string symbol;
+		nativecall call;
+		uintptr_t target;
+		uint64_t pop;
+		uint64_t push;
+	};
+
+	// nativelibrary - shared library an import entry named, open while the hub is
+
+	struct nativelibrary
+	{
+		std::string name;
+		std::unique_ptr<void, void (*)(void*)> handle;
+	};
+
+	class nativehub;
+
+	// nativecallback - native code function of a callback op, an ffi_closure of its signature
+	//                  entering the code at entry through the hub the callback was prepared by
+
+	class nativecallback
+	{
+	public:
+		using enter_type = void (*)(void* context, const nativecallback& callback, void* ret_val, void** arg_val) noexcept;
+
+	private:
+		static constexpr const char _err_msg_closure[] = "Callback closure allocation failed";
+
+		const uint8_t* _site;
+		const uint8_t* _entry;
+		nativecall _call;
+
+		ffi_closure* _closure;
+		void* _code;
+		nativehub* _hub;
+
+		static void handler(ffi_cif* cif, void* ret_val, void** arg_val, void* user_data);
+
+	public:
+		nativecallback() = delete;
+		nativecallback(const uint8_t* site, const uint8_t* entry, nativecall&& call, nativehub* hub);
+		nativecallback(const nativecallback& o) = delete;
+		nativecallback(nativecallback&& o) = delete;
+		~nativecallback() noexcept;
+
+		inline void set_hub(nativehub* hub) noexcept
+		{
+			_hub = hub;
+		}
+
+		inline const uint8_t* get_site() const noexcept
+		{
+			return _site;
+		}
+
+		inline const uint8_t* get_entry() const noexcept
+		{
+			return _entry;
+		}
+
+		inline uintptr_t get_code() const noexcept
+		{
+			return (uintptr_t)_code;
+		}
+
+		inline const nativecall& get_call() const noexcept
+		{
+			return _call;
+		}
+
+		// Bytes of the operands after the op, the offset included
+
+		inline uint64_t get_size() const noexcept
+		{
+			return _call.get_size() + 4ui64;
+		}
+
+		// Bytes the return value slot and the arguments take above the frame
+
+		inline uint64_t get_args() const noexcept
+		{
+			return _call.get_pop() + _call.get_push();
+		}
+
+		nativecallback& operator=(const nativecallback& o) = delete;
+		nativecallback& operator=(nativecallback&& o) = delete;
+	};
+
+	// nativehub - interns up to size prepared calls by signature, every native target called with
+	//             one shares its ffi_cif and argument buffers; entries are kept flat and indexed by
+	//             an open addressing hash table with linear probing, a full cache evicts with the
+	//             CLOCK algorithm so entries called since the hand passed them last stay
+
 	class nativehub
 	{
+		friend class nativecallback;
+
 	private:
-		using nref = std::map<uintptr_t, nativecall>::iterator;
+		static constexpr const char _err_msg_fetch_code[] = "Fetch out of code range";
+		static constexpr const char _err_msg_host_count[] = "Host function count exceeded";
+		static constexpr const char _err_msg_host_name[] = "Host function name already bound";
+		static constexpr const char _err_msg_import_lib[] = "Import library not found";
+		static constexpr const char _err_msg_import_sym[] = "Import symbol not found";
+		static constexpr const char _err_msg_wrong_host[] = "Wrong host function";
+		static constexpr const char _err_msg_wrong_import[] = "Wrong import entry";
 
-		static constexpr const char _err_msg_cache_error[] = "Native Hub internal cache error";
+		static constexpr uint64_t _host_count = 65536ui64;
+		static constexpr uint64_t _site_count = 256ui64;
+		static constexpr uint64_t _index_min = 16ui64;
 
-		std::map<uintptr_t, nativecall> _cache;
-		std::list<nref> _queue;
+		std::vector<nativeentry> _entries;
+		std::vector<uint64_t> _index;
+		std::array<nativesite, _site_count> _sites;
+		std::vector<nativehost> _hosts;
+		std::vector<std::optional<nativeimport>> _imports;
+		std::vector<nativelibrary> _libraries;
+		std::unordered_map<const uint8_t*, std::unique_ptr<nativecallback>> _callbacks;
 
-		uint64_t _count;
+		// Callbacks enter the dispatcher through enter with context, calls made while one runs
+		// are nested in the calls below it
+
+		void* _context;
+		nativecallback::enter_type _enter;
+		uint64_t _nested;
+
+		uint64_t _hand;
+		uint64_t _epoch;
 		uint64_t _size;
 
+		uint64_t _hits;
+		uint64_t _misses;
+		uint64_t _evictions;
+
 		template <std::endian endianness = std::endian::native>
 		static inline uintptr_t stack_pop_native_ptr(uintptr_t& stop)
 		{
@@ -288,62 +643,347 @@ namespace interpreter
 			return stack.pop_ptr();
 		}
 
-		inline std::pair<nref, bool> add(uintptr_t k, nativecall&& v)
+		static inline uint64_t get_size(const uint8_t* opptr) noexcept
+		{
+			return (uint64_t)opptr[1ui64] + 3ui64;
+		}
+
+		static inline uint64_t get_size(const uint8_t* opptr, const uint8_t* bcode, const uint8_t* ecode)
+		{
+			if (opptr < bcode || opptr + (ptrdiff_t)2 > ecode || opptr + (ptrdiff_t)get_size(opptr) > ecode)
+				throw std::runtime_error(_err_msg_fetch_code);
+			else
+				return get_size(opptr);
+		}
+
+		// FNV-1a of the signature operands
+
+		static inline uint64_t get_hash(const uint8_t* opptr, uint64_t size) noexcept
+		{
+			uint64_t hash = 0xCBF29CE484222325ui64;
+
+			for (uint64_t i = 0ui64; i < size; ++i)
+				hash = (hash ^ (uint64_t)opptr[i]) * 0x100000001B3ui64;
+
+			return hash;
+		}
+
+		static inline uint64_t get_site(const uint8_t* opptr) noexcept
+		{
+			return ((uint64_t)(uintptr_t)opptr ^ ((uint64_t)(uintptr_t)opptr >> 8ui64)) & (_site_count - 1ui64);
+		}
+
+		// Index slot holding the signature at opptr or the empty slot ending its probe sequence
+
+		inline uint64_t find(uint64_t hash, const uint8_t* opptr) const noexcept
+		{
+			const uint64_t mask = (uint64_t)_index.size() - 1ui64;
+			uint64_t pos = hash & mask;
+
+			while (_index[pos] != ~0ui64 && (_entries[_index[pos]].hash != hash || !_entries[_index[pos]].call.is_same(opptr)))
+				pos = (pos + 1ui64) & mask;
+
+			return pos;
+		}
+
+		template <VALUE V>
+		static inline V stack_pop(uintptr_t& stop)
+		{
+			return stack<>::dil_pop<V>(stop);
+		}
+
+		template <VALUE V>
+		static inline V stack_pop(stack<>& stack)
+		{
+			return stack.pop<V>();
+		}
+
+		template <VALUE V>
+		static inline void stack_push(uintptr_t& stop, V value)
+		{
+			stack<>::dil_push(stop, value);
+		}
+
+		template <VALUE V>
+		static inline void stack_push(stack<>& stack, V value)
+		{
+			stack.push(value);
+		}
+
+		static inline uintptr_t stack_pop_ptr(uintptr_t& stop)
+		{
+			return stack<>::dil_pop_ptr(stop);
+		}
+
+		static inline uintptr_t stack_pop_ptr(stack<>& stack)
+		{
+			return stack.pop_ptr();
+		}
+
+		static inline void stack_push_ptr(uintptr_t& stop, uintptr_t value)
+		{
+			stack<>::dil_push_ptr(stop, value);
+		}
+
+		static inline void stack_push_ptr(stack<>& stack, uintptr_t value)
+		{
+			stack.push_ptr(value);
+		}
+
+		// Host values are converted by their type alone, there is nothing left to look up per call
+
+		template <HOST T, STACK S>
+		static inline T host_pop(S stack)
+		{
+			if constexpr (VALUE<T>)
+				return stack_pop<T>(stack);
+			else if constexpr (std::is_pointer_v<T>)
+				return (T)stack_pop_ptr(stack);
+			else if constexpr (FLOAT<T>)
+				return (T)stack_pop<std::conditional_t<sizeof(T) == 8ui64, val64<>, val32<>>>(stack).f;
+			else if constexpr (sizeof(T) == 8ui64)
+				return (T)stack_pop<val64<>>(stack).ui;
+			else if constexpr (sizeof(T) == 4ui64)
+				return (T)stack_pop<val32<>>(stack).ui;
+			else if constexpr (sizeof(T) == 2ui64)
+				return (T)stack_pop<val16<>>(stack).ui;
+			else
+				return (T)stack_pop<val8<>>(stack).ui;
+		}
+
+		template <HOST T, STACK S>
+		static inline void host_push(S stack, T value)
+		{
+			if constexpr (VALUE<T>)
+				stack_push(stack, value);
+			else if constexpr (std::is_pointer_v<T>)
+				stack_push_ptr(stack, (uintptr_t)value);
+			else if constexpr (sizeof(T) == 8ui64)
+				stack_push(stack, val64<>(value));
+			else if constexpr (sizeof(T) == 4ui64)
+				stack_push(stack, val32<>(value));
+			else if constexpr (sizeof(T) == 2ui64)
+				stack_push(stack, val16<>(value));
+			else
+				stack_push(stack, val8<>(value));
+		}
+
+		// Arguments are popped left to right as braced initializers are evaluated in order
+
+		template <auto F, STACK S, HOST_VOID R, HOST ...A>
+		static inline void host_call(S stack, R(*)(A...))
+		{
+			std::tuple<A...> arg{ host_pop<A, S>(stack)... };
+
+			if constexpr (std::is_void_v<R>)
+				std::apply(F, std::move(arg));
+			else
+				host_push<R, S>(stack, std::apply(F, std::move(arg)));
+		}
+
+		template <auto F, STACK S, HOST_VOID R, HOST ...A>
+		static inline void host_call(S stack, R(*)(A...) noexcept)
+		{
+			host_call<F, S>(stack, (R(*)(A...))nullptr);
+		}
+
+		template <auto F>
+		static void host_glue(uintptr_t& stop)
 		{
-			std::pair<nativehub::nref, bool> r = _cache.insert({ k, std::move(v) });
-			_queue.push_back(r.first);
-			++_count;
-			return r;
+			host_call<F, uintptr_t&>(stop, F);
 		}
 
-		inline nref get(uintptr_t k)
+		template <auto F>
+		static void host_glue(stack<>& stack)
 		{
-			return _cache.find(k);
+			host_call<F, interpreter::stack<>&>(stack, F);
 		}
 
-		inline void rem()
+		nativeentry& add(uint64_t hash, nativecall&& v);
+		void erase(uint64_t pos) noexcept;
+		void place(uint64_t hash, uint64_t i) noexcept;
+		void rehash(uint64_t size);
+
+		template <STACK S, bool batch>
+		static inline void invoke(nativecall& call, S stack, uintptr_t native_ptr)
 		{
-			_cache.erase(_queue.front());
-			_queue.pop_front();
-			--_count;
+			if constexpr (batch)
+				call.call_n(stack, native_ptr);
+			else
+				call.call(stack, native_ptr);
 		}
 
-		template <STACK S, std::endian endianness = std::endian::native, typename ...L>
+		template <STACK S, std::endian endianness = std::endian::native, bool batch = false, typename ...L>
 		inline void __call(const uint8_t*& opptr, S stack, L... limit)
 		{
 			uintptr_t native_ptr = stack_pop_native_ptr<endianness>(stack);
+			nativesite& site = _sites[get_site(opptr)];
+
+			// Monomorphic inline cache, a call site seen before skips the signature lookup and the
+			// operand decoding whatever target it calls
+
+			if (site.opptr == opptr && site.epoch == _epoch)
+			{
+				++_hits;
+				site.entry->referenced = true;
+
+				opptr += (ptrdiff_t)site.entry->call.get_size();
+				invoke<S, batch>(site.entry->call, stack, native_ptr);
+				return;
+			}
+
+			// Nested calls leave the interned ones as they are, the calls below them still use theirs
+
+			if (_size == 0ui64 || _nested != 0ui64)
+			{
+				++_misses;
+
+				nativecall call_obj(opptr, limit...);
+				invoke<S, batch>(call_obj, stack, native_ptr);
+				return;
+			}
+
+			const uint8_t* site_ptr = opptr;
+			const uint64_t size = get_size(opptr, limit...);
+			const uint64_t hash = get_hash(opptr, size);
 
-			if (_count != 0ui64)
+			if (!_entries.empty())
 			{
-				nref iter = get(native_ptr);
+				const uint64_t pos = find(hash, opptr);
 
-				if (iter != _cache.end())
+				if (_index[pos] != ~0ui64)
 				{
-					iter->second.prep(opptr, limit...);
-					iter->second.call(stack, native_ptr);
+					nativeentry& entry = _entries[_index[pos]];
+
+					++_hits;
+					entry.referenced = true;
+
+					opptr += (ptrdiff_t)size;
+					site = nativesite{ site_ptr, &entry, _epoch };
+					invoke<S, batch>(entry.call, stack, native_ptr);
 					return;
 				}
 			}
 
-			nativecall call_obj(opptr, limit...);
-			nativecall* call_ptr;
+			++_misses;
+
+			nativeentry& entry = add(hash, nativecall(opptr, limit...));
 
-			if (_size == 0ui64)
-				call_ptr = &call_obj;
+			site = nativesite{ site_ptr, &entry, _epoch };
+			invoke<S, batch>(entry.call, stack, native_ptr);
+		}
+
+		static inline std::string fetch_name(const uint8_t*& opptr, const uint8_t* ecode)
+		{
+			if (opptr >= ecode || opptr + (ptrdiff_t)1 + (ptrdiff_t)*opptr > ecode)
+				throw std::runtime_error(_err_msg_fetch_code);
 			else
 			{
-				if (_count == _size)
-					rem();
+				std::string name((const char*)opptr + (ptrdiff_t)1, (uint64_t)*opptr);
+				opptr += (ptrdiff_t)1 + (ptrdiff_t)*opptr;
+
+				return name;
+			}
+		}
+
+		void import_section(const uint8_t* bcode, const uint8_t* ecode);
+		uintptr_t resolve(const std::string& library, const std::string& symbol);
+
+		template <STACK S, typename ...L>
+		inline void __import(const uint8_t*& opptr, S stack, L... limit)
+		{
+			const uint64_t index = (uint64_t)((const val16<>*)opptr)->ui;
+
+			// Loading checked every importcall it came across, control flow may still get into
+			// bytes it took for operands of other ops
+
+			if constexpr (sizeof...(L) != 0ui64)
+			{
+				const uint8_t* bcode = std::get<0ui64>(std::make_tuple(limit...));
+				const uint8_t* ecode = std::get<1ui64>(std::make_tuple(limit...));
+
+				if (opptr < bcode || opptr + (ptrdiff_t)4 > ecode)
+					throw std::runtime_error(_err_msg_fetch_code);
+				else if (index >= (uint64_t)_imports.size() || !_imports[index].has_value()
+					|| _imports[index]->pop != (uint64_t)opptr[2ui64] || _imports[index]->push != (uint64_t)opptr[3ui64])
+					throw std::runtime_error(_err_msg_wrong_import);
+			}
+
+			opptr += (ptrdiff_t)4;
+
+			nativeimport& entry = *_imports[index];
+			entry.call.call(stack, entry.target);
+		}
+
+		// Callback op is prepared once, checked code has its entry checked here and not when
+		// native code enters it
 
-				std::pair<nref, bool> r = add(native_ptr, std::move(call_obj));
+		template <typename ...L>
+		inline nativecallback& __prepare(const uint8_t*& opptr, L... limit)
+		{
+			const uint8_t* site = opptr;
+			nativecall call(opptr, limit...);
 
-				if (!r.second)
-					throw std::runtime_error(_err_msg_cache_error);
+			if constexpr (sizeof...(L) != 0ui64)
+			{
+				const uint8_t* bcode = std::get<0ui64>(std::make_tuple(limit...));
+				const uint8_t* ecode = std::get<1ui64>(std::make_tuple(limit...));
 
-				call_ptr = &(r.first->second);
+				if (opptr + (ptrdiff_t)4 > ecode || opptr + (ptrdiff_t)4 + (ptrdiff_t)((const val32<>*)opptr)->si < bcode
+					|| opptr + (ptrdiff_t)4 + (ptrdiff_t)((const val32<>*)opptr)->si >= ecode)
+					throw std::runtime_error(_err_msg_fetch_code);
 			}
 
-			call_ptr->call(stack, native_ptr);
+			const uint8_t* entry = opptr + (ptrdiff_t)4 + (ptrdiff_t)((const val32<>*)opptr)->si;
+
+			opptr += (ptrdiff_t)4;
+
+			return *_callbacks.emplace(site, std::make_unique<nativecallback>(site, entry, std::move(call), this)).first->second;
+		}
+
+		// Loading prepared the callbacks of the code, control flow getting into bytes it took for
+		// operands of other ops or code loaded without an end has the rest prepared on first use
+
+		template <typename ...L>
+		inline uintptr_t __callback(const uint8_t*& opptr, L... limit)
+		{
+			const auto it = _callbacks.find(opptr);
+
+			if (it != _callbacks.end())
+			{
+				opptr += (ptrdiff_t)it->second->get_size();
+				return it->second->get_code();
+			}
+			else
+				return __prepare(opptr, limit...).get_code();
+		}
+
+		template <STACK S, typename ...L>
+		inline void __host(const uint8_t*& opptr, S stack, L... limit)
+		{
+			const uint64_t index = (uint64_t)((const val16<>*)opptr)->ui;
+
+			// Checked code has to pop and push what the bound function does, or stack checks of
+			// the op would not hold
+
+			if constexpr (sizeof...(L) != 0ui64)
+			{
+				const uint8_t* bcode = std::get<0ui64>(std::make_tuple(limit...));
+				const uint8_t* ecode = std::get<1ui64>(std::make_tuple(limit...));
+
+				if (opptr < bcode || opptr + (ptrdiff_t)4 > ecode)
+					throw std::runtime_error(_err_msg_fetch_code);
+				else if (index >= (uint64_t)_hosts.size() || _hosts[index].pop != (uint64_t)opptr[2ui64]
+					|| _hosts[index].push != (uint64_t)opptr[3ui64])
+					throw std::runtime_error(_err_msg_wrong_host);
+			}
+
+			opptr += (ptrdiff_t)4;
+
+			if constexpr (std::same_as<S, uintptr_t&>)
+				_hosts[index].dil_call(stack);
+			else
+				_hosts[index].call(stack);
 		}
 
 	public:
@@ -377,6 +1017,139 @@ namespace interpreter
 			__call<interpreter::stack<endianness>&, endianness>(opptr, stack, bcode, ecode);
 		}
 
+		template <std::endian endianness = std::endian::native>
+		void call_n(const uint8_t*& opptr, uintptr_t& stop)
+		{
+			__call<uintptr_t&, endianness, true>(opptr, stop);
+		}
+
+		template <std::endian endianness = std::endian::native>
+		void call_n(const uint8_t*& opptr, stack<endianness>& stack)
+		{
+			__call<interpreter::stack<endianness>&, endianness, true>(opptr, stack);
+		}
+
+		template <std::endian endianness = std::endian::native>
+		void call_n(const uint8_t*& opptr, uintptr_t& stop, const uint8_t* bcode, const uint8_t* ecode)
+		{
+			__call<uintptr_t&, endianness, true>(opptr, stop, bcode, ecode);
+		}
+
+		template <std::endian endianness = std::endian::native>
+		void call_n(const uint8_t*& opptr, stack<endianness>& stack, const uint8_t* bcode, const uint8_t* ecode)
+		{
+			__call<interpreter::stack<endianness>&, endianness, true>(opptr, stack, bcode, ecode);
+		}
+
+		void host(const uint8_t*& opptr, uintptr_t& stop)
+		{
+			__host<uintptr_t&>(opptr, stop);
+		}
+
+		void host(const uint8_t*& opptr, stack<>& stack)
+		{
+			__host<interpreter::stack<>&>(opptr, stack);
+		}
+
+		void host(const uint8_t*& opptr, uintptr_t& stop, const uint8_t* bcode, const uint8_t* ecode)
+		{
+			__host<uintptr_t&>(opptr, stop, bcode, ecode);
+		}
+
+		void host(const uint8_t*& opptr, stack<>& stack, const uint8_t* bcode, const uint8_t* ecode)
+		{
+			__host<interpreter::stack<>&>(opptr, stack, bcode, ecode);
+		}
+
+		void call_import(const uint8_t*& opptr, uintptr_t& stop)
+		{
+			__import<uintptr_t&>(opptr, stop);
+		}
+
+		void call_import(const uint8_t*& opptr, stack<>& stack)
+		{
+			__import<interpreter::stack<>&>(opptr, stack);
+		}
+
+		void call_import(const uint8_t*& opptr, uintptr_t& stop, const uint8_t* bcode, const uint8_t* ecode)
+		{
+			__import<uintptr_t&>(opptr, stop, bcode, ecode);
+		}
+
+		void call_import(const uint8_t*& opptr, stack<>& stack, const uint8_t* bcode, const uint8_t* ecode)
+		{
+			__import<interpreter::stack<>&>(opptr, stack, bcode, ecode);
+		}
+
+		uintptr_t callback(const uint8_t*& opptr)
+		{
+			return __callback(opptr);
+		}
+
+		uintptr_t callback(const uint8_t*& opptr, const uint8_t* bcode, const uint8_t* ecode)
+		{
+			return __callback(opptr, bcode, ecode);
+		}
+
+		// Context and enter every callback of the hub enters the dispatcher with, set again when
+		// the dispatcher moves
+
+		inline void bind_callbacks(void* context, nativecallback::enter_type enter) noexcept
+		{
+			_context = context;
+			_enter = enter;
+		}
+
+		// Resolves the import sections of the code and checks every importcall against them, the
+		// symbols are looked up once here and never by the calls; callback ops are prepared here
+		// as well so running one finds its native code function by site
+
+		void load(const uint8_t* bcode, const uint8_t* ecode);
+
+		// Binds F under name and returns the index hostcall ops call it by, op_asm::__hostcall<F>
+		// puts the stack bytes of its type in the op
+
+		template <auto F>
+		uint64_t bind(const std::string& name)
+		{
+			static_assert(host_sig<F>::pop <= 255ui64 && host_sig<F>::push <= 255ui64);
+
+			if ((uint64_t)_hosts.size() >= _host_count)
+				throw std::runtime_error(_err_msg_host_count);
+			else if (get_host(name) != ~0ui64)
+				throw std::runtime_error(_err_msg_host_name);
+			else
+			{
+				void (*dil_call)(uintptr_t&) = &host_glue<F>;
+				void (*call)(stack<>&) = &host_glue<F>;
+
+				_hosts.push_back(nativehost{ name, dil_call, call, host_sig<F>::pop, host_sig<F>::push });
+				return (uint64_t)_hosts.size() - 1ui64;
+			}
+		}
+
+		// Index of the host function bound under name, ~0 if there is none
+
+		uint64_t get_host(const std::string& name) const noexcept;
+
+		// Calls that found their signature interned, calls that prepared a new one and interned
+		// calls the new ones replaced
+
+		inline uint64_t get_hits() const noexcept
+		{
+			return _hits;
+		}
+
+		inline uint64_t get_misses() const noexcept
+		{
+			return _misses;
+		}
+
+		inline uint64_t get_evictions() const noexcept
+		{
+			return _evictions;
+		}
+
 		nativehub& operator=(const nativehub& o) = delete;
 		nativehub& operator=(nativehub&& o) noexcept;
 	};
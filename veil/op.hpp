@@ -636,5 +636,102 @@ namespace interpreter
 		f64_2_ui32,			// [ op (8) ]
 		f32_2_ui64,			// [ op (8) ]
 		f32_2_ui32,			// [ op (8) ]
+
+		// Fused ops are never emitted by op_asm, dispatcher::fuse_ops writes them over the first
+		// op byte of a recognised sequence and leaves the rest of the sequence in place, so they
+		// have the same size as s_load_64 and control flow may still enter the sequence anywhere
+
+		// s_ucmp_jmp_64 - s_load_64, push_64, ucmp_64, jmp_cc_8 (any jmp_cc_8 but jmp_msk_8)
+		//                 affected flags: above, below
+
+		s_ucmp_jmp_64,		// [ op (8) ][ offset  (8) ]{[ push_64 ]}{[ ucmp_64 ]}{[ jmp_cc_8 ]}
+
+		// s_scmp_jmp_64 - s_load_64, push_64, scmp_64, jmp_cc_8 (any jmp_cc_8 but jmp_msk_8)
+		//                 affected flags: above, below
+
+		s_scmp_jmp_64,		// [ op (8) ][ offset  (8) ]{[ push_64 ]}{[ scmp_64 ]}{[ jmp_cc_8 ]}
+
+		// s_uinc_64 - s_load_64, uinc_64, s_store_64 to the same offset
+		//             affected flags: iovf, iunf
+
+		s_uinc_64,			// [ op (8) ][ offset  (8) ]{[ uinc_64 ]}{[ s_store_64 ]}
+
+		// s_udec_64 - s_load_64, udec_64, s_store_64 to the same offset
+		//             affected flags: iovf, iunf
+
+		s_udec_64,			// [ op (8) ][ offset  (8) ]{[ udec_64 ]}{[ s_store_64 ]}
+
+		// s_uadd_64 - s_load_64, s_load_64, uadd_64
+		//             affected flags: iovf, iunf
+
+		s_uadd_64,			// [ op (8) ][ offset  (8) ]{[ s_load_64 ]}{[ uadd_64 ]}
+
+		// s_move_64 - s_load_64, s_store_64
+		//             affected flags: none
+
+		s_move_64,			// [ op (8) ][ offset  (8) ]{[ s_store_64 ]}
+
+		// Generated ops are fused the same way from sequences listed in op_gen.hpp,
+		// which compiler::opgen writes from an OPPROFILE run, so they take the size of the first
+		// op of their sequence and have no layout of their own
+
+		gen_0,				// [ op (8) ]{ first op operands }{[ sequence ops ]}
+		gen_1,				// [ op (8) ]{ first op operands }{[ sequence ops ]}
+		gen_2,				// [ op (8) ]{ first op operands }{[ sequence ops ]}
+		gen_3,				// [ op (8) ]{ first op operands }{[ sequence ops ]}
+
+		// hostcall - calls the host function bound to nativehub by 16-bit unsigned integer index,
+		//            which pops its arguments from stack in the order they are declared and pushes
+		//            its return value; byte-code arguments are the stack bytes the function pops and
+		//            pushes, checked code throws when they are not the ones of the bound function
+		// 
+		//            Numbered after generated ops so the width groups of ops before keep their values
+
+		hostcall,			// [ op (8) ][ index (16) ][ pop (8) ][ push (8) ]
+
+		// imports - import section control flow goes over, its entries name a shared library and
+		//           a symbol in it with the signature of a nativecall; nativehub resolves them
+		//           when the code is loaded, an entry index defined twice has to be the same entry
+		// 
+		//           import entry layout, an empty library name is the running program:
+		// 
+		//           [ index (16) ][ abi_type (8) ][ arg_count (8) ]{[ arg_io_type (8) ]<arg_count + 1>}
+		//           [ library size (8) ]{ library name }[ symbol size (8) ]{ symbol name }
+
+		imports,			// [ op (8) ][ size (16) ]{ import entries }
+
+		// importcall - calls the symbol of the import entry by 16-bit unsigned integer index with
+		//              its prepared call as nativecall does without popping an address; byte-code
+		//              arguments are the stack bytes the call pops and pushes, loading throws when
+		//              they are not the ones of the entry
+
+		importcall,			// [ op (8) ][ index (16) ][ pop (8) ][ push (8) ]
+
+		// nativecall_n - calls the native code function count times with one prepared call, the
+		//                arguments of call i are elements i of the argument columns and its return
+		//                value is stored to element i of the result column; columns are arrays of
+		//                the outer types, stack arguments are popped in following order:
+		// 
+		//                1. Native code function absolute address (64 bits)
+		//                2. Call count (64 bits)
+		//                3. Result column absolute address, unless return outer-type is void (64 bits)
+		//                4. First argument column absolute address (64 bits)
+		//                5. ...
+		//                N. Last argument column absolute address (64 bits)
+		// 
+		//                byte-code arguments are the ones of nativecall
+
+		nativecall_n,		// [ op (8) ][ abi_type (8) ][ arg_count (8) ]{[ arg_io_type (8) ]<arg_count + 1>}
+
+		// callback - pushes the absolute address of a native code function with the signature of
+		//            the byte-code arguments, which native code called by the interpreter may call
+		//            back; it runs the code at the 32-bit signed integer offset from the op end in a
+		//            new frame on the interpreter stack as execute runs the code start, the return
+		//            value slot and then the arguments from last to first are pushed before the
+		//            frame and the code ends with exit
+		// 
+		//            byte-code arguments before the offset are the ones of nativecall
+
+		callback,			// [ op (8) ][ abi_type (8) ][ arg_count (8) ]{[ arg_io_type (8) ]<arg_count + 1>}[ offset (32) ]
 	};
 }
\ No newline at end of file
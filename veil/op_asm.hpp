@@ -4,7 +4,10 @@
 #include <bit>
 #include <cstdint>
 #include <memory>
+#include <stdexcept>
+#include <string>
 #include <type_traits>
+#include <vector>
 
 #include "interpreter_type.hpp"
 #include "op.hpp"
@@ -28,6 +31,8 @@
 #define ONE_VALUE_ENDIAN_TEMPLATE_TYPE_16_BIT_PARAMETERS(NAME) template <interpreter::VALUE V, std::endian endianness = std::endian::native> inline std::enable_if_t<std::is_same_v<V, interpreter::val16<endianness>>, std::array<uint8_t, (uint64_t)sizeof(interpreter::op) + (uint64_t)sizeof(interpreter::type) + (uint64_t)sizeof(interpreter::val16<endianness>) * 2ui64>> __##NAME(interpreter::val16<endianness> value, interpreter::val16<endianness> _mask, interpreter::type _type) noexcept { return std::array<uint8_t, (uint64_t)sizeof(interpreter::op) + (uint64_t)sizeof(interpreter::type) + (uint64_t)sizeof(interpreter::val16<endianness>) * 2ui64>{ (uint8_t)interpreter::op::NAME##_16, (uint8_t)_type, _mask.half.lo.ui, _mask.half.hi.ui, value.half.lo.ui, value.half.hi.ui }; }
 #define ONE_VALUE_ENDIAN_TEMPLATE_TYPE_8_BIT_PARAMETERS(NAME) template <interpreter::VALUE V, std::endian endianness = std::endian::native> inline std::enable_if_t<std::is_same_v<V, interpreter::val8<endianness>>, std::array<uint8_t, (uint64_t)sizeof(interpreter::op) + (uint64_t)sizeof(interpreter::type) + (uint64_t)sizeof(interpreter::val8<endianness>) * 2ui64>> __##NAME(interpreter::val8<endianness> value, interpreter::val8<endianness> _mask, interpreter::type _type) noexcept { return std::array<uint8_t, (uint64_t)sizeof(interpreter::op) + (uint64_t)sizeof(interpreter::type) + (uint64_t)sizeof(interpreter::val8<endianness>) * 2ui64>{ (uint8_t)interpreter::op::NAME##_8, (uint8_t)_type, _mask.ui, value.ui }; }
 
+#define FUNCTION_ENDIAN_TEMPLATE_L_PARAMETER(NAME) template <auto F, std::endian endianness = std::endian::native> inline std::enable_if_t<interpreter::host_sig<F>::pop <= 255ui64, std::array<uint8_t, (uint64_t)sizeof(interpreter::op) + (uint64_t)sizeof(interpreter::val16<endianness>) + 2ui64>> __##NAME(interpreter::val16<endianness> value) noexcept { return std::array<uint8_t, (uint64_t)sizeof(interpreter::op) + (uint64_t)sizeof(interpreter::val16<endianness>) + 2ui64>{ (uint8_t)interpreter::op::NAME, value.half.lo.ui, value.half.hi.ui, (uint8_t)interpreter::host_sig<F>::pop, (uint8_t)interpreter::host_sig<F>::push }; }
+
 #define TWO_VALUE_ENDIAN_TEMPLATE_NO_PARAMETERS_CONVERT(NAME1, NAME2, BITS1, BITS2) template <interpreter::VALUE V1, interpreter::VALUE V2, std::endian endianness = std::endian::native> inline std::enable_if_t<std::is_same_v<V1, interpreter::val##BITS1<endianness>> && std::is_same_v<V2, interpreter::val##BITS2<endianness>>, std::array<uint8_t, (uint64_t)sizeof(interpreter::op)>> __##NAME1##_2_##NAME2() noexcept { return std::array<uint8_t, (uint64_t)sizeof(interpreter::op)>{ (uint8_t)interpreter::op::NAME1##BITS1_2_##NAME2##BITS2 }; }
 
 #define ENDIAN_TEMPLATE_ABI_TYPE_ARG_TYPE_ARG_COUNT_PARAMETERS(NAME) template <std::endian endianness = std::endian::native> inline std::shared_ptr<uint8_t[]> __##NAME(interpreter::abi_type _abi_type, const interpreter::arg_type* _arg_type, uint64_t _arg_count) { if (_arg_count >= 1ui64 && _arg_count <= 256ui64) { std::shared_ptr<uint8_t[]> data(new uint8_t[_arg_count + 3ui64]); data[0ui64] = (uint8_t)interpreter::op::NAME; data[1ui64] = (uint8_t)_abi_type; data[2ui64] = (uint8_t)(_arg_count - 1ui64); memcpy(&data[3ui64], _arg_type, (uint64_t)sizeof(interpreter::arg_type) * _arg_count); return data; } else throw std::runtime_error("Wrong argument count for NAME op assembler"); }
@@ -93,6 +98,7 @@ namespace op_asm
 		ONE_VALUE_ENDIAN_TEMPLATE_NO_PARAMETERS_64_32(fmul)
 		ONE_VALUE_ENDIAN_TEMPLATE_NO_PARAMETERS_64_32(fneg)
 		ONE_VALUE_ENDIAN_TEMPLATE_NO_PARAMETERS_64_32(fsub)
+		FUNCTION_ENDIAN_TEMPLATE_L_PARAMETER(hostcall)
 		ONE_VALUE_ENDIAN_TEMPLATE_64_32_16_8_BIT_PARAMETER(jmp)
 		ONE_VALUE_ENDIAN_TEMPLATE_64_32_16_8_BIT_PARAMETER(jmp_a)
 		ONE_VALUE_ENDIAN_TEMPLATE_64_32_16_8_BIT_PARAMETER(jmp_ae)
@@ -110,6 +116,7 @@ namespace op_asm
 		ENDIAN_TEMPLATE_NO_PARAMETERS(memcpy)
 		ENDIAN_TEMPLATE_NO_PARAMETERS(memset)
 		DYNAMIC_STATIC_VARIADIC_VALUE_ENDIAN_TEMPLATE_ABI_TYPE_ARG_TYPE_PARAMETERS(nativecall)
+		DYNAMIC_STATIC_VARIADIC_VALUE_ENDIAN_TEMPLATE_ABI_TYPE_ARG_TYPE_PARAMETERS(nativecall_n)
 		ONE_VALUE_ENDIAN_TEMPLATE_NO_PARAMETERS_64_32_16_8(neg)
 		ENDIAN_TEMPLATE_NO_PARAMETERS(nop)
 		ONE_VALUE_ENDIAN_TEMPLATE_NO_PARAMETERS_64_32_16_8(not)
@@ -158,4 +165,301 @@ namespace op_asm
 		ONE_VALUE_ENDIAN_TEMPLATE_NO_PARAMETERS_64_32_16_8(ushr)
 		ONE_VALUE_ENDIAN_TEMPLATE_NO_PARAMETERS_64_32_16_8(usub)
 		ONE_VALUE_ENDIAN_TEMPLATE_NO_PARAMETERS_64_32_16_8(xor)
+}
+
+namespace op_asm
+{
+	// import_entry - symbol of a shared library importcall ops call by index, types are the ones
+	//                of the arguments and then of the return value as nativecall takes them
+
+	struct import_entry
+	{
+		uint64_t index;
+		std::string library;
+		std::string symbol;
+		interpreter::abi_type abi;
+		std::vector<interpreter::arg_type> types;
+	};
+
+	template <std::endian endianness = std::endian::native>
+	inline std::vector<uint8_t> __imports(const std::vector<import_entry>& entries)
+	{
+		std::vector<uint8_t> data{ (uint8_t)interpreter::op::imports, 0ui8, 0ui8 };
+
+		for (const import_entry& entry : entries)
+		{
+			if (entry.index > 65535ui64 || entry.types.size() < 1ui64 || entry.types.size() > 256ui64
+				|| entry.library.size() > 255ui64 || entry.symbol.size() > 255ui64)
+				throw std::runtime_error("Wrong import entry for imports op assembler");
+
+			const interpreter::val16<endianness> index((uint16_t)entry.index);
+
+			data.insert(data.end(), { index.half.lo.ui, index.half.hi.ui, (uint8_t)entry.abi, (uint8_t)(entry.types.size() - 1ui64) });
+
+			for (const interpreter::arg_type& type : entry.types)
+				data.push_back(interpreter::arg_type_val(type).__value.ui);
+
+			data.push_back((uint8_t)entry.library.size());
+			data.insert(data.end(), entry.library.begin(), entry.library.end());
+			data.push_back((uint8_t)entry.symbol.size());
+			data.insert(data.end(), entry.symbol.begin(), entry.symbol.end());
+		}
+
+		if (data.size() > 65538ui64)
+			throw std::runtime_error("Wrong import section size for imports op assembler");
+
+		const interpreter::val16<endianness> size((uint16_t)(data.size() - 3ui64));
+
+		data[1ui64] = size.half.lo.ui;
+		data[2ui64] = size.half.hi.ui;
+
+		return data;
+	}
+
+	template <std::endian endianness = std::endian::native>
+	inline std::array<uint8_t, 5ui64> __importcall(const import_entry& entry)
+	{
+		uint64_t pop = 0ui64;
+
+		for (uint64_t i = 0ui64; i + 1ui64 < (uint64_t)entry.types.size(); ++i)
+			pop += interpreter::arg_size(entry.types[i].inner);
+
+		const uint64_t push = entry.types.empty() ? 0ui64 : interpreter::arg_size(entry.types.back().inner);
+
+		if (entry.index > 65535ui64 || pop > 255ui64)
+			throw std::runtime_error("Wrong import entry for importcall op assembler");
+
+		const interpreter::val16<endianness> index((uint16_t)entry.index);
+
+		return std::array<uint8_t, 5ui64>{ (uint8_t)interpreter::op::importcall, index.half.lo.ui, index.half.hi.ui, (uint8_t)pop, (uint8_t)push };
+	}
+
+	// label - code position branches of a builder go to, bound once anywhere in the code
+
+	struct label
+	{
+		uint64_t index;
+	};
+
+	// builder - op_asm ops with branches to labels, every jmp_* and call_* takes the smallest
+	//           offset width its distance fits in; widths start at 8 bits and only grow until
+	//           no branch needs more, so the code is sized once all of them are known; branches
+	//           put as plain op_asm ops keep their offsets and must not cross builder branches
+
+	template <std::endian endianness = std::endian::native>
+	class builder
+	{
+	private:
+		static constexpr const char _err_msg_bound_label[] = "Label is already bound";
+		static constexpr const char _err_msg_far_label[] = "Label is out of callback range";
+		static constexpr const char _err_msg_free_label[] = "Label is not bound";
+		static constexpr const char _err_msg_wrong_label[] = "Wrong label";
+		static constexpr const char _err_msg_wrong_op[] = "Wrong branch op";
+
+		// Positions are offsets in the code without branches and the count of branches before,
+		// a branch keeps its 64-bit op and the width picked so far
+
+		struct position
+		{
+			uint64_t offset;
+			uint64_t branches;
+		};
+
+		struct branch
+		{
+			uint64_t offset;
+			uint64_t target;
+			uint64_t mask;
+			uint64_t width;
+			interpreter::op op_64;
+			interpreter::type type;
+		};
+
+		std::vector<uint8_t> _code;
+		std::vector<position> _labels;
+		std::vector<branch> _branches;
+
+		static inline uint64_t __width(uint64_t value) noexcept
+		{
+			return value <= 0xFFui64 ? 1ui64 : value <= 0xFFFFui64 ? 2ui64 : value <= 0xFFFFFFFFui64 ? 4ui64 : 8ui64;
+		}
+
+		static inline bool __fits(int64_t value, uint64_t width) noexcept
+		{
+			return width == 8ui64 || (value >= -(1i64 << (width * 8ui64 - 1ui64)) && value < (1i64 << (width * 8ui64 - 1ui64)));
+		}
+
+		static inline void __put(std::vector<uint8_t>& code, uint64_t value, uint64_t width)
+		{
+			for (uint64_t i = 0ui64; i < width; ++i)
+				code.push_back((uint8_t)(value >> ((endianness == std::endian::little ? i : width - i - 1ui64) * 8ui64)));
+		}
+
+		static inline uint64_t __size(const branch& br) noexcept
+		{
+			if (br.op_64 == interpreter::op::callback)
+				return br.width;
+			else
+				return br.op_64 == interpreter::op::jmp_msk_64 ? 2ui64 + br.width * 2ui64 : 1ui64 + br.width;
+		}
+
+		inline builder& __branch(interpreter::op op_64, label target, uint64_t mask = 0ui64, interpreter::type type = interpreter::type::v0)
+		{
+			if (target.index >= _labels.size())
+				throw std::runtime_error(_err_msg_wrong_label);
+			else
+			{
+				_branches.push_back(branch{ _code.size(), target.index, mask, __width(mask), op_64, type });
+				return *this;
+			}
+		}
+
+	public:
+		builder() noexcept = default;
+
+		inline label make_label()
+		{
+			_labels.push_back(position{ ~0ui64, ~0ui64 });
+			return label{ _labels.size() - 1ui64 };
+		}
+
+		inline builder& bind(label target)
+		{
+			if (target.index >= _labels.size())
+				throw std::runtime_error(_err_msg_wrong_label);
+			else if (_labels[target.index].offset != ~0ui64)
+				throw std::runtime_error(_err_msg_bound_label);
+			else
+			{
+				_labels[target.index] = position{ _code.size(), _branches.size() };
+				return *this;
+			}
+		}
+
+		template <size_t N>
+		inline builder& put(const std::array<uint8_t, N>& data)
+		{
+			_code.insert(_code.end(), data.begin(), data.end());
+			return *this;
+		}
+
+		inline builder& put(const uint8_t* data, uint64_t size)
+		{
+			_code.insert(_code.end(), data, data + (ptrdiff_t)size);
+			return *this;
+		}
+
+		// Branch ops by the 64-bit op of their family, the conditional ones and call as well
+
+		inline builder& branch_to(interpreter::op op_64, label target)
+		{
+			if (op_64 != interpreter::op::call_64 && (op_64 < interpreter::op::jmp_64 || op_64 > interpreter::op::jmp_un_64
+				|| ((uint64_t)op_64 - (uint64_t)interpreter::op::jmp_64) % 4ui64 != 0ui64))
+				throw std::runtime_error(_err_msg_wrong_op);
+			else
+				return __branch(op_64, target);
+		}
+
+		inline builder& call(label target) { return __branch(interpreter::op::call_64, target); }
+		inline builder& jmp(label target) { return __branch(interpreter::op::jmp_64, target); }
+		inline builder& jmp_a(label target) { return __branch(interpreter::op::jmp_a_64, target); }
+		inline builder& jmp_ae(label target) { return __branch(interpreter::op::jmp_ae_64, target); }
+		inline builder& jmp_b(label target) { return __branch(interpreter::op::jmp_b_64, target); }
+		inline builder& jmp_be(label target) { return __branch(interpreter::op::jmp_be_64, target); }
+		inline builder& jmp_e(label target) { return __branch(interpreter::op::jmp_e_64, target); }
+		inline builder& jmp_ne(label target) { return __branch(interpreter::op::jmp_ne_64, target); }
+		inline builder& jmp_un(label target) { return __branch(interpreter::op::jmp_un_64, target); }
+
+		// Mask shares the width of the offset, so it bounds the smallest width as well
+
+		inline builder& jmp_msk(label target, uint64_t mask, interpreter::type type)
+		{
+			return __branch(interpreter::op::jmp_msk_64, target, mask, type);
+		}
+
+		// Callback offset is the last operand of the op and always 32-bit, its other operands are
+		// the ones of nativecall
+
+		template <typename ...T>
+		inline builder& callback(label target, interpreter::abi_type abi, T... types)
+		{
+			if (target.index >= _labels.size())
+				throw std::runtime_error(_err_msg_wrong_label);
+			else
+			{
+				auto data = __nativecall<endianness>(abi, types...);
+				data[0ui64] = (uint8_t)interpreter::op::callback;
+
+				put(data);
+				_branches.push_back(branch{ _code.size(), target.index, 0ui64, 4ui64, interpreter::op::callback, interpreter::type::v0 });
+
+				return *this;
+			}
+		}
+
+		std::vector<uint8_t> assemble()
+		{
+			for (const position& pos : _labels)
+				if (pos.offset == ~0ui64)
+					throw std::runtime_error(_err_msg_free_label);
+
+			// Shifts[i] is what the first i branches take with the widths picked so far, widths
+			// only grow, so each branch grows at most three times before the loop ends
+
+			std::vector<uint64_t> shifts(_branches.size() + 1ui64, 0ui64);
+			bool grown = true;
+
+			while (grown)
+			{
+				grown = false;
+
+				for (uint64_t i = 0ui64; i < _branches.size(); ++i)
+					shifts[i + 1ui64] = shifts[i] + __size(_branches[i]);
+
+				for (uint64_t i = 0ui64; i < _branches.size(); ++i)
+				{
+					branch& br = _branches[i];
+					const position& pos = _labels[br.target];
+
+					if (!__fits((int64_t)(pos.offset + shifts[pos.branches]) - (int64_t)(br.offset + shifts[i + 1ui64]), br.width))
+					{
+						if (br.op_64 == interpreter::op::callback)
+							throw std::runtime_error(_err_msg_far_label);
+
+						br.width <<= 1ui64;
+						grown = true;
+					}
+				}
+			}
+
+			std::vector<uint8_t> code;
+			uint64_t offset = 0ui64;
+
+			code.reserve(_code.size() + _branches.size() * 9ui64);
+
+			for (uint64_t i = 0ui64; i < _branches.size(); ++i)
+			{
+				const branch& br = _branches[i];
+				const position& pos = _labels[br.target];
+
+				code.insert(code.end(), _code.begin() + (ptrdiff_t)offset, _code.begin() + (ptrdiff_t)br.offset);
+
+				if (br.op_64 != interpreter::op::callback)
+					code.push_back((uint8_t)((uint64_t)br.op_64 + 3ui64 - (uint64_t)std::countr_zero(br.width)));
+
+				if (br.op_64 == interpreter::op::jmp_msk_64)
+				{
+					code.push_back((uint8_t)br.type);
+					__put(code, br.mask, br.width);
+				}
+
+				__put(code, (pos.offset + shifts[pos.branches]) - (br.offset + shifts[i + 1ui64]), br.width);
+				offset = br.offset;
+			}
+
+			code.insert(code.end(), _code.begin() + (ptrdiff_t)offset, _code.end());
+
+			return code;
+		}
+	};
 }
\ No newline at end of file
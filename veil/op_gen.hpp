@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+
+#include "op.hpp"
+
+// Generated by compiler::opgen, do not edit
+
+namespace interpreter
+{
+	// gen_ops - sequences behind gen_0 .. gen_3 in the order fuse_ops tries them, a sequence
+	//           ends at its first nop and an empty one is never fused
+
+	inline constexpr uint64_t gen_count = 4ui64;
+	inline constexpr uint64_t gen_length = 3ui64;
+
+	inline constexpr op gen_ops[gen_count][gen_length] =
+	{
+		{ op::nop, op::nop, op::nop },
+		{ op::nop, op::nop, op::nop },
+		{ op::nop, op::nop, op::nop },
+		{ op::nop, op::nop, op::nop }
+	};
+}
\ No newline at end of file
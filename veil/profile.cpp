@@ -0,0 +1,79 @@
+#include "profile.hpp"
+
+using namespace interpreter;
+using namespace std;
+
+inline void op_profile::__def_obj() noexcept
+{
+	_code_beg = (const uint8_t*)nullptr;
+	_code_end = (const uint8_t*)nullptr;
+
+	_counts = (uint64_t*)nullptr;
+	_total = 0ui64;
+}
+
+inline void op_profile::__del_obj() noexcept
+{
+	if (_counts != (uint64_t*)nullptr)
+		delete[] _counts;
+}
+
+inline void op_profile::__mov_obj(op_profile&& o) noexcept
+{
+	_code_beg = move(o._code_beg);
+	_code_end = move(o._code_end);
+
+	_counts = move(o._counts);
+	_total = move(o._total);
+}
+
+op_profile::op_profile() noexcept
+{
+	__def_obj();
+}
+
+op_profile::op_profile(const uint8_t* bcode, const uint8_t* ecode)
+{
+	__def_obj();
+
+	if (bcode < ecode)
+	{
+		_counts = (uint64_t*)new uint64_t[ecode - bcode];
+		memset(_counts, 0ui8, (uint64_t)sizeof(uint64_t) * (uint64_t)(ecode - bcode));
+
+		_code_beg = bcode;
+		_code_end = ecode;
+	}
+}
+
+op_profile::op_profile(op_profile&& o) noexcept
+{
+	__mov_obj(move(o));
+	o.__def_obj();
+}
+
+op_profile::~op_profile() noexcept
+{
+	__del_obj();
+	__def_obj();
+}
+
+void op_profile::reset() noexcept
+{
+	if (_counts != (uint64_t*)nullptr)
+		memset(_counts, 0ui8, (uint64_t)sizeof(uint64_t) * (uint64_t)(_code_end - _code_beg));
+
+	_total = 0ui64;
+}
+
+op_profile& op_profile::operator=(op_profile&& o) noexcept
+{
+	if (this != &o)
+	{
+		__del_obj();
+		__mov_obj(move(o));
+		o.__def_obj();
+	}
+
+	return *this;
+}
\ No newline at end of file
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+namespace interpreter
+{
+	// op_profile - dispatch count of every code byte an op was fetched from, a fused op is
+	//              counted once for its whole sequence
+
+	class op_profile
+	{
+	private:
+		const uint8_t* _code_beg;
+		const uint8_t* _code_end;
+
+		uint64_t* _counts;
+		uint64_t _total;
+
+		inline void __def_obj() noexcept;
+		inline void __del_obj() noexcept;
+		inline void __mov_obj(op_profile&& o) noexcept;
+
+	public:
+		op_profile() noexcept;
+		op_profile(const uint8_t* bcode, const uint8_t* ecode);
+		op_profile(const op_profile& o) = delete;
+		op_profile(op_profile&& o) noexcept;
+		~op_profile() noexcept;
+
+		inline void hit(const uint8_t* opptr) noexcept
+		{
+			if (opptr >= _code_beg && opptr < _code_end)
+			{
+				++_counts[opptr - _code_beg];
+				++_total;
+			}
+		}
+
+		inline const uint8_t* get_code_beg() const noexcept
+		{
+			return _code_beg;
+		}
+
+		inline const uint8_t* get_code_end() const noexcept
+		{
+			return _code_end;
+		}
+
+		inline uint64_t get_count(const uint8_t* opptr) const noexcept
+		{
+			if (opptr < _code_beg || opptr >= _code_end)
+				return 0ui64;
+			else
+				return _counts[opptr - _code_beg];
+		}
+
+		inline uint64_t get_total() const noexcept
+		{
+			return _total;
+		}
+
+		void reset() noexcept;
+
+		op_profile& operator=(const op_profile& o) = delete;
+		op_profile& operator=(op_profile&& o) noexcept;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,743 @@
+#include "register.hpp"
+
+using namespace interpreter;
+using namespace std;
+
+static constexpr int64_t depth_none = -1i64;
+static constexpr int64_t depth_bad = -2i64;
+
+static inline int64_t fetch_offset(const uint8_t* opptr, uint64_t width)
+{
+	switch (width)
+	{
+	case 8ui64:
+		return (int64_t)((const val64<>*)opptr)->si;
+
+	case 4ui64:
+		return (int64_t)((const val32<>*)opptr)->si;
+
+	case 2ui64:
+		return (int64_t)((const val16<>*)opptr)->si;
+
+	case 1ui64:
+		return (int64_t)((const val8<>*)opptr)->si;
+
+	default:
+		__assume(false);
+		break;
+	}
+}
+
+// Stack effect of op in bytes, false if the depth after op does not follow from the depth before
+
+static inline bool stack_effect(const uint8_t* opptr, op op_code, int64_t& effect)
+{
+	uint64_t pop, push;
+	const bool known = verified_code::get_effect(opptr, op_code, pop, push);
+
+	effect = (int64_t)push - (int64_t)pop;
+	return known;
+}
+
+// Taken comparison states of conditional jumps, indexed by above in bit 0 and below in bit 1
+
+static uint8_t jump_cond(op op_code)
+{
+	switch (((uint64_t)op_code - (uint64_t)op::jmp_64) >> 2ui64)
+	{
+	case 0ui64:
+		return 0x0Fui8;
+
+	case 1ui64:
+		return 0x02ui8;
+
+	case 2ui64:
+		return 0x03ui8;
+
+	case 3ui64:
+		return 0x04ui8;
+
+	case 4ui64:
+		return 0x05ui8;
+
+	case 5ui64:
+		return 0x01ui8;
+
+	case 6ui64:
+		return 0x06ui8;
+
+	default:
+		return 0x08ui8;
+	}
+}
+
+// reg_value - value pushed on the stack that is not written yet, reg or imm is its content and
+//             pos is the register it belongs to, the value is in place when reg equals pos
+
+struct reg_value
+{
+	uint64_t value;
+	int64_t pos;
+	bool imm;
+};
+
+// reg_builder - state of the linear walk over one stretch of code with known stack depth
+
+struct reg_builder
+{
+	vector<register_op> ops;
+	vector<reg_value> values;
+	vector<const uint8_t*> targets;
+
+	int64_t depth;
+	int64_t entry;
+	int64_t fresh;
+
+	inline bool in_place(const reg_value& v) const noexcept
+	{
+		return !v.imm && (int64_t)v.value == v.pos;
+	}
+
+	// Pending values occupy registers from -depth up to the first of them
+
+	inline bool pending(int64_t reg) const noexcept
+	{
+		const int64_t base = depth - (int64_t)values.size() * 8i64;
+		return !values.empty() && reg + 8i64 > -depth && reg < -base;
+	}
+
+	uint64_t emit(reg_op code, int64_t dst, uint64_t a, uint64_t b, const uint8_t* target)
+	{
+		register_op rec;
+
+		rec.a = a;
+		rec.b = b;
+		rec.dst = (int32_t)dst;
+		rec.target = ~0ui32;
+		rec.depth = entry >= 0i64 ? (uint32_t)entry : (uint32_t)depth;
+		rec.code = code;
+		rec.cond = 0ui8;
+
+		entry = depth_none;
+		fresh = -1i64;
+
+		ops.push_back(rec);
+		targets.push_back(target);
+
+		return (uint64_t)ops.size() - 1ui64;
+	}
+
+	void place(reg_value& v)
+	{
+		if (!in_place(v))
+		{
+			emit(v.imm ? reg_op::mov_i : reg_op::mov_r, v.pos, v.value, 0ui64, (const uint8_t*)nullptr);
+
+			v.value = (uint64_t)v.pos;
+			v.imm = false;
+		}
+	}
+
+	void flush()
+	{
+		for (reg_value& v : values)
+			place(v);
+
+		values.clear();
+	}
+
+	// Values read from register reg are placed before it is written
+
+	bool clobbers(int64_t reg) const noexcept
+	{
+		if (pending(reg))
+			return true;
+
+		for (const reg_value& v : values)
+			if (!v.imm && !in_place(v) && (int64_t)v.value + 8i64 > reg && (int64_t)v.value < reg + 8i64)
+				return true;
+
+		return false;
+	}
+
+	void clobber(int64_t reg)
+	{
+		if (pending(reg))
+			flush();
+		else
+			for (reg_value& v : values)
+				if (!v.imm && !in_place(v) && (int64_t)v.value + 8i64 > reg && (int64_t)v.value < reg + 8i64)
+					place(v);
+	}
+
+	void push(uint64_t value, bool imm)
+	{
+		depth += 8i64;
+		values.push_back({ value, -depth, imm });
+	}
+
+	reg_value pop()
+	{
+		reg_value v;
+
+		if (values.empty())
+			v = { (uint64_t)-depth, -depth, false };
+		else
+		{
+			v = values.back();
+			values.pop_back();
+		}
+
+		depth -= 8i64;
+		return v;
+	}
+
+	void step(const uint8_t* opptr)
+	{
+		flush();
+		emit(reg_op::step, 0i64, (uint64_t)(uintptr_t)opptr, (uint64_t)depth, (const uint8_t*)nullptr);
+	}
+};
+
+static uint64_t fold(reg_op code, uint64_t a, uint64_t b)
+{
+	switch (code)
+	{
+	case reg_op::add_i:
+		return a + b;
+
+	case reg_op::sub_i:
+		return a - b;
+
+	case reg_op::mul_i:
+		return a * b;
+
+	case reg_op::and_i:
+		return a & b;
+
+	case reg_op::or_i:
+		return a | b;
+
+	default:
+		return a ^ b;
+	}
+}
+
+inline void register_code::__def_obj() noexcept
+{
+	_code_beg = (const uint8_t*)nullptr;
+	_code_end = (const uint8_t*)nullptr;
+
+	_ops = (register_op*)nullptr;
+	_index = (uint32_t*)nullptr;
+	_count = 0ui64;
+}
+
+inline void register_code::__del_obj() noexcept
+{
+	if (_ops != (register_op*)nullptr)
+		delete[] _ops;
+
+	if (_index != (uint32_t*)nullptr)
+		delete[] _index;
+}
+
+inline void register_code::__mov_obj(register_code&& o) noexcept
+{
+	_code_beg = move(o._code_beg);
+	_code_end = move(o._code_end);
+
+	_ops = move(o._ops);
+	_index = move(o._index);
+	_count = move(o._count);
+}
+
+register_code::register_code() noexcept
+{
+	__def_obj();
+}
+
+register_code::register_code(const uint8_t* bcode, const uint8_t* ecode)
+{
+	const uint64_t code_size = (uint64_t)(ecode - bcode);
+
+	__def_obj();
+
+	if (code_size >= (uint64_t)~0ui32)
+		throw runtime_error(_err_msg_large_code);
+	else
+	{
+		try
+		{
+			_code_beg = bcode;
+			_code_end = ecode;
+
+			// Stack depth at every op reachable from the code start and call targets, each of
+			// them is entered with empty frame; ops reached with different depths are bad
+
+			vector<int64_t> depth(code_size, depth_none);
+			vector<bool> label(code_size, false);
+			vector<uint64_t> work;
+
+			const auto reach = [&](const uint8_t* opptr, int64_t d)
+			{
+				if (opptr < bcode || opptr >= ecode || d < 0i64)
+					return;
+
+				int64_t& known = depth[opptr - bcode];
+
+				if (known == depth_none)
+				{
+					known = d;
+					work.push_back((uint64_t)(opptr - bcode));
+				}
+				else if (known != d)
+					known = depth_bad;
+			};
+
+			if (code_size != 0ui64)
+			{
+				reach(bcode, 0i64);
+				label[0] = true;
+			}
+
+			while (!work.empty())
+			{
+				const uint8_t* opptr = bcode + (ptrdiff_t)work.back();
+				const int64_t d = depth[opptr - bcode];
+				const uint64_t size = decoded_code::get_size(opptr, ecode);
+
+				work.pop_back();
+
+				if (size == 0ui64 || d < 0i64)
+					continue;
+
+				const uint8_t* next = opptr + (ptrdiff_t)size;
+				const op op_code = verified_code::get_base((op)*opptr);
+				const uint8_t* target = verified_code::get_target(opptr, next, op_code);
+				int64_t effect;
+
+				if (op_code == op::exit || op_code == op::ret || op_code == op::pop_flow || !stack_effect(opptr, op_code, effect))
+					continue;
+
+				if ((uint64_t)op_code >= (uint64_t)op::call_64 && (uint64_t)op_code <= (uint64_t)op::call_8)
+				{
+					reach(target, 0i64);
+					reach(next, d);
+				}
+				else if (target != (const uint8_t*)nullptr)
+				{
+					reach(target, d);
+
+					if ((uint64_t)op_code > (uint64_t)op::jmp_8)
+						reach(next, d);
+				}
+				else
+					reach(next, d + effect);
+			}
+
+			// Records are entered at the code start, call targets, targets of translated jumps
+			// and after every stepped op, all of them where the linear walk finds an op
+
+			vector<bool> start(code_size, false);
+
+			for (const uint8_t* opptr = bcode; opptr < ecode;)
+			{
+				const uint64_t size = decoded_code::get_size(opptr, ecode);
+
+				if (size == 0ui64)
+				{
+					++opptr;
+					continue;
+				}
+
+				start[opptr - bcode] = true;
+
+				const uint8_t* next = opptr + (ptrdiff_t)size;
+				const op op_code = verified_code::get_base((op)*opptr);
+				const uint8_t* target = verified_code::get_target(opptr, next, op_code);
+
+				if (target >= bcode && target < ecode)
+				{
+					if ((uint64_t)op_code >= (uint64_t)op::call_64 && (uint64_t)op_code <= (uint64_t)op::call_8)
+						label[target - bcode] = depth[target - bcode] == 0i64;
+					else if (depth[opptr - bcode] >= 0i64 && depth[target - bcode] == depth[opptr - bcode])
+						label[target - bcode] = true;
+				}
+
+				opptr = next;
+			}
+
+			for (uint64_t i = 0ui64; i < code_size; ++i)
+				label[i] = label[i] && start[i];
+
+			_index = (uint32_t*)new uint32_t[code_size];
+			memset(_index, 0xFFui8, (uint64_t)sizeof(uint32_t) * code_size);
+
+			reg_builder b;
+
+			b.depth = 0i64;
+			b.entry = depth_none;
+			b.fresh = -1i64;
+
+			bool active = false;
+
+			for (const uint8_t* opptr = bcode; opptr < ecode;)
+			{
+				const uint64_t pos = (uint64_t)(opptr - bcode);
+				const uint64_t size = decoded_code::get_size(opptr, ecode);
+				const int64_t known = depth[pos];
+
+				if (active && (size == 0ui64 || known != b.depth))
+				{
+					b.step(opptr);
+					active = false;
+				}
+
+				if (size == 0ui64)
+				{
+					++opptr;
+					continue;
+				}
+
+				if (label[pos] && known >= 0i64)
+				{
+					if (active)
+						b.flush();
+
+					// Other ops jump here too, so no result before the label is retargeted
+
+					b.depth = known;
+					b.entry = known;
+					b.fresh = -1i64;
+
+					_index[pos] = (uint32_t)b.ops.size();
+					active = true;
+				}
+
+				const uint8_t* next = opptr + (ptrdiff_t)size;
+
+				if (!active)
+				{
+					opptr = next;
+					continue;
+				}
+
+				const op op_code = verified_code::get_base((op)*opptr);
+
+				switch (op_code)
+				{
+				case op::nop:
+					break;
+
+				case op::exit:
+					b.flush();
+					b.emit(reg_op::exit, 0i64, (uint64_t)(uintptr_t)opptr, 0ui64, (const uint8_t*)nullptr);
+					active = false;
+					break;
+
+				case op::push_64:
+					b.push(((const val64<>*)(opptr + (ptrdiff_t)1))->ui, true);
+					break;
+
+				case op::pop_64:
+					b.pop();
+					break;
+
+				case op::dup_64:
+				{
+					const reg_value v = b.values.empty() ? reg_value{ (uint64_t)-b.depth, -b.depth, false } : b.values.back();
+
+					b.push(v.imm || !b.in_place(v) ? v.value : (uint64_t)v.pos, v.imm);
+					break;
+				}
+
+				case op::s_load_64:
+				case op::l_load_64:
+				{
+					const int64_t reg = op_code == op::s_load_64 ? fetch_offset(opptr + (ptrdiff_t)1, 1ui64) : fetch_offset(opptr + (ptrdiff_t)1, 2ui64);
+					const int64_t slot = reg >= 0i64 ? reg + 16i64 : reg - 7i64;
+
+					// Slots below the stack top are not registers
+
+					if (slot < -b.depth)
+					{
+						b.step(opptr);
+						active = false;
+						break;
+					}
+
+					if (b.pending(slot))
+						b.flush();
+
+					b.push((uint64_t)slot, false);
+					break;
+				}
+
+				case op::s_store_64:
+				case op::l_store_64:
+				{
+					const int64_t reg = op_code == op::s_store_64 ? fetch_offset(opptr + (ptrdiff_t)1, 1ui64) : fetch_offset(opptr + (ptrdiff_t)1, 2ui64);
+					const int64_t slot = reg >= 0i64 ? reg + 16i64 : reg - 7i64;
+
+					if (slot < -b.depth + 8i64)
+					{
+						b.step(opptr);
+						active = false;
+						break;
+					}
+
+					const int64_t fresh = b.fresh;
+					const reg_value v = b.pop();
+					bool shared = b.clobbers(slot);
+
+					for (const reg_value& u : b.values)
+						shared = shared || (!u.imm && (int64_t)u.value == v.pos);
+
+					// Result of the last op is written to the slot directly when nothing else
+					// reads the register it was pushed to
+
+					if (!shared && fresh >= 0i64 && b.in_place(v) && (int64_t)b.ops[fresh].dst == v.pos)
+						b.ops[fresh].dst = (int32_t)slot;
+					else
+					{
+						b.clobber(slot);
+						b.emit(v.imm ? reg_op::mov_i : reg_op::mov_r, slot, v.value, 0ui64, (const uint8_t*)nullptr);
+					}
+
+					b.fresh = -1i64;
+					break;
+				}
+
+				case op::sadd_64:
+				case op::uadd_64:
+				case op::ssub_64:
+				case op::usub_64:
+				case op::smul_64:
+				case op::umul_64:
+				case op::and_64:
+				case op::or_64:
+				case op::xor_64:
+				{
+					reg_op code;
+
+					switch (op_code)
+					{
+					case op::sadd_64:
+					case op::uadd_64:
+						code = reg_op::add_r;
+						break;
+
+					case op::ssub_64:
+					case op::usub_64:
+						code = reg_op::sub_r;
+						break;
+
+					case op::smul_64:
+					case op::umul_64:
+						code = reg_op::mul_r;
+						break;
+
+					case op::and_64:
+						code = reg_op::and_r;
+						break;
+
+					case op::or_64:
+						code = reg_op::or_r;
+						break;
+
+					default:
+						code = reg_op::xor_r;
+						break;
+					}
+
+					const bool checked = default_policy::opint_check
+						&& (code == reg_op::add_r || code == reg_op::sub_r || code == reg_op::mul_r);
+
+					reg_value r = b.pop();
+					reg_value l = b.pop();
+
+					// Checked ops are not folded since they set evaluation flags
+
+					if (l.imm && r.imm && !checked)
+					{
+						b.push(fold((reg_op)((uint64_t)code + 1ui64), l.value, r.value), true);
+						break;
+					}
+
+					if (l.imm && !r.imm && code != reg_op::sub_r)
+					{
+						swap(l.value, r.value);
+						swap(l.imm, r.imm);
+					}
+					else if (l.imm)
+						b.place(l);
+
+					const uint64_t index = b.emit(r.imm ? (reg_op)((uint64_t)code + 1ui64) : code, l.pos, l.value, r.value, (const uint8_t*)nullptr);
+
+					b.ops[index].cond = (uint8_t)op_code;
+					b.push((uint64_t)l.pos, false);
+					b.fresh = (int64_t)index;
+					break;
+				}
+
+				case op::sinc_64:
+				case op::uinc_64:
+				case op::sdec_64:
+				case op::udec_64:
+				case op::neg_64:
+				case op::not_64:
+				{
+					const bool checked = default_policy::opint_check && op_code != op::not_64;
+
+					reg_value v = b.pop();
+					const bool inc = op_code == op::sinc_64 || op_code == op::uinc_64;
+					const bool dec = op_code == op::sdec_64 || op_code == op::udec_64;
+
+					if (v.imm && checked)
+						b.place(v);
+					else if (v.imm)
+					{
+						if (inc || dec)
+							b.push(inc ? v.value + 1ui64 : v.value - 1ui64, true);
+						else
+							b.push(op_code == op::not_64 ? ~v.value : 0ui64 - v.value, true);
+
+						break;
+					}
+
+					const uint64_t index = inc || dec
+						? b.emit(inc ? reg_op::add_i : reg_op::sub_i, v.pos, v.value, 1ui64, (const uint8_t*)nullptr)
+						: b.emit(op_code == op::not_64 ? reg_op::not_r : reg_op::neg_r, v.pos, v.value, 0ui64, (const uint8_t*)nullptr);
+
+					b.ops[index].cond = (uint8_t)op_code;
+					b.push((uint64_t)v.pos, false);
+					b.fresh = (int64_t)index;
+					break;
+				}
+
+				case op::ucmp_64:
+				case op::scmp_64:
+				{
+					const reg_value r = b.pop();
+					reg_value l = b.pop();
+
+					if (l.imm)
+						b.place(l);
+
+					// Compare followed by a conditional jump nothing else enters is one op
+
+					const uint64_t npos = (uint64_t)(next - bcode);
+					const uint64_t nsize = next < ecode ? decoded_code::get_size(next, ecode) : 0ui64;
+					const op jcc = nsize != 0ui64 ? verified_code::get_base((op)*next) : op::nop;
+
+					if (nsize != 0ui64 && !label[npos] && depth[npos] == b.depth
+						&& (uint64_t)jcc >= (uint64_t)op::jmp_a_64 && (uint64_t)jcc <= (uint64_t)op::jmp_un_8)
+					{
+						const uint8_t* target = verified_code::get_target(next, next + (ptrdiff_t)nsize, jcc);
+
+						if (target >= bcode && target < ecode && label[target - bcode] && depth[target - bcode] == b.depth)
+						{
+							const bool s = op_code == op::scmp_64;
+
+							b.flush();
+
+							const uint64_t index = b.emit(r.imm ? (s ? reg_op::scmp_jcc_i : reg_op::ucmp_jcc_i) : (s ? reg_op::scmp_jcc_r : reg_op::ucmp_jcc_r),
+								0i64, l.value, r.value, target);
+
+							b.ops[index].cond = jump_cond(jcc);
+							next += (ptrdiff_t)nsize;
+							break;
+						}
+					}
+
+					b.emit(op_code == op::scmp_64 ? (r.imm ? reg_op::scmp_i : reg_op::scmp_r) : (r.imm ? reg_op::ucmp_i : reg_op::ucmp_r),
+						0i64, l.value, r.value, (const uint8_t*)nullptr);
+					break;
+				}
+
+				default:
+				{
+					const uint8_t* target = verified_code::get_target(opptr, next, op_code);
+
+					if ((uint64_t)op_code >= (uint64_t)op::jmp_64 && (uint64_t)op_code <= (uint64_t)op::jmp_un_8
+						&& target >= bcode && target < ecode && label[target - bcode] && depth[target - bcode] == b.depth)
+					{
+						b.flush();
+
+						const uint64_t index = b.emit((uint64_t)op_code <= (uint64_t)op::jmp_8 ? reg_op::jmp : reg_op::jcc,
+							0i64, 0ui64, 0ui64, target);
+
+						b.ops[index].cond = jump_cond(op_code);
+						active = (uint64_t)op_code > (uint64_t)op::jmp_8;
+					}
+					else
+					{
+						// Ops without register form run in the interpreter, the op after them
+						// is where the register ops are entered again
+
+						b.step(opptr);
+						active = false;
+
+						if (next < ecode)
+							label[next - bcode] = true;
+					}
+
+					break;
+				}
+				}
+
+				opptr = next;
+			}
+
+			if (active)
+				b.step(ecode);
+
+			// Branches are resolved to records once every label has one
+
+			for (uint64_t i = 0ui64; i < (uint64_t)b.ops.size(); ++i)
+				if (b.targets[i] != (const uint8_t*)nullptr)
+					b.ops[i].target = _index[b.targets[i] - bcode];
+
+			_count = (uint64_t)b.ops.size();
+			_ops = (register_op*)new register_op[_count + 1ui64];
+
+			memcpy(_ops, b.ops.data(), (uint64_t)sizeof(register_op) * _count);
+			memset(_ops + (ptrdiff_t)_count, 0ui8, (uint64_t)sizeof(register_op));
+
+			_ops[_count].code = reg_op::step;
+			_ops[_count].a = (uint64_t)(uintptr_t)ecode;
+		}
+		catch (const exception& e)
+		{
+			__del_obj();
+			__def_obj();
+
+			throw e;
+		}
+	}
+}
+
+register_code::register_code(register_code&& o) noexcept
+{
+	__mov_obj(move(o));
+	o.__def_obj();
+}
+
+register_code::~register_code() noexcept
+{
+	__del_obj();
+	__def_obj();
+}
+
+register_code& register_code::operator=(register_code&& o) noexcept
+{
+	if (this != &o)
+	{
+		__del_obj();
+		__mov_obj(move(o));
+		o.__def_obj();
+	}
+
+	return *this;
+}
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "decode.hpp"
+#include "define.hpp"
+#include "interpreter_type.hpp"
+#include "op.hpp"
+#include "verify.hpp"
+
+namespace interpreter
+{
+	// reg_op - three-address op over 64-bit virtual registers, _r takes register b and _i
+	//          takes immediate b; compares take b as the stack top and a as the value under
+	//          it; jcc and the fused compares branch on cond, a mask of the taken comparison
+	//          states indexed by above in bit 0 and below in bit 1
+
+	enum class reg_op : uint8_t
+	{
+		exit,
+		step,
+		mov_r,
+		mov_i,
+		add_r,
+		add_i,
+		sub_r,
+		sub_i,
+		mul_r,
+		mul_i,
+		and_r,
+		and_i,
+		or_r,
+		or_i,
+		xor_r,
+		xor_i,
+		not_r,
+		neg_r,
+		ucmp_r,
+		ucmp_i,
+		scmp_r,
+		scmp_i,
+		jmp,
+		jcc,
+		ucmp_jcc_r,
+		ucmp_jcc_i,
+		scmp_jcc_r,
+		scmp_jcc_i
+	};
+
+	// register_op - one register op, registers are byte offsets from the frame top of 64-bit
+	//               frame slots or stack temporaries at statically known stack depth
+	//
+	//               a, b   - source registers or immediate b, step keeps its byte code op in a
+	//                        and the bytes between frame top and stack top before it in b
+	//               dst    - destination register
+	//               target - record index of branch destination
+	//               depth  - bytes between frame top and stack top the record is entered at
+	//               code   - handler op
+	//               cond   - jcc mask, byte code op of arithmetic ops for their evaluation flags
+
+	struct alignas(32ui64) register_op
+	{
+		uint64_t a;
+		uint64_t b;
+		int32_t dst;
+		uint32_t target;
+		uint32_t depth;
+		reg_op code;
+		uint8_t cond;
+	};
+
+	// register_code - byte code translated to register ops wherever the stack depth of an op is
+	//                 known from the code start and call targets; pushes of loads, immediates
+	//                 and results stay symbolic until an op consumes them, so a = b + c is one
+	//                 add_r; ops without a register form are stepped by the interpreter
+
+	class register_code
+	{
+	private:
+		static constexpr const char _err_msg_large_code[] = "Code size is too large";
+
+		const uint8_t* _code_beg;
+		const uint8_t* _code_end;
+
+		// Index maps code bytes records can be entered at to their record, ~0 everywhere else
+
+		register_op* _ops;
+		uint32_t* _index;
+		uint64_t _count;
+
+		inline void __def_obj() noexcept;
+		inline void __del_obj() noexcept;
+		inline void __mov_obj(register_code&& o) noexcept;
+
+	public:
+		register_code() noexcept;
+		register_code(const uint8_t* bcode, const uint8_t* ecode);
+		register_code(const register_code& o) = delete;
+		register_code(register_code&& o) noexcept;
+		~register_code() noexcept;
+
+		inline bool empty() const noexcept
+		{
+			return _ops == (register_op*)nullptr;
+		}
+
+		inline uint64_t get_count() const noexcept
+		{
+			return _count;
+		}
+
+		inline const register_op* get_ops() const noexcept
+		{
+			return _ops;
+		}
+
+		// Record entered at op with the given stack depth, null if there is none
+
+		inline const register_op* get_op(const uint8_t* opptr, uint64_t depth) const noexcept
+		{
+			if (opptr < _code_beg || opptr >= _code_end || _index[opptr - _code_beg] == ~0ui32)
+				return (const register_op*)nullptr;
+			else
+			{
+				const register_op* rec = _ops + (ptrdiff_t)_index[opptr - _code_beg];
+				return (uint64_t)rec->depth == depth ? rec : (const register_op*)nullptr;
+			}
+		}
+
+		register_code& operator=(const register_code& o) = delete;
+		register_code& operator=(register_code&& o) noexcept;
+	};
+}
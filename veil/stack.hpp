@@ -105,6 +105,6 @@ namespace interpreter
 		}
 	};
 
-	template <std::endian endianness = std::endian::native>
+	template <std::endian endianness = std::endian::native, typename P = default_policy>
 	class stack : public stack_base {};
 }
\ No newline at end of file
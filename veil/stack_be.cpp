@@ -3,7 +3,8 @@
 using namespace interpreter;
 using namespace std;
 
-stack<endian::big>::stack(uint64_t size) : stack_base(size)
+template <typename P>
+stack<endian::big, P>::stack(uint64_t size) : stack_base(size)
 {
 	_sbeg = (uintptr_t)_data;
 	_send = (uintptr_t)((uintptr_t)_data + (ptrdiff_t)_size);
@@ -12,9 +13,17 @@ stack<endian::big>::stack(uint64_t size) : stack_base(size)
 	_stop = _sbeg;
 }
 
-stack<endian::big>::stack(stack&& o) noexcept : stack_base(move(o)) {}
+template <typename P>
+stack<endian::big, P>::stack(stack&& o) noexcept : stack_base(move(o)) {}
 
-stack<endian::big>& stack<endian::big>::operator=(stack&& o) noexcept
+template <typename P>
+stack<endian::big, P>& stack<endian::big, P>::operator=(stack&& o) noexcept
 {
 	return (stack&)stack_base::operator=(move(o));
-}
\ No newline at end of file
+}
+
+template class stack<endian::big, unchecked_policy>;
+template class stack<endian::big, checked_policy>;
+#ifdef PARTIALCHECK
+template class stack<endian::big, default_policy>;
+#endif
\ No newline at end of file
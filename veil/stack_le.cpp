@@ -3,7 +3,8 @@
 using namespace interpreter;
 using namespace std;
 
-stack<endian::little>::stack(uint64_t size) : stack_base(size)
+template <typename P>
+stack<endian::little, P>::stack(uint64_t size) : stack_base(size)
 {
 	_sbeg = (uintptr_t)((uintptr_t)_data + (ptrdiff_t)_size);
 	_send = (uintptr_t)_data;
@@ -12,9 +13,17 @@ stack<endian::little>::stack(uint64_t size) : stack_base(size)
 	_stop = _sbeg;
 }
 
-stack<endian::little>::stack(stack&& o) noexcept : stack_base(move(o)) {}
+template <typename P>
+stack<endian::little, P>::stack(stack&& o) noexcept : stack_base(move(o)) {}
 
-stack<endian::little>& stack<endian::little>::operator=(stack&& o) noexcept
+template <typename P>
+stack<endian::little, P>& stack<endian::little, P>::operator=(stack&& o) noexcept
 {
 	return (stack&)stack_base::operator=(move(o));
-}
\ No newline at end of file
+}
+
+template class stack<endian::little, unchecked_policy>;
+template class stack<endian::little, checked_policy>;
+#ifdef PARTIALCHECK
+template class stack<endian::little, default_policy>;
+#endif
\ No newline at end of file
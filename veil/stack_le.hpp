@@ -4,8 +4,8 @@
 
 namespace interpreter
 {
-	template <>
-	class stack<std::endian::little> : public stack_base
+	template <typename P>
+	class stack<std::endian::little, P> : public stack_base
 	{
 	private:
 		static inline void __dil_push_ptr(uintptr_t& stop, uintptr_t value)
@@ -84,27 +84,25 @@ namespace interpreter
 			{
 				uintptr_t vptr = _ftop + offset + (ptrdiff_t)(sizeof(uint64_t) * 2ui64);
 
-			#ifdef STACKCHECK
-				if ((uintptr_t)(vptr + (ptrdiff_t)sizeof(V)) > *((uintptr_t*)_ftop))
-					throw std::runtime_error(_err_msg_frame_unf);
-				else
-					return vptr;
-			#else
+				if constexpr (P::stack_check)
+				{
+					if ((uintptr_t)(vptr + (ptrdiff_t)sizeof(V)) > *((uintptr_t*)_ftop))
+						throw std::runtime_error(_err_msg_frame_unf);
+				}
+
 				return vptr;
-			#endif
 			}
 			else
 			{
 				uintptr_t vptr = _ftop - (ptrdiff_t)(~((uintptr_t)offset)) - (ptrdiff_t)sizeof(V);
 
-			#ifdef STACKCHECK
-				if (vptr < _stop)
-					throw std::runtime_error(_err_msg_frame_ovf);
-				else
-					return vptr;
-			#else
+				if constexpr (P::stack_check)
+				{
+					if (vptr < _stop)
+						throw std::runtime_error(_err_msg_frame_ovf);
+				}
+
 				return vptr;
-			#endif
 			}
 		}
 
@@ -196,6 +194,12 @@ namespace interpreter
 				stop += (ptrdiff_t)size;
 		}
 
+		template <VALUE V>
+		static inline V& dil_get(const uintptr_t& ftop, ptrdiff_t offset)
+		{
+			return *((V*)__dil_get_vptr<V>(ftop, offset));
+		}
+
 		template <VALUE V>
 		static inline void dil_load(const uintptr_t& ftop, uintptr_t& stop, ptrdiff_t offset)
 		{
@@ -238,6 +242,28 @@ namespace interpreter
 			return __dil_pop_val<V>(stop);
 		}
 
+		// Checks of ops the code verifier does not prove, pop and push are the bytes an op takes
+		// from and puts on the stack, frame slots are accessed after the op pops
+
+		static inline void dil_check(uintptr_t send, uintptr_t ftop, uintptr_t stop, uint64_t pop, uint64_t push)
+		{
+			if ((uint64_t)(ftop - stop) < pop)
+				throw std::runtime_error(_err_msg_stack_unf);
+			else if ((uint64_t)(stop - send) + pop < push)
+				throw std::runtime_error(_err_msg_stack_ovf);
+		}
+
+		static inline void dil_check_slot(uintptr_t ftop, uintptr_t stop, ptrdiff_t offset, uint64_t size, uint64_t pop)
+		{
+			if (offset >= (ptrdiff_t)0)
+			{
+				if ((uintptr_t)(ftop + offset + (ptrdiff_t)(sizeof(uint64_t) * 2ui64 + size)) > *((uintptr_t*)ftop))
+					throw std::runtime_error(_err_msg_frame_unf);
+			}
+			else if ((uintptr_t)(ftop - (ptrdiff_t)(~((uintptr_t)offset)) - (ptrdiff_t)size) < (uintptr_t)(stop + (ptrdiff_t)pop))
+				throw std::runtime_error(_err_msg_frame_ovf);
+		}
+
 		stack() = delete;
 		stack(uint64_t size);
 		stack(const stack& o) = delete;
@@ -246,124 +272,107 @@ namespace interpreter
 
 		void push_frame(uintptr_t value)
 		{
-		#ifdef STACKCHECK
-			if ((ptrdiff_t)(sizeof(uint64_t) * 2ui64) > __top_off())
-				throw std::runtime_error(_err_msg_stack_ovf);
-			else
+			if constexpr (P::stack_check)
 			{
-				__push_ptr(value);
-				__push_ptr(_ftop);
-				_ftop = _stop;
+				if ((ptrdiff_t)(sizeof(uint64_t) * 2ui64) > __top_off())
+					throw std::runtime_error(_err_msg_stack_ovf);
 			}
-		#else
+
 			__push_ptr(value);
 			__push_ptr(_ftop);
 			_ftop = _stop;
-		#endif
 		}
 
 		uintptr_t pop_frame()
 		{
-		#ifdef STACKCHECK
-			if (_stop > *((uintptr_t*)_ftop))
-				throw std::runtime_error(_err_msg_stack_unf);
-			else
+			if constexpr (P::stack_check)
 			{
-				_stop = _ftop;
-				_ftop = __pop_ptr();
-				return __pop_ptr();
+				if (_stop > *((uintptr_t*)_ftop))
+					throw std::runtime_error(_err_msg_stack_unf);
 			}
-		#else
+
 			_stop = _ftop;
 			_ftop = __pop_ptr();
 			return __pop_ptr();
-		#endif
 		}
 
 		void push_ptr(uintptr_t value)
 		{
-		#ifdef STACKCHECK
-			if ((ptrdiff_t)sizeof(uint64_t) > __top_off())
-				throw std::runtime_error(_err_msg_stack_ovf);
-			else
-				__push_ptr(value);
-		#else
+			if constexpr (P::stack_check)
+			{
+				if ((ptrdiff_t)sizeof(uint64_t) > __top_off())
+					throw std::runtime_error(_err_msg_stack_ovf);
+			}
+
 			__push_ptr(value);
-		#endif
 		}
 
 		uintptr_t pop_ptr()
 		{
-		#ifdef STACKCHECK
-			if ((ptrdiff_t)sizeof(uint64_t) > __bot_off())
-				throw std::runtime_error(_err_msg_stack_unf);
-			else
-				return __pop_ptr();
-		#else
+			if constexpr (P::stack_check)
+			{
+				if ((ptrdiff_t)sizeof(uint64_t) > __bot_off())
+					throw std::runtime_error(_err_msg_stack_unf);
+			}
+
 			return __pop_ptr();
-		#endif
 		}
 
 		void load_frame()
 		{
-		#ifdef STACKCHECK
-			if ((ptrdiff_t)sizeof(uint64_t) > __bot_off())
-				throw std::runtime_error(_err_msg_stack_unf);
-			else
-				_ftop = __pop_ptr();
-		#else
+			if constexpr (P::stack_check)
+			{
+				if ((ptrdiff_t)sizeof(uint64_t) > __bot_off())
+					throw std::runtime_error(_err_msg_stack_unf);
+			}
+
 			_ftop = __pop_ptr();
-		#endif
 		}
 
 		void load_stack()
 		{
-		#ifdef STACKCHECK
-			if ((ptrdiff_t)sizeof(uint64_t) > __bot_off())
-				throw std::runtime_error(_err_msg_stack_unf);
-			else
-				_stop = __pop_ptr();
-		#else
+			if constexpr (P::stack_check)
+			{
+				if ((ptrdiff_t)sizeof(uint64_t) > __bot_off())
+					throw std::runtime_error(_err_msg_stack_unf);
+			}
+
 			_stop = __pop_ptr();
-		#endif
 		}
 
 		void store_frame()
 		{
-		#ifdef STACKCHECK
-			if ((ptrdiff_t)sizeof(uint64_t) > __top_off())
-				throw std::runtime_error(_err_msg_stack_ovf);
-			else
-				__push_ptr(_ftop);
-		#else
+			if constexpr (P::stack_check)
+			{
+				if ((ptrdiff_t)sizeof(uint64_t) > __top_off())
+					throw std::runtime_error(_err_msg_stack_ovf);
+			}
+
 			__push_ptr(_ftop);
-		#endif
 		}
 
 		void store_stack()
 		{
-		#ifdef STACKCHECK
-			if ((ptrdiff_t)sizeof(uint64_t) > __top_off())
-				throw std::runtime_error(_err_msg_stack_ovf);
-			else
-				__push_ptr(_stop);
-		#else
+			if constexpr (P::stack_check)
+			{
+				if ((ptrdiff_t)sizeof(uint64_t) > __top_off())
+					throw std::runtime_error(_err_msg_stack_ovf);
+			}
+
 			__push_ptr(_stop);
-		#endif
 		}
 
 		void alloc(uint64_t size)
 		{
 			if (size != 0ui64)
 			{
-			#ifdef STACKCHECK
-				if (size > __top_off())
-					throw std::runtime_error(_err_msg_stack_ovf);
-				else
-					_stop -= (ptrdiff_t)size;
-			#else
+				if constexpr (P::stack_check)
+				{
+					if (size > __top_off())
+						throw std::runtime_error(_err_msg_stack_ovf);
+				}
+
 				_stop -= (ptrdiff_t)size;
-			#endif
 			}
 		}
 
@@ -371,18 +380,14 @@ namespace interpreter
 		{
 			if (size != 0ui64)
 			{
-			#ifdef STACKCHECK
-				if (size > __top_off())
-					throw std::runtime_error(_err_msg_stack_ovf);
-				else
+				if constexpr (P::stack_check)
 				{
-					_stop -= (ptrdiff_t)size;
-					memset((void*)_stop, (int)0ui8, (size_t)size);
+					if (size > __top_off())
+						throw std::runtime_error(_err_msg_stack_ovf);
 				}
-			#else
+
 				_stop -= (ptrdiff_t)size;
 				memset((void*)_stop, (int)0ui8, (size_t)size);
-			#endif
 			}
 		}
 
@@ -390,108 +395,100 @@ namespace interpreter
 		{
 			if (size != 0ui64)
 			{
-			#ifdef STACKCHECK
-				if (size > __bot_off())
-					throw std::runtime_error(_err_msg_stack_unf);
-				else
-					_stop += (ptrdiff_t)size;
-			#else
+				if constexpr (P::stack_check)
+				{
+					if (size > __bot_off())
+						throw std::runtime_error(_err_msg_stack_unf);
+				}
+
 				_stop += (ptrdiff_t)size;
-			#endif
 			}
 		}
 
 		template <VALUE V>
 		void load(ptrdiff_t offset)
 		{
-		#ifdef STACKCHECK
-			if ((ptrdiff_t)sizeof(V) > __top_off())
-				throw std::runtime_error(_err_msg_stack_ovf);
-			else
-				__push_val<V>(*((V*)__get_vptr<V>(offset)));
-		#else
+			if constexpr (P::stack_check)
+			{
+				if ((ptrdiff_t)sizeof(V) > __top_off())
+					throw std::runtime_error(_err_msg_stack_ovf);
+			}
+
 			__push_val<V>(*((V*)__get_vptr<V>(offset)));
-		#endif
 		}
 
 		template <VALUE V>
 		void store(ptrdiff_t offset)
 		{
-		#ifdef STACKCHECK
-			if ((ptrdiff_t)sizeof(V) > __bot_off())
-				throw std::runtime_error(_err_msg_stack_unf);
-			else
-				*((V*)__get_vptr<V>(offset)) = __pop_val<V>();
-		#else
+			if constexpr (P::stack_check)
+			{
+				if ((ptrdiff_t)sizeof(V) > __bot_off())
+					throw std::runtime_error(_err_msg_stack_unf);
+			}
+
 			*((V*)__get_vptr<V>(offset)) = __pop_val<V>();
-		#endif
 		}
 
 		template <VALUE V>
 		void push(V value)
 		{
-		#ifdef STACKCHECK
-			if ((ptrdiff_t)sizeof(V) > __top_off())
-				throw std::runtime_error(_err_msg_stack_ovf);
-			else
-				__push_val<V>(value);
-		#else
+			if constexpr (P::stack_check)
+			{
+				if ((ptrdiff_t)sizeof(V) > __top_off())
+					throw std::runtime_error(_err_msg_stack_ovf);
+			}
+
 			__push_val<V>(value);
-		#endif
 		}
 
 		template <VALUE V>
 		void dup()
 		{
-		#ifdef STACKCHECK
-			if ((ptrdiff_t)sizeof(V) > __top_off())
-				throw std::runtime_error(_err_msg_stack_ovf);
-			else if ((ptrdiff_t)sizeof(V) > __bot_off())
-				throw std::runtime_error(_err_msg_stack_unf);
-			else
-				__push_val<V>(__top_val<V>());
-		#else
+			if constexpr (P::stack_check)
+			{
+				if ((ptrdiff_t)sizeof(V) > __top_off())
+					throw std::runtime_error(_err_msg_stack_ovf);
+				else if ((ptrdiff_t)sizeof(V) > __bot_off())
+					throw std::runtime_error(_err_msg_stack_unf);
+			}
+
 			__push_val<V>(__top_val<V>());
-		#endif
 		}
 
 		template <VALUE V>
 		void rem()
 		{
-		#ifdef STACKCHECK
-			if ((ptrdiff_t)sizeof(V) > __bot_off())
-				throw std::runtime_error(_err_msg_stack_unf);
-			else
-				_stop += (ptrdiff_t)sizeof(V);
-		#else
+			if constexpr (P::stack_check)
+			{
+				if ((ptrdiff_t)sizeof(V) > __bot_off())
+					throw std::runtime_error(_err_msg_stack_unf);
+			}
+
 			_stop += (ptrdiff_t)sizeof(V);
-		#endif
 		}
 
 		template <VALUE V>
 		V& top()
 		{
-		#ifdef STACKCHECK
-			if ((ptrdiff_t)sizeof(V) > __bot_off())
-				throw std::runtime_error(_err_msg_stack_unf);
-			else
-				return __top_val<V>();
-		#else
+			if constexpr (P::stack_check)
+			{
+				if ((ptrdiff_t)sizeof(V) > __bot_off())
+					throw std::runtime_error(_err_msg_stack_unf);
+			}
+
 			return __top_val<V>();
-		#endif
 		}
 
 		template <VALUE V>
 		V pop()
 		{
-		#ifdef STACKCHECK
-			if ((ptrdiff_t)sizeof(V) > __bot_off())
-				throw std::runtime_error(_err_msg_stack_unf);
-			else
-				return __pop_val<V>();
-		#else
+			if constexpr (P::stack_check)
+			{
+				if ((ptrdiff_t)sizeof(V) > __bot_off())
+					throw std::runtime_error(_err_msg_stack_unf);
+			}
+
 			return __pop_val<V>();
-		#endif
 		}
 
 		stack& operator=(const stack& o) = delete;
@@ -0,0 +1,371 @@
+#include "stencil.hpp"
+
+#ifdef X64JIT
+#include <sys/mman.h>
+
+#include "stencil_gen.hpp"
+
+using namespace interpreter;
+using namespace std;
+
+// placed_stencil - stencil copy at pos in the native code, end and target are byte code addresses
+
+struct placed_stencil
+{
+	const stencil* st;
+	const uint8_t* opptr;
+	const uint8_t* end;
+	const uint8_t* target;
+	uint64_t pos;
+	uint64_t size;
+};
+
+static inline int64_t fetch_offset(const uint8_t* opptr, uint64_t width)
+{
+	switch (width)
+	{
+	case 8ui64:
+		return (int64_t)((const val64<>*)opptr)->si;
+
+	case 4ui64:
+		return (int64_t)((const val32<>*)opptr)->si;
+
+	case 2ui64:
+		return (int64_t)((const val16<>*)opptr)->si;
+
+	case 1ui64:
+		return (int64_t)((const val8<>*)opptr)->si;
+
+	default:
+		__assume(false);
+		break;
+	}
+}
+
+static inline uint64_t fetch_width(op op_code, op op_64)
+{
+	return 8ui64 >> ((uint64_t)op_code - (uint64_t)op_64);
+}
+
+// Number of ops a fused or generated op covers, its stencil runs all of them
+
+static inline uint64_t get_length(op op_code)
+{
+	switch (op_code)
+	{
+	case op::s_ucmp_jmp_64:
+	case op::s_scmp_jmp_64:
+		return 4ui64;
+
+	case op::s_uinc_64:
+	case op::s_udec_64:
+	case op::s_uadd_64:
+		return 3ui64;
+
+	case op::s_move_64:
+		return 2ui64;
+
+	case op::gen_0:
+	case op::gen_1:
+	case op::gen_2:
+	case op::gen_3:
+	{
+		const op* seq = gen_ops[(uint64_t)op_code - (uint64_t)op::gen_0];
+		uint64_t length = 0ui64;
+
+		while (length < gen_length && seq[length] != op::nop)
+			++length;
+
+		return length;
+	}
+
+	default:
+		return 1ui64;
+	}
+}
+
+// Branch target of a jump or call at opptr with the given size, null for other ops
+
+static inline const uint8_t* get_target(const uint8_t* opptr, uint64_t size)
+{
+	const op op_code = decoded_code::get_base((op)*opptr);
+	const uint8_t* next = opptr + (ptrdiff_t)size;
+
+	if ((uint8_t)op_code >= (uint8_t)op::call_64 && (uint8_t)op_code <= (uint8_t)op::call_8)
+		return next + (ptrdiff_t)fetch_offset(opptr + (ptrdiff_t)1, fetch_width(op_code, op::call_64));
+	else if ((uint8_t)op_code >= (uint8_t)op::jmp_64 && (uint8_t)op_code <= (uint8_t)op::jmp_un_8)
+	{
+		const uint64_t group = ((uint64_t)op_code - (uint64_t)op::jmp_64) & ~3ui64;
+
+		return next + (ptrdiff_t)fetch_offset(opptr + (ptrdiff_t)1, fetch_width(op_code, (op)((uint64_t)op::jmp_64 + group)));
+	}
+	else if ((uint8_t)op_code >= (uint8_t)op::jmp_msk_64 && (uint8_t)op_code <= (uint8_t)op::jmp_msk_8)
+	{
+		const uint64_t width = fetch_width(op_code, op::jmp_msk_64);
+
+		return next + (ptrdiff_t)fetch_offset(opptr + (ptrdiff_t)(2ui64 + width), width);
+	}
+	else
+		return (const uint8_t*)nullptr;
+}
+
+inline void stencil_code::__def_obj() noexcept
+{
+	_code_beg = (const uint8_t*)nullptr;
+	_code_end = (const uint8_t*)nullptr;
+
+	_text = (uint8_t*)nullptr;
+	_text_size = 0ui64;
+
+	_entry = (stencil_fn*)nullptr;
+}
+
+inline void stencil_code::__del_obj() noexcept
+{
+	if (_text != (uint8_t*)nullptr)
+		munmap(_text, _text_size);
+
+	if (_entry != (stencil_fn*)nullptr)
+		delete[] _entry;
+}
+
+inline void stencil_code::__mov_obj(stencil_code&& o) noexcept
+{
+	_code_beg = move(o._code_beg);
+	_code_end = move(o._code_end);
+
+	_text = move(o._text);
+	_text_size = move(o._text_size);
+
+	_entry = move(o._entry);
+}
+
+stencil_code::stencil_code() noexcept
+{
+	__def_obj();
+}
+
+stencil_code::stencil_code(const uint8_t* bcode, const uint8_t* ecode)
+{
+	const uint64_t code_size = (uint64_t)(ecode - bcode);
+
+	__def_obj();
+
+	if (code_size >= (uint64_t)~0ui32)
+		throw runtime_error(_err_msg_large_code);
+	else
+	{
+		try
+		{
+			_code_beg = bcode;
+			_code_end = ecode;
+
+			_entry = (stencil_fn*)new stencil_fn[code_size];
+			memset(_entry, 0ui8, (uint64_t)sizeof(stencil_fn) * code_size);
+
+			const stencil* by_code[256ui64] = {};
+
+			for (const stencil& st : stencils)
+				by_code[(uint8_t)st.op_code] = &st;
+
+			// First pass places the shared stencils, every op and a side exit at the code end, then
+			// a side exit for every branch target that is no op start; a stencil whose next op is
+			// copied right behind it loses its closing jump
+
+			vector<placed_stencil> placed;
+			vector<uint64_t> native(code_size + 1ui64, ~0ui64);
+			uint64_t pos = 0ui64;
+
+			auto place = [&](const stencil* st, const uint8_t* opptr, const uint8_t* end, const uint8_t* target, bool cut)
+			{
+				const uint64_t size = cut ? st->tail : st->size;
+
+				placed.push_back(placed_stencil{ st, opptr, end, target, pos, size });
+				pos += size;
+			};
+
+			place(&stencil_leave, (const uint8_t*)nullptr, (const uint8_t*)nullptr, (const uint8_t*)nullptr, false);
+			place(&stencil_lookup, (const uint8_t*)nullptr, (const uint8_t*)nullptr, (const uint8_t*)nullptr, false);
+
+			for (const uint8_t* opptr = bcode; opptr < ecode;)
+			{
+				const uint64_t size = decoded_code::get_size(opptr, ecode);
+				const stencil* st = by_code[*opptr];
+
+				native[opptr - bcode] = pos;
+
+				if (size == 0ui64 || st == (const stencil*)nullptr)
+				{
+					place(&stencil_side, opptr, (const uint8_t*)nullptr, (const uint8_t*)nullptr, false);
+					opptr += size == 0ui64 ? (ptrdiff_t)1 : (ptrdiff_t)size;
+					continue;
+				}
+
+				const uint64_t length = get_length((op)*opptr);
+				const uint8_t* last = opptr;
+				const uint8_t* end = opptr + (ptrdiff_t)size;
+
+				for (uint64_t i = 1ui64; i < length && end < ecode; ++i)
+				{
+					const uint64_t next_size = decoded_code::get_size(end, ecode);
+
+					if (next_size == 0ui64)
+						break;
+
+					last = end;
+					end += (ptrdiff_t)next_size;
+				}
+
+				place(st, opptr, end, get_target(last, (uint64_t)(end - last)), end == opptr + (ptrdiff_t)size);
+				opptr += (ptrdiff_t)size;
+			}
+
+			native[code_size] = pos;
+			place(&stencil_side, ecode, (const uint8_t*)nullptr, (const uint8_t*)nullptr, false);
+
+			const uint64_t op_count = (uint64_t)placed.size();
+			vector<pair<const uint8_t*, uint64_t>> sides;
+
+			auto get_native = [&](const uint8_t* opptr) -> uint64_t
+			{
+				if (opptr >= bcode && opptr <= ecode && native[opptr - bcode] != ~0ui64)
+					return native[opptr - bcode];
+
+				for (const pair<const uint8_t*, uint64_t>& side : sides)
+					if (side.first == opptr)
+						return side.second;
+
+				sides.push_back(make_pair(opptr, pos));
+				place(&stencil_side, opptr, (const uint8_t*)nullptr, (const uint8_t*)nullptr, false);
+
+				return sides.back().second;
+			};
+
+			vector<uint64_t> next_pos(op_count, 0ui64);
+			vector<uint64_t> target_pos(op_count, 0ui64);
+
+			for (uint64_t i = 0ui64; i < op_count; ++i)
+			{
+				if (placed[i].end != (const uint8_t*)nullptr)
+					next_pos[i] = get_native(placed[i].end);
+
+				if (placed[i].target != (const uint8_t*)nullptr)
+					target_pos[i] = get_native(placed[i].target);
+			}
+
+			// Second pass copies and patches into the mapping, the text address is known by now
+
+			void* data = mmap(nullptr, pos, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+			if (data == MAP_FAILED)
+				throw runtime_error(_err_msg_exec_map);
+
+			_text = (uint8_t*)data;
+			_text_size = pos;
+
+			const uint64_t text_addr = (uint64_t)(uintptr_t)_text;
+
+			for (uint64_t i = 0ui64; i < (uint64_t)placed.size(); ++i)
+			{
+				const placed_stencil& ps = placed[i];
+				uint8_t* text = _text + (ptrdiff_t)ps.pos;
+
+				memcpy(text, ps.st->text, ps.size);
+
+				for (uint64_t j = 0ui64; j < ps.st->hole_count; ++j)
+				{
+					const stencil_hole& hole = ps.st->holes[j];
+					uint64_t value;
+
+					if (hole.offset + 8ui64 > ps.size)
+						continue;
+
+					switch (hole.type)
+					{
+					case stencil_hole_type::opptr:
+						value = (uint64_t)(uintptr_t)ps.opptr;
+						break;
+
+					case stencil_hole_type::end:
+						value = (uint64_t)(uintptr_t)ps.end;
+						break;
+
+					case stencil_hole_type::next:
+						value = text_addr + next_pos[i];
+						break;
+
+					case stencil_hole_type::target:
+						value = text_addr + target_pos[i];
+						break;
+
+					case stencil_hole_type::leave:
+						value = text_addr + placed[0].pos;
+						break;
+
+					case stencil_hole_type::lookup:
+						value = text_addr + placed[1].pos;
+						break;
+
+					case stencil_hole_type::table:
+						value = (uint64_t)(uintptr_t)_entry;
+						break;
+
+					case stencil_hole_type::code:
+						value = (uint64_t)(uintptr_t)bcode;
+						break;
+
+					case stencil_hole_type::size:
+						value = code_size;
+						break;
+
+					default:
+						__assume(false);
+						break;
+					}
+
+					value += (uint64_t)hole.addend;
+					memcpy(text + (ptrdiff_t)hole.offset, &value, (uint64_t)sizeof(uint64_t));
+				}
+			}
+
+			for (uint64_t i = 0ui64; i < code_size; ++i)
+				if (native[i] != ~0ui64)
+					_entry[i] = (stencil_fn)(_text + (ptrdiff_t)native[i]);
+
+			if (mprotect(data, pos, PROT_READ | PROT_EXEC) != 0)
+				throw runtime_error(_err_msg_exec_map);
+		}
+		catch (const exception& e)
+		{
+			__del_obj();
+			__def_obj();
+
+			throw e;
+		}
+	}
+}
+
+stencil_code::stencil_code(stencil_code&& o) noexcept
+{
+	__mov_obj(move(o));
+	o.__def_obj();
+}
+
+stencil_code::~stencil_code() noexcept
+{
+	__del_obj();
+	__def_obj();
+}
+
+stencil_code& stencil_code::operator=(stencil_code&& o) noexcept
+{
+	if (this != &o)
+	{
+		__del_obj();
+		__mov_obj(move(o));
+		o.__def_obj();
+	}
+
+	return *this;
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "decode.hpp"
+#include "define.hpp"
+#include "interpreter_type.hpp"
+#include "jit.hpp"
+#include "op.hpp"
+
+#ifdef X64JIT
+namespace interpreter
+{
+	// Every stencil is entered with the machine state in argument registers and leaves through a
+	// tail call with the same arguments, so copied stencils chain without a dispatch in between
+
+	using stencil_fn = void (*)(jit_context* ctx, uintptr_t ftop, uintptr_t stop, uint64_t flags, const uint8_t* opptr);
+
+	// stencil_hole_type - what the loader writes into a hole of a copied stencil
+	//
+	//                     opptr  - op in byte code
+	//                     end    - byte code past the ops the stencil covers
+	//                     next   - native code of the op at end
+	//                     target - native code of the branch target
+	//                     leave  - stencil writing the state back and returning to the dispatcher
+	//                     lookup - stencil finding the native code of a byte code address
+	//                     table  - entry table of the native code
+	//                     code   - byte code begin
+	//                     size   - byte code size
+
+	enum class stencil_hole_type : uint8_t
+	{
+		opptr,
+		end,
+		next,
+		target,
+		leave,
+		lookup,
+		table,
+		code,
+		size
+	};
+
+	// stencil_hole - 64-bit absolute address at offset in the stencil, value is the hole plus addend
+
+	struct stencil_hole
+	{
+		uint64_t offset;
+		int64_t addend;
+		stencil_hole_type type;
+	};
+
+	// stencil - machine code extracted by compiler::stencilgen, tail is the offset of the closing
+	//           jump to the next op, which is cut when that op is copied right behind
+
+	struct stencil
+	{
+		op op_code;
+		const uint8_t* text;
+		uint64_t size;
+		uint64_t tail;
+		const stencil_hole* holes;
+		uint64_t hole_count;
+	};
+
+	// stencil_code - native code copied and patched together from precompiled handler stencils,
+	//                ops without a stencil leave it for the interpreter as in jit_code
+
+	class stencil_code
+	{
+	private:
+		static constexpr const char _err_msg_exec_map[] = "Executable memory mapping failed";
+		static constexpr const char _err_msg_large_code[] = "Code size is too large";
+
+		const uint8_t* _code_beg;
+		const uint8_t* _code_end;
+
+		uint8_t* _text;
+		uint64_t _text_size;
+
+		// Native address of every op start, null inside instructions
+
+		stencil_fn* _entry;
+
+		inline void __def_obj() noexcept;
+		inline void __del_obj() noexcept;
+		inline void __mov_obj(stencil_code&& o) noexcept;
+
+	public:
+		stencil_code() noexcept;
+		stencil_code(const uint8_t* bcode, const uint8_t* ecode);
+		stencil_code(const stencil_code& o) = delete;
+		stencil_code(stencil_code&& o) noexcept;
+		~stencil_code() noexcept;
+
+		inline bool empty() const noexcept
+		{
+			return _text == (uint8_t*)nullptr;
+		}
+
+		inline const uint8_t* get_entry(const uint8_t* opptr) const noexcept
+		{
+			if (opptr < _code_beg || opptr >= _code_end)
+				return (const uint8_t*)nullptr;
+			else
+				return (const uint8_t*)_entry[opptr - _code_beg];
+		}
+
+		inline void run(const uint8_t* entry, jit_context& ctx) const
+		{
+			((stencil_fn)entry)(&ctx, ctx.ftop, ctx.stop, (uint64_t)ctx.comp | ((uint64_t)ctx.eval << 8ui64), ctx.opptr);
+		}
+
+		stencil_code& operator=(const stencil_code& o) = delete;
+		stencil_code& operator=(stencil_code&& o) noexcept;
+	};
+}
+#endif
\ No newline at end of file
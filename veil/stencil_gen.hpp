@@ -0,0 +1,3694 @@
+#pragma once
+
+#include <cstdint>
+
+#include "op.hpp"
+#include "stencil.hpp"
+
+// Generated by compiler::stencilgen from stencil_src.cpp, do not edit
+
+#ifdef X64JIT
+namespace interpreter
+{
+	inline constexpr uint8_t __stencil_text_leave[] =
+	{
+		0x48, 0x89, 0x17, 0x48, 0x89, 0x77, 0x08, 0x4C, 0x89, 0x47, 0x10, 0x66, 0x89, 0x4F, 0x18, 0xC3
+	};
+
+	inline constexpr stencil stencil_leave = { op::nop, __stencil_text_leave, 16ui64, 16ui64, nullptr, 0ui64 };
+
+	inline constexpr uint8_t __stencil_text_lookup[] =
+	{
+		0x49, 0x89, 0xF1, 0x4C, 0x89, 0xC0, 0x48, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x48, 0x29, 0xF0, 0x48, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x39, 0xF0,
+		0x73, 0x1E, 0x48, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x04, 0xC6,
+		0x48, 0x85, 0xC0, 0x74, 0x0B, 0x4C, 0x89, 0xCE, 0xFF, 0xE0, 0x66, 0x0F, 0x1F, 0x44, 0x00, 0x00,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x89, 0xCE, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_lookup[] =
+	{
+		{ 8ui64, 0i64, stencil_hole_type::code },
+		{ 21ui64, 0i64, stencil_hole_type::size },
+		{ 36ui64, 0i64, stencil_hole_type::table },
+		{ 66ui64, 0i64, stencil_hole_type::leave }
+	};
+
+	inline constexpr stencil stencil_lookup = { op::nop, __stencil_text_lookup, 79ui64, 79ui64, __stencil_hole_lookup, 4ui64 };
+
+	inline constexpr uint8_t __stencil_text_side[] =
+	{
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_side[] =
+	{
+		{ 2ui64, 0i64, stencil_hole_type::opptr },
+		{ 12ui64, 0i64, stencil_hole_type::leave }
+	};
+
+	inline constexpr stencil stencil_side = { op::nop, __stencil_text_side, 22ui64, 22ui64, __stencil_hole_side, 2ui64 };
+
+	inline constexpr uint8_t __stencil_text_exit[] =
+	{
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x47, 0x1A, 0x01, 0x48, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_exit[] =
+	{
+		{ 2ui64, 0i64, stencil_hole_type::opptr },
+		{ 16ui64, 0i64, stencil_hole_type::leave }
+	};
+
+	inline constexpr uint8_t __stencil_text_nop[] =
+	{
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_nop[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 15ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_ret[] =
+	{
+		0x48, 0x8B, 0x06, 0x4C, 0x8B, 0x46, 0x08, 0x48, 0x8D, 0x56, 0x10, 0x0F, 0xB7, 0xC9, 0x48, 0x89,
+		0xC6, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_ret[] =
+	{
+		{ 19ui64, 0i64, stencil_hole_type::lookup }
+	};
+
+	inline constexpr uint8_t __stencil_text_call_64[] =
+	{
+		0x48, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x89, 0xF1, 0x48, 0x8D, 0x72,
+		0xF0, 0x0F, 0xB7, 0xC9, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x89,
+		0x4A, 0xF0, 0x4C, 0x89, 0x42, 0xF8, 0x49, 0x01, 0xC0, 0x48, 0x89, 0xF2, 0x48, 0xB8, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_call_64[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 22ui64, 9i64, stencil_hole_type::opptr },
+		{ 46ui64, 0i64, stencil_hole_type::target }
+	};
+
+	inline constexpr uint8_t __stencil_text_call_32[] =
+	{
+		0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x89, 0xF1, 0x48, 0x8D, 0x72, 0xF0,
+		0x0F, 0xB7, 0xC9, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x89, 0x4A,
+		0xF0, 0x48, 0x98, 0x4C, 0x89, 0x42, 0xF8, 0x48, 0x89, 0xF2, 0x49, 0x01, 0xC0, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_call_32[] =
+	{
+		{ 1ui64, 1i64, stencil_hole_type::opptr },
+		{ 21ui64, 5i64, stencil_hole_type::opptr },
+		{ 47ui64, 0i64, stencil_hole_type::target }
+	};
+
+	inline constexpr uint8_t __stencil_text_call_16[] =
+	{
+		0x66, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x89, 0xF1, 0x48, 0x8D, 0x72,
+		0xF0, 0x0F, 0xB7, 0xC9, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x89,
+		0x4A, 0xF0, 0x48, 0x0F, 0xBF, 0xC0, 0x4C, 0x89, 0x42, 0xF8, 0x48, 0x89, 0xF2, 0x49, 0x01, 0xC0,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_call_16[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 22ui64, 3i64, stencil_hole_type::opptr },
+		{ 50ui64, 0i64, stencil_hole_type::target }
+	};
+
+	inline constexpr uint8_t __stencil_text_call_8[] =
+	{
+		0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x89, 0xF1, 0x48, 0x8D, 0x72, 0xF0,
+		0x0F, 0xB7, 0xC9, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x89, 0x4A,
+		0xF0, 0x48, 0x0F, 0xBE, 0xC0, 0x4C, 0x89, 0x42, 0xF8, 0x48, 0x89, 0xF2, 0x49, 0x01, 0xC0, 0x48,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_call_8[] =
+	{
+		{ 1ui64, 1i64, stencil_hole_type::opptr },
+		{ 21ui64, 2i64, stencil_hole_type::opptr },
+		{ 49ui64, 0i64, stencil_hole_type::target }
+	};
+
+	inline constexpr uint8_t __stencil_text_l_alloc[] =
+	{
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x49, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0x40, 0x01, 0x48, 0x29, 0xC2, 0x48, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_l_alloc[] =
+	{
+		{ 2ui64, 0i64, stencil_hole_type::opptr },
+		{ 15ui64, 3i64, stencil_hole_type::opptr },
+		{ 32ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_s_alloc[] =
+	{
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x49, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x40, 0x01, 0x48, 0x29, 0xC2, 0x48, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_s_alloc[] =
+	{
+		{ 2ui64, 0i64, stencil_hole_type::opptr },
+		{ 15ui64, 2i64, stencil_hole_type::opptr },
+		{ 32ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_s_allocz[] =
+	{
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x89, 0xF2, 0x49, 0x89, 0xF9,
+		0x48, 0x89, 0xD6, 0x0F, 0xB6, 0x40, 0x01, 0x48, 0x89, 0xCA, 0x48, 0x85, 0xC0, 0x75, 0x29, 0x49,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xCA, 0x4C, 0x89, 0xCF, 0x48,
+		0x89, 0xF2, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x89, 0xD6, 0xFF,
+		0xE0, 0x0F, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x48, 0x29, 0xC6, 0x83, 0xF8, 0x08, 0x73, 0x20,
+		0xA8, 0x04, 0x75, 0x4C, 0x85, 0xC0, 0x74, 0xC7, 0xC6, 0x06, 0x00, 0xA8, 0x02, 0x74, 0xC0, 0x31,
+		0xC9, 0x66, 0x89, 0x4C, 0x30, 0xFE, 0xEB, 0xB7, 0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x48, 0x8D, 0x7E, 0x08, 0x48, 0x89, 0xF1, 0x48, 0xC7, 0x06, 0x00, 0x00, 0x00, 0x00, 0x48, 0xC7,
+		0x44, 0x30, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xE7, 0xF8, 0x48, 0x29, 0xF9, 0x01, 0xC1,
+		0x89, 0xC8, 0xC1, 0xE8, 0x03, 0x89, 0xC1, 0x31, 0xC0, 0xF3, 0x48, 0xAB, 0xEB, 0x81, 0x66, 0x90,
+		0xC7, 0x06, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x44, 0x30, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x6C,
+		0xFF, 0xFF, 0xFF
+	};
+
+	inline constexpr stencil_hole __stencil_hole_s_allocz[] =
+	{
+		{ 2ui64, 0i64, stencil_hole_type::opptr },
+		{ 33ui64, 2i64, stencil_hole_type::opptr },
+		{ 52ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_l_dealloc[] =
+	{
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xD0, 0x0F, 0xB7, 0xC9,
+		0x48, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0x52, 0x01, 0x48, 0x01,
+		0xC2, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_l_dealloc[] =
+	{
+		{ 2ui64, 3i64, stencil_hole_type::opptr },
+		{ 18ui64, 0i64, stencil_hole_type::opptr },
+		{ 35ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_s_dealloc[] =
+	{
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xD0, 0x0F, 0xB7, 0xC9,
+		0x48, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x52, 0x01, 0x48, 0x01,
+		0xC2, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_s_dealloc[] =
+	{
+		{ 2ui64, 2i64, stencil_hole_type::opptr },
+		{ 18ui64, 0i64, stencil_hole_type::opptr },
+		{ 35ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_push_flow[] =
+	{
+		0x48, 0x8D, 0x42, 0xF8, 0x0F, 0xB7, 0xC9, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x4C, 0x89, 0x42, 0xF8, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_push_flow[] =
+	{
+		{ 9ui64, 1i64, stencil_hole_type::opptr },
+		{ 26ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_push_frame[] =
+	{
+		0x48, 0x8D, 0x42, 0xF8, 0x48, 0x89, 0x72, 0xF8, 0x0F, 0xB7, 0xC9, 0x49, 0xB8, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_push_frame[] =
+	{
+		{ 13ui64, 1i64, stencil_hole_type::opptr },
+		{ 26ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_push_stack[] =
+	{
+		0x48, 0x8D, 0x42, 0xF8, 0x48, 0x89, 0x52, 0xF8, 0x0F, 0xB7, 0xC9, 0x49, 0xB8, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_push_stack[] =
+	{
+		{ 13ui64, 1i64, stencil_hole_type::opptr },
+		{ 26ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_push_state[] =
+	{
+		0x88, 0x4C, 0x24, 0xF6, 0x48, 0x8D, 0x42, 0xFE, 0x88, 0x6C, 0x24, 0xF7, 0x44, 0x0F, 0xB7, 0x44,
+		0x24, 0xF6, 0x0F, 0xB7, 0xC9, 0x66, 0x44, 0x89, 0x42, 0xFE, 0x48, 0x89, 0xC2, 0x49, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_push_state[] =
+	{
+		{ 31ui64, 1i64, stencil_hole_type::opptr },
+		{ 41ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_pop_flow[] =
+	{
+		0x48, 0x8D, 0x42, 0x08, 0x4C, 0x8B, 0x02, 0x0F, 0xB7, 0xC9, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_pop_flow[] =
+	{
+		{ 15ui64, 0i64, stencil_hole_type::lookup }
+	};
+
+	inline constexpr uint8_t __stencil_text_pop_frame[] =
+	{
+		0x48, 0x8D, 0x42, 0x08, 0x48, 0x8B, 0x32, 0x0F, 0xB7, 0xC9, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_pop_frame[] =
+	{
+		{ 12ui64, 1i64, stencil_hole_type::opptr },
+		{ 25ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_pop_stack[] =
+	{
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x12, 0x0F, 0xB7, 0xC9,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_pop_stack[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 18ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_pop_state[] =
+	{
+		0x0F, 0xB7, 0x02, 0x48, 0x83, 0xC2, 0x02, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x0F, 0xB6, 0xCC, 0x0F, 0xB6, 0xC0, 0x0F, 0xB6, 0xC9, 0x48, 0xC1, 0xE1, 0x08, 0x48, 0x09,
+		0xC1, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_pop_state[] =
+	{
+		{ 9ui64, 1i64, stencil_hole_type::opptr },
+		{ 35ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_64[] =
+	{
+		0x48, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x49, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x8D, 0x44, 0x00, 0x08, 0x48, 0xB8, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_64[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 15ui64, 1i64, stencil_hole_type::opptr },
+		{ 30ui64, 0i64, stencil_hole_type::target }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_32[] =
+	{
+		0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x49, 0xB8, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x98, 0x4D, 0x8D, 0x44, 0x00, 0x04, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_32[] =
+	{
+		{ 1ui64, 1i64, stencil_hole_type::opptr },
+		{ 14ui64, 1i64, stencil_hole_type::opptr },
+		{ 31ui64, 0i64, stencil_hole_type::target }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_16[] =
+	{
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x49, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x0F, 0xBF, 0x40, 0x01, 0x4D, 0x8D, 0x44, 0x00,
+		0x02, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_16[] =
+	{
+		{ 2ui64, 0i64, stencil_hole_type::opptr },
+		{ 15ui64, 1i64, stencil_hole_type::opptr },
+		{ 35ui64, 0i64, stencil_hole_type::target }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_8[] =
+	{
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x49, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x0F, 0xBE, 0x40, 0x01, 0x4D, 0x8D, 0x44, 0x00,
+		0x01, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_8[] =
+	{
+		{ 2ui64, 0i64, stencil_hole_type::opptr },
+		{ 15ui64, 1i64, stencil_hole_type::opptr },
+		{ 35ui64, 0i64, stencil_hole_type::target }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_a_64[] =
+	{
+		0x48, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xF6, 0xC1, 0x01, 0x74, 0x05, 0xF6, 0xC1, 0x02, 0x74, 0x22, 0x48, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x49, 0x39, 0xC0, 0x74, 0x18,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0x1F, 0x40, 0x00,
+		0x49, 0x01, 0xC0, 0xEB, 0xD9, 0x0F, 0x1F, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_a_64[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 12ui64, 9i64, stencil_hole_type::opptr },
+		{ 32ui64, 0i64, stencil_hole_type::end },
+		{ 50ui64, 0i64, stencil_hole_type::target },
+		{ 74ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_a_32[] =
+	{
+		0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xF6, 0xC1, 0x01, 0x74, 0x05, 0xF6, 0xC1, 0x02, 0x74, 0x23, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x49, 0x39, 0xC0, 0x74, 0x21, 0x48,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0x1F, 0x44, 0x00, 0x00,
+		0x48, 0x98, 0x49, 0x01, 0xC0, 0xEB, 0xD6, 0x66, 0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_a_32[] =
+	{
+		{ 1ui64, 1i64, stencil_hole_type::opptr },
+		{ 11ui64, 5i64, stencil_hole_type::opptr },
+		{ 31ui64, 0i64, stencil_hole_type::end },
+		{ 49ui64, 0i64, stencil_hole_type::target },
+		{ 82ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_a_16[] =
+	{
+		0x66, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xF6, 0xC1, 0x01, 0x74, 0x05, 0xF6, 0xC1, 0x02, 0x74, 0x22, 0x48, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x49, 0x39, 0xC0, 0x74, 0x20,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0x1F, 0x40, 0x00,
+		0x48, 0x0F, 0xBF, 0xC0, 0x49, 0x01, 0xC0, 0xEB, 0xD5, 0x0F, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_a_16[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 12ui64, 3i64, stencil_hole_type::opptr },
+		{ 32ui64, 0i64, stencil_hole_type::end },
+		{ 50ui64, 0i64, stencil_hole_type::target },
+		{ 82ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_a_8[] =
+	{
+		0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xF6, 0xC1, 0x01, 0x74, 0x05, 0xF6, 0xC1, 0x02, 0x74, 0x23, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x49, 0x39, 0xC0, 0x74, 0x21, 0x48,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0x1F, 0x44, 0x00, 0x00,
+		0x48, 0x0F, 0xBE, 0xC0, 0x49, 0x01, 0xC0, 0xEB, 0xD4, 0x0F, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_a_8[] =
+	{
+		{ 1ui64, 1i64, stencil_hole_type::opptr },
+		{ 11ui64, 2i64, stencil_hole_type::opptr },
+		{ 31ui64, 0i64, stencil_hole_type::end },
+		{ 49ui64, 0i64, stencil_hole_type::target },
+		{ 82ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_ae_64[] =
+	{
+		0x48, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xF6, 0xC1, 0x02, 0x75, 0x03, 0x49, 0x01, 0xC0, 0x48, 0xB8, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x49, 0x39, 0xC0, 0x74, 0x12, 0x48, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x66, 0x0F, 0x1F, 0x44, 0x00, 0x00,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_ae_64[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 12ui64, 9i64, stencil_hole_type::opptr },
+		{ 30ui64, 0i64, stencil_hole_type::end },
+		{ 48ui64, 0i64, stencil_hole_type::target },
+		{ 66ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_ae_32[] =
+	{
+		0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xF6, 0xC1, 0x02, 0x75, 0x05, 0x48, 0x98, 0x49, 0x01, 0xC0, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x49, 0x39, 0xC0, 0x74, 0x11, 0x48,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0x1F, 0x44, 0x00, 0x00,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_ae_32[] =
+	{
+		{ 1ui64, 1i64, stencil_hole_type::opptr },
+		{ 11ui64, 5i64, stencil_hole_type::opptr },
+		{ 31ui64, 0i64, stencil_hole_type::end },
+		{ 49ui64, 0i64, stencil_hole_type::target },
+		{ 66ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_ae_16[] =
+	{
+		0x66, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xF6, 0xC1, 0x02, 0x75, 0x07, 0x48, 0x0F, 0xBF, 0xC0, 0x49, 0x01, 0xC0,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x49, 0x39, 0xC0,
+		0x74, 0x0E, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x66, 0x90,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_ae_16[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 12ui64, 3i64, stencil_hole_type::opptr },
+		{ 34ui64, 0i64, stencil_hole_type::end },
+		{ 52ui64, 0i64, stencil_hole_type::target },
+		{ 66ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_ae_8[] =
+	{
+		0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xF6, 0xC1, 0x02, 0x75, 0x07, 0x48, 0x0F, 0xBE, 0xC0, 0x49, 0x01, 0xC0, 0x48,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x49, 0x39, 0xC0, 0x74,
+		0x0F, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0x1F, 0x00,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_ae_8[] =
+	{
+		{ 1ui64, 1i64, stencil_hole_type::opptr },
+		{ 11ui64, 2i64, stencil_hole_type::opptr },
+		{ 33ui64, 0i64, stencil_hole_type::end },
+		{ 51ui64, 0i64, stencil_hole_type::target },
+		{ 66ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_b_64[] =
+	{
+		0x48, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xF6, 0xC1, 0x01, 0x75, 0x05, 0xF6, 0xC1, 0x02, 0x75, 0x22, 0x48, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x49, 0x39, 0xC0, 0x74, 0x18,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0x1F, 0x40, 0x00,
+		0x49, 0x01, 0xC0, 0xEB, 0xD9, 0x0F, 0x1F, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_b_64[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 12ui64, 9i64, stencil_hole_type::opptr },
+		{ 32ui64, 0i64, stencil_hole_type::end },
+		{ 50ui64, 0i64, stencil_hole_type::target },
+		{ 74ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_b_32[] =
+	{
+		0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xF6, 0xC1, 0x01, 0x75, 0x05, 0xF6, 0xC1, 0x02, 0x75, 0x23, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x49, 0x39, 0xC0, 0x74, 0x21, 0x48,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0x1F, 0x44, 0x00, 0x00,
+		0x48, 0x98, 0x49, 0x01, 0xC0, 0xEB, 0xD6, 0x66, 0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_b_32[] =
+	{
+		{ 1ui64, 1i64, stencil_hole_type::opptr },
+		{ 11ui64, 5i64, stencil_hole_type::opptr },
+		{ 31ui64, 0i64, stencil_hole_type::end },
+		{ 49ui64, 0i64, stencil_hole_type::target },
+		{ 82ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_b_16[] =
+	{
+		0x66, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xF6, 0xC1, 0x01, 0x75, 0x05, 0xF6, 0xC1, 0x02, 0x75, 0x22, 0x48, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x49, 0x39, 0xC0, 0x74, 0x20,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0x1F, 0x40, 0x00,
+		0x48, 0x0F, 0xBF, 0xC0, 0x49, 0x01, 0xC0, 0xEB, 0xD5, 0x0F, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_b_16[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 12ui64, 3i64, stencil_hole_type::opptr },
+		{ 32ui64, 0i64, stencil_hole_type::end },
+		{ 50ui64, 0i64, stencil_hole_type::target },
+		{ 82ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_b_8[] =
+	{
+		0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xF6, 0xC1, 0x01, 0x75, 0x05, 0xF6, 0xC1, 0x02, 0x75, 0x23, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x49, 0x39, 0xC0, 0x74, 0x21, 0x48,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0x1F, 0x44, 0x00, 0x00,
+		0x48, 0x0F, 0xBE, 0xC0, 0x49, 0x01, 0xC0, 0xEB, 0xD4, 0x0F, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_b_8[] =
+	{
+		{ 1ui64, 1i64, stencil_hole_type::opptr },
+		{ 11ui64, 2i64, stencil_hole_type::opptr },
+		{ 31ui64, 0i64, stencil_hole_type::end },
+		{ 49ui64, 0i64, stencil_hole_type::target },
+		{ 82ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_be_64[] =
+	{
+		0x48, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xF6, 0xC1, 0x01, 0x75, 0x03, 0x49, 0x01, 0xC0, 0x48, 0xB8, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x49, 0x39, 0xC0, 0x74, 0x12, 0x48, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x66, 0x0F, 0x1F, 0x44, 0x00, 0x00,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_be_64[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 12ui64, 9i64, stencil_hole_type::opptr },
+		{ 30ui64, 0i64, stencil_hole_type::end },
+		{ 48ui64, 0i64, stencil_hole_type::target },
+		{ 66ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_be_32[] =
+	{
+		0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xF6, 0xC1, 0x01, 0x75, 0x05, 0x48, 0x98, 0x49, 0x01, 0xC0, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x49, 0x39, 0xC0, 0x74, 0x11, 0x48,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0x1F, 0x44, 0x00, 0x00,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_be_32[] =
+	{
+		{ 1ui64, 1i64, stencil_hole_type::opptr },
+		{ 11ui64, 5i64, stencil_hole_type::opptr },
+		{ 31ui64, 0i64, stencil_hole_type::end },
+		{ 49ui64, 0i64, stencil_hole_type::target },
+		{ 66ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_be_16[] =
+	{
+		0x66, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xF6, 0xC1, 0x01, 0x75, 0x07, 0x48, 0x0F, 0xBF, 0xC0, 0x49, 0x01, 0xC0,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x49, 0x39, 0xC0,
+		0x74, 0x0E, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x66, 0x90,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_be_16[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 12ui64, 3i64, stencil_hole_type::opptr },
+		{ 34ui64, 0i64, stencil_hole_type::end },
+		{ 52ui64, 0i64, stencil_hole_type::target },
+		{ 66ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_be_8[] =
+	{
+		0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xF6, 0xC1, 0x01, 0x75, 0x07, 0x48, 0x0F, 0xBE, 0xC0, 0x49, 0x01, 0xC0, 0x48,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x49, 0x39, 0xC0, 0x74,
+		0x0F, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0x1F, 0x00,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_be_8[] =
+	{
+		{ 1ui64, 1i64, stencil_hole_type::opptr },
+		{ 11ui64, 2i64, stencil_hole_type::opptr },
+		{ 33ui64, 0i64, stencil_hole_type::end },
+		{ 51ui64, 0i64, stencil_hole_type::target },
+		{ 66ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_e_64[] =
+	{
+		0x48, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xF6, 0xC1, 0x01, 0x75, 0x05, 0xF6, 0xC1, 0x02, 0x74, 0x22, 0x48, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x49, 0x39, 0xC0, 0x74, 0x18,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0x1F, 0x40, 0x00,
+		0x49, 0x01, 0xC0, 0xEB, 0xD9, 0x0F, 0x1F, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_e_64[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 12ui64, 9i64, stencil_hole_type::opptr },
+		{ 32ui64, 0i64, stencil_hole_type::end },
+		{ 50ui64, 0i64, stencil_hole_type::target },
+		{ 74ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_e_32[] =
+	{
+		0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xF6, 0xC1, 0x01, 0x75, 0x05, 0xF6, 0xC1, 0x02, 0x74, 0x23, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x49, 0x39, 0xC0, 0x74, 0x21, 0x48,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0x1F, 0x44, 0x00, 0x00,
+		0x48, 0x98, 0x49, 0x01, 0xC0, 0xEB, 0xD6, 0x66, 0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_e_32[] =
+	{
+		{ 1ui64, 1i64, stencil_hole_type::opptr },
+		{ 11ui64, 5i64, stencil_hole_type::opptr },
+		{ 31ui64, 0i64, stencil_hole_type::end },
+		{ 49ui64, 0i64, stencil_hole_type::target },
+		{ 82ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_e_16[] =
+	{
+		0x66, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xF6, 0xC1, 0x01, 0x75, 0x05, 0xF6, 0xC1, 0x02, 0x74, 0x22, 0x48, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x49, 0x39, 0xC0, 0x74, 0x20,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0x1F, 0x40, 0x00,
+		0x48, 0x0F, 0xBF, 0xC0, 0x49, 0x01, 0xC0, 0xEB, 0xD5, 0x0F, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_e_16[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 12ui64, 3i64, stencil_hole_type::opptr },
+		{ 32ui64, 0i64, stencil_hole_type::end },
+		{ 50ui64, 0i64, stencil_hole_type::target },
+		{ 82ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_e_8[] =
+	{
+		0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xF6, 0xC1, 0x01, 0x75, 0x05, 0xF6, 0xC1, 0x02, 0x74, 0x23, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x49, 0x39, 0xC0, 0x74, 0x21, 0x48,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0x1F, 0x44, 0x00, 0x00,
+		0x48, 0x0F, 0xBE, 0xC0, 0x49, 0x01, 0xC0, 0xEB, 0xD4, 0x0F, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_e_8[] =
+	{
+		{ 1ui64, 1i64, stencil_hole_type::opptr },
+		{ 11ui64, 2i64, stencil_hole_type::opptr },
+		{ 31ui64, 0i64, stencil_hole_type::end },
+		{ 49ui64, 0i64, stencil_hole_type::target },
+		{ 82ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_ne_64[] =
+	{
+		0x48, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x89, 0xD1, 0x89, 0xCA, 0x41,
+		0x89, 0xCA, 0xD0, 0xEA, 0x41, 0x83, 0xE2, 0x01, 0x0F, 0xB7, 0xC9, 0x49, 0xB8, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xE2, 0x01, 0x4D, 0x89, 0xC3, 0x49, 0x01, 0xC0, 0x48, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x38, 0xD2, 0x4C, 0x89, 0xCA, 0x4D, 0x0F,
+		0x44, 0xC3, 0x49, 0x39, 0xC0, 0x74, 0x11, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xFF, 0xE0, 0x0F, 0x1F, 0x44, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_ne_64[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 29ui64, 9i64, stencil_hole_type::opptr },
+		{ 48ui64, 0i64, stencil_hole_type::end },
+		{ 73ui64, 0i64, stencil_hole_type::target },
+		{ 90ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_ne_32[] =
+	{
+		0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x89, 0xD1, 0x89, 0xCA, 0x41, 0x89,
+		0xCA, 0xD0, 0xEA, 0x41, 0x83, 0xE2, 0x01, 0x0F, 0xB7, 0xC9, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x83, 0xE2, 0x01, 0x48, 0x98, 0x4D, 0x89, 0xC3, 0x49, 0x01, 0xC0, 0x41,
+		0x38, 0xD2, 0x4C, 0x89, 0xCA, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D,
+		0x0F, 0x44, 0xC3, 0x49, 0x39, 0xC0, 0x74, 0x10, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xE0, 0x0F, 0x1F, 0x40, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_ne_32[] =
+	{
+		{ 1ui64, 1i64, stencil_hole_type::opptr },
+		{ 28ui64, 5i64, stencil_hole_type::opptr },
+		{ 55ui64, 0i64, stencil_hole_type::end },
+		{ 74ui64, 0i64, stencil_hole_type::target },
+		{ 90ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_ne_16[] =
+	{
+		0x66, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x89, 0xD1, 0x89, 0xCA, 0x41,
+		0x89, 0xCA, 0xD0, 0xEA, 0x41, 0x83, 0xE2, 0x01, 0x0F, 0xB7, 0xC9, 0x49, 0xB8, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xE2, 0x01, 0x48, 0x0F, 0xBF, 0xC0, 0x4D, 0x89, 0xC3, 0x49,
+		0x01, 0xC0, 0x41, 0x38, 0xD2, 0x4C, 0x89, 0xCA, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x4D, 0x0F, 0x44, 0xC3, 0x49, 0x39, 0xC0, 0x74, 0x15, 0x48, 0xB8, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x66, 0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_ne_16[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 29ui64, 3i64, stencil_hole_type::opptr },
+		{ 58ui64, 0i64, stencil_hole_type::end },
+		{ 77ui64, 0i64, stencil_hole_type::target },
+		{ 98ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_ne_8[] =
+	{
+		0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x89, 0xD1, 0x89, 0xCA, 0x41, 0x89,
+		0xCA, 0xD0, 0xEA, 0x41, 0x83, 0xE2, 0x01, 0x0F, 0xB7, 0xC9, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x83, 0xE2, 0x01, 0x48, 0x0F, 0xBE, 0xC0, 0x4D, 0x89, 0xC3, 0x49, 0x01,
+		0xC0, 0x41, 0x38, 0xD2, 0x4C, 0x89, 0xCA, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x4D, 0x0F, 0x44, 0xC3, 0x49, 0x39, 0xC0, 0x74, 0x16, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x66, 0x2E, 0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_ne_8[] =
+	{
+		{ 1ui64, 1i64, stencil_hole_type::opptr },
+		{ 28ui64, 2i64, stencil_hole_type::opptr },
+		{ 57ui64, 0i64, stencil_hole_type::end },
+		{ 76ui64, 0i64, stencil_hole_type::target },
+		{ 98ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_un_64[] =
+	{
+		0x48, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xF6, 0xC1, 0x01, 0x74, 0x05, 0xF6, 0xC1, 0x02, 0x75, 0x22, 0x48, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x49, 0x39, 0xC0, 0x74, 0x18,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0x1F, 0x40, 0x00,
+		0x49, 0x01, 0xC0, 0xEB, 0xD9, 0x0F, 0x1F, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_un_64[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 12ui64, 9i64, stencil_hole_type::opptr },
+		{ 32ui64, 0i64, stencil_hole_type::end },
+		{ 50ui64, 0i64, stencil_hole_type::target },
+		{ 74ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_un_32[] =
+	{
+		0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xF6, 0xC1, 0x01, 0x74, 0x05, 0xF6, 0xC1, 0x02, 0x75, 0x23, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x49, 0x39, 0xC0, 0x74, 0x21, 0x48,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0x1F, 0x44, 0x00, 0x00,
+		0x48, 0x98, 0x49, 0x01, 0xC0, 0xEB, 0xD6, 0x66, 0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_un_32[] =
+	{
+		{ 1ui64, 1i64, stencil_hole_type::opptr },
+		{ 11ui64, 5i64, stencil_hole_type::opptr },
+		{ 31ui64, 0i64, stencil_hole_type::end },
+		{ 49ui64, 0i64, stencil_hole_type::target },
+		{ 82ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_un_16[] =
+	{
+		0x66, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xF6, 0xC1, 0x01, 0x74, 0x05, 0xF6, 0xC1, 0x02, 0x75, 0x22, 0x48, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x49, 0x39, 0xC0, 0x74, 0x20,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0x1F, 0x40, 0x00,
+		0x48, 0x0F, 0xBF, 0xC0, 0x49, 0x01, 0xC0, 0xEB, 0xD5, 0x0F, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_un_16[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 12ui64, 3i64, stencil_hole_type::opptr },
+		{ 32ui64, 0i64, stencil_hole_type::end },
+		{ 50ui64, 0i64, stencil_hole_type::target },
+		{ 82ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_un_8[] =
+	{
+		0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xF6, 0xC1, 0x01, 0x74, 0x05, 0xF6, 0xC1, 0x02, 0x75, 0x23, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x49, 0x39, 0xC0, 0x74, 0x21, 0x48,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0x1F, 0x44, 0x00, 0x00,
+		0x48, 0x0F, 0xBE, 0xC0, 0x49, 0x01, 0xC0, 0xEB, 0xD4, 0x0F, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_un_8[] =
+	{
+		{ 1ui64, 1i64, stencil_hole_type::opptr },
+		{ 11ui64, 2i64, stencil_hole_type::opptr },
+		{ 31ui64, 0i64, stencil_hole_type::end },
+		{ 49ui64, 0i64, stencil_hole_type::target },
+		{ 82ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_msk_64[] =
+	{
+		0x53, 0x49, 0x89, 0xF2, 0x49, 0x89, 0xD3, 0x49, 0x89, 0xF9, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x4C, 0x8B, 0x00, 0x48, 0x89, 0xCB, 0x48, 0xA1, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0xF5, 0x48, 0x89, 0x44, 0x24, 0xF8, 0x48, 0x8D, 0x54, 0x24,
+		0xF8, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xC0, 0x48, 0x89, 0xE0, 0x75,
+		0x4F, 0x0F, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x0A, 0x89, 0xF7, 0x09, 0xCF, 0x40,
+		0x38, 0xF9, 0x74, 0x61, 0x48, 0x83, 0xC2, 0x01, 0x48, 0x39, 0xD0, 0x75, 0xEB, 0x49, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xCB, 0x4C, 0x89, 0xDA, 0x4C, 0x89, 0xD6,
+		0x4C, 0x89, 0xCF, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x39, 0xC0,
+		0x74, 0x46, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0xFF, 0xE0, 0x90,
+		0x0F, 0xB6, 0x0A, 0x89, 0xF7, 0x21, 0xCF, 0x40, 0x38, 0xF9, 0x74, 0x19, 0x0F, 0x1F, 0x40, 0x00,
+		0x48, 0x83, 0xC2, 0x01, 0x48, 0x39, 0xD0, 0x74, 0xB4, 0x0F, 0xB6, 0x0A, 0x89, 0xF7, 0x21, 0xCF,
+		0x40, 0x38, 0xF9, 0x75, 0xEB, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49,
+		0x01, 0xC0, 0xEB, 0xA3, 0x0F, 0x1F, 0x40, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x5B, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_msk_64[] =
+	{
+		{ 12ui64, 10i64, stencil_hole_type::opptr },
+		{ 28ui64, 2i64, stencil_hole_type::opptr },
+		{ 50ui64, 1i64, stencil_hole_type::opptr },
+		{ 95ui64, 18i64, stencil_hole_type::opptr },
+		{ 117ui64, 0i64, stencil_hole_type::end },
+		{ 132ui64, 0i64, stencil_hole_type::target },
+		{ 183ui64, 18i64, stencil_hole_type::opptr },
+		{ 202ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_msk_32[] =
+	{
+		0x53, 0x49, 0x89, 0xF1, 0x49, 0x89, 0xD2, 0x0F, 0xB6, 0xF5, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xCA, 0x4C, 0x63, 0x00, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x48, 0x89, 0xE3, 0x89, 0x44, 0x24, 0xFC, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x84, 0xC0, 0x48, 0x8D, 0x44, 0x24, 0xFC, 0x75, 0x4C, 0x0F, 0xB6, 0x08, 0x41,
+		0x89, 0xF3, 0x41, 0x09, 0xCB, 0x44, 0x38, 0xD9, 0x74, 0x5E, 0x48, 0x83, 0xC0, 0x01, 0x48, 0x39,
+		0xC3, 0x75, 0xE9, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xCA, 0x4C, 0x89, 0xCE, 0x4C, 0x89, 0xD2,
+		0x49, 0x39, 0xC0, 0x74, 0x4B, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B,
+		0xFF, 0xE0, 0x66, 0x0F, 0x1F, 0x44, 0x00, 0x00, 0x0F, 0xB6, 0x08, 0x41, 0x89, 0xF3, 0x41, 0x21,
+		0xCB, 0x44, 0x38, 0xD9, 0x74, 0x12, 0x48, 0x83, 0xC0, 0x01, 0x48, 0x39, 0xC3, 0x75, 0xE9, 0xEB,
+		0xB2, 0x0F, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x49, 0x01, 0xC0, 0xEB, 0xA6, 0x66, 0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_msk_32[] =
+	{
+		{ 12ui64, 6i64, stencil_hole_type::opptr },
+		{ 27ui64, 2i64, stencil_hole_type::opptr },
+		{ 43ui64, 1i64, stencil_hole_type::opptr },
+		{ 85ui64, 10i64, stencil_hole_type::opptr },
+		{ 95ui64, 0i64, stencil_hole_type::end },
+		{ 119ui64, 0i64, stencil_hole_type::target },
+		{ 170ui64, 10i64, stencil_hole_type::opptr },
+		{ 194ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_msk_16[] =
+	{
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x89, 0xF1, 0x49, 0x89, 0xD2,
+		0x48, 0x89, 0xCE, 0x66, 0x8B, 0x10, 0x48, 0xC1, 0xEE, 0x08, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x66, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x80,
+		0x78, 0x01, 0x00, 0x41, 0x89, 0xD0, 0x74, 0x38, 0x41, 0x21, 0xF0, 0x41, 0x38, 0xD0, 0x74, 0x14,
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0xD6, 0x21, 0xD6, 0x40,
+		0x38, 0xF2, 0x75, 0x38, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x0F,
+		0xBF, 0xC0, 0x49, 0x01, 0xC0, 0xEB, 0x25, 0x66, 0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x41, 0x09, 0xF0, 0x41, 0x38, 0xD0, 0x74, 0xDC, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x0F, 0xB6, 0xD6, 0x09, 0xD6, 0x40, 0x38, 0xD6, 0x74, 0xC8, 0x48, 0xB8, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x4C, 0x89, 0xD2, 0x4C, 0x89, 0xCE, 0x49,
+		0x39, 0xC0, 0x74, 0x0C, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_msk_16[] =
+	{
+		{ 2ui64, 2i64, stencil_hole_type::opptr },
+		{ 28ui64, 0i64, stencil_hole_type::opptr },
+		{ 38ui64, 4i64, stencil_hole_type::opptr },
+		{ 66ui64, 6i64, stencil_hole_type::opptr },
+		{ 86ui64, 6i64, stencil_hole_type::opptr },
+		{ 122ui64, 6i64, stencil_hole_type::opptr },
+		{ 142ui64, 0i64, stencil_hole_type::end },
+		{ 166ui64, 0i64, stencil_hole_type::target },
+		{ 178ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_jmp_msk_8[] =
+	{
+		0x49, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x89, 0xC8, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x8A, 0x10, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x49, 0xC1, 0xE8, 0x08, 0x41, 0x80, 0x79, 0x01, 0x00, 0x75, 0x3A, 0x45, 0x09,
+		0xD0, 0x45, 0x38, 0xC2, 0x75, 0x4A, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x48, 0x0F, 0xBE, 0xC0, 0x49, 0x01, 0xC0, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x0F, 0xB7, 0xC9, 0x49, 0x39, 0xC0, 0x74, 0x37, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0x1F, 0x00, 0x45, 0x89, 0xC1, 0x49, 0xB8, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x21, 0xD1, 0x45, 0x38, 0xCA, 0x75, 0xCA, 0xEB, 0xB7, 0x90,
+		0x4D, 0x8D, 0x41, 0x04, 0xEB, 0xC1, 0x66, 0x2E, 0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_jmp_msk_8[] =
+	{
+		{ 2ui64, 0i64, stencil_hole_type::opptr },
+		{ 15ui64, 2i64, stencil_hole_type::opptr },
+		{ 27ui64, 3i64, stencil_hole_type::opptr },
+		{ 56ui64, 4i64, stencil_hole_type::opptr },
+		{ 73ui64, 0i64, stencil_hole_type::end },
+		{ 91ui64, 0i64, stencil_hole_type::target },
+		{ 109ui64, 4i64, stencil_hole_type::opptr },
+		{ 146ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_l_load_64[] =
+	{
+		0x66, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x0F, 0xBF, 0xC0, 0x4D, 0x8D,
+		0x4C, 0x30, 0xF9, 0x4D, 0x85, 0xC0, 0x78, 0x08, 0x0F, 0xB7, 0xC0, 0x4C, 0x8D, 0x4C, 0x06, 0x10,
+		0x4D, 0x8B, 0x01, 0x48, 0x8D, 0x42, 0xF8, 0x0F, 0xB7, 0xC9, 0x4C, 0x89, 0x42, 0xF8, 0x48, 0x89,
+		0xC2, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_l_load_64[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 51ui64, 3i64, stencil_hole_type::opptr },
+		{ 61ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_l_load_32[] =
+	{
+		0x66, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x0F, 0xBF, 0xC0, 0x4D, 0x8D,
+		0x4C, 0x30, 0xFD, 0x4D, 0x85, 0xC0, 0x78, 0x08, 0x0F, 0xB7, 0xC0, 0x4C, 0x8D, 0x4C, 0x06, 0x10,
+		0x45, 0x8B, 0x01, 0x48, 0x8D, 0x42, 0xFC, 0x0F, 0xB7, 0xC9, 0x44, 0x89, 0x42, 0xFC, 0x48, 0x89,
+		0xC2, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_l_load_32[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 51ui64, 3i64, stencil_hole_type::opptr },
+		{ 61ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_l_load_16[] =
+	{
+		0x66, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x0F, 0xBF, 0xC0, 0x4D, 0x8D,
+		0x4C, 0x30, 0xFF, 0x4D, 0x85, 0xC0, 0x78, 0x08, 0x0F, 0xB7, 0xC0, 0x4C, 0x8D, 0x4C, 0x06, 0x10,
+		0x45, 0x0F, 0xB7, 0x01, 0x48, 0x8D, 0x42, 0xFE, 0x0F, 0xB7, 0xC9, 0x66, 0x44, 0x89, 0x42, 0xFE,
+		0x48, 0x89, 0xC2, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_l_load_16[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 53ui64, 3i64, stencil_hole_type::opptr },
+		{ 63ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_l_load_8[] =
+	{
+		0x66, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x0F, 0xBF, 0xC0, 0x4D, 0x8D,
+		0x0C, 0x30, 0x4D, 0x85, 0xC0, 0x78, 0x08, 0x0F, 0xB7, 0xC0, 0x4C, 0x8D, 0x4C, 0x06, 0x10, 0x45,
+		0x0F, 0xB6, 0x01, 0x48, 0x8D, 0x42, 0xFF, 0x0F, 0xB7, 0xC9, 0x44, 0x88, 0x42, 0xFF, 0x48, 0x89,
+		0xC2, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_l_load_8[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 51ui64, 3i64, stencil_hole_type::opptr },
+		{ 61ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_l_store_64[] =
+	{
+		0x66, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x8B, 0x12, 0x48, 0x83, 0xC2,
+		0x08, 0x4C, 0x0F, 0xBF, 0xC0, 0x4D, 0x8D, 0x4C, 0x30, 0xF9, 0x4D, 0x85, 0xC0, 0x78, 0x08, 0x0F,
+		0xB7, 0xC0, 0x4C, 0x8D, 0x4C, 0x06, 0x10, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x4D, 0x89, 0x11, 0x0F, 0xB7, 0xC9, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_l_store_64[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 41ui64, 3i64, stencil_hole_type::opptr },
+		{ 57ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_l_store_32[] =
+	{
+		0x66, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x8B, 0x12, 0x48, 0x83, 0xC2,
+		0x04, 0x4C, 0x0F, 0xBF, 0xC0, 0x4D, 0x8D, 0x4C, 0x30, 0xFD, 0x4D, 0x85, 0xC0, 0x78, 0x08, 0x0F,
+		0xB7, 0xC0, 0x4C, 0x8D, 0x4C, 0x06, 0x10, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x45, 0x89, 0x11, 0x0F, 0xB7, 0xC9, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_l_store_32[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 41ui64, 3i64, stencil_hole_type::opptr },
+		{ 57ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_l_store_16[] =
+	{
+		0x66, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0F, 0xB7, 0x12, 0x48, 0x83,
+		0xC2, 0x02, 0x4C, 0x0F, 0xBF, 0xC0, 0x4D, 0x8D, 0x4C, 0x30, 0xFF, 0x4D, 0x85, 0xC0, 0x78, 0x08,
+		0x0F, 0xB7, 0xC0, 0x4C, 0x8D, 0x4C, 0x06, 0x10, 0x66, 0x45, 0x89, 0x11, 0x0F, 0xB7, 0xC9, 0x49,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_l_store_16[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 49ui64, 3i64, stencil_hole_type::opptr },
+		{ 59ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_l_store_8[] =
+	{
+		0x66, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0F, 0xB6, 0x12, 0x48, 0x83,
+		0xC2, 0x01, 0x4C, 0x0F, 0xBF, 0xC0, 0x4D, 0x8D, 0x0C, 0x30, 0x4D, 0x85, 0xC0, 0x78, 0x08, 0x0F,
+		0xB7, 0xC0, 0x4C, 0x8D, 0x4C, 0x06, 0x10, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x45, 0x88, 0x11, 0x0F, 0xB7, 0xC9, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_l_store_8[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 41ui64, 3i64, stencil_hole_type::opptr },
+		{ 57ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_s_load_64[] =
+	{
+		0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x0F, 0xBE, 0xC0, 0x4D, 0x8D, 0x4C,
+		0x30, 0xF9, 0x4D, 0x85, 0xC0, 0x78, 0x08, 0x0F, 0xB6, 0xC0, 0x4C, 0x8D, 0x4C, 0x06, 0x10, 0x4D,
+		0x8B, 0x01, 0x48, 0x8D, 0x42, 0xF8, 0x0F, 0xB7, 0xC9, 0x4C, 0x89, 0x42, 0xF8, 0x48, 0x89, 0xC2,
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_s_load_64[] =
+	{
+		{ 1ui64, 1i64, stencil_hole_type::opptr },
+		{ 50ui64, 2i64, stencil_hole_type::opptr },
+		{ 60ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_s_load_32[] =
+	{
+		0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x0F, 0xBE, 0xC0, 0x4D, 0x8D, 0x4C,
+		0x30, 0xFD, 0x4D, 0x85, 0xC0, 0x78, 0x08, 0x0F, 0xB6, 0xC0, 0x4C, 0x8D, 0x4C, 0x06, 0x10, 0x45,
+		0x8B, 0x01, 0x48, 0x8D, 0x42, 0xFC, 0x0F, 0xB7, 0xC9, 0x44, 0x89, 0x42, 0xFC, 0x48, 0x89, 0xC2,
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_s_load_32[] =
+	{
+		{ 1ui64, 1i64, stencil_hole_type::opptr },
+		{ 50ui64, 2i64, stencil_hole_type::opptr },
+		{ 60ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_s_load_16[] =
+	{
+		0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x0F, 0xBE, 0xC0, 0x4D, 0x8D, 0x4C,
+		0x30, 0xFF, 0x4D, 0x85, 0xC0, 0x78, 0x08, 0x0F, 0xB6, 0xC0, 0x4C, 0x8D, 0x4C, 0x06, 0x10, 0x45,
+		0x0F, 0xB7, 0x01, 0x48, 0x8D, 0x42, 0xFE, 0x0F, 0xB7, 0xC9, 0x66, 0x44, 0x89, 0x42, 0xFE, 0x48,
+		0x89, 0xC2, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_s_load_16[] =
+	{
+		{ 1ui64, 1i64, stencil_hole_type::opptr },
+		{ 52ui64, 2i64, stencil_hole_type::opptr },
+		{ 62ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_s_load_8[] =
+	{
+		0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x0F, 0xBE, 0xC0, 0x4D, 0x8D, 0x0C,
+		0x30, 0x4D, 0x85, 0xC0, 0x78, 0x08, 0x0F, 0xB6, 0xC0, 0x4C, 0x8D, 0x4C, 0x06, 0x10, 0x45, 0x0F,
+		0xB6, 0x01, 0x48, 0x8D, 0x42, 0xFF, 0x0F, 0xB7, 0xC9, 0x44, 0x88, 0x42, 0xFF, 0x48, 0x89, 0xC2,
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_s_load_8[] =
+	{
+		{ 1ui64, 1i64, stencil_hole_type::opptr },
+		{ 50ui64, 2i64, stencil_hole_type::opptr },
+		{ 60ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_s_store_64[] =
+	{
+		0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x8B, 0x12, 0x48, 0x83, 0xC2, 0x08,
+		0x4C, 0x0F, 0xBE, 0xC0, 0x4D, 0x8D, 0x4C, 0x30, 0xF9, 0x4D, 0x85, 0xC0, 0x78, 0x08, 0x0F, 0xB6,
+		0xC0, 0x4C, 0x8D, 0x4C, 0x06, 0x10, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x4D, 0x89, 0x11, 0x0F, 0xB7, 0xC9, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_s_store_64[] =
+	{
+		{ 1ui64, 1i64, stencil_hole_type::opptr },
+		{ 40ui64, 2i64, stencil_hole_type::opptr },
+		{ 56ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_s_store_32[] =
+	{
+		0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x8B, 0x12, 0x48, 0x83, 0xC2, 0x04,
+		0x4C, 0x0F, 0xBE, 0xC0, 0x4D, 0x8D, 0x4C, 0x30, 0xFD, 0x4D, 0x85, 0xC0, 0x78, 0x08, 0x0F, 0xB6,
+		0xC0, 0x4C, 0x8D, 0x4C, 0x06, 0x10, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x45, 0x89, 0x11, 0x0F, 0xB7, 0xC9, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_s_store_32[] =
+	{
+		{ 1ui64, 1i64, stencil_hole_type::opptr },
+		{ 40ui64, 2i64, stencil_hole_type::opptr },
+		{ 56ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_s_store_16[] =
+	{
+		0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0F, 0xB7, 0x12, 0x48, 0x83, 0xC2,
+		0x02, 0x4C, 0x0F, 0xBE, 0xC0, 0x4D, 0x8D, 0x4C, 0x30, 0xFF, 0x4D, 0x85, 0xC0, 0x78, 0x08, 0x0F,
+		0xB6, 0xC0, 0x4C, 0x8D, 0x4C, 0x06, 0x10, 0x66, 0x45, 0x89, 0x11, 0x0F, 0xB7, 0xC9, 0x49, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_s_store_16[] =
+	{
+		{ 1ui64, 1i64, stencil_hole_type::opptr },
+		{ 48ui64, 2i64, stencil_hole_type::opptr },
+		{ 58ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_s_store_8[] =
+	{
+		0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0F, 0xB6, 0x12, 0x48, 0x83, 0xC2,
+		0x01, 0x4C, 0x0F, 0xBE, 0xC0, 0x4D, 0x8D, 0x0C, 0x30, 0x4D, 0x85, 0xC0, 0x78, 0x08, 0x0F, 0xB6,
+		0xC0, 0x4C, 0x8D, 0x4C, 0x06, 0x10, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x45, 0x88, 0x11, 0x0F, 0xB7, 0xC9, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_s_store_8[] =
+	{
+		{ 1ui64, 1i64, stencil_hole_type::opptr },
+		{ 40ui64, 2i64, stencil_hole_type::opptr },
+		{ 56ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_push_64[] =
+	{
+		0x48, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x8D, 0x4A, 0xF8, 0x0F, 0xB7,
+		0xC9, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x42, 0xF8, 0x4C,
+		0x89, 0xCA, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_push_64[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 19ui64, 9i64, stencil_hole_type::opptr },
+		{ 36ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_push_32[] =
+	{
+		0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x8D, 0x4A, 0xFC, 0x0F, 0xB7, 0xC9,
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x42, 0xFC, 0x4C, 0x89, 0xCA,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_push_32[] =
+	{
+		{ 1ui64, 1i64, stencil_hole_type::opptr },
+		{ 18ui64, 5i64, stencil_hole_type::opptr },
+		{ 34ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_push_16[] =
+	{
+		0x66, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x8D, 0x4A, 0xFE, 0x0F, 0xB7,
+		0xC9, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x89, 0x42, 0xFE, 0x4C,
+		0x89, 0xCA, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_push_16[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 19ui64, 3i64, stencil_hole_type::opptr },
+		{ 36ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_push_8[] =
+	{
+		0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x8D, 0x4A, 0xFF, 0x0F, 0xB7, 0xC9,
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x42, 0xFF, 0x4C, 0x89, 0xCA,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_push_8[] =
+	{
+		{ 1ui64, 1i64, stencil_hole_type::opptr },
+		{ 18ui64, 2i64, stencil_hole_type::opptr },
+		{ 34ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_pop_64[] =
+	{
+		0x0F, 0xB7, 0xC9, 0x48, 0x83, 0xC2, 0x08, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_pop_64[] =
+	{
+		{ 9ui64, 1i64, stencil_hole_type::opptr },
+		{ 19ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_pop_32[] =
+	{
+		0x0F, 0xB7, 0xC9, 0x48, 0x83, 0xC2, 0x04, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_pop_32[] =
+	{
+		{ 9ui64, 1i64, stencil_hole_type::opptr },
+		{ 19ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_pop_16[] =
+	{
+		0x0F, 0xB7, 0xC9, 0x48, 0x83, 0xC2, 0x02, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_pop_16[] =
+	{
+		{ 9ui64, 1i64, stencil_hole_type::opptr },
+		{ 19ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_pop_8[] =
+	{
+		0x0F, 0xB7, 0xC9, 0x48, 0x83, 0xC2, 0x01, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_pop_8[] =
+	{
+		{ 9ui64, 1i64, stencil_hole_type::opptr },
+		{ 19ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_dup_64[] =
+	{
+		0x4C, 0x8B, 0x02, 0x48, 0x8D, 0x42, 0xF8, 0x0F, 0xB7, 0xC9, 0x4C, 0x89, 0x42, 0xF8, 0x48, 0x89,
+		0xC2, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_dup_64[] =
+	{
+		{ 19ui64, 1i64, stencil_hole_type::opptr },
+		{ 29ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_dup_32[] =
+	{
+		0x44, 0x8B, 0x02, 0x48, 0x8D, 0x42, 0xFC, 0x0F, 0xB7, 0xC9, 0x44, 0x89, 0x42, 0xFC, 0x48, 0x89,
+		0xC2, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_dup_32[] =
+	{
+		{ 19ui64, 1i64, stencil_hole_type::opptr },
+		{ 29ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_dup_16[] =
+	{
+		0x44, 0x0F, 0xB7, 0x02, 0x48, 0x8D, 0x42, 0xFE, 0x0F, 0xB7, 0xC9, 0x66, 0x44, 0x89, 0x42, 0xFE,
+		0x48, 0x89, 0xC2, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_dup_16[] =
+	{
+		{ 21ui64, 1i64, stencil_hole_type::opptr },
+		{ 31ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_dup_8[] =
+	{
+		0x44, 0x0F, 0xB6, 0x02, 0x48, 0x8D, 0x42, 0xFF, 0x0F, 0xB7, 0xC9, 0x44, 0x88, 0x42, 0xFF, 0x48,
+		0x89, 0xC2, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_dup_8[] =
+	{
+		{ 20ui64, 1i64, stencil_hole_type::opptr },
+		{ 30ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_ptrcpy_64[] =
+	{
+		0x48, 0x8B, 0x02, 0x0F, 0xB7, 0xC9, 0x48, 0x83, 0xC2, 0x10, 0x4C, 0x8B, 0x00, 0x48, 0x8B, 0x42,
+		0xF8, 0x4C, 0x89, 0x00, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_ptrcpy_64[] =
+	{
+		{ 22ui64, 1i64, stencil_hole_type::opptr },
+		{ 32ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_ptrcpy_32[] =
+	{
+		0x48, 0x8B, 0x02, 0x0F, 0xB7, 0xC9, 0x48, 0x83, 0xC2, 0x10, 0x44, 0x8B, 0x00, 0x48, 0x8B, 0x42,
+		0xF8, 0x44, 0x89, 0x00, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_ptrcpy_32[] =
+	{
+		{ 22ui64, 1i64, stencil_hole_type::opptr },
+		{ 32ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_ptrcpy_16[] =
+	{
+		0x48, 0x8B, 0x02, 0x0F, 0xB7, 0xC9, 0x48, 0x83, 0xC2, 0x10, 0x44, 0x0F, 0xB7, 0x00, 0x48, 0x8B,
+		0x42, 0xF8, 0x66, 0x44, 0x89, 0x00, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_ptrcpy_16[] =
+	{
+		{ 24ui64, 1i64, stencil_hole_type::opptr },
+		{ 34ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_ptrcpy_8[] =
+	{
+		0x48, 0x8B, 0x02, 0x0F, 0xB7, 0xC9, 0x48, 0x83, 0xC2, 0x10, 0x44, 0x0F, 0xB6, 0x00, 0x48, 0x8B,
+		0x42, 0xF8, 0x44, 0x88, 0x00, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_ptrcpy_8[] =
+	{
+		{ 23ui64, 1i64, stencil_hole_type::opptr },
+		{ 33ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_ptrget_64[] =
+	{
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x02, 0x0F, 0xB7, 0xC9,
+		0x48, 0x8B, 0x00, 0x48, 0x89, 0x02, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_ptrget_64[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 24ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_ptrget_32[] =
+	{
+		0x48, 0x8B, 0x02, 0x0F, 0xB7, 0xC9, 0x44, 0x8B, 0x00, 0x48, 0x8D, 0x42, 0x04, 0x44, 0x89, 0x42,
+		0x04, 0x48, 0x89, 0xC2, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_ptrget_32[] =
+	{
+		{ 22ui64, 1i64, stencil_hole_type::opptr },
+		{ 32ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_ptrget_16[] =
+	{
+		0x48, 0x8B, 0x02, 0x0F, 0xB7, 0xC9, 0x44, 0x0F, 0xB7, 0x00, 0x48, 0x8D, 0x42, 0x06, 0x66, 0x44,
+		0x89, 0x42, 0x06, 0x48, 0x89, 0xC2, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_ptrget_16[] =
+	{
+		{ 24ui64, 1i64, stencil_hole_type::opptr },
+		{ 34ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_ptrget_8[] =
+	{
+		0x48, 0x8B, 0x02, 0x0F, 0xB7, 0xC9, 0x44, 0x0F, 0xB6, 0x00, 0x48, 0x8D, 0x42, 0x07, 0x44, 0x88,
+		0x42, 0x07, 0x48, 0x89, 0xC2, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_ptrget_8[] =
+	{
+		{ 23ui64, 1i64, stencil_hole_type::opptr },
+		{ 33ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_ptrset_64[] =
+	{
+		0x4C, 0x8B, 0x42, 0x08, 0x48, 0x8B, 0x02, 0x0F, 0xB7, 0xC9, 0x48, 0x83, 0xC2, 0x10, 0x4C, 0x89,
+		0x00, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_ptrset_64[] =
+	{
+		{ 19ui64, 1i64, stencil_hole_type::opptr },
+		{ 29ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_ptrset_32[] =
+	{
+		0x44, 0x8B, 0x42, 0x08, 0x48, 0x8B, 0x02, 0x0F, 0xB7, 0xC9, 0x48, 0x83, 0xC2, 0x0C, 0x44, 0x89,
+		0x00, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_ptrset_32[] =
+	{
+		{ 19ui64, 1i64, stencil_hole_type::opptr },
+		{ 29ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_ptrset_16[] =
+	{
+		0x44, 0x0F, 0xB7, 0x42, 0x08, 0x48, 0x8B, 0x02, 0x0F, 0xB7, 0xC9, 0x48, 0x83, 0xC2, 0x0A, 0x66,
+		0x44, 0x89, 0x00, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_ptrset_16[] =
+	{
+		{ 21ui64, 1i64, stencil_hole_type::opptr },
+		{ 31ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_ptrset_8[] =
+	{
+		0x44, 0x0F, 0xB6, 0x42, 0x08, 0x48, 0x8B, 0x02, 0x0F, 0xB7, 0xC9, 0x48, 0x83, 0xC2, 0x09, 0x44,
+		0x88, 0x00, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_ptrset_8[] =
+	{
+		{ 20ui64, 1i64, stencil_hole_type::opptr },
+		{ 30ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_neg_64[] =
+	{
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xF7, 0x1A, 0x0F, 0xB7, 0xC9,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_neg_64[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 18ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_neg_32[] =
+	{
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x1A, 0x0F, 0xB7, 0xC9, 0x48,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_neg_32[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 17ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_neg_16[] =
+	{
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xF7, 0x1A, 0x0F, 0xB7, 0xC9,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_neg_16[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 18ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_neg_8[] =
+	{
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x1A, 0x0F, 0xB7, 0xC9, 0x48,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_neg_8[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 17ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_not_64[] =
+	{
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xF7, 0x12, 0x0F, 0xB7, 0xC9,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_not_64[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 18ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_not_32[] =
+	{
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x12, 0x0F, 0xB7, 0xC9, 0x48,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_not_32[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 17ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_not_16[] =
+	{
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xF7, 0x12, 0x0F, 0xB7, 0xC9,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_not_16[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 18ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_not_8[] =
+	{
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x12, 0x0F, 0xB7, 0xC9, 0x48,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_not_8[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 17ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_sinc_64[] =
+	{
+		0x48, 0x83, 0x02, 0x01, 0x0F, 0xB7, 0xC9, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_sinc_64[] =
+	{
+		{ 9ui64, 1i64, stencil_hole_type::opptr },
+		{ 19ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_sinc_32[] =
+	{
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x02, 0x01, 0x0F, 0xB7, 0xC9,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_sinc_32[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 18ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_sinc_16[] =
+	{
+		0x66, 0x83, 0x02, 0x01, 0x0F, 0xB7, 0xC9, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_sinc_16[] =
+	{
+		{ 9ui64, 1i64, stencil_hole_type::opptr },
+		{ 19ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_sinc_8[] =
+	{
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x01, 0x0F, 0xB7, 0xC9,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_sinc_8[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 18ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_uinc_64[] =
+	{
+		0x48, 0x83, 0x02, 0x01, 0x0F, 0xB7, 0xC9, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_uinc_64[] =
+	{
+		{ 9ui64, 1i64, stencil_hole_type::opptr },
+		{ 19ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_uinc_32[] =
+	{
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x02, 0x01, 0x0F, 0xB7, 0xC9,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_uinc_32[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 18ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_uinc_16[] =
+	{
+		0x66, 0x83, 0x02, 0x01, 0x0F, 0xB7, 0xC9, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_uinc_16[] =
+	{
+		{ 9ui64, 1i64, stencil_hole_type::opptr },
+		{ 19ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_uinc_8[] =
+	{
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x01, 0x0F, 0xB7, 0xC9,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_uinc_8[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 18ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_sdec_64[] =
+	{
+		0x48, 0x83, 0x2A, 0x01, 0x0F, 0xB7, 0xC9, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_sdec_64[] =
+	{
+		{ 9ui64, 1i64, stencil_hole_type::opptr },
+		{ 19ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_sdec_32[] =
+	{
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x2A, 0x01, 0x0F, 0xB7, 0xC9,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_sdec_32[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 18ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_sdec_16[] =
+	{
+		0x66, 0x83, 0x2A, 0x01, 0x0F, 0xB7, 0xC9, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_sdec_16[] =
+	{
+		{ 9ui64, 1i64, stencil_hole_type::opptr },
+		{ 19ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_sdec_8[] =
+	{
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x2A, 0x01, 0x0F, 0xB7, 0xC9,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_sdec_8[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 18ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_udec_64[] =
+	{
+		0x48, 0x83, 0x2A, 0x01, 0x0F, 0xB7, 0xC9, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_udec_64[] =
+	{
+		{ 9ui64, 1i64, stencil_hole_type::opptr },
+		{ 19ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_udec_32[] =
+	{
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x2A, 0x01, 0x0F, 0xB7, 0xC9,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_udec_32[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 18ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_udec_16[] =
+	{
+		0x66, 0x83, 0x2A, 0x01, 0x0F, 0xB7, 0xC9, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_udec_16[] =
+	{
+		{ 9ui64, 1i64, stencil_hole_type::opptr },
+		{ 19ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_udec_8[] =
+	{
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x2A, 0x01, 0x0F, 0xB7, 0xC9,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_udec_8[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 18ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_and_64[] =
+	{
+		0x48, 0x8D, 0x42, 0x08, 0x4C, 0x8B, 0x02, 0x0F, 0xB7, 0xC9, 0x4C, 0x21, 0x42, 0x08, 0x49, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_and_64[] =
+	{
+		{ 16ui64, 1i64, stencil_hole_type::opptr },
+		{ 29ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_and_32[] =
+	{
+		0x48, 0x8D, 0x42, 0x04, 0x44, 0x8B, 0x02, 0x0F, 0xB7, 0xC9, 0x44, 0x21, 0x42, 0x04, 0x49, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_and_32[] =
+	{
+		{ 16ui64, 1i64, stencil_hole_type::opptr },
+		{ 29ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_and_16[] =
+	{
+		0x48, 0x8D, 0x42, 0x02, 0x44, 0x0F, 0xB7, 0x02, 0x0F, 0xB7, 0xC9, 0x66, 0x44, 0x21, 0x42, 0x02,
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_and_16[] =
+	{
+		{ 18ui64, 1i64, stencil_hole_type::opptr },
+		{ 31ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_and_8[] =
+	{
+		0x48, 0x8D, 0x42, 0x01, 0x44, 0x0F, 0xB6, 0x02, 0x0F, 0xB7, 0xC9, 0x44, 0x20, 0x42, 0x01, 0x49,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_and_8[] =
+	{
+		{ 17ui64, 1i64, stencil_hole_type::opptr },
+		{ 30ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_or_64[] =
+	{
+		0x48, 0x8D, 0x42, 0x08, 0x4C, 0x8B, 0x02, 0x0F, 0xB7, 0xC9, 0x4C, 0x09, 0x42, 0x08, 0x49, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_or_64[] =
+	{
+		{ 16ui64, 1i64, stencil_hole_type::opptr },
+		{ 29ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_or_32[] =
+	{
+		0x48, 0x8D, 0x42, 0x04, 0x44, 0x8B, 0x02, 0x0F, 0xB7, 0xC9, 0x44, 0x09, 0x42, 0x04, 0x49, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_or_32[] =
+	{
+		{ 16ui64, 1i64, stencil_hole_type::opptr },
+		{ 29ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_or_16[] =
+	{
+		0x48, 0x8D, 0x42, 0x02, 0x44, 0x0F, 0xB7, 0x02, 0x0F, 0xB7, 0xC9, 0x66, 0x44, 0x09, 0x42, 0x02,
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_or_16[] =
+	{
+		{ 18ui64, 1i64, stencil_hole_type::opptr },
+		{ 31ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_or_8[] =
+	{
+		0x48, 0x8D, 0x42, 0x01, 0x44, 0x0F, 0xB6, 0x02, 0x0F, 0xB7, 0xC9, 0x44, 0x08, 0x42, 0x01, 0x49,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_or_8[] =
+	{
+		{ 17ui64, 1i64, stencil_hole_type::opptr },
+		{ 30ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_xor_64[] =
+	{
+		0x48, 0x8D, 0x42, 0x08, 0x4C, 0x8B, 0x02, 0x0F, 0xB7, 0xC9, 0x4C, 0x31, 0x42, 0x08, 0x49, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_xor_64[] =
+	{
+		{ 16ui64, 1i64, stencil_hole_type::opptr },
+		{ 29ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_xor_32[] =
+	{
+		0x48, 0x8D, 0x42, 0x04, 0x44, 0x8B, 0x02, 0x0F, 0xB7, 0xC9, 0x44, 0x31, 0x42, 0x04, 0x49, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_xor_32[] =
+	{
+		{ 16ui64, 1i64, stencil_hole_type::opptr },
+		{ 29ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_xor_16[] =
+	{
+		0x48, 0x8D, 0x42, 0x02, 0x44, 0x0F, 0xB7, 0x02, 0x0F, 0xB7, 0xC9, 0x66, 0x44, 0x31, 0x42, 0x02,
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_xor_16[] =
+	{
+		{ 18ui64, 1i64, stencil_hole_type::opptr },
+		{ 31ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_xor_8[] =
+	{
+		0x48, 0x8D, 0x42, 0x01, 0x44, 0x0F, 0xB6, 0x02, 0x0F, 0xB7, 0xC9, 0x44, 0x30, 0x42, 0x01, 0x49,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_xor_8[] =
+	{
+		{ 17ui64, 1i64, stencil_hole_type::opptr },
+		{ 30ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_sadd_64[] =
+	{
+		0x48, 0x8D, 0x42, 0x08, 0x4C, 0x8B, 0x02, 0x0F, 0xB7, 0xC9, 0x4C, 0x01, 0x42, 0x08, 0x49, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_sadd_64[] =
+	{
+		{ 16ui64, 1i64, stencil_hole_type::opptr },
+		{ 29ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_sadd_32[] =
+	{
+		0x48, 0x8D, 0x42, 0x04, 0x44, 0x8B, 0x02, 0x0F, 0xB7, 0xC9, 0x44, 0x01, 0x42, 0x04, 0x49, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_sadd_32[] =
+	{
+		{ 16ui64, 1i64, stencil_hole_type::opptr },
+		{ 29ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_sadd_16[] =
+	{
+		0x48, 0x8D, 0x42, 0x02, 0x44, 0x0F, 0xB7, 0x02, 0x0F, 0xB7, 0xC9, 0x66, 0x44, 0x01, 0x42, 0x02,
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_sadd_16[] =
+	{
+		{ 18ui64, 1i64, stencil_hole_type::opptr },
+		{ 31ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_sadd_8[] =
+	{
+		0x48, 0x8D, 0x42, 0x01, 0x44, 0x0F, 0xB6, 0x02, 0x0F, 0xB7, 0xC9, 0x44, 0x00, 0x42, 0x01, 0x49,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_sadd_8[] =
+	{
+		{ 17ui64, 1i64, stencil_hole_type::opptr },
+		{ 30ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_uadd_64[] =
+	{
+		0x48, 0x8D, 0x42, 0x08, 0x4C, 0x8B, 0x02, 0x0F, 0xB7, 0xC9, 0x4C, 0x01, 0x42, 0x08, 0x49, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_uadd_64[] =
+	{
+		{ 16ui64, 1i64, stencil_hole_type::opptr },
+		{ 29ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_uadd_32[] =
+	{
+		0x48, 0x8D, 0x42, 0x04, 0x44, 0x8B, 0x02, 0x0F, 0xB7, 0xC9, 0x44, 0x01, 0x42, 0x04, 0x49, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_uadd_32[] =
+	{
+		{ 16ui64, 1i64, stencil_hole_type::opptr },
+		{ 29ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_uadd_16[] =
+	{
+		0x48, 0x8D, 0x42, 0x02, 0x44, 0x0F, 0xB7, 0x02, 0x0F, 0xB7, 0xC9, 0x66, 0x44, 0x01, 0x42, 0x02,
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_uadd_16[] =
+	{
+		{ 18ui64, 1i64, stencil_hole_type::opptr },
+		{ 31ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_uadd_8[] =
+	{
+		0x48, 0x8D, 0x42, 0x01, 0x44, 0x0F, 0xB6, 0x02, 0x0F, 0xB7, 0xC9, 0x44, 0x00, 0x42, 0x01, 0x49,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_uadd_8[] =
+	{
+		{ 17ui64, 1i64, stencil_hole_type::opptr },
+		{ 30ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_ssub_64[] =
+	{
+		0x48, 0x8D, 0x42, 0x08, 0x4C, 0x8B, 0x02, 0x0F, 0xB7, 0xC9, 0x4C, 0x29, 0x42, 0x08, 0x49, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_ssub_64[] =
+	{
+		{ 16ui64, 1i64, stencil_hole_type::opptr },
+		{ 29ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_ssub_32[] =
+	{
+		0x48, 0x8D, 0x42, 0x04, 0x44, 0x8B, 0x02, 0x0F, 0xB7, 0xC9, 0x44, 0x29, 0x42, 0x04, 0x49, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_ssub_32[] =
+	{
+		{ 16ui64, 1i64, stencil_hole_type::opptr },
+		{ 29ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_ssub_16[] =
+	{
+		0x48, 0x8D, 0x42, 0x02, 0x44, 0x0F, 0xB7, 0x02, 0x0F, 0xB7, 0xC9, 0x66, 0x44, 0x29, 0x42, 0x02,
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_ssub_16[] =
+	{
+		{ 18ui64, 1i64, stencil_hole_type::opptr },
+		{ 31ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_ssub_8[] =
+	{
+		0x48, 0x8D, 0x42, 0x01, 0x44, 0x0F, 0xB6, 0x02, 0x0F, 0xB7, 0xC9, 0x44, 0x28, 0x42, 0x01, 0x49,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_ssub_8[] =
+	{
+		{ 17ui64, 1i64, stencil_hole_type::opptr },
+		{ 30ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_usub_64[] =
+	{
+		0x48, 0x8D, 0x42, 0x08, 0x4C, 0x8B, 0x02, 0x0F, 0xB7, 0xC9, 0x4C, 0x29, 0x42, 0x08, 0x49, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_usub_64[] =
+	{
+		{ 16ui64, 1i64, stencil_hole_type::opptr },
+		{ 29ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_usub_32[] =
+	{
+		0x48, 0x8D, 0x42, 0x04, 0x44, 0x8B, 0x02, 0x0F, 0xB7, 0xC9, 0x44, 0x29, 0x42, 0x04, 0x49, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_usub_32[] =
+	{
+		{ 16ui64, 1i64, stencil_hole_type::opptr },
+		{ 29ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_usub_16[] =
+	{
+		0x48, 0x8D, 0x42, 0x02, 0x44, 0x0F, 0xB7, 0x02, 0x0F, 0xB7, 0xC9, 0x66, 0x44, 0x29, 0x42, 0x02,
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_usub_16[] =
+	{
+		{ 18ui64, 1i64, stencil_hole_type::opptr },
+		{ 31ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_usub_8[] =
+	{
+		0x48, 0x8D, 0x42, 0x01, 0x44, 0x0F, 0xB6, 0x02, 0x0F, 0xB7, 0xC9, 0x44, 0x28, 0x42, 0x01, 0x49,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_usub_8[] =
+	{
+		{ 17ui64, 1i64, stencil_hole_type::opptr },
+		{ 30ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_smul_64[] =
+	{
+		0x48, 0x8B, 0x42, 0x08, 0x48, 0x0F, 0xAF, 0x02, 0x0F, 0xB7, 0xC9, 0x4C, 0x8D, 0x4A, 0x08, 0x49,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x42, 0x08, 0x4C, 0x89, 0xCA,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_smul_64[] =
+	{
+		{ 17ui64, 1i64, stencil_hole_type::opptr },
+		{ 34ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_smul_32[] =
+	{
+		0x8B, 0x42, 0x04, 0x0F, 0xAF, 0x02, 0x0F, 0xB7, 0xC9, 0x4C, 0x8D, 0x4A, 0x04, 0x49, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x42, 0x04, 0x4C, 0x89, 0xCA, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_smul_32[] =
+	{
+		{ 15ui64, 1i64, stencil_hole_type::opptr },
+		{ 31ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_smul_16[] =
+	{
+		0x0F, 0xB7, 0x42, 0x02, 0x66, 0x0F, 0xAF, 0x02, 0x0F, 0xB7, 0xC9, 0x4C, 0x8D, 0x4A, 0x02, 0x49,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x89, 0x42, 0x02, 0x4C, 0x89, 0xCA,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_smul_16[] =
+	{
+		{ 17ui64, 1i64, stencil_hole_type::opptr },
+		{ 34ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_smul_8[] =
+	{
+		0x0F, 0xB6, 0x42, 0x01, 0xF6, 0x22, 0x0F, 0xB7, 0xC9, 0x4C, 0x8D, 0x4A, 0x01, 0x49, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x42, 0x01, 0x4C, 0x89, 0xCA, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_smul_8[] =
+	{
+		{ 15ui64, 1i64, stencil_hole_type::opptr },
+		{ 31ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_umul_64[] =
+	{
+		0x48, 0x8B, 0x42, 0x08, 0x48, 0x0F, 0xAF, 0x02, 0x0F, 0xB7, 0xC9, 0x4C, 0x8D, 0x4A, 0x08, 0x49,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x42, 0x08, 0x4C, 0x89, 0xCA,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_umul_64[] =
+	{
+		{ 17ui64, 1i64, stencil_hole_type::opptr },
+		{ 34ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_umul_32[] =
+	{
+		0x8B, 0x42, 0x04, 0x0F, 0xAF, 0x02, 0x0F, 0xB7, 0xC9, 0x4C, 0x8D, 0x4A, 0x04, 0x49, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x42, 0x04, 0x4C, 0x89, 0xCA, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_umul_32[] =
+	{
+		{ 15ui64, 1i64, stencil_hole_type::opptr },
+		{ 31ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_umul_16[] =
+	{
+		0x0F, 0xB7, 0x42, 0x02, 0x66, 0x0F, 0xAF, 0x02, 0x0F, 0xB7, 0xC9, 0x4C, 0x8D, 0x4A, 0x02, 0x49,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x89, 0x42, 0x02, 0x4C, 0x89, 0xCA,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_umul_16[] =
+	{
+		{ 17ui64, 1i64, stencil_hole_type::opptr },
+		{ 34ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_umul_8[] =
+	{
+		0x0F, 0xB6, 0x42, 0x01, 0xF6, 0x22, 0x0F, 0xB7, 0xC9, 0x4C, 0x8D, 0x4A, 0x01, 0x49, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x42, 0x01, 0x4C, 0x89, 0xCA, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_umul_8[] =
+	{
+		{ 15ui64, 1i64, stencil_hole_type::opptr },
+		{ 31ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_smod_64[] =
+	{
+		0x4C, 0x8B, 0x02, 0x49, 0x89, 0xF9, 0x4C, 0x8D, 0x52, 0x08, 0x48, 0x89, 0xD7, 0x4D, 0x85, 0xC0,
+		0x74, 0x19, 0x49, 0x83, 0xF8, 0x01, 0x74, 0x38, 0x49, 0x83, 0xF8, 0xFF, 0x74, 0x32, 0x48, 0x8B,
+		0x42, 0x08, 0x48, 0x99, 0x49, 0xF7, 0xF8, 0x48, 0x89, 0x57, 0x08, 0x0F, 0xB7, 0xC9, 0x4C, 0x89,
+		0xD2, 0x4C, 0x89, 0xCF, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x66, 0x0F, 0x1F, 0x44, 0x00, 0x00,
+		0x48, 0xC7, 0x47, 0x08, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xD1
+	};
+
+	inline constexpr stencil_hole __stencil_hole_smod_64[] =
+	{
+		{ 54ui64, 1i64, stencil_hole_type::opptr },
+		{ 64ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_smod_32[] =
+	{
+		0x44, 0x8B, 0x02, 0x49, 0x89, 0xF9, 0x4C, 0x8D, 0x52, 0x04, 0x48, 0x89, 0xD7, 0x45, 0x85, 0xC0,
+		0x74, 0x16, 0x41, 0x83, 0xF8, 0x01, 0x74, 0x38, 0x41, 0x83, 0xF8, 0xFF, 0x74, 0x32, 0x8B, 0x42,
+		0x04, 0x99, 0x41, 0xF7, 0xF8, 0x89, 0x57, 0x04, 0x0F, 0xB7, 0xC9, 0x4C, 0x89, 0xD2, 0x4C, 0x89,
+		0xCF, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x66, 0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xC7, 0x47, 0x04, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xCF
+	};
+
+	inline constexpr stencil_hole __stencil_hole_smod_32[] =
+	{
+		{ 51ui64, 1i64, stencil_hole_type::opptr },
+		{ 61ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_smod_16[] =
+	{
+		0x49, 0x89, 0xF1, 0x48, 0x89, 0xD6, 0x0F, 0xB7, 0x12, 0x4C, 0x8D, 0x56, 0x02, 0x66, 0x85, 0xD2,
+		0x74, 0x1C, 0x66, 0x83, 0xFA, 0x01, 0x74, 0x38, 0x66, 0x83, 0xFA, 0xFF, 0x74, 0x32, 0x0F, 0xBF,
+		0x46, 0x02, 0x44, 0x0F, 0xBF, 0xC2, 0x99, 0x41, 0xF7, 0xF8, 0x66, 0x89, 0x56, 0x02, 0x0F, 0xB7,
+		0xC9, 0x4C, 0x89, 0xD2, 0x4C, 0x89, 0xCE, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0x1F, 0x00,
+		0x31, 0xC0, 0x66, 0x89, 0x46, 0x02, 0xEB, 0xD6
+	};
+
+	inline constexpr stencil_hole __stencil_hole_smod_16[] =
+	{
+		{ 57ui64, 1i64, stencil_hole_type::opptr },
+		{ 67ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_smod_8[] =
+	{
+		0x49, 0x89, 0xF1, 0x48, 0x89, 0xD6, 0x0F, 0xB6, 0x12, 0x4C, 0x8D, 0x56, 0x01, 0x84, 0xD2, 0x74,
+		0x19, 0x80, 0xFA, 0x01, 0x74, 0x3A, 0x80, 0xFA, 0xFF, 0x74, 0x35, 0x0F, 0xBE, 0x46, 0x01, 0x44,
+		0x0F, 0xBE, 0xC2, 0x99, 0x41, 0xF7, 0xF8, 0x88, 0x56, 0x01, 0x0F, 0xB7, 0xC9, 0x4C, 0x89, 0xD2,
+		0x4C, 0x89, 0xCE, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00,
+		0xC6, 0x46, 0x01, 0x00, 0xEB, 0xD4
+	};
+
+	inline constexpr stencil_hole __stencil_hole_smod_8[] =
+	{
+		{ 53ui64, 1i64, stencil_hole_type::opptr },
+		{ 63ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_umod_64[] =
+	{
+		0x4C, 0x8B, 0x02, 0x49, 0x89, 0xF9, 0x4C, 0x8D, 0x52, 0x08, 0x48, 0x89, 0xD7, 0x4D, 0x85, 0xC0,
+		0x74, 0x0D, 0x48, 0x8B, 0x42, 0x08, 0x31, 0xD2, 0x49, 0xF7, 0xF0, 0x48, 0x89, 0x57, 0x08, 0x0F,
+		0xB7, 0xC9, 0x4C, 0x89, 0xD2, 0x4C, 0x89, 0xCF, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_umod_64[] =
+	{
+		{ 42ui64, 1i64, stencil_hole_type::opptr },
+		{ 52ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_umod_32[] =
+	{
+		0x44, 0x8B, 0x02, 0x49, 0x89, 0xF9, 0x4C, 0x8D, 0x52, 0x04, 0x48, 0x89, 0xD7, 0x45, 0x85, 0xC0,
+		0x74, 0x0B, 0x8B, 0x42, 0x04, 0x31, 0xD2, 0x41, 0xF7, 0xF0, 0x89, 0x57, 0x04, 0x0F, 0xB7, 0xC9,
+		0x4C, 0x89, 0xD2, 0x4C, 0x89, 0xCF, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_umod_32[] =
+	{
+		{ 40ui64, 1i64, stencil_hole_type::opptr },
+		{ 50ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_umod_16[] =
+	{
+		0x44, 0x0F, 0xB7, 0x02, 0x49, 0x89, 0xF9, 0x4C, 0x8D, 0x52, 0x02, 0x48, 0x89, 0xD7, 0x66, 0x45,
+		0x85, 0xC0, 0x74, 0x0E, 0x0F, 0xB7, 0x42, 0x02, 0x31, 0xD2, 0x66, 0x41, 0xF7, 0xF0, 0x66, 0x89,
+		0x57, 0x02, 0x0F, 0xB7, 0xC9, 0x4C, 0x89, 0xD2, 0x4C, 0x89, 0xCF, 0x49, 0xB8, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_umod_16[] =
+	{
+		{ 45ui64, 1i64, stencil_hole_type::opptr },
+		{ 55ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_umod_8[] =
+	{
+		0x44, 0x0F, 0xB6, 0x02, 0x4C, 0x8D, 0x4A, 0x01, 0x45, 0x84, 0xC0, 0x74, 0x0A, 0x0F, 0xB6, 0x42,
+		0x01, 0x41, 0xF6, 0xF0, 0x88, 0x62, 0x01, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x0F, 0xB7, 0xC9, 0x4C, 0x89, 0xCA, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_umod_8[] =
+	{
+		{ 25ui64, 1i64, stencil_hole_type::opptr },
+		{ 41ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_sdiv_64[] =
+	{
+		0x4C, 0x8B, 0x02, 0x49, 0x89, 0xF1, 0x4C, 0x8D, 0x52, 0x08, 0x48, 0x89, 0xD6, 0x4D, 0x85, 0xC0,
+		0x74, 0x13, 0x48, 0x8B, 0x42, 0x08, 0x49, 0x83, 0xF8, 0xFF, 0x74, 0x2C, 0x48, 0x99, 0x49, 0xF7,
+		0xF8, 0x48, 0x89, 0x46, 0x08, 0x0F, 0xB7, 0xC9, 0x4C, 0x89, 0xD2, 0x4C, 0x89, 0xCE, 0x49, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xE0, 0x0F, 0x1F, 0x40, 0x00, 0x48, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x80, 0x48, 0x39, 0xD0, 0x74, 0xCE, 0x48, 0x99, 0x49, 0xF7, 0xF8, 0x48, 0x89, 0x46, 0x08,
+		0xEB, 0xC3
+	};
+
+	inline constexpr stencil_hole __stencil_hole_sdiv_64[] =
+	{
+		{ 48ui64, 1i64, stencil_hole_type::opptr },
+		{ 58ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_sdiv_32[] =
+	{
+		0x44, 0x8B, 0x02, 0x49, 0x89, 0xF1, 0x4C, 0x8D, 0x52, 0x04, 0x48, 0x89, 0xD6, 0x45, 0x85, 0xC0,
+		0x74, 0x10, 0x8B, 0x42, 0x04, 0x41, 0x83, 0xF8, 0xFF, 0x74, 0x2D, 0x99, 0x41, 0xF7, 0xF8, 0x89,
+		0x46, 0x04, 0x0F, 0xB7, 0xC9, 0x4C, 0x89, 0xD2, 0x4C, 0x89, 0xCE, 0x49, 0xB8, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xE0, 0x0F, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x80, 0x74, 0xD3, 0x99,
+		0x41, 0xF7, 0xF8, 0x89, 0x46, 0x04, 0xEB, 0xCA
+	};
+
+	inline constexpr stencil_hole __stencil_hole_sdiv_32[] =
+	{
+		{ 45ui64, 1i64, stencil_hole_type::opptr },
+		{ 55ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_sdiv_16[] =
+	{
+		0x49, 0x89, 0xF2, 0x48, 0x89, 0xD6, 0x0F, 0xB7, 0x12, 0x4C, 0x8D, 0x5E, 0x02, 0x66, 0x85, 0xD2,
+		0x74, 0x16, 0x0F, 0xBF, 0x46, 0x02, 0x66, 0x83, 0xFA, 0xFF, 0x74, 0x34, 0x44, 0x0F, 0xBF, 0xC2,
+		0x99, 0x41, 0xF7, 0xF8, 0x66, 0x89, 0x46, 0x02, 0x0F, 0xB7, 0xC9, 0x4C, 0x89, 0xDA, 0x4C, 0x89,
+		0xD6, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x66, 0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x66, 0x3D, 0x00, 0x80, 0x74, 0xD2, 0x44, 0x0F, 0xBF, 0xC2, 0x99, 0x41, 0xF7, 0xF8, 0x66, 0x89,
+		0x46, 0x02, 0xEB, 0xC4
+	};
+
+	inline constexpr stencil_hole __stencil_hole_sdiv_16[] =
+	{
+		{ 51ui64, 1i64, stencil_hole_type::opptr },
+		{ 61ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_sdiv_8[] =
+	{
+		0x49, 0x89, 0xF2, 0x48, 0x89, 0xD6, 0x0F, 0xB6, 0x12, 0x4C, 0x8D, 0x5E, 0x01, 0x84, 0xD2, 0x74,
+		0x14, 0x0F, 0xBE, 0x46, 0x01, 0x80, 0xFA, 0xFF, 0x74, 0x2E, 0x44, 0x0F, 0xBE, 0xC2, 0x99, 0x41,
+		0xF7, 0xF8, 0x88, 0x46, 0x01, 0x0F, 0xB7, 0xC9, 0x4C, 0x89, 0xDA, 0x4C, 0x89, 0xD6, 0x49, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xE0, 0x0F, 0x1F, 0x40, 0x00, 0x3C, 0x80, 0x74, 0xD9, 0x44, 0x0F, 0xBE, 0xC2,
+		0x99, 0x41, 0xF7, 0xF8, 0x88, 0x46, 0x01, 0xEB, 0xCC
+	};
+
+	inline constexpr stencil_hole __stencil_hole_sdiv_8[] =
+	{
+		{ 48ui64, 1i64, stencil_hole_type::opptr },
+		{ 58ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_udiv_64[] =
+	{
+		0x4C, 0x8B, 0x02, 0x49, 0x89, 0xF9, 0x4C, 0x8D, 0x52, 0x08, 0x48, 0x89, 0xD7, 0x4D, 0x85, 0xC0,
+		0x74, 0x0D, 0x48, 0x8B, 0x42, 0x08, 0x31, 0xD2, 0x49, 0xF7, 0xF0, 0x48, 0x89, 0x47, 0x08, 0x0F,
+		0xB7, 0xC9, 0x4C, 0x89, 0xD2, 0x4C, 0x89, 0xCF, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_udiv_64[] =
+	{
+		{ 42ui64, 1i64, stencil_hole_type::opptr },
+		{ 52ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_udiv_32[] =
+	{
+		0x44, 0x8B, 0x02, 0x49, 0x89, 0xF9, 0x4C, 0x8D, 0x52, 0x04, 0x48, 0x89, 0xD7, 0x45, 0x85, 0xC0,
+		0x74, 0x0B, 0x8B, 0x42, 0x04, 0x31, 0xD2, 0x41, 0xF7, 0xF0, 0x89, 0x47, 0x04, 0x0F, 0xB7, 0xC9,
+		0x4C, 0x89, 0xD2, 0x4C, 0x89, 0xCF, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_udiv_32[] =
+	{
+		{ 40ui64, 1i64, stencil_hole_type::opptr },
+		{ 50ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_udiv_16[] =
+	{
+		0x44, 0x0F, 0xB7, 0x02, 0x49, 0x89, 0xF9, 0x4C, 0x8D, 0x52, 0x02, 0x48, 0x89, 0xD7, 0x66, 0x45,
+		0x85, 0xC0, 0x74, 0x0E, 0x0F, 0xB7, 0x42, 0x02, 0x31, 0xD2, 0x66, 0x41, 0xF7, 0xF0, 0x66, 0x89,
+		0x47, 0x02, 0x0F, 0xB7, 0xC9, 0x4C, 0x89, 0xD2, 0x4C, 0x89, 0xCF, 0x49, 0xB8, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_udiv_16[] =
+	{
+		{ 45ui64, 1i64, stencil_hole_type::opptr },
+		{ 55ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_udiv_8[] =
+	{
+		0x44, 0x0F, 0xB6, 0x02, 0x4C, 0x8D, 0x4A, 0x01, 0x45, 0x84, 0xC0, 0x74, 0x0A, 0x0F, 0xB6, 0x42,
+		0x01, 0x41, 0xF6, 0xF0, 0x88, 0x42, 0x01, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x0F, 0xB7, 0xC9, 0x4C, 0x89, 0xCA, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_udiv_8[] =
+	{
+		{ 25ui64, 1i64, stencil_hole_type::opptr },
+		{ 41ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_scmp_64[] =
+	{
+		0x4C, 0x8B, 0x42, 0x08, 0x4C, 0x8B, 0x0A, 0x48, 0x89, 0xC8, 0x4D, 0x39, 0xC1, 0x0F, 0x9C, 0xC1,
+		0x01, 0xC9, 0x4D, 0x39, 0xC1, 0x41, 0x0F, 0x9F, 0xC0, 0x48, 0x83, 0xC2, 0x10, 0x44, 0x09, 0xC1,
+		0x41, 0x89, 0xC0, 0x25, 0x00, 0xFF, 0x00, 0x00, 0x41, 0x83, 0xE0, 0xFC, 0x44, 0x09, 0xC1, 0x49,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0xC9, 0x48, 0x09, 0xC1, 0x48,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_scmp_64[] =
+	{
+		{ 49ui64, 1i64, stencil_hole_type::opptr },
+		{ 65ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_scmp_32[] =
+	{
+		0x44, 0x8B, 0x42, 0x04, 0x44, 0x8B, 0x0A, 0x48, 0x89, 0xC8, 0x45, 0x39, 0xC1, 0x0F, 0x9C, 0xC1,
+		0x01, 0xC9, 0x45, 0x39, 0xC1, 0x41, 0x0F, 0x9F, 0xC0, 0x48, 0x83, 0xC2, 0x08, 0x44, 0x09, 0xC1,
+		0x41, 0x89, 0xC0, 0x25, 0x00, 0xFF, 0x00, 0x00, 0x41, 0x83, 0xE0, 0xFC, 0x44, 0x09, 0xC1, 0x49,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0xC9, 0x48, 0x09, 0xC1, 0x48,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_scmp_32[] =
+	{
+		{ 49ui64, 1i64, stencil_hole_type::opptr },
+		{ 65ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_scmp_16[] =
+	{
+		0x44, 0x0F, 0xB7, 0x42, 0x02, 0x44, 0x0F, 0xB7, 0x0A, 0x48, 0x89, 0xC8, 0x66, 0x45, 0x39, 0xC1,
+		0x0F, 0x9C, 0xC1, 0x01, 0xC9, 0x66, 0x45, 0x39, 0xC1, 0x41, 0x0F, 0x9F, 0xC0, 0x48, 0x83, 0xC2,
+		0x04, 0x44, 0x09, 0xC1, 0x41, 0x89, 0xC0, 0x25, 0x00, 0xFF, 0x00, 0x00, 0x41, 0x83, 0xE0, 0xFC,
+		0x44, 0x09, 0xC1, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0xC9,
+		0x48, 0x09, 0xC1, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_scmp_16[] =
+	{
+		{ 53ui64, 1i64, stencil_hole_type::opptr },
+		{ 69ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_scmp_8[] =
+	{
+		0x44, 0x0F, 0xB6, 0x42, 0x01, 0x44, 0x0F, 0xB6, 0x0A, 0x48, 0x89, 0xC8, 0x45, 0x38, 0xC1, 0x0F,
+		0x9C, 0xC1, 0x01, 0xC9, 0x45, 0x38, 0xC1, 0x41, 0x0F, 0x9F, 0xC0, 0x48, 0x83, 0xC2, 0x02, 0x44,
+		0x09, 0xC1, 0x41, 0x89, 0xC0, 0x25, 0x00, 0xFF, 0x00, 0x00, 0x41, 0x83, 0xE0, 0xFC, 0x44, 0x09,
+		0xC1, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0xC9, 0x48, 0x09,
+		0xC1, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_scmp_8[] =
+	{
+		{ 51ui64, 1i64, stencil_hole_type::opptr },
+		{ 67ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_ucmp_64[] =
+	{
+		0x4C, 0x8B, 0x02, 0x4C, 0x8B, 0x4A, 0x08, 0x48, 0x89, 0xC8, 0x4D, 0x39, 0xC8, 0x0F, 0x92, 0xC1,
+		0x01, 0xC9, 0x4D, 0x39, 0xC1, 0x41, 0x0F, 0x92, 0xC0, 0x48, 0x83, 0xC2, 0x10, 0x44, 0x09, 0xC1,
+		0x41, 0x89, 0xC0, 0x25, 0x00, 0xFF, 0x00, 0x00, 0x41, 0x83, 0xE0, 0xFC, 0x44, 0x09, 0xC1, 0x49,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0xC9, 0x48, 0x09, 0xC1, 0x48,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_ucmp_64[] =
+	{
+		{ 49ui64, 1i64, stencil_hole_type::opptr },
+		{ 65ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_ucmp_32[] =
+	{
+		0x44, 0x8B, 0x02, 0x44, 0x8B, 0x4A, 0x04, 0x48, 0x89, 0xC8, 0x45, 0x39, 0xC8, 0x0F, 0x92, 0xC1,
+		0x01, 0xC9, 0x45, 0x39, 0xC1, 0x41, 0x0F, 0x92, 0xC0, 0x48, 0x83, 0xC2, 0x08, 0x44, 0x09, 0xC1,
+		0x41, 0x89, 0xC0, 0x25, 0x00, 0xFF, 0x00, 0x00, 0x41, 0x83, 0xE0, 0xFC, 0x44, 0x09, 0xC1, 0x49,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0xC9, 0x48, 0x09, 0xC1, 0x48,
+		0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_ucmp_32[] =
+	{
+		{ 49ui64, 1i64, stencil_hole_type::opptr },
+		{ 65ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_ucmp_16[] =
+	{
+		0x44, 0x0F, 0xB7, 0x02, 0x44, 0x0F, 0xB7, 0x4A, 0x02, 0x48, 0x89, 0xC8, 0x66, 0x45, 0x39, 0xC8,
+		0x0F, 0x92, 0xC1, 0x01, 0xC9, 0x66, 0x45, 0x39, 0xC1, 0x41, 0x0F, 0x92, 0xC0, 0x48, 0x83, 0xC2,
+		0x04, 0x44, 0x09, 0xC1, 0x41, 0x89, 0xC0, 0x25, 0x00, 0xFF, 0x00, 0x00, 0x41, 0x83, 0xE0, 0xFC,
+		0x44, 0x09, 0xC1, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0xC9,
+		0x48, 0x09, 0xC1, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_ucmp_16[] =
+	{
+		{ 53ui64, 1i64, stencil_hole_type::opptr },
+		{ 69ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_ucmp_8[] =
+	{
+		0x44, 0x0F, 0xB6, 0x02, 0x44, 0x0F, 0xB6, 0x4A, 0x01, 0x48, 0x89, 0xC8, 0x45, 0x38, 0xC8, 0x0F,
+		0x92, 0xC1, 0x01, 0xC9, 0x45, 0x38, 0xC1, 0x41, 0x0F, 0x92, 0xC0, 0x48, 0x83, 0xC2, 0x02, 0x44,
+		0x09, 0xC1, 0x41, 0x89, 0xC0, 0x25, 0x00, 0xFF, 0x00, 0x00, 0x41, 0x83, 0xE0, 0xFC, 0x44, 0x09,
+		0xC1, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0xC9, 0x48, 0x09,
+		0xC1, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_ucmp_8[] =
+	{
+		{ 51ui64, 1i64, stencil_hole_type::opptr },
+		{ 67ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_rotl_64[] =
+	{
+		0x48, 0x89, 0xC8, 0x4C, 0x8D, 0x4A, 0x01, 0x0F, 0xB6, 0x0A, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x48, 0xD3, 0x42, 0x01, 0x0F, 0xB7, 0xC8, 0x4C, 0x89, 0xCA, 0x48, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_rotl_64[] =
+	{
+		{ 12ui64, 1i64, stencil_hole_type::opptr },
+		{ 32ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_rotl_32[] =
+	{
+		0x48, 0x89, 0xC8, 0x4C, 0x8D, 0x4A, 0x01, 0x0F, 0xB6, 0x0A, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xD3, 0x42, 0x01, 0x0F, 0xB7, 0xC8, 0x4C, 0x89, 0xCA, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_rotl_32[] =
+	{
+		{ 12ui64, 1i64, stencil_hole_type::opptr },
+		{ 31ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_rotl_16[] =
+	{
+		0x48, 0x89, 0xC8, 0x4C, 0x8D, 0x4A, 0x01, 0x0F, 0xB6, 0x0A, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x66, 0xD3, 0x42, 0x01, 0x0F, 0xB7, 0xC8, 0x4C, 0x89, 0xCA, 0x48, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_rotl_16[] =
+	{
+		{ 12ui64, 1i64, stencil_hole_type::opptr },
+		{ 32ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_rotl_8[] =
+	{
+		0x48, 0x89, 0xC8, 0x4C, 0x8D, 0x4A, 0x01, 0x0F, 0xB6, 0x0A, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xD2, 0x42, 0x01, 0x0F, 0xB7, 0xC8, 0x4C, 0x89, 0xCA, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_rotl_8[] =
+	{
+		{ 12ui64, 1i64, stencil_hole_type::opptr },
+		{ 31ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_rotr_64[] =
+	{
+		0x48, 0x89, 0xC8, 0x4C, 0x8D, 0x4A, 0x01, 0x0F, 0xB6, 0x0A, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x48, 0xD3, 0x4A, 0x01, 0x0F, 0xB7, 0xC8, 0x4C, 0x89, 0xCA, 0x48, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_rotr_64[] =
+	{
+		{ 12ui64, 1i64, stencil_hole_type::opptr },
+		{ 32ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_rotr_32[] =
+	{
+		0x48, 0x89, 0xC8, 0x4C, 0x8D, 0x4A, 0x01, 0x0F, 0xB6, 0x0A, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xD3, 0x4A, 0x01, 0x0F, 0xB7, 0xC8, 0x4C, 0x89, 0xCA, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_rotr_32[] =
+	{
+		{ 12ui64, 1i64, stencil_hole_type::opptr },
+		{ 31ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_rotr_16[] =
+	{
+		0x48, 0x89, 0xC8, 0x4C, 0x8D, 0x4A, 0x01, 0x0F, 0xB6, 0x0A, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x66, 0xD3, 0x4A, 0x01, 0x0F, 0xB7, 0xC8, 0x4C, 0x89, 0xCA, 0x48, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_rotr_16[] =
+	{
+		{ 12ui64, 1i64, stencil_hole_type::opptr },
+		{ 32ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_rotr_8[] =
+	{
+		0x48, 0x89, 0xC8, 0x4C, 0x8D, 0x4A, 0x01, 0x0F, 0xB6, 0x0A, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xD2, 0x4A, 0x01, 0x0F, 0xB7, 0xC8, 0x4C, 0x89, 0xCA, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_rotr_8[] =
+	{
+		{ 12ui64, 1i64, stencil_hole_type::opptr },
+		{ 31ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_sshl_64[] =
+	{
+		0x48, 0x89, 0xC8, 0x4C, 0x8D, 0x4A, 0x01, 0x0F, 0xB6, 0x0A, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x48, 0xD3, 0x62, 0x01, 0x0F, 0xB7, 0xC8, 0x4C, 0x89, 0xCA, 0x48, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_sshl_64[] =
+	{
+		{ 12ui64, 1i64, stencil_hole_type::opptr },
+		{ 32ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_sshl_32[] =
+	{
+		0x48, 0x89, 0xC8, 0x4C, 0x8D, 0x4A, 0x01, 0x0F, 0xB6, 0x0A, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xD3, 0x62, 0x01, 0x0F, 0xB7, 0xC8, 0x4C, 0x89, 0xCA, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_sshl_32[] =
+	{
+		{ 12ui64, 1i64, stencil_hole_type::opptr },
+		{ 31ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_sshl_16[] =
+	{
+		0x44, 0x0F, 0xBF, 0x42, 0x01, 0x48, 0x89, 0xC8, 0x0F, 0xB6, 0x0A, 0x4C, 0x8D, 0x4A, 0x01, 0x41,
+		0xD3, 0xE0, 0x0F, 0xB7, 0xC8, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66,
+		0x44, 0x89, 0x42, 0x01, 0x4C, 0x89, 0xCA, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_sshl_16[] =
+	{
+		{ 23ui64, 0i64, stencil_hole_type::next },
+		{ 41ui64, 1i64, stencil_hole_type::opptr }
+	};
+
+	inline constexpr uint8_t __stencil_text_sshl_8[] =
+	{
+		0x44, 0x0F, 0xBE, 0x42, 0x01, 0x48, 0x89, 0xC8, 0x0F, 0xB6, 0x0A, 0x4C, 0x8D, 0x4A, 0x01, 0x41,
+		0xD3, 0xE0, 0x0F, 0xB7, 0xC8, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44,
+		0x88, 0x42, 0x01, 0x4C, 0x89, 0xCA, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_sshl_8[] =
+	{
+		{ 23ui64, 0i64, stencil_hole_type::next },
+		{ 40ui64, 1i64, stencil_hole_type::opptr }
+	};
+
+	inline constexpr uint8_t __stencil_text_ushl_64[] =
+	{
+		0x48, 0x89, 0xC8, 0x4C, 0x8D, 0x4A, 0x01, 0x0F, 0xB6, 0x0A, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x48, 0xD3, 0x62, 0x01, 0x0F, 0xB7, 0xC8, 0x4C, 0x89, 0xCA, 0x48, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_ushl_64[] =
+	{
+		{ 12ui64, 1i64, stencil_hole_type::opptr },
+		{ 32ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_ushl_32[] =
+	{
+		0x48, 0x89, 0xC8, 0x4C, 0x8D, 0x4A, 0x01, 0x0F, 0xB6, 0x0A, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xD3, 0x62, 0x01, 0x0F, 0xB7, 0xC8, 0x4C, 0x89, 0xCA, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_ushl_32[] =
+	{
+		{ 12ui64, 1i64, stencil_hole_type::opptr },
+		{ 31ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_ushl_16[] =
+	{
+		0x44, 0x0F, 0xB7, 0x42, 0x01, 0x48, 0x89, 0xC8, 0x0F, 0xB6, 0x0A, 0x4C, 0x8D, 0x4A, 0x01, 0x41,
+		0xD3, 0xE0, 0x0F, 0xB7, 0xC8, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66,
+		0x44, 0x89, 0x42, 0x01, 0x4C, 0x89, 0xCA, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_ushl_16[] =
+	{
+		{ 23ui64, 0i64, stencil_hole_type::next },
+		{ 41ui64, 1i64, stencil_hole_type::opptr }
+	};
+
+	inline constexpr uint8_t __stencil_text_ushl_8[] =
+	{
+		0x44, 0x0F, 0xB6, 0x42, 0x01, 0x48, 0x89, 0xC8, 0x0F, 0xB6, 0x0A, 0x4C, 0x8D, 0x4A, 0x01, 0x41,
+		0xD3, 0xE0, 0x0F, 0xB7, 0xC8, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44,
+		0x88, 0x42, 0x01, 0x4C, 0x89, 0xCA, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_ushl_8[] =
+	{
+		{ 23ui64, 0i64, stencil_hole_type::next },
+		{ 40ui64, 1i64, stencil_hole_type::opptr }
+	};
+
+	inline constexpr uint8_t __stencil_text_sshr_64[] =
+	{
+		0x48, 0x89, 0xC8, 0x4C, 0x8D, 0x4A, 0x01, 0x0F, 0xB6, 0x0A, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x48, 0xD3, 0x7A, 0x01, 0x0F, 0xB7, 0xC8, 0x4C, 0x89, 0xCA, 0x48, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_sshr_64[] =
+	{
+		{ 12ui64, 1i64, stencil_hole_type::opptr },
+		{ 32ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_sshr_32[] =
+	{
+		0x48, 0x89, 0xC8, 0x4C, 0x8D, 0x4A, 0x01, 0x0F, 0xB6, 0x0A, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xD3, 0x7A, 0x01, 0x0F, 0xB7, 0xC8, 0x4C, 0x89, 0xCA, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_sshr_32[] =
+	{
+		{ 12ui64, 1i64, stencil_hole_type::opptr },
+		{ 31ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_sshr_16[] =
+	{
+		0x44, 0x0F, 0xBF, 0x42, 0x01, 0x48, 0x89, 0xC8, 0x0F, 0xB6, 0x0A, 0x4C, 0x8D, 0x4A, 0x01, 0x41,
+		0xD3, 0xF8, 0x0F, 0xB7, 0xC8, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66,
+		0x44, 0x89, 0x42, 0x01, 0x4C, 0x89, 0xCA, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_sshr_16[] =
+	{
+		{ 23ui64, 0i64, stencil_hole_type::next },
+		{ 41ui64, 1i64, stencil_hole_type::opptr }
+	};
+
+	inline constexpr uint8_t __stencil_text_sshr_8[] =
+	{
+		0x44, 0x0F, 0xBE, 0x42, 0x01, 0x48, 0x89, 0xC8, 0x0F, 0xB6, 0x0A, 0x4C, 0x8D, 0x4A, 0x01, 0x41,
+		0xD3, 0xF8, 0x0F, 0xB7, 0xC8, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44,
+		0x88, 0x42, 0x01, 0x4C, 0x89, 0xCA, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_sshr_8[] =
+	{
+		{ 23ui64, 0i64, stencil_hole_type::next },
+		{ 40ui64, 1i64, stencil_hole_type::opptr }
+	};
+
+	inline constexpr uint8_t __stencil_text_ushr_64[] =
+	{
+		0x48, 0x89, 0xC8, 0x4C, 0x8D, 0x4A, 0x01, 0x0F, 0xB6, 0x0A, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x48, 0xD3, 0x6A, 0x01, 0x0F, 0xB7, 0xC8, 0x4C, 0x89, 0xCA, 0x48, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_ushr_64[] =
+	{
+		{ 12ui64, 1i64, stencil_hole_type::opptr },
+		{ 32ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_ushr_32[] =
+	{
+		0x48, 0x89, 0xC8, 0x4C, 0x8D, 0x4A, 0x01, 0x0F, 0xB6, 0x0A, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xD3, 0x6A, 0x01, 0x0F, 0xB7, 0xC8, 0x4C, 0x89, 0xCA, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_ushr_32[] =
+	{
+		{ 12ui64, 1i64, stencil_hole_type::opptr },
+		{ 31ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_ushr_16[] =
+	{
+		0x44, 0x0F, 0xB7, 0x42, 0x01, 0x48, 0x89, 0xC8, 0x0F, 0xB6, 0x0A, 0x4C, 0x8D, 0x4A, 0x01, 0x41,
+		0xD3, 0xF8, 0x0F, 0xB7, 0xC8, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66,
+		0x44, 0x89, 0x42, 0x01, 0x4C, 0x89, 0xCA, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_ushr_16[] =
+	{
+		{ 23ui64, 0i64, stencil_hole_type::next },
+		{ 41ui64, 1i64, stencil_hole_type::opptr }
+	};
+
+	inline constexpr uint8_t __stencil_text_ushr_8[] =
+	{
+		0x44, 0x0F, 0xB6, 0x42, 0x01, 0x48, 0x89, 0xC8, 0x0F, 0xB6, 0x0A, 0x4C, 0x8D, 0x4A, 0x01, 0x41,
+		0xD3, 0xF8, 0x0F, 0xB7, 0xC8, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44,
+		0x88, 0x42, 0x01, 0x4C, 0x89, 0xCA, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_ushr_8[] =
+	{
+		{ 23ui64, 0i64, stencil_hole_type::next },
+		{ 40ui64, 1i64, stencil_hole_type::opptr }
+	};
+
+	inline constexpr uint8_t __stencil_text_fadd_64[] =
+	{
+		0xF2, 0x0F, 0x10, 0x42, 0x08, 0xF2, 0x0F, 0x58, 0x02, 0x0F, 0xB7, 0xC9, 0x48, 0x8D, 0x42, 0x08,
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0x0F, 0x11, 0x42, 0x08, 0x48,
+		0x89, 0xC2, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_fadd_64[] =
+	{
+		{ 18ui64, 1i64, stencil_hole_type::opptr },
+		{ 36ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_fadd_32[] =
+	{
+		0xF3, 0x0F, 0x10, 0x42, 0x04, 0xF3, 0x0F, 0x58, 0x02, 0x0F, 0xB7, 0xC9, 0x48, 0x8D, 0x42, 0x04,
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x0F, 0x11, 0x42, 0x04, 0x48,
+		0x89, 0xC2, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_fadd_32[] =
+	{
+		{ 18ui64, 1i64, stencil_hole_type::opptr },
+		{ 36ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_fsub_64[] =
+	{
+		0xF2, 0x0F, 0x10, 0x42, 0x08, 0xF2, 0x0F, 0x5C, 0x02, 0x0F, 0xB7, 0xC9, 0x48, 0x8D, 0x42, 0x08,
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0x0F, 0x11, 0x42, 0x08, 0x48,
+		0x89, 0xC2, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_fsub_64[] =
+	{
+		{ 18ui64, 1i64, stencil_hole_type::opptr },
+		{ 36ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_fsub_32[] =
+	{
+		0xF3, 0x0F, 0x10, 0x42, 0x04, 0xF3, 0x0F, 0x5C, 0x02, 0x0F, 0xB7, 0xC9, 0x48, 0x8D, 0x42, 0x04,
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x0F, 0x11, 0x42, 0x04, 0x48,
+		0x89, 0xC2, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_fsub_32[] =
+	{
+		{ 18ui64, 1i64, stencil_hole_type::opptr },
+		{ 36ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_fmul_64[] =
+	{
+		0xF2, 0x0F, 0x10, 0x42, 0x08, 0xF2, 0x0F, 0x59, 0x02, 0x0F, 0xB7, 0xC9, 0x48, 0x8D, 0x42, 0x08,
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0x0F, 0x11, 0x42, 0x08, 0x48,
+		0x89, 0xC2, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_fmul_64[] =
+	{
+		{ 18ui64, 1i64, stencil_hole_type::opptr },
+		{ 36ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_fmul_32[] =
+	{
+		0xF3, 0x0F, 0x10, 0x42, 0x04, 0xF3, 0x0F, 0x59, 0x02, 0x0F, 0xB7, 0xC9, 0x48, 0x8D, 0x42, 0x04,
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x0F, 0x11, 0x42, 0x04, 0x48,
+		0x89, 0xC2, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_fmul_32[] =
+	{
+		{ 18ui64, 1i64, stencil_hole_type::opptr },
+		{ 36ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_fdiv_64[] =
+	{
+		0x48, 0x8D, 0x42, 0x08, 0xF2, 0x0F, 0x10, 0x42, 0x08, 0x0F, 0xB7, 0xC9, 0xF2, 0x0F, 0x5E, 0x02,
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0x0F, 0x11, 0x42, 0x08, 0x48,
+		0x89, 0xC2, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_fdiv_64[] =
+	{
+		{ 18ui64, 1i64, stencil_hole_type::opptr },
+		{ 36ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_fdiv_32[] =
+	{
+		0x48, 0x8D, 0x42, 0x04, 0xF3, 0x0F, 0x10, 0x42, 0x04, 0x0F, 0xB7, 0xC9, 0xF3, 0x0F, 0x5E, 0x02,
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x0F, 0x11, 0x42, 0x04, 0x48,
+		0x89, 0xC2, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_fdiv_32[] =
+	{
+		{ 18ui64, 1i64, stencil_hole_type::opptr },
+		{ 36ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_fcmp_64[] =
+	{
+		0xF2, 0x0F, 0x10, 0x02, 0xF2, 0x0F, 0x10, 0x4A, 0x08, 0x48, 0x89, 0xC8, 0x66, 0x0F, 0x2F, 0xC1,
+		0x0F, 0x92, 0xC1, 0x01, 0xC9, 0x66, 0x0F, 0x2F, 0xC8, 0x41, 0x0F, 0x92, 0xC0, 0x48, 0x83, 0xC2,
+		0x10, 0x44, 0x09, 0xC1, 0x41, 0x89, 0xC0, 0x25, 0x00, 0xFF, 0x00, 0x00, 0x41, 0x83, 0xE0, 0xFC,
+		0x44, 0x09, 0xC1, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0xC9,
+		0x48, 0x09, 0xC1, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_fcmp_64[] =
+	{
+		{ 53ui64, 1i64, stencil_hole_type::opptr },
+		{ 69ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_fcmp_32[] =
+	{
+		0xF3, 0x0F, 0x10, 0x02, 0xF3, 0x0F, 0x10, 0x4A, 0x04, 0x48, 0x89, 0xC8, 0x0F, 0x2F, 0xC1, 0x0F,
+		0x92, 0xC1, 0x01, 0xC9, 0x0F, 0x2F, 0xC8, 0x41, 0x0F, 0x92, 0xC0, 0x48, 0x83, 0xC2, 0x08, 0x44,
+		0x09, 0xC1, 0x41, 0x89, 0xC0, 0x25, 0x00, 0xFF, 0x00, 0x00, 0x41, 0x83, 0xE0, 0xFC, 0x44, 0x09,
+		0xC1, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0xC9, 0x48, 0x09,
+		0xC1, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_fcmp_32[] =
+	{
+		{ 51ui64, 1i64, stencil_hole_type::opptr },
+		{ 67ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_si64_2_f64[] =
+	{
+		0x66, 0x0F, 0xEF, 0xC0, 0x0F, 0xB7, 0xC9, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0x48, 0x0F, 0x2A, 0x02,
+		0xF2, 0x0F, 0x11, 0x02, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_si64_2_f64[] =
+	{
+		{ 9ui64, 1i64, stencil_hole_type::opptr },
+		{ 19ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_si64_2_f32[] =
+	{
+		0x66, 0x0F, 0xEF, 0xC0, 0x0F, 0xB7, 0xC9, 0x48, 0x83, 0xC2, 0x04, 0x49, 0xB8, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3,
+		0x48, 0x0F, 0x2A, 0x42, 0xFC, 0xF3, 0x0F, 0x11, 0x02, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_si64_2_f32[] =
+	{
+		{ 13ui64, 1i64, stencil_hole_type::opptr },
+		{ 23ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_si32_2_f64[] =
+	{
+		0x66, 0x0F, 0xEF, 0xC0, 0x48, 0x8D, 0x42, 0xFC, 0x0F, 0xB7, 0xC9, 0x49, 0xB8, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0x0F, 0x2A, 0x02, 0xF2, 0x0F, 0x11, 0x42, 0xFC, 0x48, 0x89,
+		0xC2, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_si32_2_f64[] =
+	{
+		{ 13ui64, 1i64, stencil_hole_type::opptr },
+		{ 35ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_si32_2_f32[] =
+	{
+		0x66, 0x0F, 0xEF, 0xC0, 0x0F, 0xB7, 0xC9, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x0F, 0x2A, 0x02, 0xF3,
+		0x0F, 0x11, 0x02, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_si32_2_f32[] =
+	{
+		{ 9ui64, 1i64, stencil_hole_type::opptr },
+		{ 19ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_ui64_2_f64[] =
+	{
+		0x48, 0x8B, 0x02, 0x48, 0x85, 0xC0, 0x78, 0x28, 0x66, 0x0F, 0xEF, 0xC0, 0xF2, 0x48, 0x0F, 0x2A,
+		0xC0, 0xF2, 0x0F, 0x11, 0x02, 0x0F, 0xB7, 0xC9, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x66, 0x90,
+		0x49, 0x89, 0xC0, 0x83, 0xE0, 0x01, 0x66, 0x0F, 0xEF, 0xC0, 0x49, 0xD1, 0xE8, 0x49, 0x09, 0xC0,
+		0xF2, 0x49, 0x0F, 0x2A, 0xC0, 0xF2, 0x0F, 0x58, 0xC0, 0xEB, 0xC6
+	};
+
+	inline constexpr stencil_hole __stencil_hole_ui64_2_f64[] =
+	{
+		{ 26ui64, 1i64, stencil_hole_type::opptr },
+		{ 36ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_ui64_2_f32[] =
+	{
+		0x48, 0x8B, 0x02, 0x48, 0x85, 0xC0, 0x78, 0x30, 0x66, 0x0F, 0xEF, 0xC0, 0xF3, 0x48, 0x0F, 0x2A,
+		0xC0, 0xF3, 0x0F, 0x11, 0x42, 0x04, 0x0F, 0xB7, 0xC9, 0x48, 0x83, 0xC2, 0x04, 0x49, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xFF, 0xE0, 0x0F, 0x1F, 0x44, 0x00, 0x00, 0x49, 0x89, 0xC0, 0x83, 0xE0, 0x01, 0x66, 0x0F,
+		0xEF, 0xC0, 0x49, 0xD1, 0xE8, 0x49, 0x09, 0xC0, 0xF3, 0x49, 0x0F, 0x2A, 0xC0, 0xF3, 0x0F, 0x58,
+		0xC0, 0xEB, 0xBE
+	};
+
+	inline constexpr stencil_hole __stencil_hole_ui64_2_f32[] =
+	{
+		{ 31ui64, 1i64, stencil_hole_type::opptr },
+		{ 41ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_ui32_2_f64[] =
+	{
+		0x44, 0x8B, 0x02, 0x66, 0x0F, 0xEF, 0xC0, 0x48, 0x8D, 0x42, 0xFC, 0x0F, 0xB7, 0xC9, 0xF2, 0x49,
+		0x0F, 0x2A, 0xC0, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0x0F, 0x11,
+		0x42, 0xFC, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_ui32_2_f64[] =
+	{
+		{ 21ui64, 1i64, stencil_hole_type::opptr },
+		{ 39ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_ui32_2_f32[] =
+	{
+		0x8B, 0x02, 0x66, 0x0F, 0xEF, 0xC0, 0x0F, 0xB7, 0xC9, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xF3, 0x48, 0x0F, 0x2A, 0xC0, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xF3, 0x0F, 0x11, 0x02, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_ui32_2_f32[] =
+	{
+		{ 11ui64, 1i64, stencil_hole_type::opptr },
+		{ 26ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_s_ucmp_jmp_64[] =
+	{
+		0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x49, 0x89, 0xF1, 0x49, 0x89, 0xD2,
+		0x53, 0x48, 0x89, 0xCE, 0x48, 0x0F, 0xBE, 0xD0, 0x88, 0x4C, 0x24, 0xF6, 0x4A, 0x8D, 0x4C, 0x0A,
+		0xF9, 0x48, 0x85, 0xD2, 0x78, 0x08, 0x0F, 0xB6, 0xC0, 0x49, 0x8D, 0x4C, 0x01, 0x10, 0x48, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x8B, 0x01, 0x48, 0x8B, 0x18, 0x0F, 0xB6,
+		0x4C, 0x24, 0xF6, 0x4C, 0x0F, 0xBE, 0x58, 0x0A, 0x49, 0x39, 0xD8, 0x0F, 0x92, 0xC2, 0x83, 0xE1,
+		0xFC, 0x4C, 0x39, 0xC3, 0x0F, 0x92, 0xC0, 0x89, 0xD5, 0x0F, 0xB6, 0xD2, 0x41, 0x89, 0xC0, 0x01,
+		0xD2, 0x0F, 0xB6, 0xC0, 0x09, 0xE9, 0x09, 0xC2, 0x45, 0x01, 0xC0, 0xA0, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x44, 0x09, 0xC1, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x0F, 0xB6, 0xC0, 0x88, 0x4C, 0x24, 0xF6, 0x8D, 0x44, 0x02, 0xE5, 0xBA, 0x4F, 0x25, 0x13,
+		0x86, 0x0F, 0xA3, 0xC2, 0x73, 0x03, 0x4D, 0x01, 0xD8, 0x0F, 0xB6, 0x4C, 0x24, 0xF6, 0x81, 0xE6,
+		0x00, 0xFF, 0x00, 0x00, 0x4C, 0x89, 0xD2, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x48, 0x09, 0xF1, 0x4C, 0x89, 0xCE, 0x49, 0x39, 0xC0, 0x74, 0x14, 0x48, 0xB8, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x5D, 0xFF, 0xE0, 0x66, 0x0F, 0x1F, 0x44, 0x00, 0x00,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x5D, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_s_ucmp_jmp_64[] =
+	{
+		{ 1ui64, 1i64, stencil_hole_type::opptr },
+		{ 48ui64, 3i64, stencil_hole_type::opptr },
+		{ 108ui64, 12i64, stencil_hole_type::opptr },
+		{ 121ui64, 14i64, stencil_hole_type::opptr },
+		{ 169ui64, 0i64, stencil_hole_type::end },
+		{ 190ui64, 0i64, stencil_hole_type::target },
+		{ 210ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_s_scmp_jmp_64[] =
+	{
+		0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x49, 0x89, 0xF1, 0x49, 0x89, 0xD2,
+		0x53, 0x48, 0x89, 0xCE, 0x48, 0x0F, 0xBE, 0xD0, 0x88, 0x4C, 0x24, 0xF6, 0x4A, 0x8D, 0x4C, 0x0A,
+		0xF9, 0x48, 0x85, 0xD2, 0x78, 0x08, 0x0F, 0xB6, 0xC0, 0x49, 0x8D, 0x4C, 0x01, 0x10, 0x48, 0xB8,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x19, 0x4C, 0x8B, 0x00, 0x0F, 0xB6,
+		0x4C, 0x24, 0xF6, 0x4C, 0x0F, 0xBE, 0x58, 0x0A, 0x4C, 0x39, 0xC3, 0x0F, 0x9C, 0xC2, 0x83, 0xE1,
+		0xFC, 0x4C, 0x39, 0xC3, 0x0F, 0x9F, 0xC0, 0x89, 0xD5, 0x0F, 0xB6, 0xD2, 0x41, 0x89, 0xC0, 0x01,
+		0xD2, 0x0F, 0xB6, 0xC0, 0x09, 0xE9, 0x09, 0xC2, 0x45, 0x01, 0xC0, 0xA0, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x44, 0x09, 0xC1, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x0F, 0xB6, 0xC0, 0x88, 0x4C, 0x24, 0xF6, 0x8D, 0x44, 0x02, 0xE5, 0xBA, 0x4F, 0x25, 0x13,
+		0x86, 0x0F, 0xA3, 0xC2, 0x73, 0x03, 0x4D, 0x01, 0xD8, 0x0F, 0xB6, 0x4C, 0x24, 0xF6, 0x81, 0xE6,
+		0x00, 0xFF, 0x00, 0x00, 0x4C, 0x89, 0xD2, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x48, 0x09, 0xF1, 0x4C, 0x89, 0xCE, 0x49, 0x39, 0xC0, 0x74, 0x14, 0x48, 0xB8, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x5D, 0xFF, 0xE0, 0x66, 0x0F, 0x1F, 0x44, 0x00, 0x00,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x5D, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_s_scmp_jmp_64[] =
+	{
+		{ 1ui64, 1i64, stencil_hole_type::opptr },
+		{ 48ui64, 3i64, stencil_hole_type::opptr },
+		{ 108ui64, 12i64, stencil_hole_type::opptr },
+		{ 121ui64, 14i64, stencil_hole_type::opptr },
+		{ 169ui64, 0i64, stencil_hole_type::end },
+		{ 190ui64, 0i64, stencil_hole_type::target },
+		{ 210ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_s_uinc_64[] =
+	{
+		0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x0F, 0xBE, 0xC8, 0x4D, 0x8D, 0x44,
+		0x31, 0xF9, 0x4D, 0x85, 0xC9, 0x78, 0x08, 0x0F, 0xB6, 0xC0, 0x4C, 0x8D, 0x44, 0x06, 0x10, 0x49,
+		0x83, 0x00, 0x01, 0x0F, 0xB7, 0xC9, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_s_uinc_64[] =
+	{
+		{ 1ui64, 1i64, stencil_hole_type::opptr },
+		{ 40ui64, 5i64, stencil_hole_type::opptr },
+		{ 50ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_s_udec_64[] =
+	{
+		0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x0F, 0xBE, 0xC8, 0x4D, 0x8D, 0x44,
+		0x31, 0xF9, 0x4D, 0x85, 0xC9, 0x78, 0x08, 0x0F, 0xB6, 0xC0, 0x4C, 0x8D, 0x44, 0x06, 0x10, 0x49,
+		0x83, 0x28, 0x01, 0x0F, 0xB7, 0xC9, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_s_udec_64[] =
+	{
+		{ 1ui64, 1i64, stencil_hole_type::opptr },
+		{ 40ui64, 5i64, stencil_hole_type::opptr },
+		{ 50ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_s_uadd_64[] =
+	{
+		0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x0F, 0xBE, 0xC0, 0x4D, 0x8D, 0x4C,
+		0x30, 0xF9, 0x4D, 0x85, 0xC0, 0x78, 0x08, 0x0F, 0xB6, 0xC0, 0x4C, 0x8D, 0x4C, 0x06, 0x10, 0xA0,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x8B, 0x01, 0x4C, 0x0F, 0xBE, 0xC8, 0x4D,
+		0x8D, 0x54, 0x31, 0xF9, 0x4D, 0x85, 0xC9, 0x78, 0x08, 0x0F, 0xB6, 0xC0, 0x4C, 0x8D, 0x54, 0x06,
+		0x10, 0x48, 0x8D, 0x42, 0xF8, 0x4D, 0x03, 0x02, 0x0F, 0xB7, 0xC9, 0x4C, 0x89, 0x42, 0xF8, 0x48,
+		0x89, 0xC2, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_s_uadd_64[] =
+	{
+		{ 1ui64, 1i64, stencil_hole_type::opptr },
+		{ 32ui64, 3i64, stencil_hole_type::opptr },
+		{ 84ui64, 5i64, stencil_hole_type::opptr },
+		{ 94ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_s_move_64[] =
+	{
+		0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x0F, 0xBE, 0x10, 0xA0, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x8D, 0x5C, 0x32, 0xF9, 0x4C, 0x0F, 0xBE, 0xC8,
+		0x4D, 0x85, 0xD2, 0x78, 0x09, 0x45, 0x0F, 0xB6, 0xC2, 0x4E, 0x8D, 0x5C, 0x06, 0x10, 0x4D, 0x8D,
+		0x44, 0x31, 0xF9, 0x4D, 0x85, 0xC9, 0x78, 0x08, 0x0F, 0xB6, 0xC0, 0x4C, 0x8D, 0x44, 0x06, 0x10,
+		0x49, 0x8B, 0x03, 0x0F, 0xB7, 0xC9, 0x49, 0x89, 0x00, 0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_s_move_64[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 15ui64, 3i64, stencil_hole_type::opptr },
+		{ 75ui64, 4i64, stencil_hole_type::opptr },
+		{ 85ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_gen_0[] =
+	{
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_gen_0[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 15ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_gen_1[] =
+	{
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_gen_1[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 15ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_gen_2[] =
+	{
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_gen_2[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 15ui64, 0i64, stencil_hole_type::next }
+	};
+
+	inline constexpr uint8_t __stencil_text_gen_3[] =
+	{
+		0x49, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB7, 0xC9, 0x48, 0xB8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0
+	};
+
+	inline constexpr stencil_hole __stencil_hole_gen_3[] =
+	{
+		{ 2ui64, 1i64, stencil_hole_type::opptr },
+		{ 15ui64, 0i64, stencil_hole_type::next }
+	};
+
+	// stencils - one stencil per op that has one, ops missing here leave native code
+
+	inline constexpr stencil stencils[] =
+	{
+		{ op::exit, __stencil_text_exit, 26ui64, 26ui64, __stencil_hole_exit, 2ui64 },
+		{ op::nop, __stencil_text_nop, 25ui64, 13ui64, __stencil_hole_nop, 2ui64 },
+		{ op::ret, __stencil_text_ret, 29ui64, 29ui64, __stencil_hole_ret, 1ui64 },
+		{ op::call_64, __stencil_text_call_64, 56ui64, 56ui64, __stencil_hole_call_64, 3ui64 },
+		{ op::call_32, __stencil_text_call_32, 57ui64, 57ui64, __stencil_hole_call_32, 3ui64 },
+		{ op::call_16, __stencil_text_call_16, 60ui64, 60ui64, __stencil_hole_call_16, 3ui64 },
+		{ op::call_8, __stencil_text_call_8, 59ui64, 59ui64, __stencil_hole_call_8, 3ui64 },
+		{ op::l_alloc, __stencil_text_l_alloc, 42ui64, 30ui64, __stencil_hole_l_alloc, 3ui64 },
+		{ op::s_alloc, __stencil_text_s_alloc, 42ui64, 30ui64, __stencil_hole_s_alloc, 3ui64 },
+		{ op::s_allocz, __stencil_text_s_allocz, 179ui64, 179ui64, __stencil_hole_s_allocz, 3ui64 },
+		{ op::l_dealloc, __stencil_text_l_dealloc, 45ui64, 33ui64, __stencil_hole_l_dealloc, 3ui64 },
+		{ op::s_dealloc, __stencil_text_s_dealloc, 45ui64, 33ui64, __stencil_hole_s_dealloc, 3ui64 },
+		{ op::push_flow, __stencil_text_push_flow, 36ui64, 24ui64, __stencil_hole_push_flow, 2ui64 },
+		{ op::push_frame, __stencil_text_push_frame, 36ui64, 24ui64, __stencil_hole_push_frame, 2ui64 },
+		{ op::push_stack, __stencil_text_push_stack, 36ui64, 24ui64, __stencil_hole_push_stack, 2ui64 },
+		{ op::push_state, __stencil_text_push_state, 51ui64, 39ui64, __stencil_hole_push_state, 2ui64 },
+		{ op::pop_flow, __stencil_text_pop_flow, 25ui64, 25ui64, __stencil_hole_pop_flow, 1ui64 },
+		{ op::pop_frame, __stencil_text_pop_frame, 35ui64, 23ui64, __stencil_hole_pop_frame, 2ui64 },
+		{ op::pop_stack, __stencil_text_pop_stack, 28ui64, 16ui64, __stencil_hole_pop_stack, 2ui64 },
+		{ op::pop_state, __stencil_text_pop_state, 45ui64, 33ui64, __stencil_hole_pop_state, 2ui64 },
+		{ op::jmp_64, __stencil_text_jmp_64, 40ui64, 40ui64, __stencil_hole_jmp_64, 3ui64 },
+		{ op::jmp_32, __stencil_text_jmp_32, 41ui64, 41ui64, __stencil_hole_jmp_32, 3ui64 },
+		{ op::jmp_16, __stencil_text_jmp_16, 45ui64, 45ui64, __stencil_hole_jmp_16, 3ui64 },
+		{ op::jmp_8, __stencil_text_jmp_8, 45ui64, 45ui64, __stencil_hole_jmp_8, 3ui64 },
+		{ op::jmp_a_64, __stencil_text_jmp_a_64, 84ui64, 72ui64, __stencil_hole_jmp_a_64, 5ui64 },
+		{ op::jmp_a_32, __stencil_text_jmp_a_32, 92ui64, 80ui64, __stencil_hole_jmp_a_32, 5ui64 },
+		{ op::jmp_a_16, __stencil_text_jmp_a_16, 92ui64, 80ui64, __stencil_hole_jmp_a_16, 5ui64 },
+		{ op::jmp_a_8, __stencil_text_jmp_a_8, 92ui64, 80ui64, __stencil_hole_jmp_a_8, 5ui64 },
+		{ op::jmp_ae_64, __stencil_text_jmp_ae_64, 76ui64, 64ui64, __stencil_hole_jmp_ae_64, 5ui64 },
+		{ op::jmp_ae_32, __stencil_text_jmp_ae_32, 76ui64, 64ui64, __stencil_hole_jmp_ae_32, 5ui64 },
+		{ op::jmp_ae_16, __stencil_text_jmp_ae_16, 76ui64, 64ui64, __stencil_hole_jmp_ae_16, 5ui64 },
+		{ op::jmp_ae_8, __stencil_text_jmp_ae_8, 76ui64, 64ui64, __stencil_hole_jmp_ae_8, 5ui64 },
+		{ op::jmp_b_64, __stencil_text_jmp_b_64, 84ui64, 72ui64, __stencil_hole_jmp_b_64, 5ui64 },
+		{ op::jmp_b_32, __stencil_text_jmp_b_32, 92ui64, 80ui64, __stencil_hole_jmp_b_32, 5ui64 },
+		{ op::jmp_b_16, __stencil_text_jmp_b_16, 92ui64, 80ui64, __stencil_hole_jmp_b_16, 5ui64 },
+		{ op::jmp_b_8, __stencil_text_jmp_b_8, 92ui64, 80ui64, __stencil_hole_jmp_b_8, 5ui64 },
+		{ op::jmp_be_64, __stencil_text_jmp_be_64, 76ui64, 64ui64, __stencil_hole_jmp_be_64, 5ui64 },
+		{ op::jmp_be_32, __stencil_text_jmp_be_32, 76ui64, 64ui64, __stencil_hole_jmp_be_32, 5ui64 },
+		{ op::jmp_be_16, __stencil_text_jmp_be_16, 76ui64, 64ui64, __stencil_hole_jmp_be_16, 5ui64 },
+		{ op::jmp_be_8, __stencil_text_jmp_be_8, 76ui64, 64ui64, __stencil_hole_jmp_be_8, 5ui64 },
+		{ op::jmp_e_64, __stencil_text_jmp_e_64, 84ui64, 72ui64, __stencil_hole_jmp_e_64, 5ui64 },
+		{ op::jmp_e_32, __stencil_text_jmp_e_32, 92ui64, 80ui64, __stencil_hole_jmp_e_32, 5ui64 },
+		{ op::jmp_e_16, __stencil_text_jmp_e_16, 92ui64, 80ui64, __stencil_hole_jmp_e_16, 5ui64 },
+		{ op::jmp_e_8, __stencil_text_jmp_e_8, 92ui64, 80ui64, __stencil_hole_jmp_e_8, 5ui64 },
+		{ op::jmp_ne_64, __stencil_text_jmp_ne_64, 100ui64, 88ui64, __stencil_hole_jmp_ne_64, 5ui64 },
+		{ op::jmp_ne_32, __stencil_text_jmp_ne_32, 100ui64, 88ui64, __stencil_hole_jmp_ne_32, 5ui64 },
+		{ op::jmp_ne_16, __stencil_text_jmp_ne_16, 108ui64, 96ui64, __stencil_hole_jmp_ne_16, 5ui64 },
+		{ op::jmp_ne_8, __stencil_text_jmp_ne_8, 108ui64, 96ui64, __stencil_hole_jmp_ne_8, 5ui64 },
+		{ op::jmp_un_64, __stencil_text_jmp_un_64, 84ui64, 72ui64, __stencil_hole_jmp_un_64, 5ui64 },
+		{ op::jmp_un_32, __stencil_text_jmp_un_32, 92ui64, 80ui64, __stencil_hole_jmp_un_32, 5ui64 },
+		{ op::jmp_un_16, __stencil_text_jmp_un_16, 92ui64, 80ui64, __stencil_hole_jmp_un_16, 5ui64 },
+		{ op::jmp_un_8, __stencil_text_jmp_un_8, 92ui64, 80ui64, __stencil_hole_jmp_un_8, 5ui64 },
+		{ op::jmp_msk_64, __stencil_text_jmp_msk_64, 213ui64, 213ui64, __stencil_hole_jmp_msk_64, 8ui64 },
+		{ op::jmp_msk_32, __stencil_text_jmp_msk_32, 205ui64, 205ui64, __stencil_hole_jmp_msk_32, 8ui64 },
+		{ op::jmp_msk_16, __stencil_text_jmp_msk_16, 188ui64, 176ui64, __stencil_hole_jmp_msk_16, 9ui64 },
+		{ op::jmp_msk_8, __stencil_text_jmp_msk_8, 156ui64, 144ui64, __stencil_hole_jmp_msk_8, 8ui64 },
+		{ op::l_load_64, __stencil_text_l_load_64, 71ui64, 59ui64, __stencil_hole_l_load_64, 3ui64 },
+		{ op::l_load_32, __stencil_text_l_load_32, 71ui64, 59ui64, __stencil_hole_l_load_32, 3ui64 },
+		{ op::l_load_16, __stencil_text_l_load_16, 73ui64, 61ui64, __stencil_hole_l_load_16, 3ui64 },
+		{ op::l_load_8, __stencil_text_l_load_8, 71ui64, 59ui64, __stencil_hole_l_load_8, 3ui64 },
+		{ op::l_store_64, __stencil_text_l_store_64, 67ui64, 55ui64, __stencil_hole_l_store_64, 3ui64 },
+		{ op::l_store_32, __stencil_text_l_store_32, 67ui64, 55ui64, __stencil_hole_l_store_32, 3ui64 },
+		{ op::l_store_16, __stencil_text_l_store_16, 69ui64, 57ui64, __stencil_hole_l_store_16, 3ui64 },
+		{ op::l_store_8, __stencil_text_l_store_8, 67ui64, 55ui64, __stencil_hole_l_store_8, 3ui64 },
+		{ op::s_load_64, __stencil_text_s_load_64, 70ui64, 58ui64, __stencil_hole_s_load_64, 3ui64 },
+		{ op::s_load_32, __stencil_text_s_load_32, 70ui64, 58ui64, __stencil_hole_s_load_32, 3ui64 },
+		{ op::s_load_16, __stencil_text_s_load_16, 72ui64, 60ui64, __stencil_hole_s_load_16, 3ui64 },
+		{ op::s_load_8, __stencil_text_s_load_8, 70ui64, 58ui64, __stencil_hole_s_load_8, 3ui64 },
+		{ op::s_store_64, __stencil_text_s_store_64, 66ui64, 54ui64, __stencil_hole_s_store_64, 3ui64 },
+		{ op::s_store_32, __stencil_text_s_store_32, 66ui64, 54ui64, __stencil_hole_s_store_32, 3ui64 },
+		{ op::s_store_16, __stencil_text_s_store_16, 68ui64, 56ui64, __stencil_hole_s_store_16, 3ui64 },
+		{ op::s_store_8, __stencil_text_s_store_8, 66ui64, 54ui64, __stencil_hole_s_store_8, 3ui64 },
+		{ op::push_64, __stencil_text_push_64, 46ui64, 34ui64, __stencil_hole_push_64, 3ui64 },
+		{ op::push_32, __stencil_text_push_32, 44ui64, 32ui64, __stencil_hole_push_32, 3ui64 },
+		{ op::push_16, __stencil_text_push_16, 46ui64, 34ui64, __stencil_hole_push_16, 3ui64 },
+		{ op::push_8, __stencil_text_push_8, 44ui64, 32ui64, __stencil_hole_push_8, 3ui64 },
+		{ op::pop_64, __stencil_text_pop_64, 29ui64, 17ui64, __stencil_hole_pop_64, 2ui64 },
+		{ op::pop_32, __stencil_text_pop_32, 29ui64, 17ui64, __stencil_hole_pop_32, 2ui64 },
+		{ op::pop_16, __stencil_text_pop_16, 29ui64, 17ui64, __stencil_hole_pop_16, 2ui64 },
+		{ op::pop_8, __stencil_text_pop_8, 29ui64, 17ui64, __stencil_hole_pop_8, 2ui64 },
+		{ op::dup_64, __stencil_text_dup_64, 39ui64, 27ui64, __stencil_hole_dup_64, 2ui64 },
+		{ op::dup_32, __stencil_text_dup_32, 39ui64, 27ui64, __stencil_hole_dup_32, 2ui64 },
+		{ op::dup_16, __stencil_text_dup_16, 41ui64, 29ui64, __stencil_hole_dup_16, 2ui64 },
+		{ op::dup_8, __stencil_text_dup_8, 40ui64, 28ui64, __stencil_hole_dup_8, 2ui64 },
+		{ op::ptrcpy_64, __stencil_text_ptrcpy_64, 42ui64, 30ui64, __stencil_hole_ptrcpy_64, 2ui64 },
+		{ op::ptrcpy_32, __stencil_text_ptrcpy_32, 42ui64, 30ui64, __stencil_hole_ptrcpy_32, 2ui64 },
+		{ op::ptrcpy_16, __stencil_text_ptrcpy_16, 44ui64, 32ui64, __stencil_hole_ptrcpy_16, 2ui64 },
+		{ op::ptrcpy_8, __stencil_text_ptrcpy_8, 43ui64, 31ui64, __stencil_hole_ptrcpy_8, 2ui64 },
+		{ op::ptrget_64, __stencil_text_ptrget_64, 34ui64, 22ui64, __stencil_hole_ptrget_64, 2ui64 },
+		{ op::ptrget_32, __stencil_text_ptrget_32, 42ui64, 30ui64, __stencil_hole_ptrget_32, 2ui64 },
+		{ op::ptrget_16, __stencil_text_ptrget_16, 44ui64, 32ui64, __stencil_hole_ptrget_16, 2ui64 },
+		{ op::ptrget_8, __stencil_text_ptrget_8, 43ui64, 31ui64, __stencil_hole_ptrget_8, 2ui64 },
+		{ op::ptrset_64, __stencil_text_ptrset_64, 39ui64, 27ui64, __stencil_hole_ptrset_64, 2ui64 },
+		{ op::ptrset_32, __stencil_text_ptrset_32, 39ui64, 27ui64, __stencil_hole_ptrset_32, 2ui64 },
+		{ op::ptrset_16, __stencil_text_ptrset_16, 41ui64, 29ui64, __stencil_hole_ptrset_16, 2ui64 },
+		{ op::ptrset_8, __stencil_text_ptrset_8, 40ui64, 28ui64, __stencil_hole_ptrset_8, 2ui64 },
+		{ op::neg_64, __stencil_text_neg_64, 28ui64, 16ui64, __stencil_hole_neg_64, 2ui64 },
+		{ op::neg_32, __stencil_text_neg_32, 27ui64, 15ui64, __stencil_hole_neg_32, 2ui64 },
+		{ op::neg_16, __stencil_text_neg_16, 28ui64, 16ui64, __stencil_hole_neg_16, 2ui64 },
+		{ op::neg_8, __stencil_text_neg_8, 27ui64, 15ui64, __stencil_hole_neg_8, 2ui64 },
+		{ op::not_64, __stencil_text_not_64, 28ui64, 16ui64, __stencil_hole_not_64, 2ui64 },
+		{ op::not_32, __stencil_text_not_32, 27ui64, 15ui64, __stencil_hole_not_32, 2ui64 },
+		{ op::not_16, __stencil_text_not_16, 28ui64, 16ui64, __stencil_hole_not_16, 2ui64 },
+		{ op::not_8, __stencil_text_not_8, 27ui64, 15ui64, __stencil_hole_not_8, 2ui64 },
+		{ op::sinc_64, __stencil_text_sinc_64, 29ui64, 17ui64, __stencil_hole_sinc_64, 2ui64 },
+		{ op::sinc_32, __stencil_text_sinc_32, 28ui64, 16ui64, __stencil_hole_sinc_32, 2ui64 },
+		{ op::sinc_16, __stencil_text_sinc_16, 29ui64, 17ui64, __stencil_hole_sinc_16, 2ui64 },
+		{ op::sinc_8, __stencil_text_sinc_8, 28ui64, 16ui64, __stencil_hole_sinc_8, 2ui64 },
+		{ op::uinc_64, __stencil_text_uinc_64, 29ui64, 17ui64, __stencil_hole_uinc_64, 2ui64 },
+		{ op::uinc_32, __stencil_text_uinc_32, 28ui64, 16ui64, __stencil_hole_uinc_32, 2ui64 },
+		{ op::uinc_16, __stencil_text_uinc_16, 29ui64, 17ui64, __stencil_hole_uinc_16, 2ui64 },
+		{ op::uinc_8, __stencil_text_uinc_8, 28ui64, 16ui64, __stencil_hole_uinc_8, 2ui64 },
+		{ op::sdec_64, __stencil_text_sdec_64, 29ui64, 17ui64, __stencil_hole_sdec_64, 2ui64 },
+		{ op::sdec_32, __stencil_text_sdec_32, 28ui64, 16ui64, __stencil_hole_sdec_32, 2ui64 },
+		{ op::sdec_16, __stencil_text_sdec_16, 29ui64, 17ui64, __stencil_hole_sdec_16, 2ui64 },
+		{ op::sdec_8, __stencil_text_sdec_8, 28ui64, 16ui64, __stencil_hole_sdec_8, 2ui64 },
+		{ op::udec_64, __stencil_text_udec_64, 29ui64, 17ui64, __stencil_hole_udec_64, 2ui64 },
+		{ op::udec_32, __stencil_text_udec_32, 28ui64, 16ui64, __stencil_hole_udec_32, 2ui64 },
+		{ op::udec_16, __stencil_text_udec_16, 29ui64, 17ui64, __stencil_hole_udec_16, 2ui64 },
+		{ op::udec_8, __stencil_text_udec_8, 28ui64, 16ui64, __stencil_hole_udec_8, 2ui64 },
+		{ op::and_64, __stencil_text_and_64, 39ui64, 27ui64, __stencil_hole_and_64, 2ui64 },
+		{ op::and_32, __stencil_text_and_32, 39ui64, 27ui64, __stencil_hole_and_32, 2ui64 },
+		{ op::and_16, __stencil_text_and_16, 41ui64, 29ui64, __stencil_hole_and_16, 2ui64 },
+		{ op::and_8, __stencil_text_and_8, 40ui64, 28ui64, __stencil_hole_and_8, 2ui64 },
+		{ op::or_64, __stencil_text_or_64, 39ui64, 27ui64, __stencil_hole_or_64, 2ui64 },
+		{ op::or_32, __stencil_text_or_32, 39ui64, 27ui64, __stencil_hole_or_32, 2ui64 },
+		{ op::or_16, __stencil_text_or_16, 41ui64, 29ui64, __stencil_hole_or_16, 2ui64 },
+		{ op::or_8, __stencil_text_or_8, 40ui64, 28ui64, __stencil_hole_or_8, 2ui64 },
+		{ op::xor_64, __stencil_text_xor_64, 39ui64, 27ui64, __stencil_hole_xor_64, 2ui64 },
+		{ op::xor_32, __stencil_text_xor_32, 39ui64, 27ui64, __stencil_hole_xor_32, 2ui64 },
+		{ op::xor_16, __stencil_text_xor_16, 41ui64, 29ui64, __stencil_hole_xor_16, 2ui64 },
+		{ op::xor_8, __stencil_text_xor_8, 40ui64, 28ui64, __stencil_hole_xor_8, 2ui64 },
+		{ op::sadd_64, __stencil_text_sadd_64, 39ui64, 27ui64, __stencil_hole_sadd_64, 2ui64 },
+		{ op::sadd_32, __stencil_text_sadd_32, 39ui64, 27ui64, __stencil_hole_sadd_32, 2ui64 },
+		{ op::sadd_16, __stencil_text_sadd_16, 41ui64, 29ui64, __stencil_hole_sadd_16, 2ui64 },
+		{ op::sadd_8, __stencil_text_sadd_8, 40ui64, 28ui64, __stencil_hole_sadd_8, 2ui64 },
+		{ op::uadd_64, __stencil_text_uadd_64, 39ui64, 27ui64, __stencil_hole_uadd_64, 2ui64 },
+		{ op::uadd_32, __stencil_text_uadd_32, 39ui64, 27ui64, __stencil_hole_uadd_32, 2ui64 },
+		{ op::uadd_16, __stencil_text_uadd_16, 41ui64, 29ui64, __stencil_hole_uadd_16, 2ui64 },
+		{ op::uadd_8, __stencil_text_uadd_8, 40ui64, 28ui64, __stencil_hole_uadd_8, 2ui64 },
+		{ op::ssub_64, __stencil_text_ssub_64, 39ui64, 27ui64, __stencil_hole_ssub_64, 2ui64 },
+		{ op::ssub_32, __stencil_text_ssub_32, 39ui64, 27ui64, __stencil_hole_ssub_32, 2ui64 },
+		{ op::ssub_16, __stencil_text_ssub_16, 41ui64, 29ui64, __stencil_hole_ssub_16, 2ui64 },
+		{ op::ssub_8, __stencil_text_ssub_8, 40ui64, 28ui64, __stencil_hole_ssub_8, 2ui64 },
+		{ op::usub_64, __stencil_text_usub_64, 39ui64, 27ui64, __stencil_hole_usub_64, 2ui64 },
+		{ op::usub_32, __stencil_text_usub_32, 39ui64, 27ui64, __stencil_hole_usub_32, 2ui64 },
+		{ op::usub_16, __stencil_text_usub_16, 41ui64, 29ui64, __stencil_hole_usub_16, 2ui64 },
+		{ op::usub_8, __stencil_text_usub_8, 40ui64, 28ui64, __stencil_hole_usub_8, 2ui64 },
+		{ op::smul_64, __stencil_text_smul_64, 44ui64, 32ui64, __stencil_hole_smul_64, 2ui64 },
+		{ op::smul_32, __stencil_text_smul_32, 41ui64, 29ui64, __stencil_hole_smul_32, 2ui64 },
+		{ op::smul_16, __stencil_text_smul_16, 44ui64, 32ui64, __stencil_hole_smul_16, 2ui64 },
+		{ op::smul_8, __stencil_text_smul_8, 41ui64, 29ui64, __stencil_hole_smul_8, 2ui64 },
+		{ op::umul_64, __stencil_text_umul_64, 44ui64, 32ui64, __stencil_hole_umul_64, 2ui64 },
+		{ op::umul_32, __stencil_text_umul_32, 41ui64, 29ui64, __stencil_hole_umul_32, 2ui64 },
+		{ op::umul_16, __stencil_text_umul_16, 44ui64, 32ui64, __stencil_hole_umul_16, 2ui64 },
+		{ op::umul_8, __stencil_text_umul_8, 41ui64, 29ui64, __stencil_hole_umul_8, 2ui64 },
+		{ op::smod_64, __stencil_text_smod_64, 90ui64, 90ui64, __stencil_hole_smod_64, 2ui64 },
+		{ op::smod_32, __stencil_text_smod_32, 89ui64, 89ui64, __stencil_hole_smod_32, 2ui64 },
+		{ op::smod_16, __stencil_text_smod_16, 88ui64, 88ui64, __stencil_hole_smod_16, 2ui64 },
+		{ op::smod_8, __stencil_text_smod_8, 86ui64, 86ui64, __stencil_hole_smod_8, 2ui64 },
+		{ op::umod_64, __stencil_text_umod_64, 62ui64, 50ui64, __stencil_hole_umod_64, 2ui64 },
+		{ op::umod_32, __stencil_text_umod_32, 60ui64, 48ui64, __stencil_hole_umod_32, 2ui64 },
+		{ op::umod_16, __stencil_text_umod_16, 65ui64, 53ui64, __stencil_hole_umod_16, 2ui64 },
+		{ op::umod_8, __stencil_text_umod_8, 51ui64, 39ui64, __stencil_hole_umod_8, 2ui64 },
+		{ op::sdiv_64, __stencil_text_sdiv_64, 98ui64, 98ui64, __stencil_hole_sdiv_64, 2ui64 },
+		{ op::sdiv_32, __stencil_text_sdiv_32, 88ui64, 88ui64, __stencil_hole_sdiv_32, 2ui64 },
+		{ op::sdiv_16, __stencil_text_sdiv_16, 100ui64, 100ui64, __stencil_hole_sdiv_16, 2ui64 },
+		{ op::sdiv_8, __stencil_text_sdiv_8, 89ui64, 89ui64, __stencil_hole_sdiv_8, 2ui64 },
+		{ op::udiv_64, __stencil_text_udiv_64, 62ui64, 50ui64, __stencil_hole_udiv_64, 2ui64 },
+		{ op::udiv_32, __stencil_text_udiv_32, 60ui64, 48ui64, __stencil_hole_udiv_32, 2ui64 },
+		{ op::udiv_16, __stencil_text_udiv_16, 65ui64, 53ui64, __stencil_hole_udiv_16, 2ui64 },
+		{ op::udiv_8, __stencil_text_udiv_8, 51ui64, 39ui64, __stencil_hole_udiv_8, 2ui64 },
+		{ op::scmp_64, __stencil_text_scmp_64, 75ui64, 63ui64, __stencil_hole_scmp_64, 2ui64 },
+		{ op::scmp_32, __stencil_text_scmp_32, 75ui64, 63ui64, __stencil_hole_scmp_32, 2ui64 },
+		{ op::scmp_16, __stencil_text_scmp_16, 79ui64, 67ui64, __stencil_hole_scmp_16, 2ui64 },
+		{ op::scmp_8, __stencil_text_scmp_8, 77ui64, 65ui64, __stencil_hole_scmp_8, 2ui64 },
+		{ op::ucmp_64, __stencil_text_ucmp_64, 75ui64, 63ui64, __stencil_hole_ucmp_64, 2ui64 },
+		{ op::ucmp_32, __stencil_text_ucmp_32, 75ui64, 63ui64, __stencil_hole_ucmp_32, 2ui64 },
+		{ op::ucmp_16, __stencil_text_ucmp_16, 79ui64, 67ui64, __stencil_hole_ucmp_16, 2ui64 },
+		{ op::ucmp_8, __stencil_text_ucmp_8, 77ui64, 65ui64, __stencil_hole_ucmp_8, 2ui64 },
+		{ op::rotl_64, __stencil_text_rotl_64, 42ui64, 30ui64, __stencil_hole_rotl_64, 2ui64 },
+		{ op::rotl_32, __stencil_text_rotl_32, 41ui64, 29ui64, __stencil_hole_rotl_32, 2ui64 },
+		{ op::rotl_16, __stencil_text_rotl_16, 42ui64, 30ui64, __stencil_hole_rotl_16, 2ui64 },
+		{ op::rotl_8, __stencil_text_rotl_8, 41ui64, 29ui64, __stencil_hole_rotl_8, 2ui64 },
+		{ op::rotr_64, __stencil_text_rotr_64, 42ui64, 30ui64, __stencil_hole_rotr_64, 2ui64 },
+		{ op::rotr_32, __stencil_text_rotr_32, 41ui64, 29ui64, __stencil_hole_rotr_32, 2ui64 },
+		{ op::rotr_16, __stencil_text_rotr_16, 42ui64, 30ui64, __stencil_hole_rotr_16, 2ui64 },
+		{ op::rotr_8, __stencil_text_rotr_8, 41ui64, 29ui64, __stencil_hole_rotr_8, 2ui64 },
+		{ op::sshl_64, __stencil_text_sshl_64, 42ui64, 30ui64, __stencil_hole_sshl_64, 2ui64 },
+		{ op::sshl_32, __stencil_text_sshl_32, 41ui64, 29ui64, __stencil_hole_sshl_32, 2ui64 },
+		{ op::sshl_16, __stencil_text_sshl_16, 51ui64, 51ui64, __stencil_hole_sshl_16, 2ui64 },
+		{ op::sshl_8, __stencil_text_sshl_8, 50ui64, 50ui64, __stencil_hole_sshl_8, 2ui64 },
+		{ op::ushl_64, __stencil_text_ushl_64, 42ui64, 30ui64, __stencil_hole_ushl_64, 2ui64 },
+		{ op::ushl_32, __stencil_text_ushl_32, 41ui64, 29ui64, __stencil_hole_ushl_32, 2ui64 },
+		{ op::ushl_16, __stencil_text_ushl_16, 51ui64, 51ui64, __stencil_hole_ushl_16, 2ui64 },
+		{ op::ushl_8, __stencil_text_ushl_8, 50ui64, 50ui64, __stencil_hole_ushl_8, 2ui64 },
+		{ op::sshr_64, __stencil_text_sshr_64, 42ui64, 30ui64, __stencil_hole_sshr_64, 2ui64 },
+		{ op::sshr_32, __stencil_text_sshr_32, 41ui64, 29ui64, __stencil_hole_sshr_32, 2ui64 },
+		{ op::sshr_16, __stencil_text_sshr_16, 51ui64, 51ui64, __stencil_hole_sshr_16, 2ui64 },
+		{ op::sshr_8, __stencil_text_sshr_8, 50ui64, 50ui64, __stencil_hole_sshr_8, 2ui64 },
+		{ op::ushr_64, __stencil_text_ushr_64, 42ui64, 30ui64, __stencil_hole_ushr_64, 2ui64 },
+		{ op::ushr_32, __stencil_text_ushr_32, 41ui64, 29ui64, __stencil_hole_ushr_32, 2ui64 },
+		{ op::ushr_16, __stencil_text_ushr_16, 51ui64, 51ui64, __stencil_hole_ushr_16, 2ui64 },
+		{ op::ushr_8, __stencil_text_ushr_8, 50ui64, 50ui64, __stencil_hole_ushr_8, 2ui64 },
+		{ op::fadd_64, __stencil_text_fadd_64, 46ui64, 34ui64, __stencil_hole_fadd_64, 2ui64 },
+		{ op::fadd_32, __stencil_text_fadd_32, 46ui64, 34ui64, __stencil_hole_fadd_32, 2ui64 },
+		{ op::fsub_64, __stencil_text_fsub_64, 46ui64, 34ui64, __stencil_hole_fsub_64, 2ui64 },
+		{ op::fsub_32, __stencil_text_fsub_32, 46ui64, 34ui64, __stencil_hole_fsub_32, 2ui64 },
+		{ op::fmul_64, __stencil_text_fmul_64, 46ui64, 34ui64, __stencil_hole_fmul_64, 2ui64 },
+		{ op::fmul_32, __stencil_text_fmul_32, 46ui64, 34ui64, __stencil_hole_fmul_32, 2ui64 },
+		{ op::fdiv_64, __stencil_text_fdiv_64, 46ui64, 34ui64, __stencil_hole_fdiv_64, 2ui64 },
+		{ op::fdiv_32, __stencil_text_fdiv_32, 46ui64, 34ui64, __stencil_hole_fdiv_32, 2ui64 },
+		{ op::fcmp_64, __stencil_text_fcmp_64, 79ui64, 67ui64, __stencil_hole_fcmp_64, 2ui64 },
+		{ op::fcmp_32, __stencil_text_fcmp_32, 77ui64, 65ui64, __stencil_hole_fcmp_32, 2ui64 },
+		{ op::si64_2_f64, __stencil_text_si64_2_f64, 38ui64, 38ui64, __stencil_hole_si64_2_f64, 2ui64 },
+		{ op::si64_2_f32, __stencil_text_si64_2_f32, 43ui64, 43ui64, __stencil_hole_si64_2_f32, 2ui64 },
+		{ op::si32_2_f64, __stencil_text_si32_2_f64, 45ui64, 33ui64, __stencil_hole_si32_2_f64, 2ui64 },
+		{ op::si32_2_f32, __stencil_text_si32_2_f32, 37ui64, 37ui64, __stencil_hole_si32_2_f32, 2ui64 },
+		{ op::ui64_2_f64, __stencil_text_ui64_2_f64, 75ui64, 75ui64, __stencil_hole_ui64_2_f64, 2ui64 },
+		{ op::ui64_2_f32, __stencil_text_ui64_2_f32, 83ui64, 83ui64, __stencil_hole_ui64_2_f32, 2ui64 },
+		{ op::ui32_2_f64, __stencil_text_ui32_2_f64, 49ui64, 37ui64, __stencil_hole_ui32_2_f64, 2ui64 },
+		{ op::ui32_2_f32, __stencil_text_ui32_2_f32, 40ui64, 40ui64, __stencil_hole_ui32_2_f32, 2ui64 },
+		{ op::s_ucmp_jmp_64, __stencil_text_s_ucmp_jmp_64, 222ui64, 222ui64, __stencil_hole_s_ucmp_jmp_64, 7ui64 },
+		{ op::s_scmp_jmp_64, __stencil_text_s_scmp_jmp_64, 222ui64, 222ui64, __stencil_hole_s_scmp_jmp_64, 7ui64 },
+		{ op::s_uinc_64, __stencil_text_s_uinc_64, 60ui64, 48ui64, __stencil_hole_s_uinc_64, 3ui64 },
+		{ op::s_udec_64, __stencil_text_s_udec_64, 60ui64, 48ui64, __stencil_hole_s_udec_64, 3ui64 },
+		{ op::s_uadd_64, __stencil_text_s_uadd_64, 104ui64, 92ui64, __stencil_hole_s_uadd_64, 4ui64 },
+		{ op::s_move_64, __stencil_text_s_move_64, 95ui64, 83ui64, __stencil_hole_s_move_64, 4ui64 },
+		{ op::gen_0, __stencil_text_gen_0, 25ui64, 13ui64, __stencil_hole_gen_0, 2ui64 },
+		{ op::gen_1, __stencil_text_gen_1, 25ui64, 13ui64, __stencil_hole_gen_1, 2ui64 },
+		{ op::gen_2, __stencil_text_gen_2, 25ui64, 13ui64, __stencil_hole_gen_2, 2ui64 },
+		{ op::gen_3, __stencil_text_gen_3, 25ui64, 13ui64, __stencil_hole_gen_3, 2ui64 }
+	};
+
+	// Dropped: memcpy, memset, l_allocz, fneg_64, fneg_32, fevl_64, fevl_32, fmod_64,
+	//          fmod_32, f64_2_si64, f64_2_si32, f32_2_si64, f32_2_si32, f64_2_ui64, f64_2_ui32, f32_2_ui64,
+	//          f32_2_ui32
+}
+#endif
\ No newline at end of file
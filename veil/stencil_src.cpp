@@ -0,0 +1,2240 @@
+#include "dispatcher.hpp"
+#include "stencil.hpp"
+
+using namespace interpreter;
+using namespace std;
+
+#ifdef X64JIT
+#define __2_POW_64 18446744073709551616.0
+#define __2_POW_63 9223372036854775808.0
+#define __2_POW_32 4294967296.0
+#define __2_POW_31 2147483648.0
+#define __0 0.0
+
+// Stencils are the DEEPINLINE bodies of dispatcher::loop compiled on their own, so this file
+// is left out of the build; stencilgen.sh compiles it and turns the object into stencil_gen.hpp,
+// stencilgen.sh --check tells whether the checked in stencil_gen.hpp is still current
+//
+// The large code model turns every __hole_* symbol into a 64-bit absolute address the loader
+// patches, stencils referring to anything else (libc, constants) are dropped by stencilgen
+
+extern "C" const uint8_t __hole_opptr[];
+extern "C" const uint8_t __hole_end[];
+extern "C" const uint8_t __hole_code[];
+extern "C" const uint8_t __hole_size[];
+extern "C" const stencil_fn __hole_table[];
+
+extern "C" void __hole_next(jit_context* ctx, uintptr_t ftop, uintptr_t stop, uint64_t flags, const uint8_t* opptr);
+extern "C" void __hole_target(jit_context* ctx, uintptr_t ftop, uintptr_t stop, uint64_t flags, const uint8_t* opptr);
+extern "C" void __hole_leave(jit_context* ctx, uintptr_t ftop, uintptr_t stop, uint64_t flags, const uint8_t* opptr);
+extern "C" void __hole_lookup(jit_context* ctx, uintptr_t ftop, uintptr_t stop, uint64_t flags, const uint8_t* opptr);
+
+namespace interpreter
+{
+	struct stencil_ops
+	{
+	public:
+		using stack_type = dispatcher::stack_type;
+
+		static inline state unpack(uint64_t flags)
+		{
+			return state(comp_union(comp_byte((uint8_t)flags)), eval_union(eval_byte((uint8_t)(flags >> 8ui64))));
+		}
+
+		static inline uint64_t pack(const state& state)
+		{
+			return (uint64_t)state.comp.byte.value | ((uint64_t)state.eval.byte.value << 8ui64);
+		}
+
+		template <op OP>
+		static inline void run(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state);
+	};
+}
+
+#define __STENCIL(name, tail)\
+extern "C" void __stencil_##name(jit_context* ctx, uintptr_t ftop, uintptr_t stop, uint64_t flags, const uint8_t* opptr)\
+{\
+	state state = stencil_ops::unpack(flags);\
+\
+	opptr = __hole_opptr + (ptrdiff_t)1;\
+	stencil_ops::run<op::name>(opptr, ftop, stop, state);\
+	flags = stencil_ops::pack(state);\
+\
+	tail;\
+}
+
+#define __NEXT return __hole_next(ctx, ftop, stop, flags, opptr)
+#define __JUMP return __hole_target(ctx, ftop, stop, flags, opptr)
+#define __JCC return opptr != __hole_end ? __hole_target(ctx, ftop, stop, flags, opptr) : __hole_next(ctx, ftop, stop, flags, opptr)
+#define __FLOW return __hole_lookup(ctx, ftop, stop, flags, opptr)
+
+// Writes the machine state back and returns to the dispatcher, opptr is the op to resume at
+
+extern "C" void __stencil_leave(jit_context* ctx, uintptr_t ftop, uintptr_t stop, uint64_t flags, const uint8_t* opptr)
+{
+	ctx->stop = stop;
+	ctx->ftop = ftop;
+	ctx->opptr = opptr;
+	ctx->comp = (uint8_t)flags;
+	ctx->eval = (uint8_t)(flags >> 8ui64);
+}
+
+// Jumps to the native code of a byte code address taken from the stack, or leaves
+
+extern "C" void __stencil_lookup(jit_context* ctx, uintptr_t ftop, uintptr_t stop, uint64_t flags, const uint8_t* opptr)
+{
+	const uint64_t index = (uint64_t)(opptr - __hole_code);
+
+	if (index < (uint64_t)(uintptr_t)__hole_size && __hole_table[index] != (stencil_fn)nullptr)
+		return __hole_table[index](ctx, ftop, stop, flags, opptr);
+	else
+		return __hole_leave(ctx, ftop, stop, flags, opptr);
+}
+
+// Stands for an op without a stencil or a branch into an instruction
+
+extern "C" void __stencil_side(jit_context* ctx, uintptr_t ftop, uintptr_t stop, uint64_t flags, const uint8_t* opptr)
+{
+	return __hole_leave(ctx, ftop, stop, flags, __hole_opptr);
+}
+
+extern "C" void __stencil_exit(jit_context* ctx, uintptr_t ftop, uintptr_t stop, uint64_t flags, const uint8_t* opptr)
+{
+	ctx->exit = true;
+
+	return __hole_leave(ctx, ftop, stop, flags, __hole_opptr);
+}
+
+template <>
+inline void stencil_ops::run<op::nop>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+}
+
+__STENCIL(nop, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::ret>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	opptr = (const uint8_t*)stack_type::dil_pop_frame(ftop, stop);
+}
+
+__STENCIL(ret, __FLOW)
+
+template <>
+inline void stencil_ops::run<op::call_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_call<val64<>>(opptr, ftop, stop);
+}
+
+__STENCIL(call_64, __JUMP)
+
+template <>
+inline void stencil_ops::run<op::call_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_call<val32<>>(opptr, ftop, stop);
+}
+
+__STENCIL(call_32, __JUMP)
+
+template <>
+inline void stencil_ops::run<op::call_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_call<val16<>>(opptr, ftop, stop);
+}
+
+__STENCIL(call_16, __JUMP)
+
+template <>
+inline void stencil_ops::run<op::call_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_call<val8<>>(opptr, ftop, stop);
+}
+
+__STENCIL(call_8, __JUMP)
+
+template <>
+inline void stencil_ops::run<op::memcpy>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	uint8_t* dst = (uint8_t*)stack_type::dil_pop_ptr(stop);
+	uint8_t* src = (uint8_t*)stack_type::dil_pop_ptr(stop);
+	const uint64_t c = stack_type::dil_pop<val64<>>(stop).ui;
+
+	memcpy(dst, src, c);
+}
+
+__STENCIL(memcpy, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::memset>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	uint8_t* dst = (uint8_t*)stack_type::dil_pop_ptr(stop);
+	const uint8_t val = stack_type::dil_pop<val8<>>(stop).ui;
+	const uint64_t c = stack_type::dil_pop<val64<>>(stop).ui;
+
+	memset(dst, val, c);
+}
+
+__STENCIL(memset, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::l_alloc>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	stack_type::dil_alloc(stop, (uint64_t)dispatcher::dil_fetch<val16<>>(opptr).ui);
+}
+
+__STENCIL(l_alloc, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::s_alloc>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	stack_type::dil_alloc(stop, (uint64_t)dispatcher::dil_fetch<val8<>>(opptr).ui);
+}
+
+__STENCIL(s_alloc, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::l_allocz>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	stack_type::dil_allocz(stop, (uint64_t)dispatcher::dil_fetch<val16<>>(opptr).ui);
+}
+
+__STENCIL(l_allocz, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::s_allocz>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	stack_type::dil_allocz(stop, (uint64_t)dispatcher::dil_fetch<val8<>>(opptr).ui);
+}
+
+__STENCIL(s_allocz, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::l_dealloc>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	stack_type::dil_dealloc(stop, (uint64_t)dispatcher::dil_fetch<val16<>>(opptr).ui);
+}
+
+__STENCIL(l_dealloc, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::s_dealloc>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	stack_type::dil_dealloc(stop, (uint64_t)dispatcher::dil_fetch<val8<>>(opptr).ui);
+}
+
+__STENCIL(s_dealloc, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::push_flow>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	stack_type::dil_push_ptr(stop, (uintptr_t)opptr);
+}
+
+__STENCIL(push_flow, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::push_frame>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	stack_type::dil_store_frame(ftop, stop);
+}
+
+__STENCIL(push_frame, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::push_stack>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	stack_type::dil_store_stack(stop);
+}
+
+__STENCIL(push_stack, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::push_state>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	stack_type::dil_push(stop, (state_val<>(state)).__value);
+}
+
+__STENCIL(push_state, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::pop_flow>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	opptr = (const uint8_t*)stack_type::dil_pop_ptr(stop);
+}
+
+__STENCIL(pop_flow, __FLOW)
+
+template <>
+inline void stencil_ops::run<op::pop_frame>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	stack_type::dil_load_frame(ftop, stop);
+}
+
+__STENCIL(pop_frame, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::pop_stack>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	stack_type::dil_load_stack(stop);
+}
+
+__STENCIL(pop_stack, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::pop_state>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	state = (state_val<>(stack_type::dil_pop<val16<>>(stop))).__state;
+}
+
+__STENCIL(pop_state, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::jmp_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp<val64<>>(opptr);
+}
+
+__STENCIL(jmp_64, __JUMP)
+
+template <>
+inline void stencil_ops::run<op::jmp_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp<val32<>>(opptr);
+}
+
+__STENCIL(jmp_32, __JUMP)
+
+template <>
+inline void stencil_ops::run<op::jmp_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp<val16<>>(opptr);
+}
+
+__STENCIL(jmp_16, __JUMP)
+
+template <>
+inline void stencil_ops::run<op::jmp_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp<val8<>>(opptr);
+}
+
+__STENCIL(jmp_8, __JUMP)
+
+template <>
+inline void stencil_ops::run<op::jmp_a_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp_a<val64<>>(opptr, state);
+}
+
+__STENCIL(jmp_a_64, __JCC)
+
+template <>
+inline void stencil_ops::run<op::jmp_a_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp_a<val32<>>(opptr, state);
+}
+
+__STENCIL(jmp_a_32, __JCC)
+
+template <>
+inline void stencil_ops::run<op::jmp_a_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp_a<val16<>>(opptr, state);
+}
+
+__STENCIL(jmp_a_16, __JCC)
+
+template <>
+inline void stencil_ops::run<op::jmp_a_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp_a<val8<>>(opptr, state);
+}
+
+__STENCIL(jmp_a_8, __JCC)
+
+template <>
+inline void stencil_ops::run<op::jmp_ae_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp_ae<val64<>>(opptr, state);
+}
+
+__STENCIL(jmp_ae_64, __JCC)
+
+template <>
+inline void stencil_ops::run<op::jmp_ae_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp_ae<val32<>>(opptr, state);
+}
+
+__STENCIL(jmp_ae_32, __JCC)
+
+template <>
+inline void stencil_ops::run<op::jmp_ae_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp_ae<val16<>>(opptr, state);
+}
+
+__STENCIL(jmp_ae_16, __JCC)
+
+template <>
+inline void stencil_ops::run<op::jmp_ae_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp_ae<val8<>>(opptr, state);
+}
+
+__STENCIL(jmp_ae_8, __JCC)
+
+template <>
+inline void stencil_ops::run<op::jmp_b_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp_b<val64<>>(opptr, state);
+}
+
+__STENCIL(jmp_b_64, __JCC)
+
+template <>
+inline void stencil_ops::run<op::jmp_b_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp_b<val32<>>(opptr, state);
+}
+
+__STENCIL(jmp_b_32, __JCC)
+
+template <>
+inline void stencil_ops::run<op::jmp_b_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp_b<val16<>>(opptr, state);
+}
+
+__STENCIL(jmp_b_16, __JCC)
+
+template <>
+inline void stencil_ops::run<op::jmp_b_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp_b<val8<>>(opptr, state);
+}
+
+__STENCIL(jmp_b_8, __JCC)
+
+template <>
+inline void stencil_ops::run<op::jmp_be_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp_be<val64<>>(opptr, state);
+}
+
+__STENCIL(jmp_be_64, __JCC)
+
+template <>
+inline void stencil_ops::run<op::jmp_be_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp_be<val32<>>(opptr, state);
+}
+
+__STENCIL(jmp_be_32, __JCC)
+
+template <>
+inline void stencil_ops::run<op::jmp_be_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp_be<val16<>>(opptr, state);
+}
+
+__STENCIL(jmp_be_16, __JCC)
+
+template <>
+inline void stencil_ops::run<op::jmp_be_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp_be<val8<>>(opptr, state);
+}
+
+__STENCIL(jmp_be_8, __JCC)
+
+template <>
+inline void stencil_ops::run<op::jmp_e_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp_e<val64<>>(opptr, state);
+}
+
+__STENCIL(jmp_e_64, __JCC)
+
+template <>
+inline void stencil_ops::run<op::jmp_e_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp_e<val32<>>(opptr, state);
+}
+
+__STENCIL(jmp_e_32, __JCC)
+
+template <>
+inline void stencil_ops::run<op::jmp_e_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp_e<val16<>>(opptr, state);
+}
+
+__STENCIL(jmp_e_16, __JCC)
+
+template <>
+inline void stencil_ops::run<op::jmp_e_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp_e<val8<>>(opptr, state);
+}
+
+__STENCIL(jmp_e_8, __JCC)
+
+template <>
+inline void stencil_ops::run<op::jmp_ne_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp_ne<val64<>>(opptr, state);
+}
+
+__STENCIL(jmp_ne_64, __JCC)
+
+template <>
+inline void stencil_ops::run<op::jmp_ne_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp_ne<val32<>>(opptr, state);
+}
+
+__STENCIL(jmp_ne_32, __JCC)
+
+template <>
+inline void stencil_ops::run<op::jmp_ne_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp_ne<val16<>>(opptr, state);
+}
+
+__STENCIL(jmp_ne_16, __JCC)
+
+template <>
+inline void stencil_ops::run<op::jmp_ne_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp_ne<val8<>>(opptr, state);
+}
+
+__STENCIL(jmp_ne_8, __JCC)
+
+template <>
+inline void stencil_ops::run<op::jmp_un_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp_un<val64<>>(opptr, state);
+}
+
+__STENCIL(jmp_un_64, __JCC)
+
+template <>
+inline void stencil_ops::run<op::jmp_un_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp_un<val32<>>(opptr, state);
+}
+
+__STENCIL(jmp_un_32, __JCC)
+
+template <>
+inline void stencil_ops::run<op::jmp_un_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp_un<val16<>>(opptr, state);
+}
+
+__STENCIL(jmp_un_16, __JCC)
+
+template <>
+inline void stencil_ops::run<op::jmp_un_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp_un<val8<>>(opptr, state);
+}
+
+__STENCIL(jmp_un_8, __JCC)
+
+template <>
+inline void stencil_ops::run<op::jmp_msk_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp_msk<val64<>>(opptr, state);
+}
+
+__STENCIL(jmp_msk_64, __JCC)
+
+template <>
+inline void stencil_ops::run<op::jmp_msk_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp_msk<val32<>>(opptr, state);
+}
+
+__STENCIL(jmp_msk_32, __JCC)
+
+template <>
+inline void stencil_ops::run<op::jmp_msk_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp_msk<val16<>>(opptr, state);
+}
+
+__STENCIL(jmp_msk_16, __JCC)
+
+template <>
+inline void stencil_ops::run<op::jmp_msk_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_jmp_msk<val8<>>(opptr, state);
+}
+
+__STENCIL(jmp_msk_8, __JCC)
+
+template <>
+inline void stencil_ops::run<op::l_load_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_l_load<val64<>>(opptr, ftop, stop);
+}
+
+__STENCIL(l_load_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::l_load_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_l_load<val32<>>(opptr, ftop, stop);
+}
+
+__STENCIL(l_load_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::l_load_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_l_load<val16<>>(opptr, ftop, stop);
+}
+
+__STENCIL(l_load_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::l_load_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_l_load<val8<>>(opptr, ftop, stop);
+}
+
+__STENCIL(l_load_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::l_store_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_l_store<val64<>>(opptr, ftop, stop);
+}
+
+__STENCIL(l_store_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::l_store_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_l_store<val32<>>(opptr, ftop, stop);
+}
+
+__STENCIL(l_store_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::l_store_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_l_store<val16<>>(opptr, ftop, stop);
+}
+
+__STENCIL(l_store_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::l_store_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_l_store<val8<>>(opptr, ftop, stop);
+}
+
+__STENCIL(l_store_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::s_load_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_s_load<val64<>>(opptr, ftop, stop);
+}
+
+__STENCIL(s_load_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::s_load_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_s_load<val32<>>(opptr, ftop, stop);
+}
+
+__STENCIL(s_load_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::s_load_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_s_load<val16<>>(opptr, ftop, stop);
+}
+
+__STENCIL(s_load_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::s_load_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_s_load<val8<>>(opptr, ftop, stop);
+}
+
+__STENCIL(s_load_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::s_store_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_s_store<val64<>>(opptr, ftop, stop);
+}
+
+__STENCIL(s_store_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::s_store_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_s_store<val32<>>(opptr, ftop, stop);
+}
+
+__STENCIL(s_store_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::s_store_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_s_store<val16<>>(opptr, ftop, stop);
+}
+
+__STENCIL(s_store_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::s_store_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_s_store<val8<>>(opptr, ftop, stop);
+}
+
+__STENCIL(s_store_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::push_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_push<val64<>>(opptr, stop);
+}
+
+__STENCIL(push_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::push_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_push<val32<>>(opptr, stop);
+}
+
+__STENCIL(push_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::push_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_push<val16<>>(opptr, stop);
+}
+
+__STENCIL(push_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::push_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_push<val8<>>(opptr, stop);
+}
+
+__STENCIL(push_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::pop_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	stack_type::dil_rem<val64<>>(stop);
+}
+
+__STENCIL(pop_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::pop_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	stack_type::dil_rem<val32<>>(stop);
+}
+
+__STENCIL(pop_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::pop_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	stack_type::dil_rem<val16<>>(stop);
+}
+
+__STENCIL(pop_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::pop_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	stack_type::dil_rem<val8<>>(stop);
+}
+
+__STENCIL(pop_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::dup_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	stack_type::dil_dup<val64<>>(stop);
+}
+
+__STENCIL(dup_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::dup_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	stack_type::dil_dup<val32<>>(stop);
+}
+
+__STENCIL(dup_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::dup_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	stack_type::dil_dup<val16<>>(stop);
+}
+
+__STENCIL(dup_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::dup_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	stack_type::dil_dup<val8<>>(stop);
+}
+
+__STENCIL(dup_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::ptrcpy_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_ptrcpy<val64<>>(stop);
+}
+
+__STENCIL(ptrcpy_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::ptrcpy_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_ptrcpy<val32<>>(stop);
+}
+
+__STENCIL(ptrcpy_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::ptrcpy_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_ptrcpy<val16<>>(stop);
+}
+
+__STENCIL(ptrcpy_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::ptrcpy_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_ptrcpy<val8<>>(stop);
+}
+
+__STENCIL(ptrcpy_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::ptrget_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_ptrget<val64<>>(stop);
+}
+
+__STENCIL(ptrget_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::ptrget_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_ptrget<val32<>>(stop);
+}
+
+__STENCIL(ptrget_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::ptrget_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_ptrget<val16<>>(stop);
+}
+
+__STENCIL(ptrget_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::ptrget_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_ptrget<val8<>>(stop);
+}
+
+__STENCIL(ptrget_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::ptrset_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_ptrset<val64<>>(stop);
+}
+
+__STENCIL(ptrset_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::ptrset_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_ptrset<val32<>>(stop);
+}
+
+__STENCIL(ptrset_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::ptrset_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_ptrset<val16<>>(stop);
+}
+
+__STENCIL(ptrset_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::ptrset_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_ptrset<val8<>>(stop);
+}
+
+__STENCIL(ptrset_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::neg_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_neg<val64<>>(state, stop);
+}
+
+__STENCIL(neg_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::neg_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_neg<val32<>>(state, stop);
+}
+
+__STENCIL(neg_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::neg_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_neg<val16<>>(state, stop);
+}
+
+__STENCIL(neg_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::neg_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_neg<val8<>>(state, stop);
+}
+
+__STENCIL(neg_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::not_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_not<val64<>>(stop);
+}
+
+__STENCIL(not_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::not_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_not<val32<>>(stop);
+}
+
+__STENCIL(not_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::not_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_not<val16<>>(stop);
+}
+
+__STENCIL(not_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::not_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_not<val8<>>(stop);
+}
+
+__STENCIL(not_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::sinc_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_sinc<val64<>>(state, stop);
+}
+
+__STENCIL(sinc_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::sinc_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_sinc<val32<>>(state, stop);
+}
+
+__STENCIL(sinc_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::sinc_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_sinc<val16<>>(state, stop);
+}
+
+__STENCIL(sinc_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::sinc_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_sinc<val8<>>(state, stop);
+}
+
+__STENCIL(sinc_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::uinc_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_uinc<val64<>>(state, stop);
+}
+
+__STENCIL(uinc_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::uinc_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_uinc<val32<>>(state, stop);
+}
+
+__STENCIL(uinc_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::uinc_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_uinc<val16<>>(state, stop);
+}
+
+__STENCIL(uinc_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::uinc_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_uinc<val8<>>(state, stop);
+}
+
+__STENCIL(uinc_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::sdec_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_sdec<val64<>>(state, stop);
+}
+
+__STENCIL(sdec_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::sdec_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_sdec<val32<>>(state, stop);
+}
+
+__STENCIL(sdec_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::sdec_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_sdec<val16<>>(state, stop);
+}
+
+__STENCIL(sdec_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::sdec_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_sdec<val8<>>(state, stop);
+}
+
+__STENCIL(sdec_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::udec_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_udec<val64<>>(state, stop);
+}
+
+__STENCIL(udec_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::udec_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_udec<val32<>>(state, stop);
+}
+
+__STENCIL(udec_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::udec_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_udec<val16<>>(state, stop);
+}
+
+__STENCIL(udec_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::udec_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_udec<val8<>>(state, stop);
+}
+
+__STENCIL(udec_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::and_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_and<val64<>>(stop);
+}
+
+__STENCIL(and_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::and_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_and<val32<>>(stop);
+}
+
+__STENCIL(and_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::and_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_and<val16<>>(stop);
+}
+
+__STENCIL(and_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::and_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_and<val8<>>(stop);
+}
+
+__STENCIL(and_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::or_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_or<val64<>>(stop);
+}
+
+__STENCIL(or_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::or_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_or<val32<>>(stop);
+}
+
+__STENCIL(or_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::or_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_or<val16<>>(stop);
+}
+
+__STENCIL(or_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::or_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_or<val8<>>(stop);
+}
+
+__STENCIL(or_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::xor_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_xor<val64<>>(stop);
+}
+
+__STENCIL(xor_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::xor_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_xor<val32<>>(stop);
+}
+
+__STENCIL(xor_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::xor_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_xor<val16<>>(stop);
+}
+
+__STENCIL(xor_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::xor_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_xor<val8<>>(stop);
+}
+
+__STENCIL(xor_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::sadd_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_sadd<val64<>>(state, stop);
+}
+
+__STENCIL(sadd_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::sadd_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_sadd<val32<>>(state, stop);
+}
+
+__STENCIL(sadd_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::sadd_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_sadd<val16<>>(state, stop);
+}
+
+__STENCIL(sadd_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::sadd_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_sadd<val8<>>(state, stop);
+}
+
+__STENCIL(sadd_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::uadd_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_uadd<val64<>>(state, stop);
+}
+
+__STENCIL(uadd_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::uadd_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_uadd<val32<>>(state, stop);
+}
+
+__STENCIL(uadd_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::uadd_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_uadd<val16<>>(state, stop);
+}
+
+__STENCIL(uadd_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::uadd_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_uadd<val8<>>(state, stop);
+}
+
+__STENCIL(uadd_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::ssub_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_ssub<val64<>>(state, stop);
+}
+
+__STENCIL(ssub_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::ssub_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_ssub<val32<>>(state, stop);
+}
+
+__STENCIL(ssub_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::ssub_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_ssub<val16<>>(state, stop);
+}
+
+__STENCIL(ssub_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::ssub_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_ssub<val8<>>(state, stop);
+}
+
+__STENCIL(ssub_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::usub_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_usub<val64<>>(state, stop);
+}
+
+__STENCIL(usub_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::usub_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_usub<val32<>>(state, stop);
+}
+
+__STENCIL(usub_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::usub_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_usub<val16<>>(state, stop);
+}
+
+__STENCIL(usub_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::usub_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_usub<val8<>>(state, stop);
+}
+
+__STENCIL(usub_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::smul_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_smul<val64<>>(state, stop);
+}
+
+__STENCIL(smul_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::smul_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_smul<val32<>>(state, stop);
+}
+
+__STENCIL(smul_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::smul_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_smul<val16<>>(state, stop);
+}
+
+__STENCIL(smul_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::smul_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_smul<val8<>>(state, stop);
+}
+
+__STENCIL(smul_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::umul_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_umul<val64<>>(state, stop);
+}
+
+__STENCIL(umul_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::umul_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_umul<val32<>>(state, stop);
+}
+
+__STENCIL(umul_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::umul_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_umul<val16<>>(state, stop);
+}
+
+__STENCIL(umul_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::umul_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_umul<val8<>>(state, stop);
+}
+
+__STENCIL(umul_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::smod_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_smod<val64<>>(state, stop);
+}
+
+__STENCIL(smod_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::smod_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_smod<val32<>>(state, stop);
+}
+
+__STENCIL(smod_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::smod_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_smod<val16<>>(state, stop);
+}
+
+__STENCIL(smod_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::smod_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_smod<val8<>>(state, stop);
+}
+
+__STENCIL(smod_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::umod_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_umod<val64<>>(state, stop);
+}
+
+__STENCIL(umod_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::umod_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_umod<val32<>>(state, stop);
+}
+
+__STENCIL(umod_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::umod_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_umod<val16<>>(state, stop);
+}
+
+__STENCIL(umod_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::umod_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_umod<val8<>>(state, stop);
+}
+
+__STENCIL(umod_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::sdiv_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_sdiv<val64<>>(state, stop);
+}
+
+__STENCIL(sdiv_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::sdiv_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_sdiv<val32<>>(state, stop);
+}
+
+__STENCIL(sdiv_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::sdiv_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_sdiv<val16<>>(state, stop);
+}
+
+__STENCIL(sdiv_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::sdiv_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_sdiv<val8<>>(state, stop);
+}
+
+__STENCIL(sdiv_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::udiv_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_udiv<val64<>>(state, stop);
+}
+
+__STENCIL(udiv_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::udiv_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_udiv<val32<>>(state, stop);
+}
+
+__STENCIL(udiv_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::udiv_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_udiv<val16<>>(state, stop);
+}
+
+__STENCIL(udiv_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::udiv_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_udiv<val8<>>(state, stop);
+}
+
+__STENCIL(udiv_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::scmp_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_scmp<val64<>>(state, stop);
+}
+
+__STENCIL(scmp_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::scmp_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_scmp<val32<>>(state, stop);
+}
+
+__STENCIL(scmp_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::scmp_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_scmp<val16<>>(state, stop);
+}
+
+__STENCIL(scmp_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::scmp_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_scmp<val8<>>(state, stop);
+}
+
+__STENCIL(scmp_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::ucmp_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_ucmp<val64<>>(state, stop);
+}
+
+__STENCIL(ucmp_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::ucmp_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_ucmp<val32<>>(state, stop);
+}
+
+__STENCIL(ucmp_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::ucmp_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_ucmp<val16<>>(state, stop);
+}
+
+__STENCIL(ucmp_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::ucmp_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_ucmp<val8<>>(state, stop);
+}
+
+__STENCIL(ucmp_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::rotl_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_rotl<val64<>>(stop);
+}
+
+__STENCIL(rotl_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::rotl_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_rotl<val32<>>(stop);
+}
+
+__STENCIL(rotl_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::rotl_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_rotl<val16<>>(stop);
+}
+
+__STENCIL(rotl_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::rotl_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_rotl<val8<>>(stop);
+}
+
+__STENCIL(rotl_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::rotr_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_rotr<val64<>>(stop);
+}
+
+__STENCIL(rotr_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::rotr_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_rotr<val32<>>(stop);
+}
+
+__STENCIL(rotr_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::rotr_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_rotr<val16<>>(stop);
+}
+
+__STENCIL(rotr_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::rotr_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_rotr<val8<>>(stop);
+}
+
+__STENCIL(rotr_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::sshl_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_sshl<val64<>>(stop);
+}
+
+__STENCIL(sshl_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::sshl_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_sshl<val32<>>(stop);
+}
+
+__STENCIL(sshl_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::sshl_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_sshl<val16<>>(stop);
+}
+
+__STENCIL(sshl_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::sshl_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_sshl<val8<>>(stop);
+}
+
+__STENCIL(sshl_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::ushl_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_ushl<val64<>>(stop);
+}
+
+__STENCIL(ushl_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::ushl_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_ushl<val32<>>(stop);
+}
+
+__STENCIL(ushl_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::ushl_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_ushl<val16<>>(stop);
+}
+
+__STENCIL(ushl_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::ushl_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_ushl<val8<>>(stop);
+}
+
+__STENCIL(ushl_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::sshr_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_sshr<val64<>>(stop);
+}
+
+__STENCIL(sshr_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::sshr_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_sshr<val32<>>(stop);
+}
+
+__STENCIL(sshr_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::sshr_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_sshr<val16<>>(stop);
+}
+
+__STENCIL(sshr_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::sshr_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_sshr<val8<>>(stop);
+}
+
+__STENCIL(sshr_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::ushr_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_ushr<val64<>>(stop);
+}
+
+__STENCIL(ushr_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::ushr_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_ushr<val32<>>(stop);
+}
+
+__STENCIL(ushr_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::ushr_16>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_ushr<val16<>>(stop);
+}
+
+__STENCIL(ushr_16, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::ushr_8>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_ushr<val8<>>(stop);
+}
+
+__STENCIL(ushr_8, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::fneg_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_fneg<val64<>>(stop);
+}
+
+__STENCIL(fneg_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::fneg_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_fneg<val32<>>(stop);
+}
+
+__STENCIL(fneg_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::fevl_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_fevl<val64<>>(state, stop);
+}
+
+__STENCIL(fevl_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::fevl_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_fevl<val32<>>(state, stop);
+}
+
+__STENCIL(fevl_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::fadd_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_fadd<val64<>>(stop);
+}
+
+__STENCIL(fadd_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::fadd_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_fadd<val32<>>(stop);
+}
+
+__STENCIL(fadd_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::fsub_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_fsub<val64<>>(stop);
+}
+
+__STENCIL(fsub_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::fsub_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_fsub<val32<>>(stop);
+}
+
+__STENCIL(fsub_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::fmul_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_fmul<val64<>>(stop);
+}
+
+__STENCIL(fmul_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::fmul_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_fmul<val32<>>(stop);
+}
+
+__STENCIL(fmul_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::fmod_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_fmod<val64<>>(stop);
+}
+
+__STENCIL(fmod_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::fmod_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_fmod<val32<>>(stop);
+}
+
+__STENCIL(fmod_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::fdiv_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_fdiv<val64<>>(stop);
+}
+
+__STENCIL(fdiv_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::fdiv_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_fdiv<val32<>>(stop);
+}
+
+__STENCIL(fdiv_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::fcmp_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_fcmp<val64<>>(state, stop);
+}
+
+__STENCIL(fcmp_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::fcmp_32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_fcmp<val32<>>(state, stop);
+}
+
+__STENCIL(fcmp_32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::si64_2_f64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	val64<>& v = stack_type::dil_top<val64<>>(stop);
+
+	const int64_t si = v.si;
+	v.f = (double)si;
+}
+
+__STENCIL(si64_2_f64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::si64_2_f32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	val64<>& v = stack_type::dil_top<val64<>>(stop);
+
+	const int64_t si = v.si;
+
+	stack_type::dil_dealloc(stop, (uint64_t)sizeof(val32<>));
+
+	v.half.hi.f = (float)si;
+}
+
+__STENCIL(si64_2_f32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::si32_2_f64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	stack_type::dil_alloc(stop, (uint64_t)sizeof(val32<>));
+	val64<>& v = stack_type::dil_top<val64<>>(stop);
+
+	const int32_t si = v.half.hi.si;
+	v.f = (double)si;
+}
+
+__STENCIL(si32_2_f64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::si32_2_f32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	val32<>& v = stack_type::dil_top<val32<>>(stop);
+
+	const int32_t si = v.si;
+	v.f = (float)si;
+}
+
+__STENCIL(si32_2_f32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::ui64_2_f64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	val64<>& v = stack_type::dil_top<val64<>>(stop);
+
+	const uint64_t ui = v.ui;
+	v.f = (double)ui;
+}
+
+__STENCIL(ui64_2_f64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::ui64_2_f32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	val64<>& v = stack_type::dil_top<val64<>>(stop);
+
+	const uint64_t ui = v.ui;
+
+	stack_type::dil_dealloc(stop, (uint64_t)sizeof(val32<>));
+
+	v.half.hi.f = (float)ui;
+}
+
+__STENCIL(ui64_2_f32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::ui32_2_f64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	stack_type::dil_alloc(stop, (uint64_t)sizeof(val32<>));
+	val64<>& v = stack_type::dil_top<val64<>>(stop);
+
+	const uint32_t ui = v.half.hi.ui;
+	v.f = (double)ui;
+}
+
+__STENCIL(ui32_2_f64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::ui32_2_f32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	val32<>& v = stack_type::dil_top<val32<>>(stop);
+
+	const uint32_t ui = v.ui;
+	v.f = (float)ui;
+}
+
+__STENCIL(ui32_2_f32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::f64_2_si64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	val64<>& v = stack_type::dil_top<val64<>>(stop);
+	interpreter::state& s = state;
+
+	const double f = v.f;
+
+	const bool ovf = !(f < (double)__2_POW_63);
+	const bool unf = !(f >= -(double)__2_POW_63);
+
+	s.eval.bits.ierr = ovf && unf;
+	s.eval.bits.iovf = ovf && !unf;
+	s.eval.bits.iunf = !ovf && unf;
+
+	if (!ovf && !unf)
+		v.si = (int64_t)f;
+}
+
+__STENCIL(f64_2_si64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::f64_2_si32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	val64<>& v = stack_type::dil_top<val64<>>(stop);
+	interpreter::state& s = state;
+
+	const double f = v.f;
+
+	stack_type::dil_dealloc(stop, (uint64_t)sizeof(val32<>));
+
+	const bool ovf = !(f < (double)__2_POW_31);
+	const bool unf = !(f >= -(double)__2_POW_31);
+
+	s.eval.bits.ierr = ovf && unf;
+	s.eval.bits.iovf = ovf && !unf;
+	s.eval.bits.iunf = !ovf && unf;
+
+	if (!ovf && !unf)
+		v.half.hi.si = (int32_t)f;
+}
+
+__STENCIL(f64_2_si32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::f32_2_si64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	stack_type::dil_alloc(stop, (uint64_t)sizeof(val32<>));
+	val64<>& v = stack_type::dil_top<val64<>>(stop);
+	interpreter::state& s = state;
+
+	const float f = v.half.hi.f;
+
+	const bool ovf = !(f < (float)__2_POW_63);
+	const bool unf = !(f >= -(float)__2_POW_63);
+
+	s.eval.bits.ierr = ovf && unf;
+	s.eval.bits.iovf = ovf && !unf;
+	s.eval.bits.iunf = !ovf && unf;
+
+	if (!ovf && !unf)
+		v.si = (int64_t)f;
+}
+
+__STENCIL(f32_2_si64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::f32_2_si32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	val32<>& v = stack_type::dil_top<val32<>>(stop);
+	interpreter::state& s = state;
+
+	const float f = v.f;
+
+	const bool ovf = !(f < (float)__2_POW_31);
+	const bool unf = !(f >= -(float)__2_POW_31);
+
+	s.eval.bits.ierr = ovf && unf;
+	s.eval.bits.iovf = ovf && !unf;
+	s.eval.bits.iunf = !ovf && unf;
+
+	if (!ovf && !unf)
+		v.si = (int32_t)f;
+}
+
+__STENCIL(f32_2_si32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::f64_2_ui64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	val64<>& v = stack_type::dil_top<val64<>>(stop);
+	interpreter::state& s = state;
+
+	const double f = v.f;
+
+	const bool ovf = !(f < (double)__2_POW_64);
+	const bool unf = !(f >= (double)__0);
+
+	s.eval.bits.ierr = ovf && unf;
+	s.eval.bits.iovf = ovf && !unf;
+	s.eval.bits.iunf = !ovf && unf;
+
+	if (!ovf && !unf)
+		v.ui = (uint64_t)f;
+}
+
+__STENCIL(f64_2_ui64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::f64_2_ui32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	val64<>& v = stack_type::dil_top<val64<>>(stop);
+	interpreter::state& s = state;
+
+	const double f = v.f;
+
+	stack_type::dil_dealloc(stop, (uint64_t)sizeof(val32<>));
+
+	const bool ovf = !(f < (double)__2_POW_32);
+	const bool unf = !(f >= (double)__0);
+
+	s.eval.bits.ierr = ovf && unf;
+	s.eval.bits.iovf = ovf && !unf;
+	s.eval.bits.iunf = !ovf && unf;
+
+	if (!ovf && !unf)
+		v.half.hi.ui = (uint32_t)f;
+}
+
+__STENCIL(f64_2_ui32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::f32_2_ui64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	stack_type::dil_alloc(stop, (uint64_t)sizeof(val32<>));
+	val64<>& v = stack_type::dil_top<val64<>>(stop);
+	interpreter::state& s = state;
+
+	const float f = v.half.hi.f;
+
+	const bool ovf = !(f < (float)__2_POW_64);
+	const bool unf = !(f >= (float)__0);
+
+	s.eval.bits.ierr = ovf && unf;
+	s.eval.bits.iovf = ovf && !unf;
+	s.eval.bits.iunf = !ovf && unf;
+
+	if (!ovf && !unf)
+		v.ui = (uint64_t)f;
+}
+
+__STENCIL(f32_2_ui64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::f32_2_ui32>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	val32<>& v = stack_type::dil_top<val32<>>(stop);
+	interpreter::state& s = state;
+
+	const float f = v.f;
+
+	const bool ovf = !(f < (float)__2_POW_32);
+	const bool unf = !(f >= (float)__0);
+
+	s.eval.bits.ierr = ovf && unf;
+	s.eval.bits.iovf = ovf && !unf;
+	s.eval.bits.iunf = !ovf && unf;
+
+	if (!ovf && !unf)
+		v.ui = (uint32_t)f;
+}
+
+__STENCIL(f32_2_ui32, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::s_ucmp_jmp_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_s_ucmp_jmp<val64<>>(opptr, ftop, state);
+}
+
+__STENCIL(s_ucmp_jmp_64, __JCC)
+
+template <>
+inline void stencil_ops::run<op::s_scmp_jmp_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_s_scmp_jmp<val64<>>(opptr, ftop, state);
+}
+
+__STENCIL(s_scmp_jmp_64, __JCC)
+
+template <>
+inline void stencil_ops::run<op::s_uinc_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_s_uinc<val64<>>(opptr, ftop, state);
+}
+
+__STENCIL(s_uinc_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::s_udec_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_s_udec<val64<>>(opptr, ftop, state);
+}
+
+__STENCIL(s_udec_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::s_uadd_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_s_uadd<val64<>>(opptr, ftop, state, stop);
+}
+
+__STENCIL(s_uadd_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::s_move_64>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_s_move<val64<>>(opptr, ftop);
+}
+
+__STENCIL(s_move_64, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::gen_0>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_gen<0ui64>(opptr, ftop, stop, state);
+}
+
+__STENCIL(gen_0, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::gen_1>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_gen<1ui64>(opptr, ftop, stop, state);
+}
+
+__STENCIL(gen_1, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::gen_2>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_gen<2ui64>(opptr, ftop, stop, state);
+}
+
+__STENCIL(gen_2, __NEXT)
+
+template <>
+inline void stencil_ops::run<op::gen_3>(const uint8_t*& opptr, uintptr_t& ftop, uintptr_t& stop, state& state)
+{
+	dispatcher::__dil_gen<3ui64>(opptr, ftop, stop, state);
+}
+
+__STENCIL(gen_3, __NEXT)
+#endif
\ No newline at end of file
@@ -0,0 +1,34 @@
+#!/bin/sh
+
+# Regenerates stencil_gen.hpp from stencil_src.cpp, with --check only fails when the checked in
+# stencil_gen.hpp differs from what the sources give
+#
+# Stencils are x86-64 System V code, so this runs on x86-64 Linux; CXX has to take the MSVC literal
+# suffixes of the sources, CXXFLAGS and LIBS go to every compile and to the link
+
+set -e
+
+cd "$(dirname "$0")"
+
+CXX="${CXX:-clang++}"
+CXXFLAGS="${CXXFLAGS:--fms-extensions}"
+LIBS="${LIBS:--lffi -ldl}"
+
+tmp="$(mktemp -d)"
+trap 'rm -rf "$tmp"' EXIT
+
+# The large code model leaves every hole a 64-bit absolute relocation compiler::stencilgen patches
+
+$CXX -std=c++20 $CXXFLAGS -O2 -mcmodel=large -fno-pic -fno-asynchronous-unwind-tables -ffunction-sections \
+	-c stencil_src.cpp -o "$tmp/stencil_src.o"
+
+# A STENCILGEN build of the interpreter reads stencil_src.o and writes stencil_gen.hpp where it runs
+
+$CXX -std=c++20 $CXXFLAGS -O2 -DSTENCILGEN $(ls *.cpp | grep -v '^stencil_src\.cpp$') $LIBS -o "$tmp/stencilgen"
+(cd "$tmp" && ./stencilgen)
+
+if [ "$1" = "--check" ]; then
+	cmp -s "$tmp/stencil_gen.hpp" stencil_gen.hpp || { echo "stencil_gen.hpp is out of date, run stencilgen.sh" >&2; exit 1; }
+else
+	cp "$tmp/stencil_gen.hpp" stencil_gen.hpp
+fi
@@ -1,5 +1,8 @@
+#include <fstream>
 #include <iostream>
+#include <iterator>
 
+#include "compiler.hpp"
 #include "op_asm.hpp"
 #include "interpreter.hpp"
 
@@ -8,15 +11,6 @@ using namespace std;
 
 #include <vector>
 
-template <size_t N>
-constexpr void insertArrayToVector(std::vector<uint8_t>& vec, const std::array<uint8_t, N>& arr)
-{
-	for (const auto& elem : arr)
-	{
-		vec.push_back(elem);
-	}
-}
-
 uint64_t fibonacci(uint64_t n)
 {
 	uint64_t prev1 = 0; // Represents F(n-2)
@@ -37,6 +31,17 @@ uint64_t fibonacci(uint64_t n)
 
 int main()
 {
+#ifdef STENCILGEN
+	// Stencil build only turns the object of stencil_src.cpp into stencil_gen.hpp for the next build
+
+	ifstream obj("stencil_src.o", ios::binary);
+	vector<uint8_t> obj_data((istreambuf_iterator<char>(obj)), istreambuf_iterator<char>());
+
+	ofstream("stencil_gen.hpp", ios::binary) << compiler::stencilgen(obj_data.data(), obj_data.size()).emit_stencils();
+
+	return 0;
+#endif
+
 	auto start_1 = chrono::high_resolution_clock::now();
 	uint64_t t = fibonacci(1000000000ui64);
 	auto end_1 = chrono::high_resolution_clock::now();
@@ -49,59 +54,119 @@ int main()
 	cout << t;
 	cout << "\n";
 
-	vector<uint8_t> code;
-	code.reserve(1ui64 << 16ui64);
+	op_asm::builder<> asm_code;
+	const op_asm::label loop_start = asm_code.make_label();
+	const op_asm::label summ = asm_code.make_label();
 
-	insertArrayToVector(code, op_asm::__push<val64<>>(val64<>(1000000000ui64)));
-	insertArrayToVector(code, op_asm::__push<val64<>>(val64<>((uintptr_t)malloc)));
-	insertArrayToVector(code, op_asm::__nativecall(abi_type::NONE, arg_type(arg_i_type::__val64u, arg_o_type::__uint64), arg_type(arg_i_type::__ptr, arg_o_type::__ptr)));
-	insertArrayToVector(code, op_asm::__pop<val64<>>());
-	//insertArrayToVector(code, op_asm::__exit<endian::native>());
+	asm_code.put(op_asm::__push<val64<>>(val64<>(1000000000ui64)));
+	asm_code.put(op_asm::__push<val64<>>(val64<>((uintptr_t)malloc)));
+	asm_code.put(op_asm::__nativecall(abi_type::NONE, arg_type(arg_i_type::__val64u, arg_o_type::__uint64), arg_type(arg_i_type::__ptr, arg_o_type::__ptr)));
+	asm_code.put(op_asm::__pop<val64<>>());
+	//asm_code.put(op_asm::__exit<endian::native>());
 
-	insertArrayToVector(code, op_asm::__push<val64<>>(val64<>(0ui64)));
-	insertArrayToVector(code, op_asm::__push<val64<>>(val64<>(1ui64)));
+	asm_code.put(op_asm::__push<val64<>>(val64<>(0ui64)));
+	asm_code.put(op_asm::__push<val64<>>(val64<>(1ui64)));
 
-	uint64_t loop_start = code.size();
+	asm_code.bind(loop_start);
 
 	// check
-	insertArrayToVector(code, op_asm::__s_load<val64<>>(val8<>((uint8_t)(0ui8))));
-	insertArrayToVector(code, op_asm::__push<val64<>>(val64<>(2ui64)));
-	insertArrayToVector(code, op_asm::__ucmp<val64<>>());
-	insertArrayToVector(code, op_asm::__jmp_ne<val8<>>(val8((uint8_t)4ui8)));
+	asm_code.put(op_asm::__s_load<val64<>>(val8<>((uint8_t)(0ui8))));
+	asm_code.put(op_asm::__push<val64<>>(val64<>(2ui64)));
+	asm_code.put(op_asm::__ucmp<val64<>>());
+	asm_code.jmp_ne(summ);
 
 	// end
-	insertArrayToVector(code, op_asm::__s_store<val64<>>(val8<>((uint8_t)(8ui8))));
-	insertArrayToVector(code, op_asm::__pop<val64<>>());
-	insertArrayToVector(code, op_asm::__exit<endian::native>());
+	asm_code.put(op_asm::__s_store<val64<>>(val8<>((uint8_t)(8ui8))));
+	asm_code.put(op_asm::__pop<val64<>>());
+	asm_code.put(op_asm::__exit<endian::native>());
 
 	// summ
-	insertArrayToVector(code, op_asm::__s_load<val64<>>(val8<>((uint8_t)(~0ui8))));
-	insertArrayToVector(code, op_asm::__s_load<val64<>>(val8<>((uint8_t)(~8ui8))));
-	insertArrayToVector(code, op_asm::__uadd<val64<>>());
+	asm_code.bind(summ);
+	asm_code.put(op_asm::__s_load<val64<>>(val8<>((uint8_t)(~0ui8))));
+	asm_code.put(op_asm::__s_load<val64<>>(val8<>((uint8_t)(~8ui8))));
+	asm_code.put(op_asm::__uadd<val64<>>());
 
 	// -2 = -1 = 0
-	insertArrayToVector(code, op_asm::__s_load<val64<>>(val8<>((uint8_t)(~8ui8))));
-	insertArrayToVector(code, op_asm::__s_store<val64<>>(val8<>((uint8_t)(~0ui8))));
-	insertArrayToVector(code, op_asm::__s_store<val64<>>(val8<>((uint8_t)(~8ui8))));
+	asm_code.put(op_asm::__s_load<val64<>>(val8<>((uint8_t)(~8ui8))));
+	asm_code.put(op_asm::__s_store<val64<>>(val8<>((uint8_t)(~0ui8))));
+	asm_code.put(op_asm::__s_store<val64<>>(val8<>((uint8_t)(~8ui8))));
 
 	// dec
-	insertArrayToVector(code, op_asm::__s_load<val64<>>(val8<>((uint8_t)(0ui8))));
-	insertArrayToVector(code, op_asm::__udec<val64<>>());
-	insertArrayToVector(code, op_asm::__s_store<val64<>>(val8<>((uint8_t)(0ui8))));
-
-	uint64_t loop_end = code.size();
+	asm_code.put(op_asm::__s_load<val64<>>(val8<>((uint8_t)(0ui8))));
+	asm_code.put(op_asm::__udec<val64<>>());
+	asm_code.put(op_asm::__s_store<val64<>>(val8<>((uint8_t)(0ui8))));
 
 	// loop start
-	insertArrayToVector(code, op_asm::__jmp<val8<>>(val8<>((int8_t)((int8_t)loop_start - (int8_t)loop_end - 2i8))));
+	asm_code.jmp(loop_start);
+
+	const vector<uint8_t> code = asm_code.assemble();
 
-	::interpreter::interpreter _int(code.data(), code.size(), 16ui64, (1ui64 << 20ui64), endian::native);
+	::interpreter::interpreter _int(code.data(), code.size(), 16ui64, (1ui64 << 20ui64), endian::native, dispatch_type::switched);
+	::interpreter::interpreter _int_t(code.data(), code.size(), 16ui64, (1ui64 << 20ui64), endian::native, dispatch_type::threaded);
+	::interpreter::interpreter _int_d(code.data(), code.size(), 16ui64, (1ui64 << 20ui64), endian::native, dispatch_type::decoded);
+	::interpreter::interpreter _int_j(code.data(), code.size(), 16ui64, (1ui64 << 20ui64), endian::native, dispatch_type::jitted);
+	::interpreter::interpreter _int_p(code.data(), code.size(), 16ui64, (1ui64 << 20ui64), endian::native, dispatch_type::patched);
+	::interpreter::interpreter _int_r(code.data(), code.size(), 16ui64, (1ui64 << 20ui64), endian::native, dispatch_type::traced);
+	::interpreter::interpreter _int_c(code.data(), code.size(), 16ui64, (1ui64 << 20ui64), endian::native, dispatch_type::cached);
+	::interpreter::interpreter _int_g(code.data(), code.size(), 16ui64, (1ui64 << 20ui64), endian::native, dispatch_type::registered);
 
 	auto start_2 = chrono::high_resolution_clock::now();
 	c = _int.execute<val64<>>(val64<>(a)).ui;
 	auto end_2 = chrono::high_resolution_clock::now();
 
+	auto start_3 = chrono::high_resolution_clock::now();
+	uint64_t d = _int_t.execute<val64<>>(val64<>(a)).ui;
+	auto end_3 = chrono::high_resolution_clock::now();
+
+	auto start_4 = chrono::high_resolution_clock::now();
+	uint64_t e = _int_d.execute<val64<>>(val64<>(a)).ui;
+	auto end_4 = chrono::high_resolution_clock::now();
+
+	auto start_5 = chrono::high_resolution_clock::now();
+	uint64_t f = _int_j.execute<val64<>>(val64<>(a)).ui;
+	auto end_5 = chrono::high_resolution_clock::now();
+
+	auto start_6 = chrono::high_resolution_clock::now();
+	uint64_t g = _int_p.execute<val64<>>(val64<>(a)).ui;
+	auto end_6 = chrono::high_resolution_clock::now();
+
+	auto start_7 = chrono::high_resolution_clock::now();
+	uint64_t h = _int_r.execute<val64<>>(val64<>(a)).ui;
+	auto end_7 = chrono::high_resolution_clock::now();
+
+	auto start_8 = chrono::high_resolution_clock::now();
+	uint64_t k = _int_c.execute<val64<>>(val64<>(a)).ui;
+	auto end_8 = chrono::high_resolution_clock::now();
+
+	auto start_9 = chrono::high_resolution_clock::now();
+	uint64_t m = _int_g.execute<val64<>>(val64<>(a)).ui;
+	auto end_9 = chrono::high_resolution_clock::now();
+
 	cout << "1 TIME: " << chrono::duration_cast<chrono::milliseconds>(end_1 - start_1).count() << " ms\n";
-	cout << "2 TIME: " << chrono::duration_cast<chrono::milliseconds>(end_2 - start_2).count() << " ms\n";
+	cout << "2 TIME: " << chrono::duration_cast<chrono::milliseconds>(end_2 - start_2).count() << " ms (switch)\n";
+	cout << "3 TIME: " << chrono::duration_cast<chrono::milliseconds>(end_3 - start_3).count() << " ms (threaded)\n";
+	cout << "4 TIME: " << chrono::duration_cast<chrono::milliseconds>(end_4 - start_4).count() << " ms (decoded)\n";
+	cout << "5 TIME: " << chrono::duration_cast<chrono::milliseconds>(end_5 - start_5).count() << " ms (jitted)\n";
+	cout << "6 TIME: " << chrono::duration_cast<chrono::milliseconds>(end_6 - start_6).count() << " ms (patched)\n";
+	cout << "7 TIME: " << chrono::duration_cast<chrono::milliseconds>(end_7 - start_7).count() << " ms (traced)\n";
+	cout << "8 TIME: " << chrono::duration_cast<chrono::milliseconds>(end_8 - start_8).count() << " ms (cached)\n";
+	cout << "9 TIME: " << chrono::duration_cast<chrono::milliseconds>(end_9 - start_9).count() << " ms (registered)\n";
 
 	cout << c << "\n";
+	cout << d << "\n";
+	cout << e << "\n";
+	cout << f << "\n";
+	cout << g << "\n";
+	cout << h << "\n";
+	cout << k << "\n";
+	cout << m << "\n";
+
+#ifdef OPPROFILE
+	// Profiled build writes the generated ops for the next build of the dispatcher
+
+	compiler::opgen gen(_int.get_profile());
+
+	ofstream("op_gen.hpp", ios::binary) << gen.emit_ops();
+	ofstream("dispatcher_gen.hpp", ios::binary) << gen.emit_handlers();
+#endif
 }
\ No newline at end of file
@@ -0,0 +1,770 @@
+#include "verify.hpp"
+
+using namespace interpreter;
+using namespace std;
+
+static constexpr int64_t depth_none = -1i64;
+static constexpr int64_t depth_bad = -2i64;
+static constexpr int64_t args_none = 0x7FFFFFFFFFFFFFFFi64;
+
+static inline int64_t fetch_offset(const uint8_t* opptr, uint64_t width)
+{
+	switch (width)
+	{
+	case 8ui64:
+		return (int64_t)((const val64<>*)opptr)->si;
+
+	case 4ui64:
+		return (int64_t)((const val32<>*)opptr)->si;
+
+	case 2ui64:
+		return (int64_t)((const val16<>*)opptr)->si;
+
+	case 1ui64:
+		return (int64_t)((const val8<>*)opptr)->si;
+
+	default:
+		__assume(false);
+		break;
+	}
+}
+
+static inline uint64_t fetch_width(op op_code, op op_64)
+{
+	return 8ui64 >> ((uint64_t)op_code - (uint64_t)op_64);
+}
+
+static inline uint64_t inner_size(uint8_t arg)
+{
+	switch ((arg_i_type)(arg & 0x0Fui8))
+	{
+	case arg_i_type::__val64f:
+	case arg_i_type::__val64s:
+	case arg_i_type::__val64u:
+	case arg_i_type::__ptr:
+		return 8ui64;
+
+	case arg_i_type::__val32f:
+	case arg_i_type::__val32s:
+	case arg_i_type::__val32u:
+		return 4ui64;
+
+	case arg_i_type::__val16s:
+	case arg_i_type::__val16u:
+		return 2ui64;
+
+	case arg_i_type::__val8s:
+	case arg_i_type::__val8u:
+		return 1ui64;
+
+	default:
+		return 0ui64;
+	}
+}
+
+static inline bool is_call(op op_code)
+{
+	return (uint64_t)op_code >= (uint64_t)op::call_64 && (uint64_t)op_code <= (uint64_t)op::call_8;
+}
+
+// Code native code enters through the address callback pushes, it is no branch target of the
+// frame of callback but the start of a frame of its own
+
+static const uint8_t* callback_target(const uint8_t* next, op op_code)
+{
+	if (op_code == op::callback)
+		return next + (ptrdiff_t)fetch_offset(next - (ptrdiff_t)4, 4ui64);
+	else
+		return (const uint8_t*)nullptr;
+}
+
+// Ops a fused or generated op runs in one dispatch
+
+static uint64_t sequence_length(op op_code)
+{
+	switch (op_code)
+	{
+	case op::s_ucmp_jmp_64:
+	case op::s_scmp_jmp_64:
+		return 4ui64;
+
+	case op::s_uinc_64:
+	case op::s_udec_64:
+	case op::s_uadd_64:
+		return 3ui64;
+
+	case op::s_move_64:
+		return 2ui64;
+
+	default:
+		break;
+	}
+
+	if ((uint8_t)op_code >= (uint8_t)op::gen_0 && (uint8_t)op_code <= (uint8_t)op::gen_3)
+	{
+		const op* seq = gen_ops[(uint64_t)op_code - (uint64_t)op::gen_0];
+		uint64_t length = 0ui64;
+
+		while (length < gen_length && seq[length] != op::nop)
+			++length;
+
+		return length;
+	}
+	else
+		return 1ui64;
+}
+
+// Control flow successors of op in its own frame, the branch target and the next op where
+// control flow goes on after op
+
+static const uint8_t* next_op(const uint8_t* next, op op_code)
+{
+	const uint64_t code = (uint64_t)op_code;
+
+	if (op_code == op::exit || op_code == op::ret || op_code == op::pop_flow)
+		return (const uint8_t*)nullptr;
+	else if (code >= (uint64_t)op::jmp_64 && code <= (uint64_t)op::jmp_8)
+		return (const uint8_t*)nullptr;
+	else
+		return next;
+}
+
+inline void verified_code::__def_obj() noexcept
+{
+	_code_beg = (const uint8_t*)nullptr;
+	_code_end = (const uint8_t*)nullptr;
+
+	_safe = (uint8_t*)nullptr;
+	_frame = (uint64_t*)nullptr;
+	_args = 0ui64;
+	_stack = 0ui64;
+	_whole = false;
+}
+
+inline void verified_code::__del_obj() noexcept
+{
+	if (_safe != (uint8_t*)nullptr)
+		delete[] _safe;
+
+	if (_frame != (uint64_t*)nullptr)
+		delete[] _frame;
+}
+
+inline void verified_code::__mov_obj(verified_code&& o) noexcept
+{
+	_code_beg = move(o._code_beg);
+	_code_end = move(o._code_end);
+
+	_safe = move(o._safe);
+	_frame = move(o._frame);
+	_args = move(o._args);
+	_stack = move(o._stack);
+	_whole = move(o._whole);
+}
+
+bool verified_code::get_effect(const uint8_t* opptr, op op_code, uint64_t& pop, uint64_t& push) noexcept
+{
+	const uint64_t code = (uint64_t)op_code;
+
+	pop = 0ui64;
+	push = 0ui64;
+
+	switch (op_code)
+	{
+	case op::nativecall:
+	{
+		pop = 8ui64;
+		push = inner_size(opptr[3ui64 + (uint64_t)opptr[2]]);
+
+		for (uint64_t i = 0ui64; i < (uint64_t)opptr[2]; ++i)
+			pop += inner_size(opptr[3ui64 + i]);
+
+		return true;
+	}
+
+	case op::nativecall_n:
+		pop = ((uint64_t)opptr[2] + 2ui64) * 8ui64 + ((opptr[3ui64 + (uint64_t)opptr[2]] & 0xF0ui8) != 0ui8 ? 8ui64 : 0ui64);
+		return true;
+
+	case op::callback:
+		push = 8ui64;
+		return true;
+
+	case op::hostcall:
+	case op::importcall:
+		pop = (uint64_t)opptr[3];
+		push = (uint64_t)opptr[4];
+		return true;
+
+	case op::memcpy:
+		pop = 24ui64;
+		return true;
+
+	case op::memset:
+		pop = 17ui64;
+		return true;
+
+	case op::l_alloc:
+	case op::l_allocz:
+		push = (uint64_t)((const val16<>*)(opptr + (ptrdiff_t)1))->ui;
+		return true;
+
+	case op::s_alloc:
+	case op::s_allocz:
+		push = (uint64_t)opptr[1];
+		return true;
+
+	case op::l_dealloc:
+		pop = (uint64_t)((const val16<>*)(opptr + (ptrdiff_t)1))->ui;
+		return true;
+
+	case op::s_dealloc:
+		pop = (uint64_t)opptr[1];
+		return true;
+
+	case op::push_flow:
+	case op::push_frame:
+	case op::push_stack:
+		push = 8ui64;
+		return true;
+
+	case op::push_state:
+		push = 2ui64;
+		return true;
+
+	case op::pop_flow:
+		pop = 8ui64;
+		return true;
+
+	case op::pop_state:
+		pop = 2ui64;
+		return true;
+
+	case op::pop_frame:
+	case op::pop_stack:
+		pop = 8ui64;
+		return false;
+
+	default:
+		break;
+	}
+
+	if (code >= (uint64_t)op::l_load_64 && code <= (uint64_t)op::f32_2_ui32)
+	{
+		// Every b-bit group is 64, 32, 16, 8 in a row, float groups are 64, 32
+
+		const uint64_t width = 8ui64 >> (code & 3ui64);
+		const uint64_t fwidth = 8ui64 >> (code & 1ui64);
+
+		if (code < (uint64_t)op::s_store_64)
+		{
+			if (code < (uint64_t)op::l_store_64 || code >= (uint64_t)op::s_load_64)
+				push = width;
+			else
+				pop = width;
+		}
+		else if (code < (uint64_t)op::push_64)
+			pop = width;
+		else if (code < (uint64_t)op::pop_64)
+			push = width;
+		else if (code < (uint64_t)op::dup_64)
+			pop = width;
+		else if (code < (uint64_t)op::ptrcpy_64)
+		{
+			pop = width;
+			push = width * 2ui64;
+		}
+		else if (code < (uint64_t)op::ptrget_64)
+			pop = 16ui64;
+		else if (code < (uint64_t)op::ptrset_64)
+		{
+			pop = 8ui64;
+			push = width;
+		}
+		else if (code < (uint64_t)op::neg_64)
+			pop = 8ui64 + width;
+		else if (code < (uint64_t)op::and_64)
+		{
+			pop = width;
+			push = width;
+		}
+		else if (code < (uint64_t)op::scmp_64)
+		{
+			pop = width * 2ui64;
+			push = width;
+		}
+		else if (code < (uint64_t)op::rotl_64)
+			pop = width * 2ui64;
+		else if (code < (uint64_t)op::fneg_64)
+		{
+			pop = width + 1ui64;
+			push = width;
+		}
+		else if (code < (uint64_t)op::fevl_64)
+		{
+			pop = fwidth;
+			push = fwidth;
+		}
+		else if (code < (uint64_t)op::fcmp_64)
+		{
+			pop = fwidth * 2ui64;
+			push = fwidth;
+		}
+		else if (code < (uint64_t)op::si64_2_f64)
+			pop = fwidth * 2ui64;
+		else
+		{
+			const uint64_t i = code - (uint64_t)op::si64_2_f64;
+
+			pop = (i & 2ui64) != 0ui64 ? 4ui64 : 8ui64;
+			push = (i & 1ui64) != 0ui64 ? 4ui64 : 8ui64;
+		}
+	}
+
+	return true;
+}
+
+bool verified_code::get_slot(const uint8_t* opptr, op op_code, ptrdiff_t& offset, uint64_t& size) noexcept
+{
+	const uint64_t code = (uint64_t)op_code;
+
+	if (code >= (uint64_t)op::l_load_64 && code < (uint64_t)op::s_load_64)
+		offset = (ptrdiff_t)fetch_offset(opptr + (ptrdiff_t)1, 2ui64);
+	else if (code >= (uint64_t)op::s_load_64 && code < (uint64_t)op::push_64)
+		offset = (ptrdiff_t)fetch_offset(opptr + (ptrdiff_t)1, 1ui64);
+	else
+		return false;
+
+	size = 8ui64 >> (code & 3ui64);
+	return true;
+}
+
+const uint8_t* verified_code::get_target(const uint8_t* opptr, const uint8_t* next, op op_code) noexcept
+{
+	const uint64_t code = (uint64_t)op_code;
+
+	if (code >= (uint64_t)op::call_64 && code <= (uint64_t)op::call_8)
+		return next + (ptrdiff_t)fetch_offset(opptr + (ptrdiff_t)1, fetch_width(op_code, op::call_64));
+	else if (code >= (uint64_t)op::jmp_64 && code <= (uint64_t)op::jmp_un_8)
+	{
+		const op op_64 = (op)((uint64_t)op::jmp_64 + ((code - (uint64_t)op::jmp_64) & ~3ui64));
+		return next + (ptrdiff_t)fetch_offset(opptr + (ptrdiff_t)1, fetch_width(op_code, op_64));
+	}
+	else if (code >= (uint64_t)op::jmp_msk_64 && code <= (uint64_t)op::jmp_msk_8)
+	{
+		const uint64_t width = fetch_width(op_code, op::jmp_msk_64);
+		return next + (ptrdiff_t)fetch_offset(opptr + (ptrdiff_t)(2ui64 + width), width);
+	}
+	else
+		return (const uint8_t*)nullptr;
+}
+
+verified_code::verified_code() noexcept
+{
+	__def_obj();
+}
+
+verified_code::verified_code(const uint8_t* bcode, const uint8_t* ecode)
+{
+	const uint64_t code_size = (uint64_t)(ecode - bcode);
+
+	__def_obj();
+
+	if (code_size >= (uint64_t)~0ui32)
+		throw runtime_error(_err_msg_large_code);
+	else
+	{
+		try
+		{
+			_code_beg = bcode;
+			_code_end = ecode;
+
+			// Op boundaries of the linear walk, code branching anywhere else decodes differently
+			// than it is proven, so is code whose control flow comes from the stack
+
+			vector<bool> start(code_size, false);
+			bool dynamic = false;
+
+			for (const uint8_t* opptr = bcode; opptr < ecode;)
+			{
+				const uint64_t size = decoded_code::get_size(opptr, ecode);
+
+				if (size == 0ui64)
+					++opptr;
+				else
+				{
+					start[opptr - bcode] = true;
+					opptr += (ptrdiff_t)size;
+				}
+			}
+
+			const auto boundary = [&](const uint8_t* opptr)
+			{
+				return opptr >= bcode && opptr < ecode && start[opptr - bcode];
+			};
+
+			// Stack depth at every op reachable from the code start, call and callback targets,
+			// argument bytes every call site reaching it leaves above its frame and which frames
+			// native code enters reach it, 1 for the code start and 2 for callback targets; ops
+			// reached with different depths are bad
+
+			vector<int64_t> depth(code_size, depth_none);
+			vector<int64_t> args(code_size, args_none);
+			vector<uint8_t> entry(code_size, 0ui8);
+			vector<uint64_t> work;
+
+			const auto reach = [&](const uint8_t* opptr, int64_t d, int64_t a, uint8_t e)
+			{
+				if (opptr == (const uint8_t*)nullptr || opptr >= ecode || d < 0i64)
+					return;
+
+				const uint64_t i = (uint64_t)(opptr - bcode);
+				bool again = false;
+
+				if (depth[i] == depth_none)
+				{
+					depth[i] = d;
+					again = true;
+				}
+				else if (depth[i] != d)
+					depth[i] = depth_bad;
+
+				if (a < args[i])
+				{
+					args[i] = a;
+					again = true;
+				}
+
+				if ((entry[i] | e) != entry[i])
+				{
+					entry[i] |= e;
+					again = true;
+				}
+
+				if (again && depth[i] >= 0i64)
+					work.push_back(i);
+			};
+
+			if (boundary(bcode))
+				reach(bcode, 0i64, args_none, 1ui8);
+			else
+				dynamic = true;
+
+			while (!work.empty())
+			{
+				const uint64_t i = work.back();
+				const uint8_t* opptr = bcode + (ptrdiff_t)i;
+
+				work.pop_back();
+
+				if (depth[i] < 0i64)
+					continue;
+
+				// Op cut off by the code end has no operands to read, the op control flow goes on
+				// to off the op boundaries decodes differently than it is proven
+
+				const uint64_t size = decoded_code::get_size(opptr, ecode);
+
+				if (size == 0ui64)
+				{
+					depth[i] = depth_bad;
+					dynamic = true;
+					continue;
+				}
+
+				const uint8_t* next = opptr + (ptrdiff_t)size;
+				const op op_code = get_base((op)*opptr);
+				const uint8_t* target = get_target(opptr, next, op_code);
+				const uint8_t* after = next_op(next, op_code);
+				const uint8_t* back = callback_target(next, op_code);
+				uint64_t pop, push;
+
+				if (op_code == op::pop_flow || op_code == op::pop_frame || (target != (const uint8_t*)nullptr && !boundary(target))
+					|| (back != (const uint8_t*)nullptr && !boundary(back)) || (after != (const uint8_t*)nullptr && after < ecode && !boundary(after)))
+					dynamic = true;
+				else if (get_effect(opptr, op_code, pop, push))
+				{
+					if (is_call(op_code))
+					{
+						reach(target, 0i64, depth[i], 0ui8);
+						reach(after, depth[i], args[i], entry[i]);
+					}
+					else if (back != (const uint8_t*)nullptr)
+					{
+						int64_t a = (int64_t)inner_size(opptr[3ui64 + (uint64_t)opptr[2]]);
+
+						for (uint64_t j = 0ui64; j < (uint64_t)opptr[2]; ++j)
+							a += (int64_t)inner_size(opptr[3ui64 + j]);
+
+						reach(back, 0i64, a, 2ui8);
+						reach(after, depth[i] - (int64_t)pop + (int64_t)push, args[i], entry[i]);
+					}
+					else if (target != (const uint8_t*)nullptr)
+					{
+						reach(target, depth[i], args[i], entry[i]);
+						reach(after, depth[i], args[i], entry[i]);
+					}
+					else
+						reach(after, depth[i] - (int64_t)pop + (int64_t)push, args[i], entry[i]);
+				}
+			}
+
+			// Ops after a bad or unknown depth run with a depth nothing is proven for, along with
+			// every op control flow goes on to from them
+
+			vector<bool> taint(code_size, false);
+
+			for (uint64_t i = 0ui64; i < code_size; ++i)
+				if (depth[i] != depth_none)
+				{
+					uint64_t pop, push;
+
+					if (depth[i] == depth_bad || !get_effect(bcode + (ptrdiff_t)i, get_base((op)bcode[i]), pop, push))
+					{
+						taint[i] = true;
+						work.push_back(i);
+					}
+				}
+
+			while (!work.empty())
+			{
+				const uint8_t* opptr = bcode + (ptrdiff_t)work.back();
+
+				work.pop_back();
+
+				const uint64_t size = decoded_code::get_size(opptr, ecode);
+
+				if (size == 0ui64)
+				{
+					dynamic = true;
+					continue;
+				}
+
+				const uint8_t* next = opptr + (ptrdiff_t)size;
+				const op op_code = get_base((op)*opptr);
+				const uint8_t* target = get_target(opptr, next, op_code);
+				const uint8_t* after = next_op(next, op_code);
+
+				if (op_code == op::pop_flow || op_code == op::pop_frame || (target != (const uint8_t*)nullptr && !boundary(target))
+					|| (after != (const uint8_t*)nullptr && after < ecode && !boundary(after)))
+					dynamic = true;
+
+				if (target != (const uint8_t*)nullptr && boundary(target) && !taint[target - bcode])
+				{
+					taint[target - bcode] = true;
+					work.push_back((uint64_t)(target - bcode));
+				}
+
+				if (after != (const uint8_t*)nullptr && after < ecode && !taint[after - bcode])
+				{
+					taint[after - bcode] = true;
+					work.push_back((uint64_t)(after - bcode));
+				}
+			}
+
+			// Proven ops pop what their depth holds, read frame slots under their depth or inside
+			// the arguments of their call sites, do not run off the code end and do not return
+			// from the code start frame; arguments it reads are checked once the code runs
+
+			_safe = (uint8_t*)new uint8_t[code_size];
+			memset(_safe, 0ui8, (uint64_t)sizeof(uint8_t) * code_size);
+
+			_frame = (uint64_t*)new uint64_t[code_size];
+			memset(_frame, 0ui8, (uint64_t)sizeof(uint64_t) * code_size);
+
+			_whole = !dynamic;
+
+			for (uint64_t i = 0ui64; i < code_size; ++i)
+				if (depth[i] != depth_none)
+				{
+					const uint8_t* opptr = bcode + (ptrdiff_t)i;
+					const uint8_t* next = opptr + (ptrdiff_t)decoded_code::get_size(opptr, ecode);
+					const op op_code = get_base((op)*opptr);
+					const uint8_t* after = next_op(next, op_code);
+					const int64_t d = depth[i];
+					uint64_t pop, push;
+					ptrdiff_t offset;
+					uint64_t size;
+
+					bool good = d >= 0i64 && !taint[i] && get_effect(opptr, op_code, pop, push) && (uint64_t)d >= pop
+						&& (after == (const uint8_t*)nullptr || after < ecode) && (op_code != op::ret || entry[i] == 0ui8);
+
+					if (good && get_slot(opptr, op_code, offset, size))
+					{
+						if (offset >= (ptrdiff_t)0)
+						{
+							good = (int64_t)offset + (int64_t)size <= args[i];
+
+							if ((entry[i] & 1ui8) != 0ui8 && _args < (uint64_t)offset + size)
+								_args = (uint64_t)offset + size;
+						}
+						else
+							good = (int64_t)(~offset) + (int64_t)size <= d - (int64_t)pop;
+					}
+
+					// Frames native code enters through callback take stack no chain of calls from
+					// the code start accounts for
+
+					_safe[i] = good && !dynamic && !is_call(op_code) ? 1ui8 : 0ui8;
+					_whole = _whole && good && op_code != op::callback;
+				}
+
+			// Fused and generated ops are proven when every op of their sequence is
+
+			for (uint64_t i = 0ui64; i < code_size; ++i)
+				if (_safe[i] != 0ui8)
+				{
+					const uint64_t length = sequence_length((op)bcode[i]);
+					const uint8_t* opptr = bcode + (ptrdiff_t)i;
+
+					for (uint64_t j = 1ui64; j < length && _safe[i] != 0ui8; ++j)
+					{
+						opptr += (ptrdiff_t)decoded_code::get_size(opptr, ecode);
+
+						if (opptr >= ecode || _safe[opptr - bcode] == 0ui8)
+							_safe[i] = 0ui8;
+					}
+				}
+
+			// Frames are entered at the code start, call and callback targets, each takes the most
+			// bytes any op reachable in it takes; code proven whole needs no more than the deepest
+			// chain of calls from the code start, which does not exist for recursive calls
+
+			vector<uint64_t> funcs;
+			vector<uint64_t> stamp(code_size, ~0ui64);
+			vector<uint64_t> calls;
+
+			if (code_size != 0ui64 && depth[0] == 0i64)
+				funcs.push_back(0ui64);
+
+			for (uint64_t i = 0ui64; i < code_size; ++i)
+				if (depth[i] >= 0i64 && (is_call(get_base((op)bcode[i])) || get_base((op)bcode[i]) == op::callback))
+				{
+					const uint8_t* opptr = bcode + (ptrdiff_t)i;
+					const uint8_t* next = opptr + (ptrdiff_t)decoded_code::get_size(opptr, ecode);
+					const op op_code = get_base((op)*opptr);
+					const uint8_t* target = op_code == op::callback ? callback_target(next, op_code) : get_target(opptr, next, op_code);
+
+					if (boundary(target) && depth[target - bcode] == 0i64 && target != bcode)
+						funcs.push_back((uint64_t)(target - bcode));
+				}
+
+			vector<uint64_t> fidx(code_size, ~0ui64);
+
+			for (uint64_t f = 0ui64; f < (uint64_t)funcs.size(); ++f)
+				fidx[funcs[f]] = f;
+
+			vector<uint64_t> need(funcs.size(), 0ui64);
+
+			for (uint64_t f = 0ui64; f < (uint64_t)funcs.size(); ++f)
+			{
+				uint64_t frame = 0ui64;
+
+				work.push_back(funcs[f]);
+				stamp[funcs[f]] = f;
+
+				while (!work.empty())
+				{
+					const uint64_t i = work.back();
+					const uint8_t* opptr = bcode + (ptrdiff_t)i;
+
+					work.pop_back();
+
+					const uint8_t* next = opptr + (ptrdiff_t)decoded_code::get_size(opptr, ecode);
+					const op op_code = get_base((op)*opptr);
+					const uint8_t* target = get_target(opptr, next, op_code);
+					const uint8_t* after = next_op(next, op_code);
+					const uint64_t d = (uint64_t)depth[i];
+					uint64_t pop, push;
+
+					get_effect(opptr, op_code, pop, push);
+
+					if (d < pop)
+						continue;
+
+					if (frame < d)
+						frame = d;
+
+					if (frame < d - pop + push)
+						frame = d - pop + push;
+
+					if (is_call(op_code))
+					{
+						if (boundary(target) && fidx[target - bcode] != ~0ui64)
+						{
+							calls.push_back(f);
+							calls.push_back(d);
+							calls.push_back(fidx[target - bcode]);
+						}
+
+						target = (const uint8_t*)nullptr;
+					}
+
+					for (const uint8_t* succ : { target, after })
+						if (boundary(succ) && depth[succ - bcode] >= 0i64 && stamp[succ - bcode] != f)
+						{
+							stamp[succ - bcode] = f;
+							work.push_back((uint64_t)(succ - bcode));
+						}
+				}
+
+				_frame[funcs[f]] = frame;
+				need[f] = frame;
+			}
+
+			bool relaxed = true;
+
+			for (uint64_t n = 0ui64; n <= (uint64_t)funcs.size() && relaxed; ++n)
+			{
+				relaxed = false;
+
+				for (uint64_t c = 0ui64; c < (uint64_t)calls.size(); c += 3ui64)
+				{
+					const uint64_t chain = calls[c + 1ui64] + (uint64_t)sizeof(uint64_t) * 2ui64 + need[calls[c + 2ui64]];
+
+					if (need[calls[c]] < chain)
+					{
+						need[calls[c]] = chain;
+						relaxed = true;
+					}
+				}
+			}
+
+			_whole = _whole && !relaxed && !funcs.empty() && funcs[0] == 0ui64;
+
+			if (!funcs.empty() && funcs[0] == 0ui64)
+				_stack = _whole ? need[0] : _frame[0];
+		}
+		catch (const exception& e)
+		{
+			__del_obj();
+			__def_obj();
+
+			throw e;
+		}
+	}
+}
+
+verified_code::verified_code(verified_code&& o) noexcept
+{
+	__mov_obj(move(o));
+	o.__def_obj();
+}
+
+verified_code::~verified_code() noexcept
+{
+	__del_obj();
+	__def_obj();
+}
+
+verified_code& verified_code::operator=(verified_code&& o) noexcept
+{
+	if (this != &o)
+	{
+		__del_obj();
+		__mov_obj(move(o));
+		o.__def_obj();
+	}
+
+	return *this;
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "decode.hpp"
+#include "define.hpp"
+#include "interpreter_type.hpp"
+#include "op.hpp"
+
+namespace interpreter
+{
+	// verified_code - ops proven once before the code runs, a proven op decodes inside the code,
+	//                 branches to op boundaries only, is reached with one stack depth by every
+	//                 path and keeps its pops and frame slots inside its frame; code proven whole
+	//                 runs without checks, any other code checks its unproven ops and its calls
+
+	class verified_code
+	{
+	private:
+		static constexpr const char _err_msg_large_code[] = "Code size is too large";
+
+		const uint8_t* _code_beg;
+		const uint8_t* _code_end;
+
+		// Safe marks proven ops but calls, frame maps the code start and call targets to the
+		// most bytes the frame entered there takes, args is what the code start reads above it
+
+		uint8_t* _safe;
+		uint64_t* _frame;
+		uint64_t _args;
+		uint64_t _stack;
+		bool _whole;
+
+		inline void __def_obj() noexcept;
+		inline void __del_obj() noexcept;
+		inline void __mov_obj(verified_code&& o) noexcept;
+
+	public:
+		// Bytes op takes from and puts on the stack, false if the depth after op does not follow
+		// from the depth before
+
+		static bool get_effect(const uint8_t* opptr, op op_code, uint64_t& pop, uint64_t& push) noexcept;
+
+		// Frame slot offset and size of load and store ops, false for every other op
+
+		static bool get_slot(const uint8_t* opptr, op op_code, ptrdiff_t& offset, uint64_t& size) noexcept;
+
+		// Branch target of call and jump ops, null for every other op
+
+		static const uint8_t* get_target(const uint8_t* opptr, const uint8_t* next, op op_code) noexcept;
+
+		// Fused ops begin with s_load_64 and keep the rest of their ops in place, generated ops
+		// are their first op the same way
+
+		static inline op get_base(op op_code) noexcept
+		{
+			if ((uint8_t)op_code >= (uint8_t)op::s_ucmp_jmp_64 && (uint8_t)op_code <= (uint8_t)op::s_move_64)
+				return op::s_load_64;
+			else
+				return decoded_code::get_base(op_code);
+		}
+
+		verified_code() noexcept;
+		verified_code(const uint8_t* bcode, const uint8_t* ecode);
+		verified_code(const verified_code& o) = delete;
+		verified_code(verified_code&& o) noexcept;
+		~verified_code() noexcept;
+
+		inline bool empty() const noexcept
+		{
+			return _safe == (uint8_t*)nullptr;
+		}
+
+		inline bool is_whole() const noexcept
+		{
+			return _whole;
+		}
+
+		inline const uint8_t* get_code_beg() const noexcept
+		{
+			return _code_beg;
+		}
+
+		inline const uint8_t* get_code_end() const noexcept
+		{
+			return _code_end;
+		}
+
+		inline uint64_t get_args() const noexcept
+		{
+			return _args;
+		}
+
+		// Most bytes the whole run takes for code proven whole, the ones of the code start frame
+		// for any other code
+
+		inline uint64_t get_stack() const noexcept
+		{
+			return _stack;
+		}
+
+		inline bool is_safe(const uint8_t* opptr) const noexcept
+		{
+			return opptr >= _code_beg && opptr < _code_end && _safe[opptr - _code_beg] != 0ui8;
+		}
+
+		inline uint64_t get_frame(const uint8_t* opptr) const noexcept
+		{
+			return opptr >= _code_beg && opptr < _code_end ? _frame[opptr - _code_beg] : 0ui64;
+		}
+
+		verified_code& operator=(const verified_code& o) = delete;
+		verified_code& operator=(verified_code&& o) noexcept;
+	};
+}